@@ -0,0 +1,157 @@
+/**
+ * Micro benchmarks for the IR analyses on functions with thousands of blocks.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/ir/DataFlow.h>
+#include <cmm/ir/Dominators.h>
+#include <cmm/ir/Function.h>
+#include <cmm/ir/IRBuilder.h>
+#include <cmm/ir/LoopInfo.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace cmm;
+
+// The number of facts of the dataflow benchmark, independent of the function size.
+static constexpr std::size_t FACT_COUNT = 256;
+
+/**
+ * Builds a function made of 'segments' loops run one after another, each loop holding an if/else,
+ * so every segment adds four blocks, a back edge and a join.
+ *
+ * @param module the ir::Module to add the function to.
+ * @param segments the number of loops.
+ * @return pointer to the ir::Function.
+ */
+static ir::Function* buildFunction(ir::Module& module, const std::size_t segments)
+{
+    auto& types = module.getTypes();
+    auto* function = module.getOrInsertFunction("f" + std::to_string(segments), types.getFunction(types.getVoid(), { types.getBool() }));
+    auto* cond = function->getArg(0);
+    ir::IRBuilder builder(module);
+
+    auto* block = function->createBlock("entry");
+
+    for (std::size_t i = 0; i < segments; ++i)
+    {
+        auto* header = function->createBlock("header");
+        auto* left = function->createBlock("left");
+        auto* right = function->createBlock("right");
+        auto* latch = function->createBlock("latch");
+
+        builder.setInsertPoint(block);
+        builder.createBr(header);
+
+        builder.setInsertPoint(header);
+        builder.createCondBr(cond, left, right);
+
+        builder.setInsertPoint(left);
+        builder.createBr(latch);
+
+        builder.setInsertPoint(right);
+        builder.createBr(latch);
+
+        block = function->createBlock("exit");
+        builder.setInsertPoint(latch);
+        builder.createCondBr(cond, header, block);
+    }
+
+    builder.setInsertPoint(block);
+    builder.createRetVoid();
+
+    return function;
+}
+
+/**
+ * Runs the function 'iterations' times and prints the average time per run and per block.
+ *
+ * @param name the name of the benchmark.
+ * @param blocks the number of blocks of the function.
+ * @param iterations the number of times to run.
+ * @param func the function to benchmark.
+ */
+static void runBenchmark(const std::string& name, const std::size_t blocks, const std::size_t iterations, const std::function<void()>& func)
+{
+    // Warm-up
+    func();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        func();
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    const auto totalMicros = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    const f64 micros = static_cast<f64>(totalMicros) / static_cast<f64>(iterations);
+
+    std::cout << std::left << std::setw(40) << name << std::right << std::setw(12) << micros << " us/iter"
+              << std::setw(12) << (micros * 1000.0 / static_cast<f64>(blocks)) << " ns/block\n";
+}
+
+// Prevents the results from being optimized away.
+static volatile std::size_t sink = 0;
+
+static void benchAnalyses()
+{
+    for (const std::size_t segments : { 256, 1024, 4096 })
+    {
+        ir::Module module;
+        auto* function = buildFunction(module, segments);
+        const std::size_t blocks = function->size();
+        const std::size_t iterations = 4096 / segments + 1;
+        const std::string suffix = " (" + std::to_string(blocks) + " blocks)";
+
+        runBenchmark("dominator tree" + suffix, blocks, iterations, [&]()
+        {
+            const ir::DominatorTree dominators(*function);
+            sink = dominators.getReversePostOrder().size();
+        });
+
+        runBenchmark("loop info" + suffix, blocks, iterations, [&]()
+        {
+            const ir::DominatorTree dominators(*function);
+            const ir::LoopInfo loops(dominators);
+            sink = loops.getTopLevelLoops().size();
+        });
+
+        for (const auto direction : { ir::EnumDataFlowDirection::FORWARD, ir::EnumDataFlowDirection::BACKWARD })
+        {
+            const bool forward = direction == ir::EnumDataFlowDirection::FORWARD;
+
+            runBenchmark(std::string(forward ? "forward" : "backward") + " dataflow" + suffix, blocks, iterations, [&]()
+            {
+                ir::DataFlowSolver solver(*function, FACT_COUNT, direction, ir::EnumDataFlowMeet::UNION);
+                std::size_t index = 0;
+
+                for (const auto& block : *function)
+                {
+                    solver.getGen(block.get()).set(index % FACT_COUNT);
+                    solver.getKill(block.get()).set((index + 7) % FACT_COUNT);
+                    ++index;
+                }
+
+                sink = solver.solve();
+            });
+        }
+    }
+}
+
+s32 main(s32 argc, char* argv[])
+{
+    benchAnalyses();
+
+    return 0;
+}
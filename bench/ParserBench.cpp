@@ -0,0 +1,223 @@
+/**
+ * Micro benchmarks for the parser.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/NodeList.h>
+#include <cmm/Keyword.h>
+#include <cmm/Parser.h>
+#include <cmm/ParserDispatchTable.h>
+#include <cmm/ParserPredictor.h>
+#include <cmm/Reporter.h>
+#include <cmm/Token.h>
+
+// std includes
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace cmm;
+
+/**
+ * Builds a single expression statement of 'terms' variables joined by the given operators in a round robin.
+ *
+ * @param terms the number of operands in the chain.
+ * @param ops the binary operators to cycle through.
+ * @return std::string source.
+ */
+static std::string buildChain(const std::size_t terms, const std::vector<std::string>& ops)
+{
+    std::ostringstream os;
+    os << "x0";
+
+    for (std::size_t i = 1; i < terms; ++i)
+    {
+        os << ' ' << ops[i % ops.size()] << " x" << i;
+    }
+
+    os << ';';
+    return os.str();
+}
+
+/**
+ * Runs the function 'iterations' times and prints the average time per run.
+ *
+ * @param name the name of the benchmark.
+ * @param iterations the number of times to run.
+ * @param func the function to benchmark.
+ */
+static void runBenchmark(const std::string& name, const std::size_t iterations, const std::function<void()>& func)
+{
+    // Warm-up
+    func();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        func();
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    const auto totalMicros = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << std::left << std::setw(40) << name << std::right << std::setw(12)
+              << (static_cast<f64>(totalMicros) / static_cast<f64>(iterations)) << " us/iter\n";
+}
+
+/**
+ * Parses the source and aborts if it fails.
+ *
+ * @param source the source to parse.
+ */
+static void parseOrAbort(const std::string& source)
+{
+    Parser parser(source);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    if (compUnitPtr == nullptr || !errorMessage.empty())
+    {
+        std::cerr << "Parse failed: " << errorMessage << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+static void benchExpressionChains()
+{
+    const std::vector<std::string> additive = { "+", "-" };
+    const std::vector<std::string> mixed = { "+", "*", "-", "/", "%", "<<", "&", "|", "^", "<", "==", "&&", "||" };
+
+    for (const std::size_t terms : { 100, 1000, 5000 })
+    {
+        const auto additiveSource = buildChain(terms, additive);
+        const auto mixedSource = buildChain(terms, mixed);
+        const std::size_t iterations = 100000 / terms;
+
+        runBenchmark("additive chain (" + std::to_string(terms) + " terms)", iterations, [&]() { parseOrAbort(additiveSource); });
+        runBenchmark("mixed precedence chain (" + std::to_string(terms) + " terms)", iterations, [&]() { parseOrAbort(mixedSource); });
+    }
+}
+
+// Stand-ins for parse functions so only the cost of the dispatch itself is measured.
+static s32 dispatchReturn(s32 value) { return value + 1; }
+static s32 dispatchIf(s32 value) { return value + 2; }
+static s32 dispatchBlock(s32 value) { return value + 3; }
+static s32 dispatchDeclaration(s32 value) { return value + 4; }
+
+// Prevents the dispatch loops from being optimized away.
+static volatile s32 dispatchSink = 0;
+
+static void benchFirstTokenDispatch()
+{
+    using DispatchFunc = s32 (*)(s32);
+
+    // Mirrors the statement dispatch in the parser.
+    ParserPredictor<s32(s32)> predictor;
+    auto token = Token('\0', false);
+    token.setStringSymbol("return");
+    predictor.registerFunction(token, dispatchReturn);
+    token.setStringSymbol("if");
+    predictor.registerFunction(token, dispatchIf);
+    token.setCharSymbol(CHAR_LCURLY_BRACKET);
+    predictor.registerFunction(token, dispatchBlock);
+
+    Keyword::registerPrimitiveKeywordsByName([&](const std::string& keywordName)
+            {
+                token.setStringSymbol(keywordName);
+                predictor.registerFunction(token, dispatchDeclaration);
+            });
+
+    static CMM_CONSTEXPR auto dispatchTable = []()
+    {
+        ParserDispatchTable<DispatchFunc> table;
+        table.registerFunction(EnumKeyword::RETURN, dispatchReturn);
+        table.registerFunction(EnumKeyword::IF, dispatchIf);
+        table.registerFunction(CHAR_LCURLY_BRACKET, dispatchBlock);
+
+        for (std::size_t i = 0; i < keywordInfoTable.size(); ++i)
+        {
+            if (keywordInfoTable[i].isAType)
+            {
+                table.registerFunction(static_cast<EnumKeyword>(i), dispatchDeclaration);
+            }
+        }
+
+        return table;
+    }();
+
+    // A typical mix of statement leading tokens (including misses that fall through to expressions).
+    std::vector<Token> tokens;
+    const char* symbols[] = { "int", "x", "return", "if", "double", "y", "while", "struct" };
+
+    for (const char* symbol : symbols)
+    {
+        tokens.emplace_back('\0', false);
+        tokens.back().setStringSymbol(symbol);
+    }
+
+    tokens.emplace_back(CHAR_LCURLY_BRACKET, true);
+    tokens.emplace_back(CHAR_LPAREN, true);
+    tokens.emplace_back(true);
+
+    const std::size_t rounds = 100000;
+
+    runBenchmark("ParserPredictor dispatch", 10, [&]()
+    {
+        s32 sum = 0;
+
+        for (std::size_t i = 0; i < rounds; ++i)
+        {
+            for (const auto& current : tokens)
+            {
+                auto context = predictor.predict(current);
+
+                if (context.has_value())
+                {
+                    sum = predictor.call<s32>(*context, sum);
+                }
+            }
+        }
+
+        dispatchSink = sum;
+    });
+
+    runBenchmark("ParserDispatchTable dispatch", 10, [&]()
+    {
+        s32 sum = 0;
+
+        for (std::size_t i = 0; i < rounds; ++i)
+        {
+            for (const auto& current : tokens)
+            {
+                const auto func = dispatchTable.dispatch(current);
+
+                if (func != nullptr)
+                {
+                    sum = func(sum);
+                }
+            }
+        }
+
+        dispatchSink = sum;
+    });
+}
+
+s32 main(s32 argc, char* argv[])
+{
+    Reporter::instance().setEnablePrint(false);
+
+    benchExpressionChains();
+    benchFirstTokenDispatch();
+
+    return 0;
+}
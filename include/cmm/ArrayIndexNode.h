@@ -0,0 +1,121 @@
+/**
+ * An AST node for representing an array subscript (ex. 'a[i]').
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_ARRAY_INDEX_NODE_H
+#define CMM_ARRAY_INDEX_NODE_H
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/ExpressionNode.h>
+
+// std includes
+#include <memory>
+#include <string>
+
+namespace cmm
+{
+    class ArrayIndexNode : public ExpressionNode
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param location the Location of this node.
+         * @param expression the ExpressionNode (array or pointer) being subscripted.
+         * @param index the index ExpressionNode.
+         */
+        ArrayIndexNode(const Location& location, std::unique_ptr<ExpressionNode>&& expression,
+            std::unique_ptr<ExpressionNode>&& index) CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        ArrayIndexNode(const ArrayIndexNode&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        ArrayIndexNode(ArrayIndexNode&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Destructor
+         */
+        ~ArrayIndexNode() = default;
+
+        /**
+         * Copy assignment operator.
+         *
+         * @return ArrayIndexNode reference.
+         */
+        ArrayIndexNode& operator= (const ArrayIndexNode&) = delete;
+
+        /**
+         * Move assignment operator.
+         *
+         * @return ArrayIndexNode reference.
+         */
+        ArrayIndexNode& operator= (ArrayIndexNode&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Gets the ExpressionNode being subscripted.
+         *
+         * @return pointer to ExpressionNode.
+         */
+        ExpressionNode* getExpression() CMM_NOEXCEPT;
+
+        /**
+         * Gets the ExpressionNode being subscripted.
+         *
+         * @return const pointer to ExpressionNode.
+         */
+        const ExpressionNode* getExpression() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the index ExpressionNode.
+         *
+         * @return pointer to ExpressionNode.
+         */
+        ExpressionNode* getIndex() CMM_NOEXCEPT;
+
+        /**
+         * Gets the index ExpressionNode.
+         *
+         * @return const pointer to ExpressionNode.
+         */
+        const ExpressionNode* getIndex() const CMM_NOEXCEPT;
+
+        /**
+         * Replaces the index with a new expression.
+         *
+         * @param index the new ExpressionNode.
+         */
+        void setIndex(std::unique_ptr<ExpressionNode>&& index) CMM_NOEXCEPT;
+
+        /**
+         * Adds a DerefNode to the index expression.
+         * Note: This assumes the caller has already performed checks.
+         */
+        void derefIndex();
+
+        VisitorResult accept(Visitor* visitor) override;
+        std::string toString() const override;
+
+    private:
+
+        // The array or pointer being subscripted.
+        std::unique_ptr<ExpressionNode> expression;
+
+        // The subscript.
+        std::unique_ptr<ExpressionNode> index;
+    };
+}
+
+#endif //!CMM_ARRAY_INDEX_NODE_H
+
@@ -16,6 +16,7 @@
 
 // std includes
 #include <optional>
+#include <vector>
 
 namespace cmm
 {
@@ -48,9 +49,10 @@ namespace cmm
         BinOpNode(BinOpNode&&) CMM_NOEXCEPT = default;
 
         /**
-         * Destructor
+         * Destructor.  Nested BinOpNodes are torn down with an explicit stack
+         * rather than recursively.
          */
-        ~BinOpNode() = default;
+        ~BinOpNode();
 
         /**
          * Copy assignment operator.
@@ -80,6 +82,13 @@ namespace cmm
          */
         bool isComparisonOp() const CMM_NOEXCEPT;
 
+        /**
+         * Gets whether the EnumBinOpNodeType is a logical (short-circuit) operation or not.
+         *
+         * @return bool.
+         */
+        bool isLogicalOp() const CMM_NOEXCEPT;
+
         /**
          * Gets the left node.
          *
@@ -108,6 +117,15 @@ namespace cmm
          */
         const ExpressionNode* getRight() const CMM_NOEXCEPT;
 
+        /**
+         * Collects this node followed by every BinOpNode directly down the left operands
+         * (i.e. '((a + b) + c) + d' yields the outer, middle and inner '+').  This lets visitors
+         * walk long left associative chains without recursing once per operator.
+         *
+         * @param spine the vector to append the nodes to (outermost first).
+         */
+        void collectLeftSpine(std::vector<BinOpNode*>& spine);
+
         /**
          * Attempts to cast the left ExpressionNode.
          *
@@ -150,6 +168,14 @@ namespace cmm
          */
         void popDerefNodeRight();
 
+        /**
+         * Gets whether an explicit DerefNode was popped off of the left node (i.e. an assignment
+         * through a pointer such as '*x = y'), meaning the left node now yields the address to store to.
+         *
+         * @return bool.
+         */
+        bool isLeftDerefPopped() const CMM_NOEXCEPT;
+
         /**
          * Replaces the left ExpressionNode with a new expression.
          *
@@ -175,6 +201,9 @@ namespace cmm
         // The operands
         std::unique_ptr<ExpressionNode> left;
         std::unique_ptr<ExpressionNode> right;
+
+        // Whether popDerefNodeLeft was applied.
+        bool leftDerefPopped;
     };
 }
 
@@ -17,6 +17,7 @@
 
 // std includes
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace cmm
@@ -52,9 +53,9 @@ namespace cmm
         BlockNode(BlockNode&&) CMM_NOEXCEPT = default;
 
         /**
-         * Default destructor
+         * Destructor.  Directly nested BlockNodes are destroyed iteratively.
          */
-        ~BlockNode() = default;
+        ~BlockNode();
 
         /**
          * Copy assignment operator.
@@ -137,6 +138,49 @@ namespace cmm
          */
         const StatementListConstIter cend() const CMM_NOEXCEPT;
 
+        /**
+         * Walks this block's statements in order, descending into directly nested BlockNodes
+         * (i.e. '{ { { ... } } }') with an explicit stack rather than recursing once per level.
+         *
+         * @param enterBlock called with each BlockNode (this one included) before its statements.
+         * @param visitStatement called with each statement that is not a BlockNode.
+         * @param exitBlock called with each BlockNode after its statements.
+         */
+        template<class EnterFunc, class StatementFunc, class ExitFunc>
+        void walkNestedBlocks(EnterFunc enterBlock, StatementFunc visitStatement, ExitFunc exitBlock)
+        {
+            std::vector<std::pair<BlockNode*, StatementListIter>> stack;
+            enterBlock(*this);
+            stack.emplace_back(this, statements.begin());
+
+            while (!stack.empty())
+            {
+                auto* block = stack.back().first;
+                auto& iter = stack.back().second;
+
+                if (iter == block->statements.end())
+                {
+                    stack.pop_back();
+                    exitBlock(*block);
+                    continue;
+                }
+
+                auto& statementPtr = *iter++;
+
+                if (statementPtr->getType() == EnumNodeType::BLOCK)
+                {
+                    auto* nestedBlock = static_cast<BlockNode*>(statementPtr.get());
+                    enterBlock(*nestedBlock);
+                    stack.emplace_back(nestedBlock, nestedBlock->statements.begin());
+                }
+
+                else
+                {
+                    visitStatement(*statementPtr);
+                }
+            }
+        }
+
         VisitorResult accept(Visitor* visitor) override;
         std::string toString() const override;
 
@@ -0,0 +1,68 @@
+/**
+ * An AST node for representing a break statement.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_BREAK_STATEMENT_NODE_H
+#define CMM_BREAK_STATEMENT_NODE_H
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/StatementNode.h>
+
+// std includes
+#include <string>
+
+namespace cmm
+{
+    class BreakStatementNode : public StatementNode
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param location the location of this node.
+         */
+        explicit BreakStatementNode(const Location& location) CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        BreakStatementNode(const BreakStatementNode&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        BreakStatementNode(BreakStatementNode&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Destructor
+         */
+        ~BreakStatementNode() = default;
+
+        /**
+         * Copy assignment operator.
+         *
+         * @return BreakStatementNode reference.
+         */
+        BreakStatementNode& operator= (const BreakStatementNode&) = delete;
+
+        /**
+         * Move assignment operator.
+         *
+         * @return BreakStatementNode reference.
+         */
+        BreakStatementNode& operator= (BreakStatementNode&&) CMM_NOEXCEPT = default;
+
+        VisitorResult accept(Visitor* visitor) override;
+        std::string toString() const override;
+    };
+}
+
+#endif //!CMM_BREAK_STATEMENT_NODE_H
+
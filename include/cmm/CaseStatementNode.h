@@ -0,0 +1,163 @@
+/**
+ * An AST node for representing a 'case' (or 'default') label of a switch statement along
+ * with the statements following it, up to the next label.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_CASE_STATEMENT_NODE_H
+#define CMM_CASE_STATEMENT_NODE_H
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/StatementNode.h>
+
+// std includes
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cmm
+{
+    // Forward declarations:
+    class ExpressionNode;
+
+    class CaseStatementNode : public StatementNode
+    {
+    public:
+
+        using StatementList = std::vector<std::unique_ptr<StatementNode>>;
+        using StatementListIter = StatementList::iterator;
+        using StatementListConstIter = StatementList::const_iterator;
+
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param location the location of this node.
+         * @param expression the case's ExpressionNode, nullptr for the 'default' label.
+         * @param statements the StatementList following the label.
+         */
+        CaseStatementNode(const Location& location, std::unique_ptr<ExpressionNode>&& expression, StatementList&& statements) CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        CaseStatementNode(const CaseStatementNode&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        CaseStatementNode(CaseStatementNode&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Destructor
+         */
+        ~CaseStatementNode() = default;
+
+        /**
+         * Copy assignment operator.
+         *
+         * @return CaseStatementNode reference.
+         */
+        CaseStatementNode& operator= (const CaseStatementNode&) = delete;
+
+        /**
+         * Move assignment operator.
+         *
+         * @return CaseStatementNode reference.
+         */
+        CaseStatementNode& operator= (CaseStatementNode&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Gets whether this is the 'default' label.
+         *
+         * @return bool.
+         */
+        bool isDefault() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the ExpressionNode of the case.
+         *
+         * @return pointer to ExpressionNode, nullptr for the 'default' label.
+         */
+        ExpressionNode* getExpression() CMM_NOEXCEPT;
+
+        /**
+         * Gets the ExpressionNode of the case.
+         *
+         * @return const pointer to ExpressionNode, nullptr for the 'default' label.
+         */
+        const ExpressionNode* getExpression() const CMM_NOEXCEPT;
+
+        /**
+         * Replaces the case's expression with a new expression.
+         *
+         * @param expression the new ExpressionNode.
+         */
+        void setExpression(std::unique_ptr<ExpressionNode>&& expression) CMM_NOEXCEPT;
+
+        /**
+         * Gets the constant value of the case, as evaluated by the Analyzer.
+         *
+         * @return optional s64, std::nullopt if not (yet) known.
+         */
+        std::optional<s64> getValue() const CMM_NOEXCEPT;
+
+        /**
+         * Sets the constant value of the case.
+         *
+         * @param value the s64 value.
+         */
+        void setValue(const s64 value) CMM_NOEXCEPT;
+
+        /**
+         * Gets whether there are no statements following the label.
+         *
+         * @return bool.
+         */
+        bool empty() const CMM_NOEXCEPT;
+
+        /**
+         * Iterator to the beginning of the statement list.
+         */
+        StatementListIter begin() CMM_NOEXCEPT;
+
+        /**
+         * Const iterator to the beginning of the statement list.
+         */
+        StatementListConstIter cbegin() const CMM_NOEXCEPT;
+
+        /**
+         * Iterator to the end of the statement list.
+         */
+        StatementListIter end() CMM_NOEXCEPT;
+
+        /**
+         * Const iterator to the end of the statement list.
+         */
+        StatementListConstIter cend() const CMM_NOEXCEPT;
+
+        VisitorResult accept(Visitor* visitor) override;
+        std::string toString() const override;
+
+    private:
+
+        // The case's expression, nullptr for 'default'.
+        std::unique_ptr<ExpressionNode> expression;
+
+        // The value of the case's expression.
+        std::optional<s64> value;
+
+        // The statements following the label.
+        StatementList statements;
+    };
+}
+
+#endif //!CMM_CASE_STATEMENT_NODE_H
+
@@ -99,6 +99,13 @@ namespace cmm
          */
         EnumNodeType getRootType() const CMM_NOEXCEPT;
 
+        /**
+         * Gets whether this is an explicit deref (i.e. '*x') vs a standard read from variable's memory.
+         *
+         * @return bool.
+         */
+        bool isExplicit() const CMM_NOEXCEPT;
+
         /**
          * Resolves the actual datatype if the DerefNode is explicit (see alt constructor).
          */
@@ -24,11 +24,11 @@ namespace cmm
 {
     enum class EnumNodeType
     {
-        UNKNOWN = 0, ADDRESS_OF, ARG, CAST, COMPILATION_UNIT, BIN_OP, BLOCK, DEREF,
+        UNKNOWN = 0, ADDRESS_OF, ARG, ARRAY_INDEX, CAST, COMPILATION_UNIT, BIN_OP, BLOCK, BREAK_STATEMENT, CASE_STATEMENT, DEREF,
         ENUM_DEFINITION, ENUM_USAGE,
         FIELD_ACCESS, FUNCTION_CALL, FUNCTION_DECLARATION_STATEMENT, FUNCTION_DEFINITION_STATEMENT,
         EXPRESSION_STATEMENT, EXPRESSION, IF_ELSE_STATEMENT, PARAMETER, PAREN_EXPRESSION,
-        LITTERAL, RETURN_STATEMENT, STRUCT_DEFINITION, STRUCT_FWD_DECLARATION, TRANSLATION_UNIT, UNARY_OP,
+        LITTERAL, RETURN_STATEMENT, STRUCT_DEFINITION, STRUCT_FWD_DECLARATION, SWITCH_STATEMENT, TRANSLATION_UNIT, UNARY_OP,
         VARIABLE, VARIABLE_DECLARATION_STATEMENT,
         WHILE_STATEMENT
     };
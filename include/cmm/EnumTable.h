@@ -134,6 +134,18 @@ namespace cmm
          */
         EnumData* addOrUpdate(std::string&& name, EnumData&& data, std::string* reason = nullptr);
 
+        /**
+         * Moves every enum from another table into this table.  The EnumData
+         * entries keep their addresses, so EnumDefinitionStatementNodes pointing
+         * into the other table remain valid.  Nothing is moved if any enum or
+         * enumerator name would be redefined.
+         *
+         * @param other the EnumTable to merge from.
+         * @param reason optional std::string pointer to write an error message if unsuccessfull.
+         * @return bool true if merged successfully, else false.
+         */
+        bool merge(EnumTable&& other, std::string* reason = nullptr);
+
         /**
          * Gets the EnumData if enum is in the table by name.
          *
@@ -91,6 +91,13 @@ namespace cmm
          */
         const ExpressionNode* getIfConditional() const CMM_NOEXCEPT;
 
+        /**
+         * Replaces the if conditional with a new expression.
+         *
+         * @param expression the new ExpressionNode.
+         */
+        void setIfConditional(std::unique_ptr<ExpressionNode>&& expression) CMM_NOEXCEPT;
+
         /**
          * Wraps the if conditional in a comparison (BinOpNode) operator.
          * Note: This assumes the caller has already performed sufficient
@@ -14,12 +14,94 @@
 #include <cmm/Types.h>
 
 // std includes
+#include <array>
 #include <map>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 
 namespace cmm
 {
+    /**
+     * Dense ids for every supported keyword (i.e. for table driven dispatch).
+     */
+    enum class EnumKeyword : u8
+    {
+        BREAK = 0, CASE, CHAR, DEFAULT, DOUBLE, ELSE, ENUM, FLOAT, IF, INT, LONG, RETURN, SHORT, SIGNED, STRUCT, SWITCH, UNSIGNED, VOID,
+        WHILE, COUNT
+    };
+
+    struct KeywordInfo
+    {
+        // The keyword as it appears in source.
+        std::string_view name;
+
+        // Whether the keyword starts a type.
+        bool isAType;
+    };
+
+    // Indexed by EnumKeyword.  The Keyword instances below are built from this table.
+    CMM_CONSTEXPR std::array<KeywordInfo, static_cast<std::size_t>(EnumKeyword::COUNT)> keywordInfoTable = {{
+        { "break", false }, { "case", false }, { "char", true }, { "default", false }, { "double", true },
+        { "else", false }, { "enum", true }, { "float", true }, { "if", false }, { "int", true },
+        { "long", true }, { "return", false }, { "short", true }, { "signed", true }, { "struct", true },
+        { "switch", false }, { "unsigned", true }, { "void", true }, { "while", false }
+    }};
+
+    /**
+     * Looks up the EnumKeyword of a string without any allocation.
+     *
+     * @param name the name to check.
+     * @return optional EnumKeyword if the name is a keyword, else std::nullopt.
+     */
+    CMM_CONSTEXPR_FUNC std::optional<EnumKeyword> findEnumKeyword(const std::string_view name) CMM_NOEXCEPT
+    {
+        for (std::size_t i = 0; i < keywordInfoTable.size(); ++i)
+        {
+            if (keywordInfoTable[i].name == name)
+            {
+                return std::make_optional(static_cast<EnumKeyword>(i));
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * Checks that every EnumKeyword has an entry in the keywordInfoTable and that no two
+     * entries share a name (i.e. each name looks up its own EnumKeyword).
+     *
+     * @return bool true if valid, else false.
+     */
+    CMM_CONSTEXPR_FUNC bool isKeywordInfoTableValid() CMM_NOEXCEPT
+    {
+        for (std::size_t i = 0; i < keywordInfoTable.size(); ++i)
+        {
+            const auto keyword = findEnumKeyword(keywordInfoTable[i].name);
+
+            if (keywordInfoTable[i].name.empty() || !keyword.has_value() || static_cast<std::size_t>(*keyword) != i)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(isKeywordInfoTableValid(), "keywordInfoTable is missing an EnumKeyword or has a duplicate name");
+
+    /**
+     * Gets the KeywordInfo of an EnumKeyword.
+     *
+     * @param keyword the EnumKeyword.
+     * @return KeywordInfo const reference.
+     */
+    CMM_CONSTEXPR_FUNC const KeywordInfo& getKeywordInfo(const EnumKeyword keyword) CMM_NOEXCEPT
+    {
+        return keywordInfoTable[static_cast<std::size_t>(keyword)];
+    }
+
     class Keyword
     {
     private:
@@ -27,10 +109,9 @@ namespace cmm
         /**
          * Constructor.
          *
-         * @param name the std::string representation of the keyword.
-         * @param isAType flags this keyword as a primitive type.
+         * @param keyword the EnumKeyword whose KeywordInfo (name, is a type) this Keyword represents.
          */
-        Keyword(std::string&& name, const bool isAType) CMM_NOEXCEPT;
+        explicit Keyword(const EnumKeyword keyword);
 
     public:
 
@@ -73,6 +154,13 @@ namespace cmm
          */
         const std::string& getName() const CMM_NOEXCEPT;
 
+        /**
+         * Gets the EnumKeyword of this Keyword.
+         *
+         * @return EnumKeyword.
+         */
+        EnumKeyword getEnumKeyword() const CMM_NOEXCEPT;
+
         /**
          * Gets whether this Keyword is a primitive type or not.
          *
@@ -124,7 +212,10 @@ namespace cmm
 
     public:
 
+        static const Keyword BREAK;
+        static const Keyword CASE;
         static const Keyword CHAR;
+        static const Keyword DEFAULT;
         static const Keyword DOUBLE;
         static const Keyword ELSE;
         static const Keyword ENUM;
@@ -134,12 +225,16 @@ namespace cmm
         static const Keyword LONG;
         static const Keyword RETURN;
         static const Keyword SHORT;
+        static const Keyword SIGNED;
         static const Keyword STRUCT;
+        static const Keyword SWITCH;
+        static const Keyword UNSIGNED;
         static const Keyword VOID;
         static const Keyword WHILE;
 
     private:
 
+        EnumKeyword keyword;
         std::string name;
         bool isAType;
 
@@ -27,6 +27,16 @@ namespace cmm
     public:
         Lexer(const std::string& text);
         Lexer(std::string&& text) CMM_NOEXCEPT;
+
+        /**
+         * Constructor for a lexer that begins lexing at some location other than
+         * the beginning of a file (i.e. a slice of a larger input).
+         *
+         * @param text the text to lex.
+         * @param location the Location of the first character of the text.
+         */
+        Lexer(std::string&& text, const Location& location) CMM_NOEXCEPT;
+
         Lexer(const Lexer&) = default;
         Lexer(Lexer&&) CMM_NOEXCEPT = default;
         ~Lexer() = default;
@@ -62,6 +72,16 @@ namespace cmm
         void restore(const Snapshot& snap) CMM_NOEXCEPT;
         Snapshot snap() CMM_NOEXCEPT;
 
+        /**
+         * Creates a new, independent Lexer over the text between the two snapshots.
+         * Locations reported by the new Lexer are relative to the original input.
+         *
+         * @param begin the Snapshot marking the start of the slice (inclusive).
+         * @param end the Snapshot marking the end of the slice (exclusive).
+         * @return Lexer.
+         */
+        Lexer slice(const Snapshot& begin, const Snapshot& end) const;
+
     private:
         void consumeWhitespace();
         char nextChar() CMM_NOEXCEPT;
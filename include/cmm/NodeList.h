@@ -11,8 +11,11 @@
 #define CMM_NODE_LIST_H
 
 #include <cmm/ArgNode.h>
+#include <cmm/ArrayIndexNode.h>
 #include <cmm/BinOpNode.h>
 #include <cmm/BlockNode.h>
+#include <cmm/BreakStatementNode.h>
+#include <cmm/CaseStatementNode.h>
 #include <cmm/CastNode.h>
 #include <cmm/CompilationUnitNode.h>
 #include <cmm/DerefNode.h>
@@ -33,6 +36,7 @@
 #include <cmm/StatementNode.h>
 #include <cmm/StructDefinitionStatementNode.h>
 #include <cmm/StructFwdDeclarationStatementNode.h>
+#include <cmm/SwitchStatementNode.h>
 #include <cmm/TranslationUnitNode.h>
 #include <cmm/TypeNode.h>
 #include <cmm/UnaryOpNode.h>
@@ -13,8 +13,11 @@
 namespace cmm
 {
     class ArgNode;
+    class ArrayIndexNode;
     class BinOpNode;
     class BlockNode;
+    class BreakStatementNode;
+    class CaseStatementNode;
     class CastNode;
     class CompilationUnitNode;
     class DerefNode;
@@ -35,6 +38,7 @@ namespace cmm
     class StatementNode;
     class StructDefinitionStatementNode;
     class StructFwdDeclarationStatementNode;
+    class SwitchStatementNode;
     class TranslationUnitNode;
     class TypeNode;
     class UnaryOpNode;
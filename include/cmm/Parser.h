@@ -14,6 +14,7 @@
 #include <cmm/Types.h>
 #include <cmm/Lexer.h>
 #include <cmm/NodeListFwd.h>
+#include <cmm/ParserMemo.h>
 
 // std includes
 #include <memory>
@@ -71,6 +72,45 @@ namespace cmm
          */
         Parser& operator= (Parser&&) CMM_NOEXCEPT = default;
 
+        /**
+         * Gets the number of threads used for parsing top-level function bodies.
+         *
+         * @return u32 thread count (1 means the input is parsed sequentially).
+         */
+        u32 getParseThreadCount() const CMM_NOEXCEPT;
+
+        /**
+         * Sets the number of threads used for parsing top-level function bodies.
+         * When greater than 1, top-level statements are first split by brace matching
+         * and function definitions are parsed speculatively on worker threads.
+         *
+         * @param threadCount the u32 thread count.  A value of 0 is treated as 1.
+         */
+        void setParseThreadCount(const u32 threadCount) CMM_NOEXCEPT;
+
+        /**
+         * Gets whether the packrat memo table is used while parsing.
+         *
+         * @return bool true if enabled, else false.
+         */
+        bool isMemoizationEnabled() const CMM_NOEXCEPT;
+
+        /**
+         * Sets whether the packrat memo table is used while parsing.  When enabled, a
+         * failed attempt of a speculative rule is recorded by (rule, position) and any
+         * retry of that rule from the same position fails immediately.
+         *
+         * @param enable bool flag.
+         */
+        void setMemoizationEnabled(const bool enable) CMM_NOEXCEPT;
+
+        /**
+         * Gets the memo table's counters from the last call to parseCompilationUnit.
+         *
+         * @return ParserMemoStats const reference.
+         */
+        const ParserMemoStats& getMemoStats() const CMM_NOEXCEPT;
+
         /**
          * Attempts to parse the compilation unit.
          *
@@ -83,6 +123,15 @@ namespace cmm
 
         // The lexer to the input text to be parsed.
         Lexer lexer;
+
+        // The number of threads to use while parsing.
+        u32 parseThreadCount;
+
+        // Whether the packrat memo table is used while parsing.
+        bool memoize;
+
+        // The memo table's counters from the last parse.
+        ParserMemoStats memoStats;
     };
 }
 
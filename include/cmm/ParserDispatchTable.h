@@ -0,0 +1,140 @@
+/**
+ * A dense, constexpr buildable table for dispatching a parse function from the first token.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_PARSER_DISPATCH_TABLE_H
+#define CMM_PARSER_DISPATCH_TABLE_H
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/Keyword.h>
+#include <cmm/Token.h>
+
+// std includes
+#include <array>
+#include <cstddef>
+
+namespace cmm
+{
+    // Layout of the first token kinds:
+    // [0, 128): char symbols by their ASCII value.
+    // [128, 128 + keywords): keyword symbols by EnumKeyword.
+    // [128 + keywords, count): every other token by its TokenType.
+    CMM_CONSTEXPR std::size_t FIRST_TOKEN_CHAR_SYMBOL_COUNT = 128;
+    CMM_CONSTEXPR std::size_t FIRST_TOKEN_KEYWORD_OFFSET = FIRST_TOKEN_CHAR_SYMBOL_COUNT;
+    CMM_CONSTEXPR std::size_t FIRST_TOKEN_TYPE_OFFSET = FIRST_TOKEN_KEYWORD_OFFSET + static_cast<std::size_t>(EnumKeyword::COUNT);
+    CMM_CONSTEXPR std::size_t FIRST_TOKEN_KIND_COUNT = FIRST_TOKEN_TYPE_OFFSET + static_cast<std::size_t>(TokenType::SYMBOL) + 1;
+
+    /**
+     * Gets the first token kind of any token of the TokenType.
+     *
+     * @param type the TokenType.
+     * @return std::size_t index into a ParserDispatchTable.
+     */
+    CMM_CONSTEXPR_FUNC std::size_t getFirstTokenKind(const TokenType type) CMM_NOEXCEPT
+    {
+        return FIRST_TOKEN_TYPE_OFFSET + static_cast<std::size_t>(type);
+    }
+
+    /**
+     * Gets the first token kind of a char symbol.
+     *
+     * @param charSymbol the char symbol.
+     * @return std::size_t index into a ParserDispatchTable.
+     */
+    CMM_CONSTEXPR_FUNC std::size_t getFirstTokenKind(const char charSymbol) CMM_NOEXCEPT
+    {
+        const auto asUnsigned = static_cast<unsigned char>(charSymbol);
+        return asUnsigned < FIRST_TOKEN_CHAR_SYMBOL_COUNT ? asUnsigned : getFirstTokenKind(TokenType::CHAR_SYMBOL);
+    }
+
+    /**
+     * Gets the first token kind of a keyword.
+     *
+     * @param keyword the EnumKeyword.
+     * @return std::size_t index into a ParserDispatchTable.
+     */
+    CMM_CONSTEXPR_FUNC std::size_t getFirstTokenKind(const EnumKeyword keyword) CMM_NOEXCEPT
+    {
+        return FIRST_TOKEN_KEYWORD_OFFSET + static_cast<std::size_t>(keyword);
+    }
+
+    /**
+     * Gets the first token kind of a Token.  Char symbols and keywords get their own
+     * kind, all other tokens are classified by their TokenType.
+     *
+     * @param token the Token to classify.
+     * @return std::size_t index into a ParserDispatchTable.
+     */
+    std::size_t getFirstTokenKind(const Token& token) CMM_NOEXCEPT;
+
+    template<class Func>
+    class ParserDispatchTable
+    {
+    public:
+
+        /**
+         * Constructor with every entry set to nullptr.
+         */
+        CMM_CONSTEXPR_FUNC ParserDispatchTable() CMM_NOEXCEPT : table{}
+        {
+        }
+
+        /**
+         * Registers the function for a char symbol.
+         *
+         * @param charSymbol the char symbol.
+         * @param func the function to dispatch.
+         */
+        CMM_CONSTEXPR_FUNC void registerFunction(const char charSymbol, Func func) CMM_NOEXCEPT
+        {
+            table[getFirstTokenKind(charSymbol)] = func;
+        }
+
+        /**
+         * Registers the function for a keyword.
+         *
+         * @param keyword the EnumKeyword.
+         * @param func the function to dispatch.
+         */
+        CMM_CONSTEXPR_FUNC void registerFunction(const EnumKeyword keyword, Func func) CMM_NOEXCEPT
+        {
+            table[getFirstTokenKind(keyword)] = func;
+        }
+
+        /**
+         * Registers the function for any token of the TokenType that is not a registered
+         * char symbol or keyword.
+         *
+         * @param type the TokenType.
+         * @param func the function to dispatch.
+         */
+        CMM_CONSTEXPR_FUNC void registerFunction(const TokenType type, Func func) CMM_NOEXCEPT
+        {
+            table[getFirstTokenKind(type)] = func;
+        }
+
+        /**
+         * Looks up the function registered for the token.
+         *
+         * @param token the lookahead Token.
+         * @return the registered function, else nullptr.
+         */
+        Func dispatch(const Token& token) const CMM_NOEXCEPT
+        {
+            return table[getFirstTokenKind(token)];
+        }
+
+    private:
+
+        // Indexed by the first token kind.
+        std::array<Func, FIRST_TOKEN_KIND_COUNT> table;
+    };
+}
+
+#endif //!CMM_PARSER_DISPATCH_TABLE_H
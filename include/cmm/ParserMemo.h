@@ -0,0 +1,199 @@
+/**
+ * A packrat style memo table for parse rules that may be retried from the same position.
+ * Only failures are recorded: AST nodes are move-only and have no deep copy, so a successful
+ * subtree is owned by exactly one caller and can't be handed out again on a later hit.  In
+ * this grammar a successful rule is either kept or thrown away together with the enclosing
+ * attempt, i.e. it is only ever retried from the same position after failing.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_PARSER_MEMO_H
+#define CMM_PARSER_MEMO_H
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/Snapshot.h>
+
+// std includes
+#include <array>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+namespace cmm
+{
+    /**
+     * The parse rules eligible for memoization.
+     */
+    enum class EnumParseRule : u8
+    {
+        FUNCTION_CALL_OR_VARIABLE = 0, CAST_EXPRESSION, PAREN_EXPRESSION, DECLARATION_STATEMENT, COUNT
+    };
+
+    /**
+     * Gets the string representation of the EnumParseRule.
+     *
+     * @param rule the EnumParseRule.
+     * @return C-style string.
+     */
+    const char* toString(const EnumParseRule rule) CMM_NOEXCEPT;
+
+    struct ParserMemoRuleStats
+    {
+        // The number of times the rule was looked up.
+        std::size_t lookups = 0;
+
+        // The number of lookups that were answered by the table.
+        std::size_t hits = 0;
+
+        // The number of results stored in the table.
+        std::size_t stores = 0;
+    };
+
+    struct ParserMemoStats
+    {
+        // Stats indexed by EnumParseRule.
+        std::array<ParserMemoRuleStats, static_cast<std::size_t>(EnumParseRule::COUNT)> rules;
+
+        /**
+         * Gets the stats for a specific rule.
+         *
+         * @param rule the EnumParseRule.
+         * @return ParserMemoRuleStats reference.
+         */
+        ParserMemoRuleStats& operator[] (const EnumParseRule rule) CMM_NOEXCEPT;
+
+        /**
+         * Gets the stats for a specific rule.
+         *
+         * @param rule the EnumParseRule.
+         * @return ParserMemoRuleStats const reference.
+         */
+        const ParserMemoRuleStats& operator[] (const EnumParseRule rule) const CMM_NOEXCEPT;
+
+        /**
+         * Accumulates the other stats into these stats.
+         *
+         * @param other the ParserMemoStats to add.
+         * @return ParserMemoStats reference.
+         */
+        ParserMemoStats& operator+= (const ParserMemoStats& other) CMM_NOEXCEPT;
+
+        /**
+         * Gets the total number of lookups across all rules.
+         *
+         * @return std::size_t.
+         */
+        std::size_t totalLookups() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the total number of hits across all rules.
+         *
+         * @return std::size_t.
+         */
+        std::size_t totalHits() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the ratio of hits to lookups across all rules.
+         *
+         * @return f64 in the range [0, 1].
+         */
+        f64 hitRate() const CMM_NOEXCEPT;
+
+        /**
+         * Gets a human readable, per rule summary of the stats.
+         *
+         * @return std::string.
+         */
+        std::string toString() const;
+    };
+
+    class ParserMemo
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        ParserMemo() = default;
+
+        /**
+         * Deleted copy constructor.
+         */
+        ParserMemo(const ParserMemo&) = delete;
+
+        /**
+         * Default move constructor.
+         */
+        ParserMemo(ParserMemo&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~ParserMemo() = default;
+
+        /**
+         * Deleted copy assignment operator.
+         *
+         * @return ParserMemo reference.
+         */
+        ParserMemo& operator= (const ParserMemo&) = delete;
+
+        /**
+         * Default move assignment operator.
+         *
+         * @return ParserMemo reference.
+         */
+        ParserMemo& operator= (ParserMemo&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Looks up a previously recorded failure of the rule at the lexer's index.
+         *
+         * @param rule the EnumParseRule being attempted.
+         * @param index the lexer index the rule starts at.
+         * @return pointer to the Snapshot the failed attempt left the lexer at, else nullptr.
+         */
+        const Snapshot* findFailure(const EnumParseRule rule, const std::size_t index);
+
+        /**
+         * Records that the rule failed when started at the lexer's index.
+         *
+         * @param rule the EnumParseRule that failed.
+         * @param index the lexer index the rule started at.
+         * @param end the Snapshot the failed attempt left the lexer at.
+         */
+        void addFailure(const EnumParseRule rule, const std::size_t index, const Snapshot& end);
+
+        /**
+         * Gets the hit/miss counters.
+         *
+         * @return ParserMemoStats const reference.
+         */
+        const ParserMemoStats& getStats() const CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Combines the rule and index into a single key.
+         *
+         * @param rule the EnumParseRule.
+         * @param index the lexer index.
+         * @return std::size_t key.
+         */
+        static std::size_t makeKey(const EnumParseRule rule, const std::size_t index) CMM_NOEXCEPT;
+
+    private:
+
+        // The table of failed attempts keyed by (rule, index).
+        std::unordered_map<std::size_t, Snapshot> failures;
+
+        // The hit/miss counters.
+        ParserMemoStats stats;
+    };
+}
+
+#endif //!CMM_PARSER_MEMO_H
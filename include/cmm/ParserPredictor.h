@@ -83,7 +83,7 @@ namespace cmm
          * Calls the predicted function.
          */
         template<class ResultType, class... Args>
-        ResultType call(const PredictionContext<T>& context, Args&&... args)
+        ResultType call(const PredictionContext<T>& context, Args&&... args) const
         {
             return context.func(std::forward<Args>(args)...);
         }
@@ -94,7 +94,7 @@ namespace cmm
          * @param token the Token to base our prediction from.
          * @return optional PredictionContext.
          */
-        std::optional<PredictionContext<T>> predict(const Token& token) CMM_NOEXCEPT
+        std::optional<PredictionContext<T>> predict(const Token& token) const CMM_NOEXCEPT
         {
             std::optional<PredictionContext<T>> result = std::nullopt;
             const auto findResult = tokenTable.find(token);
@@ -15,12 +15,36 @@
 #include <cmm/Location.h>
 
 // std includes
+#include <atomic>
 #include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
 
 namespace cmm
 {
     class Reporter
     {
+    public:
+
+        /**
+         * An error or warning held back while the reporting thread defers its reports.
+         */
+        struct DeferredReport
+        {
+            // Whether this is an error, else a warning.
+            bool isError;
+
+            // The formatted message.
+            std::string message;
+
+            // The Location in the file where the error or warning occurred.
+            Location location;
+        };
+
+        using DeferredReportList = std::vector<DeferredReport>;
+
     private:
 
         /**
@@ -34,9 +58,9 @@ namespace cmm
         Reporter(const Reporter&) CMM_NOEXCEPT = delete;
 
         /**
-         * Default move constructor.
+         * Deleted move constructor.
          */
-        Reporter(Reporter&&) CMM_NOEXCEPT = default;
+        Reporter(Reporter&&) CMM_NOEXCEPT = delete;
 
         /**
          * Deleted copy assignment operator.
@@ -44,9 +68,9 @@ namespace cmm
         Reporter& operator= (const Reporter&) CMM_NOEXCEPT = delete;
 
         /**
-         * Default move assignment operator.
+         * Deleted move assignment operator.
          */
-        Reporter& operator= (Reporter&&) CMM_NOEXCEPT = default;
+        Reporter& operator= (Reporter&&) CMM_NOEXCEPT = delete;
 
     public:
 
@@ -96,6 +120,7 @@ namespace cmm
         {
             if (canPrint)
             {
+                std::lock_guard<std::mutex> guard(printMutex);
                 std::cout << "bug: " << msg << " at " << location << std::endl;
             }
 
@@ -114,8 +139,15 @@ namespace cmm
         template<class T>
         void error(const T& msg, const Location& location)
         {
+            if (deferredReports != nullptr)
+            {
+                defer(true, msg, location);
+                return;
+            }
+
             if (canPrint)
             {
+                std::lock_guard<std::mutex> guard(printMutex);
                 std::cout << "error: " << msg << " at " << location << std::endl;
             }
 
@@ -131,14 +163,37 @@ namespace cmm
         template<class T>
         void warn(const T& msg, const Location& location)
         {
+            if (deferredReports != nullptr)
+            {
+                defer(false, msg, location);
+                return;
+            }
+
             if (canPrint)
             {
+                std::lock_guard<std::mutex> guard(printMutex);
                 std::cout << "warning: " << msg << " at " << location << std::endl;
             }
 
             ++warnings;
         }
 
+        /**
+         * Sets where the calling thread's errors and warnings are collected instead of being
+         * reported.  This lets a speculative or out of order parse decide later which of them
+         * actually happened (see replay).
+         *
+         * @param reports pointer to the DeferredReportList or nullptr to report directly again.
+         */
+        void setDeferredReports(DeferredReportList* reports) CMM_NOEXCEPT;
+
+        /**
+         * Reports previously deferred errors and warnings, in order.
+         *
+         * @param reports the DeferredReportList to report.
+         */
+        void replay(const DeferredReportList& reports);
+
         /**
          * Resets tracked errors and warnings.
          */
@@ -146,11 +201,34 @@ namespace cmm
 
     private:
 
+        /**
+         * Adds an error or warning to the calling thread's DeferredReportList.
+         *
+         * @param isError whether this is an error, else a warning.
+         * @param msg the templated message to provide.
+         * @param location the Location in the file where the error or warning occurred.
+         */
+        template<class T>
+        void defer(const bool isError, const T& msg, const Location& location)
+        {
+            std::ostringstream os;
+            os << msg;
+            deferredReports->push_back(DeferredReport { isError, os.str(), location });
+        }
+
+    private:
+
+        // The calling thread's deferred reports or nullptr when reporting directly.
+        static thread_local DeferredReportList* deferredReports;
+
         // The count of errors.
-        s32 errors;
+        std::atomic<s32> errors;
 
         // The count of warnings.
-        s32 warnings;
+        std::atomic<s32> warnings;
+
+        // Serializes output when reports come from more than one (parser) thread.
+        std::mutex printMutex;
 
         // Flag for enabling/disabling printing.
         bool canPrint;
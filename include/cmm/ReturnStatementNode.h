@@ -90,6 +90,13 @@ namespace cmm
          */
         const ExpressionNode* getExpression() const CMM_NOEXCEPT;
 
+        /**
+         * Replaces the returned expression with a new expression.
+         *
+         * @param expression the new ExpressionNode.
+         */
+        void setExpression(std::unique_ptr<ExpressionNode>&& expression) CMM_NOEXCEPT;
+
         /**
          * Gets the underlying CType from the Expression (if non-nullptr).
          *
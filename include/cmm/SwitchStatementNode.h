@@ -0,0 +1,145 @@
+/**
+ * An AST node for representing a switch statement.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_SWITCH_STATEMENT_NODE_H
+#define CMM_SWITCH_STATEMENT_NODE_H
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/CaseStatementNode.h>
+#include <cmm/StatementNode.h>
+
+// std includes
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cmm
+{
+    // Forward declarations:
+    class ExpressionNode;
+
+    class SwitchStatementNode : public StatementNode
+    {
+    public:
+
+        using CaseList = std::vector<std::unique_ptr<CaseStatementNode>>;
+        using size_type = CaseList::size_type;
+        using CaseListIter = CaseList::iterator;
+        using CaseListConstIter = CaseList::const_iterator;
+
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param location the location of this node.
+         * @param conditional the ExpressionNode switched on.
+         * @param cases the CaseList in source order.
+         */
+        SwitchStatementNode(const Location& location, std::unique_ptr<ExpressionNode>&& conditional, CaseList&& cases) CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        SwitchStatementNode(const SwitchStatementNode&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        SwitchStatementNode(SwitchStatementNode&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Destructor
+         */
+        ~SwitchStatementNode() = default;
+
+        /**
+         * Copy assignment operator.
+         *
+         * @return SwitchStatementNode reference.
+         */
+        SwitchStatementNode& operator= (const SwitchStatementNode&) = delete;
+
+        /**
+         * Move assignment operator.
+         *
+         * @return SwitchStatementNode reference.
+         */
+        SwitchStatementNode& operator= (SwitchStatementNode&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Gets the ExpressionNode switched on.
+         *
+         * @return pointer to ExpressionNode.
+         */
+        ExpressionNode* getConditional() CMM_NOEXCEPT;
+
+        /**
+         * Gets the ExpressionNode switched on.
+         *
+         * @return const pointer to ExpressionNode.
+         */
+        const ExpressionNode* getConditional() const CMM_NOEXCEPT;
+
+        /**
+         * Replaces the conditional with a new expression.
+         *
+         * @param expression the new ExpressionNode.
+         */
+        void setConditional(std::unique_ptr<ExpressionNode>&& expression) CMM_NOEXCEPT;
+
+        /**
+         * Adds a DerefNode to the conditional expression.
+         * Note: This assumes the caller has already performed checks.
+         */
+        void derefConditional();
+
+        /**
+         * Gets the number of labels ('default' included).
+         *
+         * @return size_type count.
+         */
+        size_type size() const CMM_NOEXCEPT;
+
+        /**
+         * Iterator to the beginning of the case list.
+         */
+        CaseListIter begin() CMM_NOEXCEPT;
+
+        /**
+         * Const iterator to the beginning of the case list.
+         */
+        CaseListConstIter cbegin() const CMM_NOEXCEPT;
+
+        /**
+         * Iterator to the end of the case list.
+         */
+        CaseListIter end() CMM_NOEXCEPT;
+
+        /**
+         * Const iterator to the end of the case list.
+         */
+        CaseListConstIter cend() const CMM_NOEXCEPT;
+
+        VisitorResult accept(Visitor* visitor) override;
+        std::string toString() const override;
+
+    private:
+
+        // The expression switched on.
+        std::unique_ptr<ExpressionNode> conditional;
+
+        // The labels with their statements, in source order.
+        CaseList cases;
+    };
+}
+
+#endif //!CMM_SWITCH_STATEMENT_NODE_H
+
@@ -23,12 +23,14 @@ namespace cmm
     CMM_CONSTEXPR char CHAR_ASTERISK = '*';
     CMM_CONSTEXPR char CHAR_BACK_SLASH = '\\';
     CMM_CONSTEXPR char CHAR_BACK_SPACE = (char) 12;
+    CMM_CONSTEXPR char CHAR_CARET = '^';
     CMM_CONSTEXPR char CHAR_CARRIAGE_RETURN = '\r';
     CMM_CONSTEXPR char CHAR_COLON = ':';
     CMM_CONSTEXPR char CHAR_COMMA = ',';
     CMM_CONSTEXPR char CHAR_DOUBLE_QOUTE = '"';
     CMM_CONSTEXPR char CHAR_EOF = EOF;
     CMM_CONSTEXPR char CHAR_EQUALS = '=';
+    CMM_CONSTEXPR char CHAR_EXCLAMATION = '!';
     CMM_CONSTEXPR char CHAR_FORM_FEED = (char) 12;
     CMM_CONSTEXPR char CHAR_FORWARD_SLASH = '/';
     CMM_CONSTEXPR char CHAR_GT = '>';
@@ -39,7 +41,9 @@ namespace cmm
     CMM_CONSTEXPR char CHAR_MINUS = '-';
     CMM_CONSTEXPR char CHAR_NEWLINE = '\n';
     CMM_CONSTEXPR char CHAR_NULL = '\0';
+    CMM_CONSTEXPR char CHAR_PERCENT = '%';
     CMM_CONSTEXPR char CHAR_PERIOD = '.';
+    CMM_CONSTEXPR char CHAR_PIPE = '|';
     CMM_CONSTEXPR char CHAR_PLUS = '+';
     CMM_CONSTEXPR char CHAR_RCURLY_BRACKET = '}';
     CMM_CONSTEXPR char CHAR_RPAREN = ')';
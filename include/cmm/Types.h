@@ -234,12 +234,18 @@ namespace cmm
         u16 pointers;
         std::optional<std::string> optTypeName;
 
+        // Whether an integer type was declared 'unsigned' (signed is the default).
+        bool unsignedInt;
+
+        // The number of elements of a fixed-size array (ex. 'int a[8]'), 0 if not an array.
+        u32 arrayLength;
+
         /**
          * Needed for std::pair... do NOT use otherwise.
          */
         CType() CMM_NOEXCEPT;
         explicit CType(const EnumCType type, const u16 pointers = 0,
-            std::optional<std::string>&& optTypeName = std::nullopt) CMM_NOEXCEPT;
+            std::optional<std::string>&& optTypeName = std::nullopt, const bool unsignedInt = false) CMM_NOEXCEPT;
         CType(const CType& other);
         CType(CType&& other) CMM_NOEXCEPT;
 
@@ -249,9 +255,27 @@ namespace cmm
         bool isEnum() const CMM_NOEXCEPT;
         bool isFloatingPoint() const CMM_NOEXCEPT;
         bool isInt() const CMM_NOEXCEPT;
+        bool isSignedInt() const CMM_NOEXCEPT;
+        bool isUnsignedInt() const CMM_NOEXCEPT;
         bool isPointerType() const CMM_NOEXCEPT;
+        bool isArray() const CMM_NOEXCEPT;
         bool isString() const CMM_NOEXCEPT;
 
+        /**
+         * Gets the CType of an element of an array or the pointee of a pointer.
+         *
+         * @return CType.
+         */
+        CType getElementType() const;
+
+        /**
+         * Gets the CType of this type when used as a value, where arrays
+         * decay to a pointer to their first element.
+         *
+         * @return CType.
+         */
+        CType decay() const;
+
         bool operator== (const CType& other) const CMM_NOEXCEPT;
         bool operator!= (const CType& other) const CMM_NOEXCEPT;
     };
@@ -334,7 +358,9 @@ namespace cmm
     enum class EnumBinOpNodeType
     {
         ASSIGNMENT = 0, ADD, SUBTRACT, MULTIPLY, DIVIDE,
-        CMP_EQ, CMP_NE, CMP_GE, CMP_GT, CMP_LE, CMP_LT
+        CMP_EQ, CMP_NE, CMP_GE, CMP_GT, CMP_LE, CMP_LT,
+        MODULUS, BITWISE_AND, BITWISE_OR, BITWISE_XOR, SHIFT_LEFT, SHIFT_RIGHT,
+        LOGICAL_AND, LOGICAL_OR, COUNT
     };
 
     std::optional<EnumBinOpNodeType> isEnumBinOpType(const Token& token) CMM_NOEXCEPT;
@@ -366,6 +392,11 @@ namespace cmm
     template<class Stream>
     void printType(Stream& stream, const CType& type)
     {
+        if (type.unsignedInt)
+        {
+            stream << "unsigned ";
+        }
+
         stream << toString(type.type);
 
         if (type.isEnum() && type.optTypeName.has_value())
@@ -374,6 +405,11 @@ namespace cmm
         }
 
         printRepeat(stream, '*', type.pointers);
+
+        if (type.isArray())
+        {
+            stream << '[' << type.arrayLength << ']';
+        }
     }
 
     template <class T>
@@ -395,6 +431,8 @@ namespace std
             std::size_t result = (cmm::s32) type.type;
             cmm::hash_combine(result, type.pointers);
             cmm::hash_combine(result, type.optTypeName);
+            cmm::hash_combine(result, type.unsignedInt);
+            cmm::hash_combine(result, type.arrayLength);
 
             return result;
         }
@@ -79,6 +79,13 @@ namespace cmm
          */
         const ExpressionNode* getConditional() const CMM_NOEXCEPT;
 
+        /**
+         * Replaces the conditional with a new expression.
+         *
+         * @param expression the new ExpressionNode.
+         */
+        void setConditional(std::unique_ptr<ExpressionNode>&& expression) CMM_NOEXCEPT;
+
         /**
          * Get the StatementNode for the while loop to run.
          *
@@ -0,0 +1,189 @@
+/**
+ * Simple, conservative alias queries over IR pointers: two pointers are only known not
+ * to overlap when they are based on distinct locals or globals, or take distinct constant
+ * paths into the same aggregate.  The per function AliasAnalysis adds what is known from
+ * the locals whose address is never taken, noalias arguments and the accessed types.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_IR_ALIAS_ANALYSIS_H
+#define CMM_IR_ALIAS_ANALYSIS_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <unordered_set>
+
+namespace cmm::ir
+{
+    class Function;
+    class Instruction;
+    class Value;
+
+    enum class EnumAliasResult : u8
+    {
+        NO_ALIAS = 0, MAY_ALIAS, MUST_ALIAS
+    };
+
+    const char* toString(const EnumAliasResult result) CMM_NOEXCEPT;
+
+    /**
+     * Gets the object a pointer is derived from by looking through GEPs and bitcasts.
+     *
+     * @param pointer the pointer Value.
+     * @return pointer to the underlying Value.
+     */
+    const Value* getUnderlyingObject(const Value* pointer) CMM_NOEXCEPT;
+
+    /**
+     * Gets whether a value is an object of its own (an alloca or a global variable), i.e.
+     * memory distinct from every other identified object.
+     *
+     * @param value the Value.
+     * @return bool.
+     */
+    bool isIdentifiedObject(const Value* value) CMM_NOEXCEPT;
+
+    /**
+     * Gets whether a pointer can be dereferenced without trapping wherever it is defined:
+     * an identified object or a constant inbounds path into one.
+     *
+     * @param pointer the pointer Value.
+     * @return bool.
+     */
+    bool isDereferenceablePointer(const Value* pointer);
+
+    /**
+     * Gets whether two pointers may refer to overlapping memory.
+     *
+     * @param first the first pointer Value.
+     * @param second the second pointer Value.
+     * @return bool true if they may alias, else false.
+     */
+    bool mayAlias(const Value* first, const Value* second);
+
+    /**
+     * Gets whether a pointer's address may be captured, i.e. stored to memory, passed to a
+     * call, converted to an int or merged with other pointers, so code elsewhere may use it.
+     * Loading from it, storing to it and non escaping GEPs of it don't capture it.
+     *
+     * @param pointer the pointer Value.
+     * @return bool.
+     */
+    bool mayEscape(const Value* pointer);
+
+    /**
+     * Gets whether a pointer's address may be captured.  Unlike mayEscape, passing it to
+     * a nocapture argument doesn't count: the callee may use it, but not keep it.
+     *
+     * @param pointer the pointer Value.
+     * @return bool.
+     */
+    bool mayBeCaptured(const Value* pointer);
+
+    class AliasAnalysis
+    {
+    public:
+
+        /**
+         * Constructor, finding the locals of a function whose address is taken.
+         *
+         * @param function the ir::Function.
+         */
+        explicit AliasAnalysis(const Function& function);
+
+        /**
+         * Copy constructor.
+         */
+        AliasAnalysis(const AliasAnalysis&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        AliasAnalysis(AliasAnalysis&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~AliasAnalysis() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        AliasAnalysis& operator= (const AliasAnalysis&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        AliasAnalysis& operator= (AliasAnalysis&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Gets whether two pointers, each accessed with its pointee type, refer to the same,
+         * overlapping or distinct memory.
+         *
+         * @param first the first pointer Value.
+         * @param second the second pointer Value.
+         * @return EnumAliasResult.
+         */
+        EnumAliasResult alias(const Value* first, const Value* second) const;
+
+        /**
+         * Gets whether two pointers may refer to overlapping memory.
+         *
+         * @param first the first pointer Value.
+         * @param second the second pointer Value.
+         * @return bool true if they may alias, else false.
+         */
+        bool mayAlias(const Value* first, const Value* second) const;
+
+        /**
+         * Gets whether an instruction may read or write the memory a pointer refers to.  A
+         * call can only reach a local whose address is taken or that it is passed.
+         *
+         * @param instruction the ir::Instruction.
+         * @param pointer the pointer Value.
+         * @return bool.
+         */
+        bool mayAccess(const Instruction& instruction, const Value* pointer) const;
+
+        /**
+         * Gets whether an alloca of the function has its address taken (captured).
+         *
+         * @param object the alloca Value.
+         * @return bool.
+         */
+        bool isAddressTaken(const Value* object) const;
+
+        /**
+         * Gets the allocas of the function whose address is taken.
+         *
+         * @return const reference to the std::unordered_set of allocas.
+         */
+        const std::unordered_set<const Value*>& getAddressTaken() const CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Gets whether an object is a local of the function that nothing else can point to.
+         *
+         * @param object the underlying object Value.
+         * @return bool.
+         */
+        bool isPrivateObject(const Value* object) const;
+
+    private:
+
+        // The allocas whose address is taken.
+        std::unordered_set<const Value*> addressTaken;
+
+        // The allocas whose address is never taken.
+        std::unordered_set<const Value*> privateObjects;
+    };
+}
+
+#endif //!CMM_IR_ALIAS_ANALYSIS_H
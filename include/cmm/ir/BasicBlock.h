@@ -0,0 +1,157 @@
+/**
+ * A basic block in the cmm IR: a straight line list of instructions ending in a terminator.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_BASIC_BLOCK_H
+#define CMM_IR_BASIC_BLOCK_H
+
+// Our includes
+#include <cmm/ir/Instruction.h>
+
+// std includes
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cmm::ir
+{
+    class Function;
+
+    class BasicBlock : public Value
+    {
+    public:
+
+        using InstructionList = Instruction::InstructionList;
+        using BlockList = std::list<std::unique_ptr<BasicBlock>>;
+
+        /**
+         * Constructor.
+         *
+         * @param labelType the label Type.
+         * @param name the optional name of the block.
+         */
+        BasicBlock(Type* labelType, std::string name = "");
+
+        /**
+         * Destructor.
+         */
+        virtual ~BasicBlock();
+
+        /**
+         * Gets the function containing this block.
+         *
+         * @return pointer to the Function, else nullptr if not inserted.
+         */
+        Function* getParent() const CMM_NOEXCEPT;
+
+        bool empty() const CMM_NOEXCEPT;
+        std::size_t size() const CMM_NOEXCEPT;
+
+        InstructionList::iterator begin() CMM_NOEXCEPT;
+        InstructionList::iterator end() CMM_NOEXCEPT;
+        InstructionList::const_iterator begin() const CMM_NOEXCEPT;
+        InstructionList::const_iterator end() const CMM_NOEXCEPT;
+
+        Instruction* front() const CMM_NOEXCEPT;
+        Instruction* back() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the terminator of this block.
+         *
+         * @return pointer to the terminating Instruction, else nullptr if the block is not terminated.
+         */
+        Instruction* getTerminator() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the first instruction that is not a PHI.
+         *
+         * @return pointer to the Instruction, else nullptr.
+         */
+        Instruction* getFirstNonPhi() const CMM_NOEXCEPT;
+
+        /**
+         * Appends an instruction to the end of this block.
+         *
+         * @param instruction the Instruction to take ownership of.
+         * @return pointer to the Instruction.
+         */
+        Instruction* append(std::unique_ptr<Instruction>&& instruction);
+
+        /**
+         * Inserts an instruction before another instruction in this block.
+         *
+         * @param position the Instruction to insert before (nullptr appends).
+         * @param instruction the Instruction to take ownership of.
+         * @return pointer to the Instruction.
+         */
+        Instruction* insertBefore(Instruction* position, std::unique_ptr<Instruction>&& instruction);
+
+        /**
+         * Unlinks an instruction from this block and returns ownership.
+         *
+         * @param instruction the Instruction to remove.
+         * @return std::unique_ptr to the Instruction.
+         */
+        std::unique_ptr<Instruction> remove(Instruction* instruction);
+
+        /**
+         * Gets the predecessors of this block (each listed once, in a stable order).
+         *
+         * @return std::vector of BasicBlock pointers.
+         */
+        std::vector<BasicBlock*> getPredecessors() const;
+
+        /**
+         * Gets the successors of this block.
+         *
+         * @return std::vector of BasicBlock pointers.
+         */
+        std::vector<BasicBlock*> getSuccessors() const;
+
+        /**
+         * Gets the single predecessor if there is exactly one.
+         *
+         * @return pointer to the BasicBlock, else nullptr.
+         */
+        BasicBlock* getSinglePredecessor() const;
+
+        /**
+         * Removes this block as a predecessor from the PHIs of all of its successors.
+         */
+        void removeFromSuccessorPhis();
+
+        /**
+         * Unlinks this block from its function and destroys it.
+         */
+        void eraseFromParent();
+
+        /**
+         * Moves every instruction from position onward into the end of another block.
+         *
+         * @param position the first Instruction to move.
+         * @param other the destination BasicBlock.
+         */
+        void spliceInto(Instruction* position, BasicBlock* other);
+
+    private:
+
+        friend class Function;
+
+        // The containing function.
+        Function* parent;
+
+        // The position of this block in its parent's list.
+        BlockList::iterator position;
+
+        // The instructions.
+        InstructionList instructions;
+    };
+}
+
+#endif //!CMM_IR_BASIC_BLOCK_H
@@ -0,0 +1,129 @@
+/**
+ * Call graph of a cmm IR module: the direct call sites between its functions and their
+ * strongly connected components (i.e. which functions are recursive).
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_IR_CALL_GRAPH_H
+#define CMM_IR_CALL_GRAPH_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <unordered_map>
+#include <vector>
+
+namespace cmm::ir
+{
+    class Function;
+    class Instruction;
+    class Module;
+
+    class CallGraph
+    {
+    public:
+
+        /**
+         * Constructor that builds the graph of a module.
+         *
+         * @param module the Module.
+         */
+        explicit CallGraph(const Module& module);
+
+        /**
+         * Copy constructor.
+         */
+        CallGraph(const CallGraph&) = default;
+
+        /**
+         * Move constructor.
+         */
+        CallGraph(CallGraph&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~CallGraph() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        CallGraph& operator= (const CallGraph&) = default;
+
+        /**
+         * Move assignment operator.
+         */
+        CallGraph& operator= (CallGraph&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Rebuilds the graph after calls were added or removed.
+         *
+         * @param module the Module.
+         */
+        void recalculate(const Module& module);
+
+        /**
+         * Gets the calls made by a function, in program order.
+         *
+         * @param caller the Function.
+         * @return const reference to the call Instructions.
+         */
+        const std::vector<Instruction*>& getCalls(const Function* caller) const;
+
+        /**
+         * Gets the calls made to a function from anywhere in the module.
+         *
+         * @param callee the Function.
+         * @return const reference to the call Instructions.
+         */
+        const std::vector<Instruction*>& getCallSites(const Function* callee) const;
+
+        /**
+         * Gets whether a function may (directly or through others) call itself.
+         *
+         * @param function the Function.
+         * @return bool.
+         */
+        bool isRecursive(const Function* function) const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether two functions belong to the same cycle of calls.
+         *
+         * @param first the first Function.
+         * @param second the second Function.
+         * @return bool.
+         */
+        bool isSameComponent(const Function* first, const Function* second) const CMM_NOEXCEPT;
+
+        /**
+         * Gets the defined functions ordered callees first (each cycle's members together).
+         *
+         * @return const reference to the Functions.
+         */
+        const std::vector<Function*>& getBottomUpOrder() const CMM_NOEXCEPT;
+
+    private:
+
+        // Per function information.
+        struct Node
+        {
+            std::vector<Instruction*> calls;
+            std::vector<Instruction*> callSites;
+            u32 component = 0;
+            bool recursive = false;
+        };
+
+        // The node of each function.
+        std::unordered_map<const Function*, Node> nodes;
+
+        // The defined functions, callees first.
+        std::vector<Function*> bottomUpOrder;
+    };
+}
+
+#endif //!CMM_IR_CALL_GRAPH_H
@@ -0,0 +1,108 @@
+/**
+ * Constant values in the cmm IR.  Constants are uniqued by the owning Module.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_CONSTANT_H
+#define CMM_IR_CONSTANT_H
+
+// Our includes
+#include <cmm/ir/Value.h>
+
+namespace cmm::ir
+{
+    class ConstantInt : public Value
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param type the int Type.
+         * @param value the value (will be truncated and sign extended to the type's width).
+         */
+        ConstantInt(Type* type, const s64 value);
+
+        /**
+         * Gets the value sign extended from the type's width.
+         *
+         * @return s64.
+         */
+        s64 getValue() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the value zero extended from the type's width.
+         *
+         * @return u64.
+         */
+        u64 getZExtValue() const CMM_NOEXCEPT;
+
+        bool isZero() const CMM_NOEXCEPT;
+        bool isOne() const CMM_NOEXCEPT;
+        bool isAllOnes() const CMM_NOEXCEPT;
+
+        /**
+         * Truncates and sign extends a value to the given bit width.
+         *
+         * @param value the value.
+         * @param bits the bit width.
+         * @return s64 the normalized value.
+         */
+        static s64 normalize(const s64 value, const u32 bits) CMM_NOEXCEPT;
+
+    private:
+
+        // The value, sign extended from the type's width.
+        s64 value;
+    };
+
+    class ConstantFP : public Value
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param type the float or double Type.
+         * @param value the value (rounded to float for float types).
+         */
+        ConstantFP(Type* type, const f64 value);
+
+        f64 getValue() const CMM_NOEXCEPT;
+
+    private:
+
+        // The value.
+        f64 value;
+    };
+
+    class ConstantNull : public Value
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param type the pointer Type.
+         */
+        explicit ConstantNull(Type* type);
+    };
+
+    class ConstantUndef : public Value
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param type the Type.
+         */
+        explicit ConstantUndef(Type* type);
+    };
+}
+
+#endif //!CMM_IR_CONSTANT_H
@@ -0,0 +1,77 @@
+/**
+ * Evaluation of IR operations over constant operands.  Integers wrap at their width like
+ * the target does; anything undefined in C (division by zero, INT_MIN / -1, oversized
+ * shifts, out of range float to int conversions) is left unfolded so it happens at runtime.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_IR_CONSTANT_FOLD_H
+#define CMM_IR_CONSTANT_FOLD_H
+
+// Our includes
+#include <cmm/ir/Instruction.h>
+
+// std includes
+#include <vector>
+
+namespace cmm::ir
+{
+    class Module;
+
+    /**
+     * Gets whether a value is a constant the folder understands (int, fp or null).
+     *
+     * @param value the Value.
+     * @return bool.
+     */
+    bool isFoldableConstant(const Value* value) CMM_NOEXCEPT;
+
+    /**
+     * Folds a binary operator (integer or floating point).
+     *
+     * @param module the Module to create the result in.
+     * @param opcode the EnumOpcode.
+     * @param left the left constant.
+     * @param right the right constant.
+     * @return pointer to the constant result, else nullptr if it can't be folded.
+     */
+    Value* foldBinary(Module& module, const EnumOpcode opcode, Value* left, Value* right);
+
+    /**
+     * Folds an icmp or fcmp to an i1.
+     *
+     * @param module the Module to create the result in.
+     * @param predicate the EnumCmpPredicate.
+     * @param left the left constant.
+     * @param right the right constant.
+     * @return pointer to the constant result, else nullptr if it can't be folded.
+     */
+    Value* foldCompare(Module& module, const EnumCmpPredicate predicate, Value* left, Value* right);
+
+    /**
+     * Folds a cast.
+     *
+     * @param module the Module to create the result in.
+     * @param opcode the cast EnumOpcode.
+     * @param value the constant operand.
+     * @param type the destination Type.
+     * @return pointer to the constant result, else nullptr if it can't be folded.
+     */
+    Value* foldCast(Module& module, const EnumOpcode opcode, Value* value, Type* type);
+
+    /**
+     * Folds an instruction given (possibly replaced) values for its operands.
+     *
+     * @param module the Module to create the result in.
+     * @param instruction the Instruction to fold.
+     * @param operands the operand values to fold with, in operand order.
+     * @return pointer to the constant result, else nullptr if it can't be folded.
+     */
+    Value* foldInstruction(Module& module, const Instruction& instruction, const std::vector<Value*>& operands);
+}
+
+#endif //!CMM_IR_CONSTANT_FOLD_H
@@ -0,0 +1,283 @@
+/**
+ * A generic worklist solver for bit vector dataflow problems over the CFG of a cmm IR
+ * function.  A client numbers its facts (values, allocas, definitions, ...), fills in each
+ * block's gen and kill sets and picks a direction and a meet; the solver then iterates
+ * out = gen | (in - kill) to a fixed point, visiting blocks in reverse post order (post order
+ * for backward problems) so most problems settle in a couple of passes.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_IR_DATA_FLOW_H
+#define CMM_IR_DATA_FLOW_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <unordered_map>
+#include <vector>
+
+namespace cmm::ir
+{
+    class BasicBlock;
+    class Function;
+
+    class BitVector
+    {
+    public:
+
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        /**
+         * Constructor.
+         *
+         * @param size the number of bits.
+         * @param value the initial value of every bit.
+         */
+        explicit BitVector(const std::size_t size = 0, const bool value = false);
+
+        /**
+         * Copy constructor.
+         */
+        BitVector(const BitVector&) = default;
+
+        /**
+         * Move constructor.
+         */
+        BitVector(BitVector&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~BitVector() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        BitVector& operator= (const BitVector&) = default;
+
+        /**
+         * Move assignment operator.
+         */
+        BitVector& operator= (BitVector&&) CMM_NOEXCEPT = default;
+
+        bool operator== (const BitVector& other) const CMM_NOEXCEPT;
+        bool operator!= (const BitVector& other) const CMM_NOEXCEPT;
+
+        std::size_t size() const CMM_NOEXCEPT;
+
+        /**
+         * Resizes the vector, new bits are cleared.
+         *
+         * @param size the new number of bits.
+         */
+        void resize(const std::size_t size);
+
+        bool test(const std::size_t index) const CMM_NOEXCEPT;
+        void set(const std::size_t index) CMM_NOEXCEPT;
+        void reset(const std::size_t index) CMM_NOEXCEPT;
+
+        /**
+         * Sets every bit.
+         */
+        void setAll() CMM_NOEXCEPT;
+
+        /**
+         * Clears every bit.
+         */
+        void clear() CMM_NOEXCEPT;
+
+        /**
+         * Gets whether any bit is set.
+         *
+         * @return bool.
+         */
+        bool any() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the number of set bits.
+         *
+         * @return std::size_t.
+         */
+        std::size_t count() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the first set bit at or after an index.
+         *
+         * @param index the index to start from.
+         * @return the index of the set bit, else npos.
+         */
+        std::size_t findNext(const std::size_t index) const CMM_NOEXCEPT;
+
+        /**
+         * Sets the bits set in another vector of the same size.
+         *
+         * @param other the other BitVector.
+         * @return bool true if any bit changed, else false.
+         */
+        bool unionWith(const BitVector& other) CMM_NOEXCEPT;
+
+        /**
+         * Clears the bits not set in another vector of the same size.
+         *
+         * @param other the other BitVector.
+         * @return bool true if any bit changed, else false.
+         */
+        bool intersectWith(const BitVector& other) CMM_NOEXCEPT;
+
+        /**
+         * Clears the bits set in another vector of the same size.
+         *
+         * @param other the other BitVector.
+         * @return bool true if any bit changed, else false.
+         */
+        bool subtract(const BitVector& other) CMM_NOEXCEPT;
+
+        /**
+         * Assigns gen | (in - kill), all of the same size, in a single pass.
+         *
+         * @param gen the generated bits.
+         * @param in the incoming bits.
+         * @param kill the killed bits.
+         * @return bool true if any bit changed, else false.
+         */
+        bool assignTransfer(const BitVector& gen, const BitVector& in, const BitVector& kill) CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Clears the unused bits of the last word so whole words can be compared and counted.
+         */
+        void clearUnusedBits() CMM_NOEXCEPT;
+
+    private:
+
+        // The number of bits.
+        std::size_t bits;
+
+        // The bits, 64 to a word.
+        std::vector<u64> words;
+    };
+
+    enum class EnumDataFlowDirection : u8
+    {
+        FORWARD, BACKWARD
+    };
+
+    enum class EnumDataFlowMeet : u8
+    {
+        UNION, INTERSECTION
+    };
+
+    class DataFlowSolver
+    {
+    public:
+
+        /**
+         * Constructor.  Every block starts with empty gen and kill sets, and the boundary
+         * (the value entering the entry block, or leaving the exit blocks when backward) is empty.
+         *
+         * @param function the Function (must have a body).
+         * @param bits the number of facts.
+         * @param direction the EnumDataFlowDirection.
+         * @param meet how the values of several predecessors (or successors) are combined.
+         */
+        DataFlowSolver(const Function& function, const std::size_t bits, const EnumDataFlowDirection direction, const EnumDataFlowMeet meet);
+
+        /**
+         * Copy constructor.
+         */
+        DataFlowSolver(const DataFlowSolver&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        DataFlowSolver(DataFlowSolver&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~DataFlowSolver() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        DataFlowSolver& operator= (const DataFlowSolver&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        DataFlowSolver& operator= (DataFlowSolver&&) CMM_NOEXCEPT = default;
+
+        BitVector& getGen(const BasicBlock* block);
+        BitVector& getKill(const BasicBlock* block);
+        BitVector& getBoundary() CMM_NOEXCEPT;
+
+        /**
+         * Solves the problem.  Blocks are queued in (reverse) post order and a block is only
+         * queued again when the value flowing into it changed.
+         *
+         * @return std::size_t the number of blocks visited.
+         */
+        std::size_t solve();
+
+        /**
+         * Gets the value at the top of a block (before its first instruction).
+         *
+         * @param block the BasicBlock.
+         * @return const reference to the BitVector.
+         */
+        const BitVector& getIn(const BasicBlock* block) const;
+
+        /**
+         * Gets the value at the bottom of a block (after its terminator).
+         *
+         * @param block the BasicBlock.
+         * @return const reference to the BitVector.
+         */
+        const BitVector& getOut(const BasicBlock* block) const;
+
+    private:
+
+        /**
+         * Gets the number of a block.
+         *
+         * @param block the BasicBlock.
+         * @return u32.
+         */
+        u32 indexOf(const BasicBlock* block) const;
+
+    private:
+
+        // The direction of the problem.
+        EnumDataFlowDirection direction;
+
+        // How incoming values are combined.
+        EnumDataFlowMeet meet;
+
+        // Every block, reachable ones first in reverse post order.
+        std::vector<BasicBlock*> blocks;
+
+        // The number of each block.
+        std::unordered_map<const BasicBlock*, u32> indices;
+
+        // The predecessors and successors of each block, by number.
+        std::vector<std::vector<u32>> preds;
+        std::vector<std::vector<u32>> succs;
+
+        // The per block sets, by number.
+        std::vector<BitVector> gens;
+        std::vector<BitVector> kills;
+        std::vector<BitVector> ins;
+        std::vector<BitVector> outs;
+
+        // The value entering the entry block (forward) or leaving the exit blocks (backward).
+        BitVector boundary;
+    };
+}
+
+#endif //!CMM_IR_DATA_FLOW_H
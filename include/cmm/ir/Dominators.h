@@ -0,0 +1,162 @@
+/**
+ * Dominator tree and dominance frontiers of a cmm IR function.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_IR_DOMINATORS_H
+#define CMM_IR_DOMINATORS_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <unordered_map>
+#include <vector>
+
+namespace cmm::ir
+{
+    class BasicBlock;
+    class Function;
+    class Instruction;
+
+    class DominatorTree
+    {
+    public:
+
+        /**
+         * Constructor that computes the tree for a function.
+         *
+         * @param function the Function (must have a body).
+         */
+        explicit DominatorTree(const Function& function);
+
+        /**
+         * Copy constructor.
+         */
+        DominatorTree(const DominatorTree&) = default;
+
+        /**
+         * Move constructor.
+         */
+        DominatorTree(DominatorTree&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~DominatorTree() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        DominatorTree& operator= (const DominatorTree&) = default;
+
+        /**
+         * Move assignment operator.
+         */
+        DominatorTree& operator= (DominatorTree&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Recomputes the tree after the CFG of the function changed.
+         *
+         * @param function the Function.
+         */
+        void recalculate(const Function& function);
+
+        /**
+         * Gets whether a block is reachable from the entry block.
+         *
+         * @param block the BasicBlock.
+         * @return bool.
+         */
+        bool isReachable(const BasicBlock* block) const CMM_NOEXCEPT;
+
+        /**
+         * Gets the immediate dominator of a block.
+         *
+         * @param block the BasicBlock.
+         * @return pointer to the BasicBlock, else nullptr for the entry or unreachable blocks.
+         */
+        BasicBlock* getIDom(const BasicBlock* block) const CMM_NOEXCEPT;
+
+        /**
+         * Gets the blocks immediately dominated by a block.
+         *
+         * @param block the BasicBlock.
+         * @return const reference to the std::vector of children.
+         */
+        const std::vector<BasicBlock*>& getChildren(const BasicBlock* block) const;
+
+        /**
+         * Gets whether block a dominates block b (every block dominates itself).  An unreachable
+         * block is dominated by everything.
+         *
+         * @param a the dominating BasicBlock.
+         * @param b the dominated BasicBlock.
+         * @return bool.
+         */
+        bool dominates(const BasicBlock* a, const BasicBlock* b) const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether a definition dominates a (non-phi) user.
+         *
+         * @param def the defining Instruction.
+         * @param user the using Instruction.
+         * @return bool.
+         */
+        bool dominates(const Instruction* def, const Instruction* user) const;
+
+        /**
+         * Gets the dominance frontier of a block.
+         *
+         * @param block the BasicBlock.
+         * @return const reference to the std::vector of blocks in the frontier.
+         */
+        const std::vector<BasicBlock*>& getFrontier(const BasicBlock* block) const;
+
+        /**
+         * Gets the reachable blocks in reverse post order (entry first).
+         *
+         * @return const reference to the std::vector of blocks.
+         */
+        const std::vector<BasicBlock*>& getReversePostOrder() const CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Gets the reverse post order number of a block.
+         *
+         * @param block the BasicBlock.
+         * @return the number, else npos if unreachable.
+         */
+        u32 indexOf(const BasicBlock* block) const CMM_NOEXCEPT;
+
+    private:
+
+        static constexpr u32 npos = static_cast<u32>(-1);
+
+        // The reachable blocks in reverse post order.
+        std::vector<BasicBlock*> order;
+
+        // The reverse post order number of each reachable block.
+        std::unordered_map<const BasicBlock*, u32> indices;
+
+        // The immediate dominator of each block, by reverse post order number.
+        std::vector<u32> idoms;
+
+        // The children of each block in the tree, by reverse post order number.
+        std::vector<std::vector<BasicBlock*>> children;
+
+        // The dominance frontier of each block, by reverse post order number.
+        std::vector<std::vector<BasicBlock*>> frontiers;
+
+        // Pre and post visit numbers of a walk of the tree for constant time queries.
+        std::vector<u32> enter;
+        std::vector<u32> exit;
+    };
+}
+
+#endif //!CMM_IR_DOMINATORS_H
@@ -0,0 +1,201 @@
+/**
+ * A function (and its arguments) in the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_FUNCTION_H
+#define CMM_IR_FUNCTION_H
+
+// Our includes
+#include <cmm/ir/BasicBlock.h>
+#include <cmm/ir/GlobalVariable.h>
+
+// std includes
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cmm::ir
+{
+    class Function;
+    class Module;
+
+    enum EnumArgumentAttribute : u8
+    {
+        NO_ARG_ATTRIBUTES = 0, NO_ALIAS = 1, NO_CAPTURE = 2
+    };
+
+    enum EnumFunctionAttribute : u8
+    {
+        NO_FUNCTION_ATTRIBUTES = 0, READ_NONE = 1, READ_ONLY = 2, NO_UNWIND = 4, WILL_RETURN = 8
+    };
+
+    class Argument : public Value
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param type the Type of the argument.
+         * @param parent the owning Function.
+         * @param index the position of the argument.
+         * @param name the optional name.
+         */
+        Argument(Type* type, Function* parent, const u32 index, std::string name = "");
+
+        Function* getParent() const CMM_NOEXCEPT;
+        u32 getIndex() const CMM_NOEXCEPT;
+
+        u8 getAttributes() const CMM_NOEXCEPT;
+        bool hasAttribute(const EnumArgumentAttribute attribute) const CMM_NOEXCEPT;
+        void setAttribute(const EnumArgumentAttribute attribute, const bool enable = true) CMM_NOEXCEPT;
+
+    private:
+
+        // The owning function.
+        Function* parent;
+
+        // The position of the argument.
+        u32 index;
+
+        // The EnumArgumentAttribute bit set.
+        u8 attributes;
+    };
+
+    class Function : public Value
+    {
+    public:
+
+        using BlockList = BasicBlock::BlockList;
+
+        /**
+         * Constructor.  The value of a function is its address, so its type is a
+         * pointer to the function type.
+         *
+         * @param functionType the function Type.
+         * @param name the name of the function.
+         * @param parent the owning Module.
+         */
+        Function(Type* functionType, const std::string& name, Module* parent);
+
+        /**
+         * Destructor.
+         */
+        virtual ~Function();
+
+        Module* getParent() const CMM_NOEXCEPT;
+        Type* getFunctionType() const CMM_NOEXCEPT;
+        Type* getReturnType() const CMM_NOEXCEPT;
+
+        EnumLinkage getLinkage() const CMM_NOEXCEPT;
+        void setLinkage(const EnumLinkage linkage) CMM_NOEXCEPT;
+
+        u8 getAttributes() const CMM_NOEXCEPT;
+        bool hasAttribute(const EnumFunctionAttribute attribute) const CMM_NOEXCEPT;
+        void setAttribute(const EnumFunctionAttribute attribute, const bool enable = true) CMM_NOEXCEPT;
+
+        /**
+         * Gets whether a call to this function can't change memory the caller can see
+         * (readnone or readonly).
+         *
+         * @return bool.
+         */
+        bool onlyReadsMemory() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether a call to this function can be removed when its result is unused,
+         * i.e. it doesn't write memory, can't unwind and always returns.
+         *
+         * @return bool.
+         */
+        bool isSideEffectFree() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether this function only has a prototype (no body).
+         *
+         * @return bool.
+         */
+        bool isDeclaration() const CMM_NOEXCEPT;
+
+        std::size_t argSize() const CMM_NOEXCEPT;
+        Argument* getArg(const std::size_t index) const CMM_NOEXCEPT;
+
+        bool empty() const CMM_NOEXCEPT;
+        std::size_t size() const CMM_NOEXCEPT;
+
+        BlockList::iterator begin() CMM_NOEXCEPT;
+        BlockList::iterator end() CMM_NOEXCEPT;
+        BlockList::const_iterator begin() const CMM_NOEXCEPT;
+        BlockList::const_iterator end() const CMM_NOEXCEPT;
+
+        BasicBlock* getEntryBlock() const CMM_NOEXCEPT;
+
+        /**
+         * Creates a new block at the end of this function.
+         *
+         * @param name the optional name of the block.
+         * @return pointer to the BasicBlock.
+         */
+        BasicBlock* createBlock(const std::string& name = "");
+
+        /**
+         * Inserts a block after another block (or at the end when position is nullptr).
+         *
+         * @param position the BasicBlock to insert after.
+         * @param block the BasicBlock to take ownership of.
+         * @return pointer to the BasicBlock.
+         */
+        BasicBlock* insertBlockAfter(BasicBlock* position, std::unique_ptr<BasicBlock>&& block);
+
+        /**
+         * Unlinks a block from this function and returns ownership.
+         *
+         * @param block the BasicBlock to remove.
+         * @return std::unique_ptr to the BasicBlock.
+         */
+        std::unique_ptr<BasicBlock> remove(BasicBlock* block);
+
+        /**
+         * Moves a block to just after another block of this function.
+         *
+         * @param block the BasicBlock to move.
+         * @param position the BasicBlock to move it after.
+         */
+        void moveBlockAfter(BasicBlock* block, BasicBlock* position);
+
+        /**
+         * Gets the number of instructions across all blocks.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getInstructionCount() const CMM_NOEXCEPT;
+
+    private:
+
+        // The owning module.
+        Module* parent;
+
+        // The function type.
+        Type* functionType;
+
+        // The linkage.
+        EnumLinkage linkage;
+
+        // The EnumFunctionAttribute bit set.
+        u8 attributes;
+
+        // The arguments.
+        std::vector<std::unique_ptr<Argument>> args;
+
+        // The blocks (entry first).
+        BlockList blocks;
+    };
+}
+
+#endif //!CMM_IR_FUNCTION_H
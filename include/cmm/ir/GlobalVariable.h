@@ -0,0 +1,89 @@
+/**
+ * A module level variable in the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_GLOBAL_VARIABLE_H
+#define CMM_IR_GLOBAL_VARIABLE_H
+
+// Our includes
+#include <cmm/ir/Value.h>
+
+// std includes
+#include <optional>
+#include <string>
+
+namespace cmm::ir
+{
+    enum class EnumLinkage : u8
+    {
+        EXTERNAL = 0, INTERNAL, PRIVATE
+    };
+
+    const char* toString(const EnumLinkage linkage) CMM_NOEXCEPT;
+
+    class GlobalVariable : public Value
+    {
+    public:
+
+        /**
+         * Constructor.  The value of a GlobalVariable is its address, so its type
+         * is a pointer to the value type.
+         *
+         * @param valueType the Type of the stored value.
+         * @param name the name of the global.
+         * @param linkage the EnumLinkage.
+         * @param constant whether the global is read only.
+         */
+        GlobalVariable(Type* valueType, const std::string& name, const EnumLinkage linkage, const bool constant);
+
+        Type* getValueType() const CMM_NOEXCEPT;
+        EnumLinkage getLinkage() const CMM_NOEXCEPT;
+        bool isConstantGlobal() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the string initializer (without the null terminator) for c-string globals.
+         *
+         * @return const reference to the optional std::string.
+         */
+        const std::optional<std::string>& getStringInitializer() const CMM_NOEXCEPT;
+
+        /**
+         * Sets the string initializer.
+         *
+         * @param str the string without the null terminator.
+         */
+        void setStringInitializer(const std::string& str);
+
+        /**
+         * Gets the explicit alignment of the global (0 for the natural alignment).
+         *
+         * @return u32 alignment in bytes.
+         */
+        u32 getAlignment() const CMM_NOEXCEPT;
+        void setAlignment(const u32 alignment) CMM_NOEXCEPT;
+
+    private:
+
+        // The type of the stored value.
+        Type* valueType;
+
+        // The linkage.
+        EnumLinkage linkage;
+
+        // Whether the global is read only.
+        bool constant;
+
+        // The string initializer for c-strings, otherwise zero initialized.
+        std::optional<std::string> stringInitializer;
+
+        // The explicit alignment, 0 for the natural alignment.
+        u32 alignment;
+    };
+}
+
+#endif //!CMM_IR_GLOBAL_VARIABLE_H
@@ -0,0 +1,138 @@
+/**
+ * A helper for creating and inserting IR instructions.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_IR_BUILDER_H
+#define CMM_IR_IR_BUILDER_H
+
+// Our includes
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <string>
+#include <vector>
+
+namespace cmm::ir
+{
+    class IRBuilder
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param module the Module to create instructions in.
+         */
+        explicit IRBuilder(Module& module) CMM_NOEXCEPT;
+
+        /**
+         * Deleted copy constructor.
+         */
+        IRBuilder(const IRBuilder&) = delete;
+
+        /**
+         * Default move constructor.
+         */
+        IRBuilder(IRBuilder&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~IRBuilder() = default;
+
+        /**
+         * Deleted copy assignment operator.
+         */
+        IRBuilder& operator= (const IRBuilder&) = delete;
+
+        /**
+         * Deleted move assignment operator.
+         */
+        IRBuilder& operator= (IRBuilder&&) CMM_NOEXCEPT = delete;
+
+        Module& getModule() CMM_NOEXCEPT;
+        TypeContext& getTypes() CMM_NOEXCEPT;
+
+        /**
+         * Sets the insertion point to the end of a block.
+         *
+         * @param block the BasicBlock.
+         */
+        void setInsertPoint(BasicBlock* block) CMM_NOEXCEPT;
+
+        /**
+         * Sets the insertion point to just before an instruction.
+         *
+         * @param instruction the Instruction.
+         */
+        void setInsertPoint(Instruction* instruction) CMM_NOEXCEPT;
+
+        BasicBlock* getInsertBlock() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether the current block already ends in a terminator.
+         *
+         * @return bool.
+         */
+        bool isTerminated() const CMM_NOEXCEPT;
+
+        /**
+         * Inserts an already created instruction at the insertion point.
+         *
+         * @param instruction the Instruction to take ownership of.
+         * @return pointer to the Instruction.
+         */
+        Instruction* insert(std::unique_ptr<Instruction>&& instruction);
+
+        Instruction* createAlloca(Type* type, const std::string& name = "");
+        Instruction* createLoad(Value* pointer, const std::string& name = "");
+        Instruction* createStore(Value* value, Value* pointer);
+        Instruction* createGEP(Type* sourceType, Value* pointer, const std::vector<Value*>& indices, const std::string& name = "");
+
+        /**
+         * Creates the address of a field of the struct pointed to by pointer.
+         *
+         * @param pointer the pointer to the struct.
+         * @param fieldIndex the index of the field.
+         * @param name the optional name of the result.
+         * @return pointer to the Instruction.
+         */
+        Instruction* createStructGEP(Value* pointer, const u32 fieldIndex, const std::string& name = "");
+
+        Instruction* createBinary(const EnumOpcode opcode, Value* left, Value* right, const std::string& name = "");
+        Instruction* createFNeg(Value* value, const std::string& name = "");
+        Instruction* createICmp(const EnumCmpPredicate predicate, Value* left, Value* right, const std::string& name = "");
+        Instruction* createFCmp(const EnumCmpPredicate predicate, Value* left, Value* right, const std::string& name = "");
+        Instruction* createCast(const EnumOpcode opcode, Value* value, Type* type, const std::string& name = "");
+        Instruction* createSelect(Value* cond, Value* trueValue, Value* falseValue, const std::string& name = "");
+        Instruction* createPhi(Type* type, const std::string& name = "");
+        Instruction* createCall(Function* function, const std::vector<Value*>& args, const std::string& name = "");
+        Instruction* createExtractElement(Value* vector, Value* index, const std::string& name = "");
+        Instruction* createInsertElement(Value* vector, Value* value, Value* index, const std::string& name = "");
+
+        Instruction* createBr(BasicBlock* dest);
+        Instruction* createCondBr(Value* cond, BasicBlock* trueDest, BasicBlock* falseDest);
+        Instruction* createSwitch(Value* cond, BasicBlock* defaultDest);
+        Instruction* createRet(Value* value);
+        Instruction* createRetVoid();
+        Instruction* createUnreachable();
+
+    private:
+
+        // The module being built.
+        Module& module;
+
+        // The block to insert into.
+        BasicBlock* block;
+
+        // The instruction to insert before (nullptr for the end of the block).
+        Instruction* before;
+    };
+}
+
+#endif //!CMM_IR_IR_BUILDER_H
@@ -0,0 +1,318 @@
+/**
+ * An instruction in the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_INSTRUCTION_H
+#define CMM_IR_INSTRUCTION_H
+
+// Our includes
+#include <cmm/ir/Value.h>
+
+// std includes
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cmm::ir
+{
+    class BasicBlock;
+    class Function;
+
+    enum class EnumOpcode : u8
+    {
+        // Terminators
+        RET = 0, BR, COND_BR, SWITCH, UNREACHABLE,
+
+        // Integer binary operators
+        ADD, SUB, MUL, SDIV, UDIV, SREM, UREM, SHL, LSHR, ASHR, AND, OR, XOR,
+
+        // Floating point operators
+        FADD, FSUB, FMUL, FDIV, FREM, FNEG,
+
+        // Memory
+        ALLOCA, LOAD, STORE, GET_ELEMENT_PTR,
+
+        // Casts
+        TRUNC, ZEXT, SEXT, FP_TRUNC, FP_EXT, FP_TO_SI, FP_TO_UI, SI_TO_FP, UI_TO_FP,
+        PTR_TO_INT, INT_TO_PTR, BITCAST,
+
+        // Everything else
+        ICMP, FCMP, PHI, SELECT, CALL,
+
+        // Vector lanes
+        EXTRACT_ELEMENT, INSERT_ELEMENT, COUNT
+    };
+
+    /**
+     * Gets the textual (LLVM style) mnemonic of an opcode.
+     *
+     * @param opcode the EnumOpcode.
+     * @return C-style string.
+     */
+    const char* toString(const EnumOpcode opcode) CMM_NOEXCEPT;
+
+    enum class EnumCmpPredicate : u8
+    {
+        // Integer predicates
+        EQ = 0, NE, SGT, SGE, SLT, SLE, UGT, UGE, ULT, ULE,
+
+        // Floating point predicates (ordered, except UNE which is true for NaNs as C's != requires).
+        OEQ, ONE, OGT, OGE, OLT, OLE, UNE
+    };
+
+    const char* toString(const EnumCmpPredicate predicate) CMM_NOEXCEPT;
+
+    /**
+     * Gets the predicate that holds when the operands are swapped (ex. SLT -> SGT).
+     *
+     * @param predicate the EnumCmpPredicate.
+     * @return EnumCmpPredicate.
+     */
+    EnumCmpPredicate getSwappedPredicate(const EnumCmpPredicate predicate) CMM_NOEXCEPT;
+
+    /**
+     * Gets the predicate that holds exactly when this one does not (ex. SLT -> SGE).
+     * Note: the inverse of an ordered floating point predicate is unordered and
+     * therefore not representable; std::nullopt is returned for those.
+     *
+     * @param predicate the EnumCmpPredicate.
+     * @return optional EnumCmpPredicate.
+     */
+    std::optional<EnumCmpPredicate> getInversePredicate(const EnumCmpPredicate predicate) CMM_NOEXCEPT;
+
+    enum EnumInstructionFlag : u8
+    {
+        NO_FLAGS = 0, NSW = 1, NUW = 2, EXACT = 4, INBOUNDS = 8, TAIL = 16, MUST_TAIL = 32
+    };
+
+    class Instruction : public Value
+    {
+    public:
+
+        using InstructionList = std::list<std::unique_ptr<Instruction>>;
+
+        /**
+         * Constructor.
+         *
+         * @param opcode the EnumOpcode.
+         * @param type the result Type (void for instructions without a result).
+         * @param operands the operands.
+         * @param name the optional name of the result.
+         */
+        Instruction(const EnumOpcode opcode, Type* type, const std::vector<Value*>& operands = {}, std::string name = "");
+
+        /**
+         * Destructor.  Drops this instruction from the use lists of its operands.
+         */
+        virtual ~Instruction();
+
+        EnumOpcode getOpcode() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the basic block containing this instruction.
+         *
+         * @return pointer to the BasicBlock, else nullptr if not inserted.
+         */
+        BasicBlock* getParent() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the function containing this instruction.
+         *
+         * @return pointer to the Function, else nullptr if not inserted.
+         */
+        Function* getFunction() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the instruction following this one in its block.
+         *
+         * @return pointer to the next Instruction, else nullptr if this is the last one or not inserted.
+         */
+        Instruction* getNextInstruction() const CMM_NOEXCEPT;
+
+        std::size_t getNumOperands() const CMM_NOEXCEPT;
+        Value* getOperand(const std::size_t index) const CMM_NOEXCEPT;
+        const std::vector<Value*>& getOperands() const CMM_NOEXCEPT;
+        void setOperand(const std::size_t index, Value* value);
+        void addOperand(Value* value);
+
+        /**
+         * Removes an operand, shifting the operands after it down by one.
+         *
+         * @param index the index of the operand to remove.
+         */
+        void removeOperand(const std::size_t index);
+
+        /**
+         * Replaces every occurrence of one operand with another.
+         *
+         * @param from the Value to replace.
+         * @param to the replacement Value.
+         */
+        void replaceUsesOfWith(Value* from, Value* to);
+
+        /**
+         * Drops all operands (and this instruction from their use lists).
+         */
+        void dropAllReferences();
+
+        EnumCmpPredicate getPredicate() const CMM_NOEXCEPT;
+        void setPredicate(const EnumCmpPredicate predicate) CMM_NOEXCEPT;
+
+        u8 getFlags() const CMM_NOEXCEPT;
+        bool hasFlag(const EnumInstructionFlag flag) const CMM_NOEXCEPT;
+        void setFlag(const EnumInstructionFlag flag, const bool enable = true) CMM_NOEXCEPT;
+
+        /**
+         * Gets the allocated type of an ALLOCA, or the source element type of a GET_ELEMENT_PTR.
+         *
+         * @return pointer to the Type.
+         */
+        Type* getAuxType() const CMM_NOEXCEPT;
+        void setAuxType(Type* type) CMM_NOEXCEPT;
+
+        /**
+         * Gets the explicit alignment of a memory instruction (0 for the natural alignment).
+         *
+         * @return u32 alignment in bytes.
+         */
+        u32 getAlignment() const CMM_NOEXCEPT;
+        void setAlignment(const u32 alignment) CMM_NOEXCEPT;
+
+        bool isTerminator() const CMM_NOEXCEPT;
+        bool isBinaryOp() const CMM_NOEXCEPT;
+        bool isCast() const CMM_NOEXCEPT;
+        bool isCommutative() const CMM_NOEXCEPT;
+        bool isCompare() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether the instruction may read memory.
+         *
+         * @return bool.
+         */
+        bool mayReadMemory() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether the instruction may write memory.
+         *
+         * @return bool.
+         */
+        bool mayWriteMemory() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether removing this instruction could change the program's behavior
+         * even when its result is unused (stores, calls not known to be side effect free,
+         * terminators, trapping division).
+         *
+         * @return bool.
+         */
+        bool mayHaveSideEffects() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the called function of a CALL instruction.
+         *
+         * @return pointer to the Function.
+         */
+        Function* getCalledFunction() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the successor blocks of a terminator.
+         *
+         * @return std::vector of BasicBlock pointers.
+         */
+        std::vector<BasicBlock*> getSuccessors() const;
+
+        /**
+         * Replaces a successor block of a terminator.
+         *
+         * @param from the old successor.
+         * @param to the new successor.
+         */
+        void replaceSuccessor(BasicBlock* from, BasicBlock* to);
+
+        // PHI helpers:
+        std::size_t getNumIncoming() const CMM_NOEXCEPT;
+        Value* getIncomingValue(const std::size_t index) const CMM_NOEXCEPT;
+        BasicBlock* getIncomingBlock(const std::size_t index) const CMM_NOEXCEPT;
+        void setIncomingValue(const std::size_t index, Value* value);
+        void addIncoming(Value* value, BasicBlock* block);
+        void removeIncoming(const std::size_t index);
+
+        /**
+         * Gets the incoming value of a PHI for the given predecessor.
+         *
+         * @param block the predecessor BasicBlock.
+         * @return pointer to the Value, else nullptr.
+         */
+        Value* getIncomingValueForBlock(const BasicBlock* block) const CMM_NOEXCEPT;
+
+        // SWITCH helpers:
+        BasicBlock* getDefaultDest() const CMM_NOEXCEPT;
+        std::size_t getNumCases() const CMM_NOEXCEPT;
+        Value* getCaseValue(const std::size_t index) const CMM_NOEXCEPT;
+        BasicBlock* getCaseDest(const std::size_t index) const CMM_NOEXCEPT;
+        void addCase(Value* value, BasicBlock* block);
+
+        /**
+         * Unlinks this instruction from its block and destroys it.
+         */
+        void eraseFromParent();
+
+        /**
+         * Unlinks this instruction from its block and returns ownership.
+         *
+         * @return std::unique_ptr to this instruction.
+         */
+        std::unique_ptr<Instruction> removeFromParent();
+
+        /**
+         * Moves this instruction to just before another instruction (possibly in another block).
+         *
+         * @param position the Instruction to insert before.
+         */
+        void moveBefore(Instruction* position);
+
+        /**
+         * Creates a copy of this instruction (with the same operands, but no parent and no uses).
+         *
+         * @return std::unique_ptr to the new Instruction.
+         */
+        std::unique_ptr<Instruction> clone() const;
+
+    private:
+
+        friend class BasicBlock;
+
+        // The opcode.
+        EnumOpcode opcode;
+
+        // The containing block.
+        BasicBlock* parent;
+
+        // The position of this instruction in its parent's list.
+        InstructionList::iterator position;
+
+        // The operands.
+        std::vector<Value*> operands;
+
+        // The predicate for ICMP/FCMP.
+        EnumCmpPredicate predicate;
+
+        // The EnumInstructionFlag bit set.
+        u8 flags;
+
+        // Alignment in bytes (0 for natural).
+        u32 alignment;
+
+        // The allocated type of an ALLOCA or the source element type of a GET_ELEMENT_PTR.
+        Type* auxType;
+    };
+}
+
+#endif //!CMM_IR_INSTRUCTION_H
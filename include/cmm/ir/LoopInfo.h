@@ -0,0 +1,234 @@
+/**
+ * Natural loops of a cmm IR function: every back edge (an edge to a block dominating its
+ * source) defines a loop made of the blocks that reach the edge without passing through
+ * its header.  Loops sharing a header are merged, and nested loops are linked to the
+ * innermost loop containing them.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_IR_LOOP_INFO_H
+#define CMM_IR_LOOP_INFO_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace cmm::ir
+{
+    class BasicBlock;
+    class DominatorTree;
+    class Instruction;
+    class Value;
+
+    class Loop
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param header the header BasicBlock.
+         */
+        explicit Loop(BasicBlock* header);
+
+        /**
+         * Copy constructor.
+         */
+        Loop(const Loop&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        Loop(Loop&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~Loop() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        Loop& operator= (const Loop&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        Loop& operator= (Loop&&) CMM_NOEXCEPT = default;
+
+        BasicBlock* getHeader() const CMM_NOEXCEPT;
+        Loop* getParentLoop() const CMM_NOEXCEPT;
+        const std::vector<Loop*>& getSubLoops() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the nesting depth of the loop (1 for an outermost loop).
+         *
+         * @return u32.
+         */
+        u32 getDepth() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the blocks of the loop (nested loops included) in reverse post order,
+         * the header first.
+         *
+         * @return const reference to the BasicBlocks.
+         */
+        const std::vector<BasicBlock*>& getBlocks() const CMM_NOEXCEPT;
+
+        bool contains(const BasicBlock* block) const;
+        bool contains(const Instruction* instruction) const;
+        bool contains(const Loop* loop) const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether a value is computed outside of the loop (or isn't an instruction).
+         *
+         * @param value the Value.
+         * @return bool.
+         */
+        bool isLoopInvariant(const Value* value) const;
+
+        /**
+         * Gets the blocks in the loop branching back to the header.
+         *
+         * @return std::vector of BasicBlocks.
+         */
+        std::vector<BasicBlock*> getLatches() const;
+
+        /**
+         * Gets the only block branching back to the header.
+         *
+         * @return pointer to the BasicBlock, else nullptr if there are several.
+         */
+        BasicBlock* getLatch() const;
+
+        /**
+         * Gets the block outside of the loop that is the header's only other predecessor
+         * and only branches to the header (where invariant code can be placed).
+         *
+         * @return pointer to the BasicBlock, else nullptr if there is none.
+         */
+        BasicBlock* getPreheader() const;
+
+        /**
+         * Gets the blocks outside of the loop that are branched to from inside it.
+         *
+         * @return std::vector of BasicBlocks.
+         */
+        std::vector<BasicBlock*> getExitBlocks() const;
+
+    private:
+
+        friend class LoopInfo;
+
+        // The header (the target of the back edges).
+        BasicBlock* header;
+
+        // The innermost loop containing this one.
+        Loop* parent;
+
+        // The loops directly nested in this one.
+        std::vector<Loop*> subLoops;
+
+        // The blocks in reverse post order.
+        std::vector<BasicBlock*> blocks;
+
+        // The blocks for fast lookups.
+        std::unordered_set<const BasicBlock*> blockSet;
+    };
+
+    class LoopInfo
+    {
+    public:
+
+        /**
+         * Constructor that finds the loops of a function.
+         *
+         * @param dominators the up to date DominatorTree of the function.
+         */
+        explicit LoopInfo(const DominatorTree& dominators);
+
+        /**
+         * Copy constructor.
+         */
+        LoopInfo(const LoopInfo&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        LoopInfo(LoopInfo&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~LoopInfo() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        LoopInfo& operator= (const LoopInfo&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        LoopInfo& operator= (LoopInfo&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Finds the loops again after the CFG changed.
+         *
+         * @param dominators the up to date DominatorTree of the function.
+         */
+        void recalculate(const DominatorTree& dominators);
+
+        bool empty() const CMM_NOEXCEPT;
+        std::size_t size() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the innermost loop containing a block.
+         *
+         * @param block the BasicBlock.
+         * @return pointer to the Loop, else nullptr if the block isn't in a loop.
+         */
+        Loop* getLoopFor(const BasicBlock* block) const;
+
+        const std::vector<Loop*>& getTopLevelLoops() const CMM_NOEXCEPT;
+
+        /**
+         * Gets every loop, nested loops before the loops containing them.
+         *
+         * @return std::vector of Loops.
+         */
+        std::vector<Loop*> getLoopsInnermostFirst() const;
+
+        /**
+         * Gets the preheader of a loop, creating one (and adding it to the enclosing loops)
+         * when the loop doesn't have one.  Note: the DominatorTree is not updated.
+         *
+         * @param loop the Loop.
+         * @return pointer to the BasicBlock, else nullptr if the header has no predecessor
+         *         outside of the loop (i.e. it is the entry block).
+         */
+        BasicBlock* insertPreheader(Loop* loop);
+
+    private:
+
+        // Every loop.
+        std::vector<std::unique_ptr<Loop>> loops;
+
+        // The outermost loops.
+        std::vector<Loop*> topLevelLoops;
+
+        // The innermost loop of each block in a loop.
+        std::unordered_map<const BasicBlock*, Loop*> loopOfBlock;
+    };
+}
+
+#endif //!CMM_IR_LOOP_INFO_H
@@ -0,0 +1,174 @@
+/**
+ * A module (i.e. the IR of one translation unit) in the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_MODULE_H
+#define CMM_IR_MODULE_H
+
+// Our includes
+#include <cmm/ir/Constant.h>
+#include <cmm/ir/Function.h>
+#include <cmm/ir/GlobalVariable.h>
+#include <cmm/ir/Type.h>
+
+// std includes
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cmm::ir
+{
+    class Module
+    {
+    public:
+
+        using FunctionList = std::list<std::unique_ptr<Function>>;
+        using GlobalList = std::vector<std::unique_ptr<GlobalVariable>>;
+
+        /**
+         * Constructor.
+         *
+         * @param name the name of the module.
+         */
+        explicit Module(const std::string& name = "");
+
+        /**
+         * Deleted copy constructor.
+         */
+        Module(const Module&) = delete;
+
+        /**
+         * Deleted move constructor.
+         */
+        Module(Module&&) CMM_NOEXCEPT = delete;
+
+        /**
+         * Destructor.
+         */
+        ~Module();
+
+        /**
+         * Deleted copy assignment operator.
+         */
+        Module& operator= (const Module&) = delete;
+
+        /**
+         * Deleted move assignment operator.
+         */
+        Module& operator= (Module&&) CMM_NOEXCEPT = delete;
+
+        const std::string& getName() const CMM_NOEXCEPT;
+        TypeContext& getTypes() CMM_NOEXCEPT;
+        const TypeContext& getTypes() const CMM_NOEXCEPT;
+
+        FunctionList& getFunctions() CMM_NOEXCEPT;
+        const FunctionList& getFunctions() const CMM_NOEXCEPT;
+        const GlobalList& getGlobals() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the named function, creating a declaration with the given type if it does not yet exist.
+         *
+         * @param name the name of the function.
+         * @param functionType the function Type.
+         * @return pointer to the Function.
+         */
+        Function* getOrInsertFunction(const std::string& name, Type* functionType);
+
+        /**
+         * Finds a function by name.
+         *
+         * @param name the name of the function.
+         * @return pointer to the Function, else nullptr.
+         */
+        Function* getFunction(const std::string& name) const;
+
+        /**
+         * Removes and destroys a function.  The function must not have any remaining uses.
+         *
+         * @param function the Function to erase.
+         */
+        void eraseFunction(Function* function);
+
+        /**
+         * Creates a new global variable.
+         *
+         * @param valueType the Type of the stored value.
+         * @param name the name of the global.
+         * @param linkage the EnumLinkage.
+         * @param constant whether the global is read only.
+         * @return pointer to the GlobalVariable.
+         */
+        GlobalVariable* createGlobal(Type* valueType, const std::string& name, const EnumLinkage linkage, const bool constant);
+
+        /**
+         * Finds a global variable by name.
+         *
+         * @param name the name of the global.
+         * @return pointer to the GlobalVariable, else nullptr.
+         */
+        GlobalVariable* getGlobal(const std::string& name) const;
+
+        /**
+         * Gets the private constant global holding a c-string, creating it on first use.
+         *
+         * @param str the string without the null terminator.
+         * @return pointer to the GlobalVariable.
+         */
+        GlobalVariable* getOrCreateCString(const std::string& str);
+
+        ConstantInt* getConstantInt(Type* type, const s64 value);
+        ConstantInt* getTrue();
+        ConstantInt* getFalse();
+        ConstantFP* getConstantFP(Type* type, const f64 value);
+        ConstantNull* getNull(Type* type);
+        ConstantUndef* getUndef(Type* type);
+
+        /**
+         * Gets the zero value of a single value type (0, 0.0 or null).
+         *
+         * @param type the Type.
+         * @return pointer to the Value.
+         */
+        Value* getZero(Type* type);
+
+        /**
+         * Gets the number of instructions across all functions.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getInstructionCount() const CMM_NOEXCEPT;
+
+    private:
+
+        // The name of the module.
+        std::string name;
+
+        // The uniqued types.
+        TypeContext types;
+
+        // Uniqued constants.
+        std::map<std::pair<Type*, s64>, std::unique_ptr<ConstantInt>> intConstants;
+        std::map<std::pair<Type*, u64>, std::unique_ptr<ConstantFP>> fpConstants;
+        std::unordered_map<Type*, std::unique_ptr<ConstantNull>> nullConstants;
+        std::unordered_map<Type*, std::unique_ptr<ConstantUndef>> undefConstants;
+
+        // The global variables (in creation order) and c-string lookup.
+        GlobalList globals;
+        std::unordered_map<std::string, GlobalVariable*> globalMap;
+        std::unordered_map<std::string, GlobalVariable*> cstringMap;
+
+        // The functions (in creation order) and lookup.
+        FunctionList functions;
+        std::unordered_map<std::string, Function*> functionMap;
+    };
+}
+
+#endif //!CMM_IR_MODULE_H
@@ -0,0 +1,118 @@
+/**
+ * Pretty-printer for the cmm IR.  The textual form intentionally follows LLVM's
+ * assembly syntax (typed pointers), so a printed module can be fed to llvm-as.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_PRINTER_H
+#define CMM_IR_PRINTER_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <iosfwd>
+#include <string>
+
+namespace cmm::ir
+{
+    class BasicBlock;
+    class Function;
+    class GlobalVariable;
+    class Instruction;
+    class Module;
+    class SlotTracker;
+    class Type;
+
+    class Printer
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param os the stream to print to.
+         * @param annotate whether to add comments (ex. block predecessors) to the output.
+         */
+        explicit Printer(std::ostream& os, const bool annotate = true) CMM_NOEXCEPT;
+
+        void print(const Module& module);
+        void print(const Function& function);
+
+        /**
+         * Prints the body of a named struct type (ex. "%struct.A = type { i32 }").
+         *
+         * @param type the struct Type.
+         */
+        void printStructType(const Type& type);
+
+        void printGlobal(const GlobalVariable& global);
+
+        /**
+         * Prints "declare" or "define" followed by the signature of a function.
+         *
+         * @param function the Function.
+         * @param slots the SlotTracker numbering the function.
+         */
+        void printFunctionHeader(const Function& function, SlotTracker& slots);
+
+        void printBlockLabel(const BasicBlock& block, SlotTracker& slots);
+
+        /**
+         * Prints a single instruction (without indentation or a trailing newline).
+         *
+         * @param instruction the Instruction.
+         * @param slots the SlotTracker numbering the containing function.
+         */
+        void printInstruction(const Instruction& instruction, SlotTracker& slots);
+
+        /**
+         * Escapes a string for use in a c"..." initializer.
+         *
+         * @param str the raw string.
+         * @return std::string.
+         */
+        static std::string escapeCString(const std::string& str);
+
+    private:
+
+        /**
+         * Prints a typed operand (ex. "i32 %t_0").
+         *
+         * @param index the operand index.
+         * @param instruction the Instruction.
+         * @param slots the SlotTracker.
+         */
+        void printTypedOperand(const std::size_t index, const Instruction& instruction, SlotTracker& slots);
+
+    private:
+
+        // The output stream.
+        std::ostream& os;
+
+        // Whether to print comments.
+        bool annotate;
+    };
+
+    /**
+     * Prints a module to a string.
+     *
+     * @param module the Module.
+     * @return std::string.
+     */
+    std::string toString(const Module& module);
+
+    /**
+     * Prints a function to a string.
+     *
+     * @param function the Function.
+     * @return std::string.
+     */
+    std::string toString(const Function& function);
+}
+
+#endif //!CMM_IR_PRINTER_H
@@ -0,0 +1,93 @@
+/**
+ * Assigns unique printable names to the values of a function.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_SLOT_TRACKER_H
+#define CMM_IR_SLOT_TRACKER_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace cmm::ir
+{
+    class Function;
+    class Value;
+
+    class SlotTracker
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        SlotTracker() = default;
+
+        /**
+         * Names every argument, block and instruction of a function.  Named values
+         * keep their name (made unique with a ".N" suffix), unnamed temporaries become
+         * "t_N", unnamed blocks "l_N" and unnamed arguments "p_N".
+         *
+         * @param function the Function to number.
+         */
+        void incorporate(const Function& function);
+
+        /**
+         * Gets the local name (without the '%' sigil) of a value.
+         *
+         * @param value the Value.
+         * @return const reference to std::string.
+         */
+        const std::string& getName(const Value* value);
+
+        /**
+         * Formats a value as an operand (ex. "%t_3", "@main", "42", "null").
+         *
+         * @param value the Value.
+         * @return std::string.
+         */
+        std::string formatOperand(const Value* value);
+
+        /**
+         * Formats a floating point constant as LLVM's exact hexadecimal form.
+         *
+         * @param value the value (already rounded to the constant's type).
+         * @return std::string.
+         */
+        static std::string formatFloatingPoint(const f64 value);
+
+    private:
+
+        /**
+         * Assigns a unique name to a value.
+         *
+         * @param value the Value.
+         * @param base the requested name.
+         */
+        void assign(const Value* value, const std::string& base);
+
+    private:
+
+        // The assigned names.
+        std::unordered_map<const Value*, std::string> names;
+
+        // Names already taken in the current function.
+        std::unordered_set<std::string> taken;
+
+        // Counters for generated names.
+        std::size_t tempCounter = 0;
+        std::size_t labelCounter = 0;
+        std::size_t paramCounter = 0;
+    };
+}
+
+#endif //!CMM_IR_SLOT_TRACKER_H
@@ -0,0 +1,312 @@
+/**
+ * Types used by the cmm mid-level IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_TYPE_H
+#define CMM_IR_TYPE_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cmm::ir
+{
+    enum class EnumTypeKind : u8
+    {
+        VOID = 0, LABEL, INT, FLOAT, DOUBLE, POINTER, STRUCT, ARRAY, VECTOR, FUNCTION
+    };
+
+    class TypeContext;
+
+    /**
+     * An IR type.  Types are uniqued by their owning TypeContext, so two types
+     * are the same if and only if their pointers compare equal.
+     */
+    class Type
+    {
+    private:
+
+        /**
+         * Constructor used by the TypeContext.
+         *
+         * @param kind the EnumTypeKind of this type.
+         */
+        explicit Type(const EnumTypeKind kind) CMM_NOEXCEPT;
+
+    public:
+
+        /**
+         * Deleted copy constructor.
+         */
+        Type(const Type&) = delete;
+
+        /**
+         * Deleted move constructor.
+         */
+        Type(Type&&) CMM_NOEXCEPT = delete;
+
+        /**
+         * Default destructor.
+         */
+        ~Type() = default;
+
+        /**
+         * Deleted copy assignment operator.
+         */
+        Type& operator= (const Type&) = delete;
+
+        /**
+         * Deleted move assignment operator.
+         */
+        Type& operator= (Type&&) CMM_NOEXCEPT = delete;
+
+        EnumTypeKind getKind() const CMM_NOEXCEPT;
+
+        bool isVoid() const CMM_NOEXCEPT;
+        bool isLabel() const CMM_NOEXCEPT;
+        bool isInt() const CMM_NOEXCEPT;
+        bool isInt(const u32 bits) const CMM_NOEXCEPT;
+        bool isFloatingPoint() const CMM_NOEXCEPT;
+        bool isPointer() const CMM_NOEXCEPT;
+        bool isStruct() const CMM_NOEXCEPT;
+        bool isArray() const CMM_NOEXCEPT;
+        bool isVector() const CMM_NOEXCEPT;
+        bool isFunction() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether a value of this type can live in a register (i.e. is not
+         * void, a label, a function or an aggregate).
+         *
+         * @return bool.
+         */
+        bool isSingleValue() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the bit width of an int type.
+         *
+         * @return u32 bits (0 for non-int types).
+         */
+        u32 getBits() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the pointee type of a pointer, the element type of an array or
+         * vector, or the return type of a function.
+         *
+         * @return pointer to the Type, else nullptr.
+         */
+        Type* getElementType() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the element type of a vector, else this type (i.e. the type each lane of
+         * a value of this type has).
+         *
+         * @return pointer to the Type.
+         */
+        Type* getScalarType() CMM_NOEXCEPT;
+
+        /**
+         * Gets the number of elements in an array or vector type.
+         *
+         * @return u64 count.
+         */
+        u64 getCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the name of a struct type (without the "struct." prefix).
+         *
+         * @return const reference to std::string.
+         */
+        const std::string& getName() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the field types of a struct or the parameter types of a function.
+         *
+         * @return const reference to the std::vector of Types.
+         */
+        const std::vector<Type*>& getFields() const CMM_NOEXCEPT;
+
+        /**
+         * Sets the body of a struct type.
+         *
+         * @param fields the field types.
+         */
+        void setFields(std::vector<Type*>&& fields);
+
+        /**
+         * Gets whether this is a struct without a body (i.e. only forward declared).
+         *
+         * @return bool.
+         */
+        bool isOpaque() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the pointer type pointing to this type.
+         *
+         * @return pointer to the Type.
+         */
+        Type* getPointerTo();
+
+        /**
+         * Gets the size in bytes of this type using the natural alignment of the
+         * host (x86-64 style) data layout.
+         *
+         * @return u64 size in bytes.
+         */
+        u64 getSizeInBytes() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the natural alignment in bytes of this type.
+         *
+         * @return u64 alignment in bytes.
+         */
+        u64 getAlignment() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the textual form of this type (ex. "i32", "%struct.Vec2*").
+         *
+         * @return std::string.
+         */
+        std::string toString() const;
+
+    private:
+
+        friend class TypeContext;
+
+        // The kind of this type.
+        EnumTypeKind kind;
+
+        // Bit width for ints.
+        u32 bits;
+
+        // Element count for arrays and vectors.
+        u64 count;
+
+        // Pointee, element or return type.
+        Type* elementType;
+
+        // Cached pointer type to this type.
+        Type* pointerTo;
+
+        // The owning context (used to create pointer types on demand).
+        TypeContext* context;
+
+        // Name of a struct.
+        std::string name;
+
+        // Fields of a struct or the parameters of a function.
+        std::vector<Type*> fields;
+
+        // Whether the struct has a body.
+        bool hasBody;
+    };
+
+    class TypeContext
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        TypeContext();
+
+        /**
+         * Deleted copy constructor.
+         */
+        TypeContext(const TypeContext&) = delete;
+
+        /**
+         * Deleted move constructor.
+         */
+        TypeContext(TypeContext&&) CMM_NOEXCEPT = delete;
+
+        /**
+         * Default destructor.
+         */
+        ~TypeContext() = default;
+
+        /**
+         * Deleted copy assignment operator.
+         */
+        TypeContext& operator= (const TypeContext&) = delete;
+
+        /**
+         * Deleted move assignment operator.
+         */
+        TypeContext& operator= (TypeContext&&) CMM_NOEXCEPT = delete;
+
+        Type* getVoid() CMM_NOEXCEPT;
+        Type* getLabel() CMM_NOEXCEPT;
+        Type* getBool() CMM_NOEXCEPT;
+        Type* getInt(const u32 bits);
+        Type* getFloat() CMM_NOEXCEPT;
+        Type* getDouble() CMM_NOEXCEPT;
+        Type* getPointer(Type* pointee);
+        Type* getArray(Type* elementType, const u64 count);
+        Type* getVector(Type* elementType, const u64 count);
+        Type* getFunction(Type* returnType, const std::vector<Type*>& params);
+
+        /**
+         * Gets the named struct type, creating an opaque struct if it does not yet exist.
+         *
+         * @param name the name of the struct.
+         * @return pointer to the Type.
+         */
+        Type* getStruct(const std::string& name);
+
+        /**
+         * Finds the named struct type.
+         *
+         * @param name the name of the struct.
+         * @return pointer to the Type if found, else nullptr.
+         */
+        Type* findStruct(const std::string& name) const;
+
+        /**
+         * Gets all named struct types in the order they were created.
+         *
+         * @return const reference to the std::vector of struct Types.
+         */
+        const std::vector<Type*>& getStructs() const CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Creates and takes ownership of a new type.
+         *
+         * @param kind the EnumTypeKind.
+         * @return pointer to the Type.
+         */
+        Type* create(const EnumTypeKind kind);
+
+    private:
+
+        // Owning storage for every type.
+        std::vector<std::unique_ptr<Type>> storage;
+
+        Type* voidType;
+        Type* labelType;
+        Type* floatType;
+        Type* doubleType;
+
+        std::unordered_map<u32, Type*> intTypes;
+        std::map<std::pair<Type*, u64>, Type*> arrayTypes;
+        std::map<std::pair<Type*, u64>, Type*> vectorTypes;
+        std::map<std::pair<Type*, std::vector<Type*>>, Type*> functionTypes;
+        std::unordered_map<std::string, Type*> structTypes;
+        std::vector<Type*> structOrder;
+    };
+}
+
+#endif //!CMM_IR_TYPE_H
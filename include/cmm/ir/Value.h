@@ -0,0 +1,141 @@
+/**
+ * The base class of everything that can be used as an operand in the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_VALUE_H
+#define CMM_IR_VALUE_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <string>
+#include <vector>
+
+namespace cmm::ir
+{
+    class Instruction;
+    class Type;
+
+    enum class EnumValueKind : u8
+    {
+        ARGUMENT = 0, BASIC_BLOCK, CONSTANT_INT, CONSTANT_FP, CONSTANT_NULL, CONSTANT_UNDEF,
+        FUNCTION, GLOBAL_VARIABLE, INSTRUCTION
+    };
+
+    class Value
+    {
+    protected:
+
+        /**
+         * Constructor.
+         *
+         * @param kind the EnumValueKind of the derived class.
+         * @param type the Type of this value.
+         * @param name the optional name of this value (empty for an unnamed temporary).
+         */
+        Value(const EnumValueKind kind, Type* type, std::string name = "");
+
+    public:
+
+        /**
+         * Deleted copy constructor.
+         */
+        Value(const Value&) = delete;
+
+        /**
+         * Deleted move constructor.
+         */
+        Value(Value&&) CMM_NOEXCEPT = delete;
+
+        /**
+         * Default virtual destructor.
+         */
+        virtual ~Value() = default;
+
+        /**
+         * Deleted copy assignment operator.
+         */
+        Value& operator= (const Value&) = delete;
+
+        /**
+         * Deleted move assignment operator.
+         */
+        Value& operator= (Value&&) CMM_NOEXCEPT = delete;
+
+        EnumValueKind getKind() const CMM_NOEXCEPT;
+        Type* getType() const CMM_NOEXCEPT;
+
+        /**
+         * Sets the type of this value.  Only used by transforms that retype a value in place.
+         *
+         * @param type the new Type.
+         */
+        void setType(Type* type) CMM_NOEXCEPT;
+
+        const std::string& getName() const CMM_NOEXCEPT;
+        void setName(const std::string& name);
+        bool hasName() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether this value is a constant (int, floating point, null or undef).
+         *
+         * @return bool.
+         */
+        bool isConstant() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether uses of this value are tracked.  Constants are uniqued and
+         * shared by the whole module, so their (potentially huge) use lists are not kept.
+         *
+         * @return bool.
+         */
+        bool tracksUses() const CMM_NOEXCEPT;
+
+        /**
+         * Gets every instruction using this value.  An instruction using this value
+         * as more than one operand is listed once per operand.
+         *
+         * @return const reference to the std::vector of users.
+         */
+        const std::vector<Instruction*>& getUsers() const CMM_NOEXCEPT;
+
+        bool hasUses() const CMM_NOEXCEPT;
+        std::size_t getUseCount() const CMM_NOEXCEPT;
+
+        /**
+         * Rewrites every use of this value to use another value instead.
+         *
+         * @param other the replacement Value.
+         */
+        void replaceAllUsesWith(Value* other);
+
+    private:
+
+        friend class Instruction;
+
+        void addUser(Instruction* user);
+        void removeUser(Instruction* user) CMM_NOEXCEPT;
+
+    protected:
+
+        // The kind of the derived class.
+        EnumValueKind kind;
+
+        // The type of this value.
+        Type* type;
+
+        // The (possibly empty) name.
+        std::string name;
+
+        // The instructions using this value.
+        std::vector<Instruction*> users;
+    };
+}
+
+#endif //!CMM_IR_VALUE_H
@@ -0,0 +1,133 @@
+/**
+ * Structural and type checks for the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_VERIFIER_H
+#define CMM_IR_VERIFIER_H
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/ir/Dominators.h>
+
+// std includes
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace cmm::ir
+{
+    class BasicBlock;
+    class Function;
+    class Instruction;
+    class Module;
+    class Value;
+
+    class Verifier
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        Verifier() = default;
+
+        /**
+         * Verifies every function of a module.
+         *
+         * @param module the Module to verify.
+         * @return bool true if no errors were found, else false.
+         */
+        bool verify(const Module& module);
+
+        /**
+         * Verifies a single function.
+         *
+         * @param function the Function to verify.
+         * @return bool true if no errors were found, else false.
+         */
+        bool verify(const Function& function);
+
+        /**
+         * Gets the errors found by all prior calls to verify.
+         *
+         * @return const reference to the std::vector of error messages.
+         */
+        const std::vector<std::string>& getErrors() const CMM_NOEXCEPT;
+
+        /**
+         * Clears the recorded errors.
+         */
+        void clear() CMM_NOEXCEPT;
+
+    private:
+
+        // A (used value, user) pair.
+        using Use = std::pair<const Value*, const Instruction*>;
+
+        struct UseHash
+        {
+            std::size_t operator() (const Use& use) const CMM_NOEXCEPT;
+        };
+
+        /**
+         * Verifies a single function without resetting the use list index.
+         *
+         * @param function the Function to verify.
+         * @return bool true if no errors were found, else false.
+         */
+        bool verifyFunction(const Function& function);
+
+        void verifyBlock(const Function& function, const BasicBlock& block);
+        void verifyInstruction(const Function& function, const BasicBlock& block, const Instruction& instruction);
+        void verifyTypes(const Instruction& instruction);
+
+        /**
+         * Checks that an operand may legally be referenced from an instruction of a function.
+         *
+         * @param function the Function containing the user.
+         * @param instruction the using Instruction.
+         * @param operand the used Value.
+         */
+        void verifyOperand(const Function& function, const Instruction& instruction, const Value* operand);
+
+        /**
+         * Records an error.
+         *
+         * @param function the Function the error was found in.
+         * @param message the error message.
+         */
+        void fail(const Function& function, const std::string& message);
+
+        /**
+         * Forgets the indexed use lists.
+         */
+        void clearUseIndex() CMM_NOEXCEPT;
+
+    private:
+
+        // The errors found so far.
+        std::vector<std::string> errors;
+
+        // The position of every instruction within its block (for the current function).
+        std::unordered_map<const Instruction*, std::size_t> positions;
+
+        // The dominator tree of the current function.
+        std::optional<DominatorTree> dominators;
+
+        // The values whose use lists are in 'listedUses'.
+        std::unordered_set<const Value*> indexedValues;
+
+        // Every (value, user) pair found in the use lists of 'indexedValues'.
+        std::unordered_set<Use, UseHash> listedUses;
+    };
+}
+
+#endif //!CMM_IR_VERIFIER_H
@@ -0,0 +1,112 @@
+/**
+ * Infers the nocapture and noalias attributes of pointer arguments from the alias and
+ * escape analysis, so both our passes (through ir::AliasAnalysis) and LLVM can tell what
+ * a call may do with the pointers it is given.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_ARGUMENT_ATTRIBUTES_H
+#define CMM_OPT_ARGUMENT_ATTRIBUTES_H
+
+// Our includes
+#include <cmm/Types.h>
+
+namespace cmm::ir
+{
+    class Argument;
+    class Function;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class ArgumentAttributes
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        ArgumentAttributes() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        ArgumentAttributes(const ArgumentAttributes&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        ArgumentAttributes(ArgumentAttributes&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~ArgumentAttributes() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        ArgumentAttributes& operator= (const ArgumentAttributes&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        ArgumentAttributes& operator= (ArgumentAttributes&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module until nothing changes, since
+         * an argument only passed on to nocapture arguments is nocapture itself.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Gets the number of arguments marked nocapture so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getNoCaptureCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the number of arguments marked noalias so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getNoAliasCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether a pointer argument can be marked noalias: its function makes no calls
+         * and only accesses memory through it or its own locals, so no other pointer can
+         * reach the same memory while the function runs.
+         *
+         * @param arg the pointer ir::Argument.
+         * @return bool.
+         */
+        static bool isNoAlias(const ir::Argument& arg);
+
+    private:
+
+        // The number of arguments marked nocapture.
+        std::size_t noCaptureCount;
+
+        // The number of arguments marked noalias.
+        std::size_t noAliasCount;
+    };
+}
+
+#endif //!CMM_OPT_ARGUMENT_ATTRIBUTES_H
@@ -0,0 +1,90 @@
+/**
+ * Sparse conditional constant propagation (Wegman and Zadeck): folds instructions over
+ * constants and propagates the results through phis, ignoring paths that can't be taken.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_CONSTANT_PROPAGATION_H
+#define CMM_OPT_CONSTANT_PROPAGATION_H
+
+// Our includes
+#include <cmm/Types.h>
+
+namespace cmm::ir
+{
+    class Function;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class ConstantPropagation
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        ConstantPropagation() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        ConstantPropagation(const ConstantPropagation&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        ConstantPropagation(ConstantPropagation&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~ConstantPropagation() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        ConstantPropagation& operator= (const ConstantPropagation&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        ConstantPropagation& operator= (ConstantPropagation&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function.  Branches on a constant are left in place
+         * (with the constant as their condition) for dead code elimination to clean up.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Gets the number of instructions replaced by a constant so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getFoldedCount() const CMM_NOEXCEPT;
+
+    private:
+
+        // The number of instructions replaced by a constant.
+        std::size_t foldedCount;
+    };
+}
+
+#endif //!CMM_OPT_CONSTANT_PROPAGATION_H
@@ -0,0 +1,164 @@
+/**
+ * Dead code and dead store elimination: folds branches on constants, removes unreachable
+ * blocks, merges straight line blocks, and deletes unused computations and stores that
+ * can never be read.  Calls are always kept since they may have side effects.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_DEAD_CODE_ELIMINATION_H
+#define CMM_OPT_DEAD_CODE_ELIMINATION_H
+
+// Our includes
+#include <cmm/Types.h>
+
+namespace cmm::ir
+{
+    class BasicBlock;
+    class Function;
+    class Instruction;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class DeadCodeElimination
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        DeadCodeElimination() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        DeadCodeElimination(const DeadCodeElimination&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        DeadCodeElimination(DeadCodeElimination&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~DeadCodeElimination() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        DeadCodeElimination& operator= (const DeadCodeElimination&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        DeadCodeElimination& operator= (DeadCodeElimination&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function until nothing more can be removed.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Gets the number of instructions removed so far (stores and branches included).
+         *
+         * @return std::size_t.
+         */
+        std::size_t getRemovedInstructionCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the number of stores removed so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getRemovedStoreCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the number of blocks removed (unreachable or merged) so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getRemovedBlockCount() const CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Rewrites conditional branches and switches on a constant into unconditional branches.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool foldConstantBranches(ir::Function& function);
+
+        /**
+         * Removes the blocks that can't be reached from the entry block.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool removeUnreachableBlocks(ir::Function& function);
+
+        /**
+         * Merges each block into its predecessor when it is that predecessor's only successor
+         * and the predecessor is its only predecessor.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool mergeBlocks(ir::Function& function);
+
+        /**
+         * Removes stores that are overwritten (or whose local goes away on return) before
+         * anything may read them, and every store to a local whose memory is never read at all.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool removeDeadStores(ir::Function& function);
+
+        /**
+         * Removes the instructions (phi cycles included) whose results don't contribute to
+         * any side effect.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool removeDeadInstructions(ir::Function& function);
+
+        /**
+         * Erases an instruction, counting it.
+         *
+         * @param instruction the ir::Instruction.
+         */
+        void erase(ir::Instruction* instruction);
+
+    private:
+
+        // The number of instructions removed.
+        std::size_t removedInstructionCount;
+
+        // The number of stores removed.
+        std::size_t removedStoreCount;
+
+        // The number of blocks removed.
+        std::size_t removedBlockCount;
+    };
+}
+
+#endif //!CMM_OPT_DEAD_CODE_ELIMINATION_H
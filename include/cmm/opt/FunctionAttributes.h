@@ -0,0 +1,116 @@
+/**
+ * Infers function attributes bottom-up over the call graph: whether a function doesn't
+ * touch the caller's memory (readnone) or only reads it (readonly), can't unwind (nounwind)
+ * and always returns (willreturn).  Calls to such functions can then be reused by value
+ * numbering, or removed when their result is unused.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_FUNCTION_ATTRIBUTES_H
+#define CMM_OPT_FUNCTION_ATTRIBUTES_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <vector>
+
+namespace cmm::ir
+{
+    class CallGraph;
+    class Function;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class FunctionAttributes
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        FunctionAttributes() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        FunctionAttributes(const FunctionAttributes&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        FunctionAttributes(FunctionAttributes&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~FunctionAttributes() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        FunctionAttributes& operator= (const FunctionAttributes&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        FunctionAttributes& operator= (FunctionAttributes&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over every defined function of a module with its already computed
+         * call graph, callees first so their attributes are known at each call.
+         *
+         * @param module the ir::Module.
+         * @param callGraph the ir::CallGraph of the module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module, const ir::CallGraph& callGraph);
+
+        /**
+         * Gets the number of attributes added so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getInferredCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether a function's control flow has a cycle (a loop of any shape).
+         *
+         * @param function the ir::Function.
+         * @return bool.
+         */
+        static bool hasCycle(const ir::Function& function);
+
+    private:
+
+        /**
+         * Infers the attributes of a cycle of calls (or a single function), assuming calls
+         * within the cycle add nothing.
+         *
+         * @param component the ir::Functions of the cycle.
+         * @param recursive whether the functions call each other (or themselves).
+         */
+        void infer(const std::vector<ir::Function*>& component, const bool recursive);
+
+    private:
+
+        // The number of attributes added.
+        std::size_t inferredCount;
+    };
+}
+
+#endif //!CMM_OPT_FUNCTION_ATTRIBUTES_H
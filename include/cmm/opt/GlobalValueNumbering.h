@@ -0,0 +1,125 @@
+/**
+ * Dominator scoped value numbering (common subexpression elimination): an instruction
+ * computing the same value as one that dominates it is replaced by that earlier result.
+ * Loads are reused (and stored values forwarded to them) while no store that may alias
+ * or call that may access the memory (see ir/AliasAnalysis.h) can have changed it.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_GLOBAL_VALUE_NUMBERING_H
+#define CMM_OPT_GLOBAL_VALUE_NUMBERING_H
+
+// Our includes
+#include <cmm/Types.h>
+
+namespace cmm::ir
+{
+    class AliasAnalysis;
+    class DominatorTree;
+    class Function;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class GlobalValueNumbering
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        GlobalValueNumbering() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        GlobalValueNumbering(const GlobalValueNumbering&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        GlobalValueNumbering(GlobalValueNumbering&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~GlobalValueNumbering() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        GlobalValueNumbering& operator= (const GlobalValueNumbering&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        GlobalValueNumbering& operator= (GlobalValueNumbering&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Runs the pass over a single function with its already computed dominator tree
+         * (which stays valid: only instructions are removed).
+         *
+         * @param function the ir::Function.
+         * @param dominators the ir::DominatorTree of the function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function, const ir::DominatorTree& dominators);
+
+        /**
+         * Runs the pass over a single function with its already computed dominator tree and
+         * alias analysis.
+         *
+         * @param function the ir::Function.
+         * @param dominators the ir::DominatorTree of the function.
+         * @param aliasAnalysis the ir::AliasAnalysis of the function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function, const ir::DominatorTree& dominators, const ir::AliasAnalysis& aliasAnalysis);
+
+        /**
+         * Gets the number of redundant computations (arithmetic, addresses, casts...)
+         * removed so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getEliminatedCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the number of redundant loads removed so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getEliminatedLoadCount() const CMM_NOEXCEPT;
+
+    private:
+
+        // The number of redundant computations removed.
+        std::size_t eliminatedCount;
+
+        // The number of redundant loads removed.
+        std::size_t eliminatedLoadCount;
+    };
+}
+
+#endif //!CMM_OPT_GLOBAL_VALUE_NUMBERING_H
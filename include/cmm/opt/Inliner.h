@@ -0,0 +1,120 @@
+/**
+ * Inlines calls to small functions, and to functions called from a single place, by
+ * copying the callee's blocks into the caller.  Returns become branches to a block after
+ * the call, with a phi merging the returned values.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_INLINER_H
+#define CMM_OPT_INLINER_H
+
+// Our includes
+#include <cmm/Types.h>
+
+namespace cmm::ir
+{
+    class CallGraph;
+    class Instruction;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class Inliner
+    {
+    public:
+
+        // The default size (in instructions) up to which a callee is always inlined.
+        static constexpr std::size_t defaultThreshold = 32;
+
+        /**
+         * Constructor.
+         *
+         * @param threshold the size (in instructions) up to which a callee is always inlined.
+         */
+        explicit Inliner(const std::size_t threshold = defaultThreshold) CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        Inliner(const Inliner&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        Inliner(Inliner&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~Inliner() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        Inliner& operator= (const Inliner&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        Inliner& operator= (Inliner&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over a module, visiting callees before their callers so that what
+         * gets copied has already had its own calls inlined.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a module with its already computed call graph (which is left
+         * stale if anything was inlined).
+         *
+         * @param module the ir::Module.
+         * @param callGraph the ir::CallGraph of the module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module, const ir::CallGraph& callGraph);
+
+        /**
+         * Inlines a single call.  The callee must be defined and may not be the caller.
+         *
+         * @param call the CALL ir::Instruction (erased on return).
+         */
+        static void inlineCall(ir::Instruction* call);
+
+        /**
+         * Gets the number of calls inlined so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getInlinedCount() const CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Gets whether a call should be inlined.
+         *
+         * @param callGraph the ir::CallGraph of the module.
+         * @param call the CALL ir::Instruction.
+         * @return bool.
+         */
+        bool shouldInline(const ir::CallGraph& callGraph, const ir::Instruction* call) const;
+
+    private:
+
+        // The size (in instructions) up to which a callee is always inlined.
+        std::size_t threshold;
+
+        // The number of calls inlined.
+        std::size_t inlinedCount;
+    };
+}
+
+#endif //!CMM_OPT_INLINER_H
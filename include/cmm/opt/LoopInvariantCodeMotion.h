@@ -0,0 +1,134 @@
+/**
+ * Loop invariant code motion: computations whose operands don't change within a loop
+ * are moved to the loop's preheader so they are evaluated once instead of per iteration.
+ * Loads are hoisted when nothing in the loop may write to the memory they read.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_LOOP_INVARIANT_CODE_MOTION_H
+#define CMM_OPT_LOOP_INVARIANT_CODE_MOTION_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <vector>
+
+namespace cmm::ir
+{
+    class AliasAnalysis;
+    class Function;
+    class Instruction;
+    class Loop;
+    class LoopInfo;
+    class Module;
+    class Value;
+}
+
+namespace cmm::opt
+{
+    class LoopInvariantCodeMotion
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        LoopInvariantCodeMotion() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        LoopInvariantCodeMotion(const LoopInvariantCodeMotion&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        LoopInvariantCodeMotion(LoopInvariantCodeMotion&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~LoopInvariantCodeMotion() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        LoopInvariantCodeMotion& operator= (const LoopInvariantCodeMotion&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        LoopInvariantCodeMotion& operator= (LoopInvariantCodeMotion&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function, innermost loops first so invariants can
+         * keep moving out through enclosing loops.  Preheaders are created as needed.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Runs the pass over a single function with its already computed loops.  Created
+         * preheaders are added to the loops, but any dominator tree is left stale.
+         *
+         * @param function the ir::Function.
+         * @param loopInfo the ir::LoopInfo of the function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function, ir::LoopInfo& loopInfo);
+
+        /**
+         * Runs the pass over a single function with its already computed loops and alias
+         * analysis (which moving instructions around doesn't change).
+         *
+         * @param function the ir::Function.
+         * @param loopInfo the ir::LoopInfo of the function.
+         * @param aliasAnalysis the ir::AliasAnalysis of the function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function, ir::LoopInfo& loopInfo, const ir::AliasAnalysis& aliasAnalysis);
+
+        /**
+         * Gets the number of instructions hoisted so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getHoistedCount() const CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Gets whether an instruction of a loop can be moved to its preheader.
+         *
+         * @param loop the ir::Loop.
+         * @param instruction the ir::Instruction.
+         * @param clobbers the stores and calls of the loop.
+         * @param aliasAnalysis the ir::AliasAnalysis of the function.
+         * @return bool.
+         */
+        static bool canHoist(const ir::Loop& loop, const ir::Instruction& instruction,
+                             const std::vector<const ir::Instruction*>& clobbers, const ir::AliasAnalysis& aliasAnalysis);
+
+    private:
+
+        // The number of instructions hoisted.
+        std::size_t hoistedCount;
+    };
+}
+
+#endif //!CMM_OPT_LOOP_INVARIANT_CODE_MOTION_H
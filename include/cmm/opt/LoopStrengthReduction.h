@@ -0,0 +1,112 @@
+/**
+ * Induction variable strength reduction: a multiplication of a loop counter (a header
+ * phi stepped by a loop invariant amount) by a loop invariant becomes a second counter
+ * stepped by the product, i.e. i * c is replaced by an addition per iteration.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_LOOP_STRENGTH_REDUCTION_H
+#define CMM_OPT_LOOP_STRENGTH_REDUCTION_H
+
+// Our includes
+#include <cmm/Types.h>
+
+namespace cmm::ir
+{
+    class Function;
+    class Loop;
+    class LoopInfo;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class LoopStrengthReduction
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        LoopStrengthReduction() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        LoopStrengthReduction(const LoopStrengthReduction&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        LoopStrengthReduction(LoopStrengthReduction&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~LoopStrengthReduction() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        LoopStrengthReduction& operator= (const LoopStrengthReduction&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        LoopStrengthReduction& operator= (LoopStrengthReduction&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function.  Only loops with a preheader and a single
+         * latch are considered (LoopInvariantCodeMotion creates the preheaders).
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Runs the pass over a single function with its already computed loops (which stay
+         * valid: the CFG is left untouched).
+         *
+         * @param function the ir::Function.
+         * @param loopInfo the ir::LoopInfo of the function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function, const ir::LoopInfo& loopInfo);
+
+        /**
+         * Gets the number of multiplications replaced so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getReducedCount() const CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Reduces the multiplications of a loop's induction variables.
+         *
+         * @param loop the ir::Loop.
+         */
+        void reduce(ir::Loop& loop);
+
+    private:
+
+        // The number of multiplications replaced.
+        std::size_t reducedCount;
+    };
+}
+
+#endif //!CMM_OPT_LOOP_STRENGTH_REDUCTION_H
@@ -0,0 +1,134 @@
+/**
+ * Loop vectorization: a counted loop (i = phi [ start, preheader ], [ i + 1, latch ] while
+ * i < bound) whose body only does element wise arithmetic over the i-th elements of arrays
+ * and pointers is rewritten to process several iterations at once using vector types, sized
+ * by the target's vector width (ex. <4 x i32> for 128 bits, <8 x float> for 256 bits).  The
+ * original loop is kept to run the remaining iterations, and integer sums, products and bit
+ * wise reductions are split across lanes and combined once the vector loop is done.  Arrays
+ * that may overlap are checked at run time, falling back to the scalar loop when they do.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_LOOP_VECTORIZE_H
+#define CMM_OPT_LOOP_VECTORIZE_H
+
+// Our includes
+#include <cmm/Types.h>
+
+namespace cmm::ir
+{
+    class AliasAnalysis;
+    class Function;
+    class Loop;
+    class LoopInfo;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class LoopVectorize
+    {
+    public:
+
+        // The default width in bits of the target's vector registers (SSE).
+        static constexpr u32 defaultVectorWidth = 128;
+
+        /**
+         * Constructor.
+         *
+         * @param vectorWidth the width in bits of the target's vector registers (0 disables the pass).
+         */
+        explicit LoopVectorize(const u32 vectorWidth = defaultVectorWidth) CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        LoopVectorize(const LoopVectorize&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        LoopVectorize(LoopVectorize&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~LoopVectorize() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        LoopVectorize& operator= (const LoopVectorize&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        LoopVectorize& operator= (LoopVectorize&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Runs the pass over a single function with its already computed loops and alias
+         * analysis.  Both are stale afterwards when a loop was vectorized.
+         *
+         * @param function the ir::Function.
+         * @param loopInfo the ir::LoopInfo of the function.
+         * @param aliasAnalysis the ir::AliasAnalysis of the function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function, const ir::LoopInfo& loopInfo, const ir::AliasAnalysis& aliasAnalysis);
+
+        /**
+         * Gets the width in bits of the target's vector registers.
+         *
+         * @return u32.
+         */
+        u32 getVectorWidth() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the number of loops vectorized so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getVectorizedCount() const CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Vectorizes a loop when it is a counted loop the pass understands.
+         *
+         * @param loop the innermost ir::Loop.
+         * @param aliasAnalysis the ir::AliasAnalysis of the function.
+         * @return bool true if the loop was vectorized, else false.
+         */
+        bool vectorize(ir::Loop& loop, const ir::AliasAnalysis& aliasAnalysis);
+
+    private:
+
+        // The width in bits of the target's vector registers.
+        u32 vectorWidth;
+
+        // The number of loops vectorized.
+        std::size_t vectorizedCount;
+    };
+}
+
+#endif //!CMM_OPT_LOOP_VECTORIZE_H
@@ -0,0 +1,141 @@
+/**
+ * Promotes stack slots (allocas) of scalars to SSA values with phi nodes at the joins.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_MEM2REG_H
+#define CMM_OPT_MEM2REG_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <vector>
+
+namespace cmm::ir
+{
+    class DominatorTree;
+    class Function;
+    class Instruction;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class Mem2Reg
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        Mem2Reg() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        Mem2Reg(const Mem2Reg&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        Mem2Reg(Mem2Reg&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~Mem2Reg() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        Mem2Reg& operator= (const Mem2Reg&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        Mem2Reg& operator= (Mem2Reg&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Runs the pass over a single function with its already computed dominator tree
+         * (which the pass keeps valid: the CFG is left untouched).
+         *
+         * @param function the ir::Function.
+         * @param dominators the ir::DominatorTree of the function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function, const ir::DominatorTree& dominators);
+
+        /**
+         * Gets the number of allocas promoted so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getPromotedCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the number of phi nodes inserted so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getPhiCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether an alloca can be promoted, that is a scalar whose address is
+         * only ever loaded from or stored to (never escapes).
+         *
+         * @param alloca the alloca ir::Instruction.
+         * @return bool.
+         */
+        static bool isPromotable(const ir::Instruction& alloca);
+
+    private:
+
+        /**
+         * Gets the promotable allocas of a function.
+         *
+         * @param function the ir::Function.
+         * @return std::vector of alloca ir::Instructions.
+         */
+        static std::vector<ir::Instruction*> findPromotable(ir::Function& function);
+
+        /**
+         * Inserts the phi nodes for each alloca and renames loads and stores to SSA values.
+         *
+         * @param function the ir::Function.
+         * @param allocas the promotable allocas.
+         * @param dominators the ir::DominatorTree of the function.
+         */
+        void promote(ir::Function& function, const std::vector<ir::Instruction*>& allocas, const ir::DominatorTree& dominators);
+
+    private:
+
+        // The number of allocas promoted.
+        std::size_t promotedCount;
+
+        // The number of phi nodes inserted.
+        std::size_t phiCount;
+    };
+}
+
+#endif //!CMM_OPT_MEM2REG_H
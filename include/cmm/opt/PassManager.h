@@ -0,0 +1,399 @@
+/**
+ * Runs a pipeline of optimization passes over a cmm IR module.  The analyses passes
+ * share (dominator trees, loops and the call graph) are cached by an AnalysisManager
+ * and only recomputed after a pass that changed the IR didn't preserve them.  Each run
+ * records how long every pass took and how it changed the size of the IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_PASS_MANAGER_H
+#define CMM_OPT_PASS_MANAGER_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cmm::ir
+{
+    class AliasAnalysis;
+    class CallGraph;
+    class DominatorTree;
+    class Function;
+    class LoopInfo;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    // The cached analyses, as a mask of those a pass preserves.
+    enum EnumAnalysis : u8
+    {
+        NO_ANALYSES = 0, DOMINATORS = 1, LOOPS = 2, CALL_GRAPH = 4, ALIASES = 8, ALL_ANALYSES = 15
+    };
+
+    enum class EnumOptLevel : u8
+    {
+        O0 = 0, O1, O2
+    };
+
+    constexpr const char* toString(const EnumOptLevel level)
+    {
+        switch (level)
+        {
+        case EnumOptLevel::O0:
+            return "O0";
+        case EnumOptLevel::O1:
+            return "O1";
+        case EnumOptLevel::O2:
+            return "O2";
+        default:
+            return "UNKNOWN";
+        }
+
+        return nullptr;
+    }
+
+    class AnalysisManager
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        AnalysisManager() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        AnalysisManager(const AnalysisManager&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        AnalysisManager(AnalysisManager&&) CMM_NOEXCEPT;
+
+        /**
+         * Destructor.
+         */
+        ~AnalysisManager();
+
+        /**
+         * Copy assignment operator.
+         */
+        AnalysisManager& operator= (const AnalysisManager&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        AnalysisManager& operator= (AnalysisManager&&) CMM_NOEXCEPT;
+
+        /**
+         * Gets the dominator tree of a function, computing it if it isn't cached.
+         *
+         * @param function the defined ir::Function.
+         * @return reference to the ir::DominatorTree.
+         */
+        const ir::DominatorTree& getDominatorTree(const ir::Function& function);
+
+        /**
+         * Gets the loops of a function, computing them if they aren't cached.  Mutable since
+         * passes may add preheaders.
+         *
+         * @param function the defined ir::Function.
+         * @return reference to the ir::LoopInfo.
+         */
+        ir::LoopInfo& getLoopInfo(const ir::Function& function);
+
+        /**
+         * Gets the call graph of a module, computing it if it isn't cached.
+         *
+         * @param module the ir::Module.
+         * @return reference to the ir::CallGraph.
+         */
+        const ir::CallGraph& getCallGraph(const ir::Module& module);
+
+        /**
+         * Gets the alias analysis of a function, computing it if it isn't cached.
+         *
+         * @param function the defined ir::Function.
+         * @return reference to the ir::AliasAnalysis.
+         */
+        const ir::AliasAnalysis& getAliasAnalysis(const ir::Function& function);
+
+        /**
+         * Drops every cached analysis not in the preserved mask.  Loops are found using the
+         * dominator tree, so they are dropped with it.
+         *
+         * @param preserved the mask of EnumAnalysis values still valid.
+         */
+        void invalidate(const u8 preserved);
+
+        /**
+         * Gets the number of analyses computed so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getComputedCount() const CMM_NOEXCEPT;
+
+    private:
+
+        // The dominator tree of each function.
+        std::unordered_map<const ir::Function*, std::unique_ptr<ir::DominatorTree>> dominators;
+
+        // The loops of each function.
+        std::unordered_map<const ir::Function*, std::unique_ptr<ir::LoopInfo>> loops;
+
+        // The call graph of the module.
+        std::unique_ptr<ir::CallGraph> callGraph;
+
+        // The alias analysis of each function.
+        std::unordered_map<const ir::Function*, std::unique_ptr<ir::AliasAnalysis>> aliases;
+
+        // The number of analyses computed.
+        std::size_t computedCount;
+    };
+
+    class Pass
+    {
+    public:
+
+        /**
+         * Copy constructor.
+         */
+        Pass(const Pass&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        Pass(Pass&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        virtual ~Pass() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        Pass& operator= (const Pass&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        Pass& operator= (Pass&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Gets the name of the pass, as used in a pipeline.
+         *
+         * @return const reference to the std::string name.
+         */
+        const std::string& getName() const CMM_NOEXCEPT;
+
+        /**
+         * Runs the pass over a module.
+         *
+         * @param module the ir::Module.
+         * @param analyses the AnalysisManager to get analyses from.
+         * @return bool true if anything changed, else false.
+         */
+        virtual bool run(ir::Module& module, AnalysisManager& analyses) = 0;
+
+        /**
+         * Gets the analyses still valid after the pass changed the IR.
+         *
+         * @return u8 mask of EnumAnalysis values.
+         */
+        virtual u8 getPreservedAnalyses() const CMM_NOEXCEPT = 0;
+
+        /**
+         * Gets what the pass did so far, for statistics.
+         *
+         * @return std::string (empty if there is nothing to add).
+         */
+        virtual std::string getDetails() const;
+
+    protected:
+
+        /**
+         * Constructor.
+         *
+         * @param name the name of the pass.
+         */
+        explicit Pass(const std::string& name);
+
+    private:
+
+        // The name of the pass.
+        std::string name;
+    };
+
+    // What a single run of a pass did.
+    struct PassStatistics
+    {
+        std::string name;
+        std::string details;
+        f64 milliseconds;
+        std::size_t instructionsBefore;
+        std::size_t instructionsAfter;
+        bool changed;
+    };
+
+    class PassManager
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        PassManager() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        PassManager(const PassManager&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        PassManager(PassManager&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~PassManager() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        PassManager& operator= (const PassManager&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        PassManager& operator= (PassManager&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Adds a pass to the end of the pipeline.
+         *
+         * @param pass the Pass.
+         */
+        void addPass(std::unique_ptr<Pass> pass);
+
+        /**
+         * Gets the width in bits of the target's vector registers passes are added for.
+         *
+         * @return u32.
+         */
+        u32 getVectorWidth() const CMM_NOEXCEPT;
+
+        /**
+         * Sets the width in bits of the target's vector registers (ex. 128 for SSE, 256 for
+         * AVX, 0 for none) used by the vectorizer passes added afterwards.
+         *
+         * @param vectorWidth the u32 width in bits.
+         */
+        void setVectorWidth(const u32 vectorWidth) CMM_NOEXCEPT;
+
+        /**
+         * Adds passes by name from a comma separated list, e.g. "mem2reg,constprop,dce".
+         *
+         * @param pipeline the std::string list of pass names.
+         * @param errorMessage optional error message to set.  Assumes valid pointer if non-nullptr.
+         * @return bool true on success, else false if a name is unknown (nothing is added).
+         */
+        bool addPipeline(const std::string& pipeline, std::string* errorMessage);
+
+        /**
+         * Adds the default passes of an optimization level.
+         *
+         * @param level the EnumOptLevel.
+         */
+        void addDefaultPipeline(const EnumOptLevel level);
+
+        /**
+         * Runs every pass, in order, over a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Gets the number of passes in the pipeline.
+         *
+         * @return std::size_t.
+         */
+        std::size_t size() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the names of the passes in the pipeline.
+         *
+         * @return std::vector of std::string names.
+         */
+        std::vector<std::string> getPassNames() const;
+
+        /**
+         * Gets the statistics of every pass run so far.
+         *
+         * @return const reference to the std::vector of PassStatistics.
+         */
+        const std::vector<PassStatistics>& getStatistics() const CMM_NOEXCEPT;
+
+        /**
+         * Prints the statistics of every pass run so far, one line per pass and a total.
+         *
+         * @param os the std::ostream to print to.
+         */
+        void printStatistics(std::ostream& os) const;
+
+        /**
+         * Gets the analysis cache shared by the passes.
+         *
+         * @return reference to the AnalysisManager.
+         */
+        AnalysisManager& getAnalysisManager() CMM_NOEXCEPT;
+
+        /**
+         * Creates a pass by name.
+         *
+         * @param name the std::string name of the pass.
+         * @return std::unique_ptr to the Pass, else nullptr if the name is unknown.
+         */
+        static std::unique_ptr<Pass> createPass(const std::string& name);
+
+        /**
+         * Creates a pass by name for a target with the given vector register width.
+         *
+         * @param name the std::string name of the pass.
+         * @param vectorWidth the u32 width in bits of the target's vector registers.
+         * @return std::unique_ptr to the Pass, else nullptr if the name is unknown.
+         */
+        static std::unique_ptr<Pass> createPass(const std::string& name, const u32 vectorWidth);
+
+    private:
+
+        // The passes, in order.
+        std::vector<std::unique_ptr<Pass>> passes;
+
+        // The analyses cached between passes.
+        AnalysisManager analyses;
+
+        // The statistics of each pass run.
+        std::vector<PassStatistics> statistics;
+
+        // The width in bits of the target's vector registers.
+        u32 vectorWidth;
+    };
+}
+
+#endif //!CMM_OPT_PASS_MANAGER_H
@@ -0,0 +1,146 @@
+/**
+ * Arithmetic peephole optimizations: algebraic identities (x + 0, x * 1, x * 0, -(-x), ...)
+ * are simplified away, and multiplications, divisions and remainders by constants are
+ * strength reduced into shifts, masks and multiply-high sequences, so backends without an
+ * optimizer of their own don't emit a hardware divide for them.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_PEEPHOLE_H
+#define CMM_OPT_PEEPHOLE_H
+
+// Our includes
+#include <cmm/Types.h>
+
+namespace cmm::ir
+{
+    class Function;
+    class IRBuilder;
+    class Instruction;
+    class Module;
+    class Value;
+}
+
+namespace cmm::opt
+{
+    class Peephole
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        Peephole() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        Peephole(const Peephole&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        Peephole(Peephole&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~Peephole() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        Peephole& operator= (const Peephole&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        Peephole& operator= (Peephole&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function until nothing more can be rewritten.  The CFG
+         * is left untouched; replaced instructions are erased, but operands they no longer
+         * use are left for DeadCodeElimination.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Gets the number of instructions simplified to an existing value or constant so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getSimplifiedCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the number of multiplications, divisions and remainders strength reduced so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getStrengthReducedCount() const CMM_NOEXCEPT;
+
+    private:
+
+        /**
+         * Gets the value an instruction simplifies to without creating anything new.
+         *
+         * @param instruction the ir::Instruction.
+         * @return pointer to the ir::Value, else nullptr.
+         */
+        ir::Value* simplify(ir::Instruction& instruction);
+
+        /**
+         * Creates a cheaper sequence computing the same value as an instruction, inserted
+         * before it.
+         *
+         * @param instruction the ir::Instruction.
+         * @param builder the ir::IRBuilder positioned before the instruction.
+         * @return pointer to the ir::Value, else nullptr if nothing cheaper is known.
+         */
+        ir::Value* reduce(ir::Instruction& instruction, ir::IRBuilder& builder);
+
+        /**
+         * Creates an unsigned division by a constant that is not a power of two.
+         *
+         * @param builder the ir::IRBuilder.
+         * @param dividend the ir::Value to divide.
+         * @param divisor the divisor.
+         * @return pointer to the ir::Value, else nullptr if the type is too wide.
+         */
+        static ir::Value* createUnsignedDivision(ir::IRBuilder& builder, ir::Value* dividend, const u64 divisor);
+
+        /**
+         * Creates a signed division by a constant that is not a power of two (or its negation).
+         *
+         * @param builder the ir::IRBuilder.
+         * @param dividend the ir::Value to divide.
+         * @param divisor the divisor.
+         * @return pointer to the ir::Value, else nullptr if the type is too wide.
+         */
+        static ir::Value* createSignedDivision(ir::IRBuilder& builder, ir::Value* dividend, const s64 divisor);
+
+    private:
+
+        // The number of instructions simplified away.
+        std::size_t simplifiedCount;
+
+        // The number of instructions strength reduced.
+        std::size_t strengthReducedCount;
+    };
+}
+
+#endif //!CMM_OPT_PEEPHOLE_H
@@ -0,0 +1,116 @@
+/**
+ * Scalar replacement of aggregates: a local struct (or array) whose address never escapes is
+ * split into one stack slot per field, so each field can then be promoted to a register by
+ * mem2reg.  Whole aggregate copies (a load only feeding stores) are split field by field too.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_SCALAR_REPLACEMENT_H
+#define CMM_OPT_SCALAR_REPLACEMENT_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <vector>
+
+namespace cmm::ir
+{
+    class Function;
+    class Instruction;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class ScalarReplacement
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        ScalarReplacement() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        ScalarReplacement(const ScalarReplacement&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        ScalarReplacement(ScalarReplacement&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~ScalarReplacement() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        ScalarReplacement& operator= (const ScalarReplacement&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        ScalarReplacement& operator= (ScalarReplacement&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function.  Nested aggregates are split again, one
+         * level at a time, until only scalars (or aggregates that can't be split) remain.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Gets the number of aggregate allocas split so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getSplitCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets whether an alloca can be split, that is an aggregate in the entry block whose
+         * address doesn't escape and is only used by constant field GEPs, or by whole loads
+         * and stores that are part of an aggregate copy.
+         *
+         * @param alloca the alloca ir::Instruction.
+         * @return bool.
+         */
+        static bool isSplittable(const ir::Instruction& alloca);
+
+    private:
+
+        /**
+         * Splits an alloca into one alloca per field, first breaking up the aggregate copies
+         * into and out of it.
+         *
+         * @param alloca the alloca ir::Instruction.
+         * @return std::vector of the new alloca ir::Instructions.
+         */
+        std::vector<ir::Instruction*> split(ir::Instruction* alloca);
+
+    private:
+
+        // The number of aggregate allocas split.
+        std::size_t splitCount;
+    };
+}
+
+#endif //!CMM_OPT_SCALAR_REPLACEMENT_H
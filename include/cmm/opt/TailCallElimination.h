@@ -0,0 +1,127 @@
+/**
+ * Tail call elimination: a call whose result is immediately returned (return f(...)) needs
+ * nothing from its caller's frame afterward.  Self recursive tail calls become a branch back
+ * to the top of the function, with the arguments flowing in through phis, so deep recursion
+ * runs in constant stack space.  Other tail calls are marked 'tail' ('musttail' when the
+ * prototypes match) so the backend can reuse the frame.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+#pragma once
+
+#ifndef CMM_OPT_TAIL_CALL_ELIMINATION_H
+#define CMM_OPT_TAIL_CALL_ELIMINATION_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <vector>
+
+namespace cmm::ir
+{
+    class Function;
+    class Instruction;
+    class Module;
+}
+
+namespace cmm::opt
+{
+    class TailCallElimination
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        TailCallElimination() CMM_NOEXCEPT;
+
+        /**
+         * Copy constructor.
+         */
+        TailCallElimination(const TailCallElimination&) = delete;
+
+        /**
+         * Move constructor.
+         */
+        TailCallElimination(TailCallElimination&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        ~TailCallElimination() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        TailCallElimination& operator= (const TailCallElimination&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        TailCallElimination& operator= (TailCallElimination&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Runs the pass over every defined function of a module.
+         *
+         * @param module the ir::Module.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Module& module);
+
+        /**
+         * Runs the pass over a single function.  Nothing is done when one of its locals
+         * escapes, since a callee could then still be using the caller's frame.
+         *
+         * @param function the ir::Function.
+         * @return bool true if anything changed, else false.
+         */
+        bool run(ir::Function& function);
+
+        /**
+         * Gets the number of self recursive calls turned into loops so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getEliminatedCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the number of calls marked as tail calls so far.
+         *
+         * @return std::size_t.
+         */
+        std::size_t getMarkedCount() const CMM_NOEXCEPT;
+
+        /**
+         * Gets the calls of a function in tail position, i.e. directly followed by a return
+         * of their result (or a void return after a void call).
+         *
+         * @param function the ir::Function.
+         * @return std::vector of CALL ir::Instructions.
+         */
+        static std::vector<ir::Instruction*> findTailCalls(const ir::Function& function);
+
+    private:
+
+        /**
+         * Turns self recursive tail calls into branches to a new loop header holding the
+         * entry block's code, with a phi per argument.
+         *
+         * @param function the ir::Function.
+         * @param calls the self recursive tail CALL ir::Instructions.
+         */
+        void eliminate(ir::Function& function, const std::vector<ir::Instruction*>& calls);
+
+    private:
+
+        // The number of self recursive calls turned into loops.
+        std::size_t eliminatedCount;
+
+        // The number of calls marked as tail calls.
+        std::size_t markedCount;
+    };
+}
+
+#endif //!CMM_OPT_TAIL_CALL_ELIMINATION_H
@@ -0,0 +1,112 @@
+/**
+ * A base class for platform backends that consume the cmm IR (rather than AST nodes).
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_PLATFORM_BASE_H
+#define CMM_IR_PLATFORM_BASE_H
+
+// Our includes
+#include <cmm/Types.h>
+
+// std includes
+#include <iosfwd>
+#include <string>
+
+namespace cmm
+{
+    namespace ir
+    {
+        class BasicBlock;
+        class Function;
+        class GlobalVariable;
+        class Instruction;
+        class Module;
+        class SlotTracker;
+        class Type;
+    }
+
+    class IRPlatformBase
+    {
+    protected:
+
+        /**
+         * Default constructor.
+         *
+         * @param name std::string l-value.
+         */
+        explicit IRPlatformBase(const std::string& name);
+
+        /**
+         * Default constructor.
+         *
+         * @param name std::string r-value.
+         */
+        explicit IRPlatformBase(std::string&& name) CMM_NOEXCEPT;
+
+    public:
+
+        /**
+         * Deleted copy constructor.
+         */
+        IRPlatformBase(const IRPlatformBase&) CMM_NOEXCEPT = delete;
+
+        /**
+         * Default move constructor.
+         */
+        IRPlatformBase(IRPlatformBase&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default virtual destructor.
+         */
+        virtual ~IRPlatformBase() = default;
+
+        /**
+         * Deleted copy assignment operator.
+         */
+        IRPlatformBase& operator= (const IRPlatformBase&) CMM_NOEXCEPT = delete;
+
+        /**
+         * Default move assignment operator.
+         */
+        IRPlatformBase& operator= (IRPlatformBase&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Gets the name of the platform.
+         *
+         * @return const reference to std::string.
+         */
+        const std::string& getName() const CMM_NOEXCEPT;
+
+        /**
+         * Emits a whole module by walking its types, globals and functions and
+         * calling the platform hooks below in order.
+         *
+         * @param module the Module to emit.
+         * @param os the stream to emit to.
+         */
+        void emit(const ir::Module& module, std::ostream& os);
+
+        virtual void emitHeader(const ir::Module& module, std::ostream& os);
+        virtual void emitFooter(const ir::Module& module, std::ostream& os);
+
+        virtual void emitStructType(const ir::Type& type, std::ostream& os) = 0;
+        virtual void emitGlobal(const ir::GlobalVariable& global, std::ostream& os) = 0;
+        virtual void emitFunctionDeclaration(const ir::Function& function, std::ostream& os) = 0;
+        virtual void emitFunctionStart(const ir::Function& function, ir::SlotTracker& slots, std::ostream& os) = 0;
+        virtual void emitBlockLabel(const ir::BasicBlock& block, ir::SlotTracker& slots, std::ostream& os) = 0;
+        virtual void emitInstruction(const ir::Instruction& instruction, ir::SlotTracker& slots, std::ostream& os) = 0;
+        virtual void emitFunctionEnd(const ir::Function& function, std::ostream& os) = 0;
+
+    protected:
+
+        // The name of the implementing platform.
+        std::string name;
+    };
+}
+
+#endif //!CMM_IR_PLATFORM_BASE_H
@@ -0,0 +1,64 @@
+/**
+ * An IR backend emitting LLVM assembly.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_IR_PLATFORM_LLVM_H
+#define CMM_IR_PLATFORM_LLVM_H
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/platform/IRPlatformBase.h>
+
+namespace cmm
+{
+    class IRPlatformLLVM : public IRPlatformBase
+    {
+    public:
+
+        /**
+         * Default constructor.
+         */
+        IRPlatformLLVM();
+
+        /**
+         * Deleted copy constructor.
+         */
+        IRPlatformLLVM(const IRPlatformLLVM&) CMM_NOEXCEPT = delete;
+
+        /**
+         * Default move constructor.
+         */
+        IRPlatformLLVM(IRPlatformLLVM&&) CMM_NOEXCEPT = default;
+
+        /**
+         * Default destructor.
+         */
+        virtual ~IRPlatformLLVM() = default;
+
+        /**
+         * Deleted copy assignment operator.
+         */
+        IRPlatformLLVM& operator= (const IRPlatformLLVM&) CMM_NOEXCEPT = delete;
+
+        /**
+         * Default move assignment operator.
+         */
+        IRPlatformLLVM& operator= (IRPlatformLLVM&&) CMM_NOEXCEPT = default;
+
+        virtual void emitHeader(const ir::Module& module, std::ostream& os) override;
+        virtual void emitStructType(const ir::Type& type, std::ostream& os) override;
+        virtual void emitGlobal(const ir::GlobalVariable& global, std::ostream& os) override;
+        virtual void emitFunctionDeclaration(const ir::Function& function, std::ostream& os) override;
+        virtual void emitFunctionStart(const ir::Function& function, ir::SlotTracker& slots, std::ostream& os) override;
+        virtual void emitBlockLabel(const ir::BasicBlock& block, ir::SlotTracker& slots, std::ostream& os) override;
+        virtual void emitInstruction(const ir::Instruction& instruction, ir::SlotTracker& slots, std::ostream& os) override;
+        virtual void emitFunctionEnd(const ir::Function& function, std::ostream& os) override;
+    };
+}
+
+#endif //!CMM_IR_PLATFORM_LLVM_H
@@ -65,8 +65,11 @@ namespace cmm
         Analyzer& operator= (Analyzer&&) CMM_NOEXCEPT = delete;
 
         virtual VisitorResult visit(ArgNode& node) override;
+        virtual VisitorResult visit(ArrayIndexNode& node) override;
         virtual VisitorResult visit(BinOpNode& node) override;
         virtual VisitorResult visit(BlockNode& node) override;
+        virtual VisitorResult visit(BreakStatementNode& node) override;
+        virtual VisitorResult visit(CaseStatementNode& node) override;
         virtual VisitorResult visit(CastNode& node) override;
         virtual VisitorResult visit(CompilationUnitNode& node) override;
         virtual VisitorResult visit(DerefNode& node) override;
@@ -84,6 +87,7 @@ namespace cmm
         virtual VisitorResult visit(ReturnStatementNode& node) override;
         virtual VisitorResult visit(StructDefinitionStatementNode& node) override;
         virtual VisitorResult visit(StructFwdDeclarationStatementNode& node) override;
+        virtual VisitorResult visit(SwitchStatementNode& node) override;
         virtual VisitorResult visit(TranslationUnitNode& node) override;
         virtual VisitorResult visit(TypeNode& node) override;
         virtual VisitorResult visit(UnaryOpNode& node) override;
@@ -93,6 +97,21 @@ namespace cmm
 
     private:
 
+        /**
+         * Analyzes the right operand of a BinOpNode (the part of the analysis done before
+         * the left operand is visited).
+         *
+         * @param node the BinOpNode.
+         */
+        void analyzeBinOpRight(BinOpNode& node);
+
+        /**
+         * Finishes analyzing a BinOpNode whose operands have both been visited.
+         *
+         * @param node the BinOpNode.
+         */
+        void analyzeBinOpLeft(BinOpNode& node);
+
         /**
          * Checks to see if the ExpressionNode is a VariableNode with a EnumLocality
          * of EnumLocality::PARAMETER.  This is a special case primarily for LLVM.
@@ -129,6 +148,9 @@ namespace cmm
         // For tracking current locality.
         std::stack<EnumLocality, std::vector<EnumLocality>> localityStack;
 
+        // The number of enclosing loops and switch statements a 'break' may leave.
+        u32 breakableDepth;
+
     };
 }
 
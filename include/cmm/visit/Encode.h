@@ -100,8 +100,11 @@ namespace cmm
         void emitSpace() const CMM_NOEXCEPT;
 
         virtual VisitorResult visit(ArgNode& node) override;
+        virtual VisitorResult visit(ArrayIndexNode& node) override;
         virtual VisitorResult visit(BinOpNode& node) override;
         virtual VisitorResult visit(BlockNode& node) override;
+        virtual VisitorResult visit(BreakStatementNode& node) override;
+        virtual VisitorResult visit(CaseStatementNode& node) override;
         virtual VisitorResult visit(CastNode& node) override;
         virtual VisitorResult visit(CompilationUnitNode& node) override;
         virtual VisitorResult visit(DerefNode& node) override;
@@ -119,6 +122,7 @@ namespace cmm
         virtual VisitorResult visit(ReturnStatementNode& node) override;
         virtual VisitorResult visit(StructDefinitionStatementNode& node) override;
         virtual VisitorResult visit(StructFwdDeclarationStatementNode& node) override;
+        virtual VisitorResult visit(SwitchStatementNode& node) override;
         virtual VisitorResult visit(TranslationUnitNode& node) override;
         virtual VisitorResult visit(TypeNode& node) override;
         virtual VisitorResult visit(UnaryOpNode& node) override;
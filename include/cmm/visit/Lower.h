@@ -0,0 +1,313 @@
+/**
+ * An implementation of the base visitor class for lowering an analyzed AST into the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+#pragma once
+
+#ifndef CMM_LOWER_H
+#define CMM_LOWER_H
+
+// Our includes
+#include <cmm/Types.h>
+#include <cmm/NodeListFwd.h>
+#include <cmm/ir/IRBuilder.h>
+#include <cmm/visit/Visitor.h>
+
+// std includes
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cmm
+{
+    // Forward declarations:
+    class Location;
+    class Reporter;
+
+    class Lower : public Visitor
+    {
+    public:
+
+        /**
+         * Constructor.
+         *
+         * @param module the ir::Module to lower into.
+         */
+        explicit Lower(ir::Module& module);
+
+        /**
+         * Copy constructor
+         */
+        Lower(const Lower&) = delete;
+
+        /**
+         * Move constructor
+         */
+        Lower(Lower&&) CMM_NOEXCEPT = delete;
+
+        /**
+         * Default destructor
+         */
+        virtual ~Lower() = default;
+
+        /**
+         * Copy assignment operator.
+         */
+        Lower& operator= (const Lower&) = delete;
+
+        /**
+         * Move assignment operator.
+         */
+        Lower& operator= (Lower&&) CMM_NOEXCEPT = delete;
+
+        /**
+         * Gets the module being lowered into.
+         *
+         * @return reference to the ir::Module.
+         */
+        ir::Module& getModule() CMM_NOEXCEPT;
+
+        virtual VisitorResult visit(ArgNode& node) override;
+        virtual VisitorResult visit(ArrayIndexNode& node) override;
+        virtual VisitorResult visit(BinOpNode& node) override;
+        virtual VisitorResult visit(BlockNode& node) override;
+        virtual VisitorResult visit(BreakStatementNode& node) override;
+        virtual VisitorResult visit(CaseStatementNode& node) override;
+        virtual VisitorResult visit(CastNode& node) override;
+        virtual VisitorResult visit(CompilationUnitNode& node) override;
+        virtual VisitorResult visit(DerefNode& node) override;
+        virtual VisitorResult visit(EnumDefinitionStatementNode& node) override;
+        virtual VisitorResult visit(EnumUsageNode& node) override;
+        virtual VisitorResult visit(ExpressionStatementNode& node) override;
+        virtual VisitorResult visit(FieldAccessNode& node) override;
+        virtual VisitorResult visit(FunctionCallNode& node) override;
+        virtual VisitorResult visit(FunctionDeclarationStatementNode& node) override;
+        virtual VisitorResult visit(FunctionDefinitionStatementNode& node) override;
+        virtual VisitorResult visit(IfElseStatementNode& node) override;
+        virtual VisitorResult visit(LitteralNode& node) override;
+        virtual VisitorResult visit(ParameterNode& node) override;
+        virtual VisitorResult visit(ParenExpressionNode& node) override;
+        virtual VisitorResult visit(ReturnStatementNode& node) override;
+        virtual VisitorResult visit(StructDefinitionStatementNode& node) override;
+        virtual VisitorResult visit(StructFwdDeclarationStatementNode& node) override;
+        virtual VisitorResult visit(SwitchStatementNode& node) override;
+        virtual VisitorResult visit(TranslationUnitNode& node) override;
+        virtual VisitorResult visit(TypeNode& node) override;
+        virtual VisitorResult visit(UnaryOpNode& node) override;
+        virtual VisitorResult visit(VariableDeclarationStatementNode& node) override;
+        virtual VisitorResult visit(VariableNode& node) override;
+        virtual VisitorResult visit(WhileStatementNode& node) override;
+
+    private:
+
+        // The value of each case of a switch along with the block it jumps to.
+        using SwitchCaseList = std::vector<std::pair<s64, ir::BasicBlock*>>;
+
+        /**
+         * Maps a CType to its IR type.
+         *
+         * @param datatype the CType.
+         * @return pointer to the ir::Type.
+         */
+        ir::Type* resolveType(const CType& datatype);
+
+        /**
+         * Lowers an expression for its value (i.e. an r-value).
+         *
+         * @param expression the ExpressionNode.
+         * @return pointer to the ir::Value (nullptr for void calls).
+         */
+        ir::Value* lowerValue(ExpressionNode* expression);
+
+        /**
+         * Lowers an expression for the address it designates (i.e. an l-value).
+         *
+         * @param expression the ExpressionNode.
+         * @return pointer to the ir::Value.
+         */
+        ir::Value* lowerAddress(ExpressionNode* expression);
+
+        /**
+         * Lowers an expression used as a branch condition down to an i1.
+         *
+         * @param expression the ExpressionNode.
+         * @return pointer to the ir::Value.
+         */
+        ir::Value* lowerCondition(ExpressionNode* expression);
+
+        /**
+         * Tests a lowered value against zero, leaving an i1 as is.
+         *
+         * @param value the ir::Value.
+         * @return pointer to the i1 ir::Value.
+         */
+        ir::Value* toCondition(ir::Value* value);
+
+        /**
+         * Lowers a condition straight into control flow.  '&&' and '||' branch around their
+         * right operand rather than materializing a boolean that is then tested again.
+         *
+         * @param expression the ExpressionNode.
+         * @param trueBlock the ir::BasicBlock to branch to when the condition holds.
+         * @param falseBlock the ir::BasicBlock to branch to otherwise.
+         * @return pointer to the ir::ConstantInt if the whole condition is constant, in which
+         *         case no branch is emitted, else nullptr.
+         */
+        ir::ConstantInt* lowerBranch(ExpressionNode* expression, ir::BasicBlock* trueBlock, ir::BasicBlock* falseBlock);
+
+        /**
+         * Folds a lowered condition that only depends on constants (ex. a literal, an enumerator
+         * or '1 < 2'), erasing the instructions computing it.
+         *
+         * @param cond the i1 ir::Value returned by lowerCondition.
+         * @return pointer to the ir::ConstantInt, else nullptr if the condition isn't constant.
+         */
+        ir::ConstantInt* foldCondition(ir::Value* cond);
+
+        /**
+         * Lowers a chain of binary operators.  Comparisons and logical operators at the top
+         * of the chain are left as an i1 so that callers branching on them can skip the round trip.
+         *
+         * @param node the BinOpNode.
+         * @return pointer to the ir::Value.
+         */
+        ir::Value* lowerBinOp(BinOpNode& node);
+
+        /**
+         * Applies a single binary operator to an already lowered left operand.
+         *
+         * @param node the BinOpNode.
+         * @param left the lowered left operand.
+         * @return pointer to the ir::Value.
+         */
+        ir::Value* lowerBinOpStep(BinOpNode& node, ir::Value* left);
+
+        ir::Value* lowerAssignment(BinOpNode& node);
+        ir::Value* lowerCompare(BinOpNode& node, ir::Value* left, ir::Value* right);
+
+        /**
+         * Lowers a '&&' or '||' used for its value, evaluating the right operand only when
+         * needed and merging the result with a phi.
+         *
+         * @param node the BinOpNode.
+         * @param left the lowered left operand.
+         * @return pointer to the i1 ir::Value.
+         */
+        ir::Value* lowerLogical(BinOpNode& node, ir::Value* left);
+
+        /**
+         * Branches to the block of the case matching a value.  Dense runs of cases become a
+         * 'switch' (i.e. a jump table) while the rest are found with a balanced binary search.
+         *
+         * @param value the integer ir::Value switched on.
+         * @param cases the SwitchCaseList sorted by value.
+         * @param defaultBlock the ir::BasicBlock to go to when no case matches.
+         * @param isUnsigned whether the value (and so the sort order of the cases) is unsigned.
+         */
+        void lowerSwitchDispatch(ir::Value* value, const SwitchCaseList& cases, ir::BasicBlock* defaultBlock,
+            const bool isUnsigned);
+
+        ir::Value* lowerPointerArithmetic(BinOpNode& node, ir::Value* pointer, ir::Value* offset, const bool negate);
+
+        /**
+         * Lowers the address of an element of an array or pointer (i.e. 'a[i]') to an
+         * inbounds getelementptr, with the index extended to i64 by its signedness.
+         *
+         * @param node the ArrayIndexNode.
+         * @return pointer to the ir::Value.
+         */
+        ir::Value* lowerArrayIndexAddress(ArrayIndexNode& node);
+
+        /**
+         * Converts a value to another type choosing the cast by the IR types, where the
+         * signedness of ints comes from their AST types.
+         *
+         * @param value the ir::Value to convert.
+         * @param type the ir::Type to convert to.
+         * @param location the Location for reporting.
+         * @param fromUnsigned whether the value is an unsigned int (zero rather than sign extended).
+         * @param toUnsigned whether the converted to type is an unsigned int.
+         * @return pointer to the ir::Value.
+         */
+        ir::Value* convert(ir::Value* value, ir::Type* type, const Location& location, const bool fromUnsigned = false,
+            const bool toUnsigned = false);
+
+        /**
+         * Widens an i1 to the type expected by the AST for a comparison's value.
+         *
+         * @param value the i1 ir::Value.
+         * @param type the ir::Type to widen to.
+         * @return pointer to the ir::Value.
+         */
+        ir::Value* widenBool(ir::Value* value, ir::Type* type);
+
+        /**
+         * Creates an alloca in the entry block of the current function.
+         *
+         * @param type the allocated ir::Type.
+         * @param name the name of the slot.
+         * @return pointer to the ir::Instruction.
+         */
+        ir::Instruction* createEntryAlloca(ir::Type* type, const std::string& name);
+
+        /**
+         * Moves a block after the current insertion block and continues inserting there.
+         *
+         * @param block the ir::BasicBlock.
+         */
+        void startBlock(ir::BasicBlock* block);
+
+        /**
+         * Branches to a block unless the current block already has a terminator.
+         *
+         * @param block the ir::BasicBlock.
+         */
+        void branchTo(ir::BasicBlock* block);
+
+        /**
+         * Terminates any open blocks and drops blocks that can never be reached.
+         */
+        void finishFunction();
+
+        void declareStructs(TranslationUnitNode& node);
+        void declareFunction(const std::string& name, const CType& returnType, const std::vector<const ParameterNode*>& params);
+
+        /**
+         * Looks up the storage (alloca or global) of a variable by name.
+         *
+         * @param name the name of the variable.
+         * @param location the Location for reporting.
+         * @return pointer to the ir::Value.
+         */
+        ir::Value* lookupVariable(const std::string& name, const Location& location);
+
+    private:
+
+        // Our reporter for reporting things.
+        static Reporter& reporter;
+
+        // The module being built.
+        ir::Module& module;
+
+        // The instruction builder.
+        ir::IRBuilder builder;
+
+        // The function currently being lowered.
+        ir::Function* currentFunction;
+
+        // The lowered value of the last visited expression.
+        ir::Value* current;
+
+        // The storage of each variable, one map per lexical scope (globals first).
+        std::vector<std::unordered_map<std::string, ir::Value*>> scopes;
+
+        // Where a 'break' goes, innermost loop or switch last.
+        std::vector<ir::BasicBlock*> breakTargets;
+    };
+}
+
+#endif //!CMM_LOWER_H
@@ -98,8 +98,11 @@ namespace cmm
         Visitor& operator= (Visitor&&) CMM_NOEXCEPT = delete;
 
         virtual VisitorResult visit(ArgNode& node) = 0;
+        virtual VisitorResult visit(ArrayIndexNode& node) = 0;
         virtual VisitorResult visit(BinOpNode& node) = 0;
         virtual VisitorResult visit(BlockNode& node) = 0;
+        virtual VisitorResult visit(BreakStatementNode& node) = 0;
+        virtual VisitorResult visit(CaseStatementNode& node) = 0;
         virtual VisitorResult visit(CastNode& node) = 0;
         virtual VisitorResult visit(CompilationUnitNode& node) = 0;
         virtual VisitorResult visit(DerefNode& node) = 0;
@@ -117,6 +120,7 @@ namespace cmm
         virtual VisitorResult visit(ReturnStatementNode& node) = 0;
         virtual VisitorResult visit(StructDefinitionStatementNode& node) = 0;
         virtual VisitorResult visit(StructFwdDeclarationStatementNode& node) = 0;
+        virtual VisitorResult visit(SwitchStatementNode& node) = 0;
         virtual VisitorResult visit(TranslationUnitNode& node) = 0;
         virtual VisitorResult visit(TypeNode& node) = 0;
         virtual VisitorResult visit(UnaryOpNode& node) = 0;
@@ -0,0 +1,62 @@
+/**
+ * An AST node for representing an array subscript (ex. 'a[i]').
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/ArrayIndexNode.h>
+#include <cmm/DerefNode.h>
+
+namespace cmm
+{
+    ArrayIndexNode::ArrayIndexNode(const Location& location, std::unique_ptr<ExpressionNode>&& expression,
+        std::unique_ptr<ExpressionNode>&& index) CMM_NOEXCEPT : ExpressionNode(EnumNodeType::ARRAY_INDEX, location),
+        expression(std::move(expression)), index(std::move(index))
+    {
+    }
+
+    ExpressionNode* ArrayIndexNode::getExpression() CMM_NOEXCEPT
+    {
+        return expression.get();
+    }
+
+    const ExpressionNode* ArrayIndexNode::getExpression() const CMM_NOEXCEPT
+    {
+        return expression.get();
+    }
+
+    ExpressionNode* ArrayIndexNode::getIndex() CMM_NOEXCEPT
+    {
+        return index.get();
+    }
+
+    const ExpressionNode* ArrayIndexNode::getIndex() const CMM_NOEXCEPT
+    {
+        return index.get();
+    }
+
+    void ArrayIndexNode::setIndex(std::unique_ptr<ExpressionNode>&& index) CMM_NOEXCEPT
+    {
+        this->index = std::move(index);
+    }
+
+    void ArrayIndexNode::derefIndex()
+    {
+        const auto location = index->getLocation();
+        auto temp = std::move(index);
+        index = std::make_unique<DerefNode>(location, std::move(temp));
+    }
+
+    VisitorResult ArrayIndexNode::accept(Visitor* visitor) /* override */
+    {
+        return visitor->visit(*this);
+    }
+
+    std::string ArrayIndexNode::toString() const /* override */
+    {
+        return "ArrayIndexNode";
+    }
+}
+
@@ -17,10 +17,39 @@ namespace cmm
     BinOpNode::BinOpNode(const Location& location, const EnumBinOpNodeType type,
                          std::unique_ptr<ExpressionNode>&& left,
                          std::unique_ptr<ExpressionNode>&& right) CMM_NOEXCEPT :
-        ExpressionNode(EnumNodeType::BIN_OP, location), type(type), left(std::move(left)), right(std::move(right))
+        ExpressionNode(EnumNodeType::BIN_OP, location), type(type), left(std::move(left)), right(std::move(right)),
+        leftDerefPopped(false)
     {
     }
 
+    BinOpNode::~BinOpNode()
+    {
+        // Detach nested BinOpNodes before they get destroyed so that each one is
+        // destroyed with no BinOpNode children of its own.
+        std::vector<std::unique_ptr<ExpressionNode>> pending;
+
+        const auto detachIfBinOp = [&pending](std::unique_ptr<ExpressionNode>& expression)
+        {
+            if (expression != nullptr && expression->getType() == EnumNodeType::BIN_OP)
+            {
+                pending.emplace_back(std::move(expression));
+            }
+        };
+
+        detachIfBinOp(left);
+        detachIfBinOp(right);
+
+        while (!pending.empty())
+        {
+            auto current = std::move(pending.back());
+            pending.pop_back();
+
+            auto* binOpNode = static_cast<BinOpNode*>(current.get());
+            detachIfBinOp(binOpNode->left);
+            detachIfBinOp(binOpNode->right);
+        }
+    }
+
     EnumBinOpNodeType BinOpNode::getTypeof() const CMM_NOEXCEPT
     {
         return type;
@@ -44,6 +73,11 @@ namespace cmm
         return false;
     }
 
+    bool BinOpNode::isLogicalOp() const CMM_NOEXCEPT
+    {
+        return type == EnumBinOpNodeType::LOGICAL_AND || type == EnumBinOpNodeType::LOGICAL_OR;
+    }
+
     ExpressionNode* BinOpNode::getLeft() CMM_NOEXCEPT
     {
         return left.get();
@@ -64,6 +98,18 @@ namespace cmm
         return right.get();
     }
 
+    void BinOpNode::collectLeftSpine(std::vector<BinOpNode*>& spine)
+    {
+        BinOpNode* current = this;
+        spine.push_back(current);
+
+        while (current->left != nullptr && current->left->getType() == EnumNodeType::BIN_OP)
+        {
+            current = static_cast<BinOpNode*>(current->left.get());
+            spine.push_back(current);
+        }
+    }
+
     void BinOpNode::castLeft(const CType& newType)
     {
         const auto location = left->getLocation();
@@ -101,6 +147,8 @@ namespace cmm
         // We 'pop' the pointer count to make the datatypes agree.
         auto& datatype = left->getDatatype();
         --datatype.pointers;
+
+        leftDerefPopped = true;
     }
 
     void BinOpNode::popDerefNodeRight()
@@ -114,6 +162,11 @@ namespace cmm
         --datatype.pointers;
     }
 
+    bool BinOpNode::isLeftDerefPopped() const CMM_NOEXCEPT
+    {
+        return leftDerefPopped;
+    }
+
     void BinOpNode::setLeftNode(std::unique_ptr<ExpressionNode>&& left) CMM_NOEXCEPT
     {
         this->left = std::move(left);
@@ -15,6 +15,34 @@ namespace cmm
     {
     }
 
+    BlockNode::~BlockNode()
+    {
+        // Detach nested BlockNodes before they get destroyed so that each one is
+        // destroyed with no BlockNode children of its own.
+        std::vector<std::unique_ptr<StatementNode>> pending;
+
+        const auto detachBlocks = [&pending](StatementList& statementList)
+        {
+            for (auto& statementPtr : statementList)
+            {
+                if (statementPtr != nullptr && statementPtr->getType() == EnumNodeType::BLOCK)
+                {
+                    pending.emplace_back(std::move(statementPtr));
+                }
+            }
+        };
+
+        detachBlocks(statements);
+
+        while (!pending.empty())
+        {
+            auto current = std::move(pending.back());
+            pending.pop_back();
+
+            detachBlocks(static_cast<BlockNode*>(current.get())->statements);
+        }
+    }
+
     bool BlockNode::empty() const CMM_NOEXCEPT
     {
         return statements.empty();
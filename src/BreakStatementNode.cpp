@@ -0,0 +1,28 @@
+/**
+ * An AST node for representing a break statement.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/BreakStatementNode.h>
+
+namespace cmm
+{
+    BreakStatementNode::BreakStatementNode(const Location& location) CMM_NOEXCEPT :
+        StatementNode(EnumNodeType::BREAK_STATEMENT, location)
+    {
+    }
+
+    VisitorResult BreakStatementNode::accept(Visitor* visitor) /* override */
+    {
+        return visitor->visit(*this);
+    }
+
+    std::string BreakStatementNode::toString() const /* override */
+    {
+        return "BreakStatementNode";
+    }
+}
+
@@ -0,0 +1,86 @@
+/**
+ * An AST node for representing a 'case' (or 'default') label of a switch statement along
+ * with the statements following it, up to the next label.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/CaseStatementNode.h>
+#include <cmm/ExpressionNode.h>
+
+namespace cmm
+{
+    CaseStatementNode::CaseStatementNode(const Location& location, std::unique_ptr<ExpressionNode>&& expression,
+        StatementList&& statements) CMM_NOEXCEPT : StatementNode(EnumNodeType::CASE_STATEMENT, location),
+        expression(std::move(expression)), value(std::nullopt), statements(std::move(statements))
+    {
+    }
+
+    bool CaseStatementNode::isDefault() const CMM_NOEXCEPT
+    {
+        return expression == nullptr;
+    }
+
+    ExpressionNode* CaseStatementNode::getExpression() CMM_NOEXCEPT
+    {
+        return expression.get();
+    }
+
+    const ExpressionNode* CaseStatementNode::getExpression() const CMM_NOEXCEPT
+    {
+        return expression.get();
+    }
+
+    void CaseStatementNode::setExpression(std::unique_ptr<ExpressionNode>&& expression) CMM_NOEXCEPT
+    {
+        this->expression = std::move(expression);
+    }
+
+    std::optional<s64> CaseStatementNode::getValue() const CMM_NOEXCEPT
+    {
+        return value;
+    }
+
+    void CaseStatementNode::setValue(const s64 value) CMM_NOEXCEPT
+    {
+        this->value = value;
+    }
+
+    bool CaseStatementNode::empty() const CMM_NOEXCEPT
+    {
+        return statements.empty();
+    }
+
+    CaseStatementNode::StatementListIter CaseStatementNode::begin() CMM_NOEXCEPT
+    {
+        return statements.begin();
+    }
+
+    CaseStatementNode::StatementListConstIter CaseStatementNode::cbegin() const CMM_NOEXCEPT
+    {
+        return statements.cbegin();
+    }
+
+    CaseStatementNode::StatementListIter CaseStatementNode::end() CMM_NOEXCEPT
+    {
+        return statements.end();
+    }
+
+    CaseStatementNode::StatementListConstIter CaseStatementNode::cend() const CMM_NOEXCEPT
+    {
+        return statements.cend();
+    }
+
+    VisitorResult CaseStatementNode::accept(Visitor* visitor) /* override */
+    {
+        return visitor->visit(*this);
+    }
+
+    std::string CaseStatementNode::toString() const /* override */
+    {
+        return "CaseStatementNode";
+    }
+}
+
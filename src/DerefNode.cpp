@@ -55,6 +55,11 @@ namespace cmm
         return rootType;
     }
 
+    bool DerefNode::isExplicit() const CMM_NOEXCEPT
+    {
+        return modType.has_value();
+    }
+
     void DerefNode::resolveDatatype() CMM_NOEXCEPT
     {
         if (modType.has_value())
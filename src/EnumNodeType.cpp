@@ -13,7 +13,7 @@ namespace cmm
     bool isValidNonLitteralRHSNodeType(const EnumNodeType type) CMM_NOEXCEPT
     {
         return type == EnumNodeType::VARIABLE || type == EnumNodeType::DEREF ||
-               type == EnumNodeType::FIELD_ACCESS;
+               type == EnumNodeType::FIELD_ACCESS || type == EnumNodeType::ARRAY_INDEX;
     }
 }
 
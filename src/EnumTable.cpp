@@ -106,6 +106,56 @@ namespace cmm
         return result;
     }
 
+    bool EnumTable::merge(EnumTable&& other, std::string* reason)
+    {
+        // Validate everything first so a failed merge leaves both tables untouched.
+        for (const auto& [enumName, enumData] : other.enumMap)
+        {
+            if (enumMap.find(enumName) != enumMap.cend())
+            {
+                if (reason != nullptr)
+                {
+                    std::ostringstream os;
+                    os << "enum '" << enumName << "' is already defined";
+                    *reason = os.str();
+                }
+
+                return false;
+            }
+
+            for (const auto& [enumeratorName, enumerator] : enumData.enumeratorMap)
+            {
+                if (enumeratorNameMap.find(enumeratorName) != enumeratorNameMap.cend())
+                {
+                    if (reason != nullptr)
+                    {
+                        std::ostringstream os;
+                        os << "enumerator with name '" << enumeratorName << "' is already previously defined";
+                        *reason = os.str();
+                    }
+
+                    return false;
+                }
+            }
+        }
+
+        while (!other.enumMap.empty())
+        {
+            // Note: extract/insert re-links the node itself, so neither the key nor the EnumData move in memory.
+            auto node = other.enumMap.extract(other.enumMap.begin());
+            auto insertResult = enumMap.insert(std::move(node));
+            EnumData* enumDataPtr = &insertResult.position->second;
+
+            for (const auto& [enumeratorName, enumerator] : enumDataPtr->enumeratorMap)
+            {
+                enumeratorNameMap.emplace(enumeratorName, enumDataPtr);
+            }
+        }
+
+        other.enumeratorNameMap.clear();
+        return true;
+    }
+
     EnumData* EnumTable::get(const std::string& name)
     {
         const auto findResult = enumMap.find(name);
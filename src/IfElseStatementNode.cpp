@@ -37,6 +37,11 @@ namespace cmm
         return ifConditionalExpression.get();
     }
 
+    void IfElseStatementNode::setIfConditional(std::unique_ptr<ExpressionNode>&& expression) CMM_NOEXCEPT
+    {
+        ifConditionalExpression = std::move(expression);
+    }
+
     void IfElseStatementNode::wrapIfConditional(const EnumBinOpNodeType binOpType, std::unique_ptr<ExpressionNode>&& comparator)
     {
         auto tempLHS = std::move(ifConditionalExpression);
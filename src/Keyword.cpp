@@ -8,6 +8,10 @@
 // Our includes
 #include <cmm/Keyword.h>
 
+// std includes
+#include <iterator>
+#include <mutex>
+
 namespace cmm
 {
     /* static */
@@ -17,33 +21,56 @@ namespace cmm
     std::unordered_set<const Keyword*> Keyword::primitiveTypes;
 
     /* static */
-    const Keyword Keyword::CHAR("char", true);
+    const Keyword Keyword::BREAK(EnumKeyword::BREAK);
+    /* static */
+    const Keyword Keyword::CASE(EnumKeyword::CASE);
+    /* static */
+    const Keyword Keyword::CHAR(EnumKeyword::CHAR);
+    /* static */
+    const Keyword Keyword::DEFAULT(EnumKeyword::DEFAULT);
+    /* static */
+    const Keyword Keyword::DOUBLE(EnumKeyword::DOUBLE);
+    /* static */
+    const Keyword Keyword::ELSE(EnumKeyword::ELSE);
+    /* static */
+    const Keyword Keyword::ENUM(EnumKeyword::ENUM);
     /* static */
-    const Keyword Keyword::DOUBLE("double", true);
+    const Keyword Keyword::FLOAT(EnumKeyword::FLOAT);
     /* static */
-    const Keyword Keyword::ELSE("else", false);
+    const Keyword Keyword::IF(EnumKeyword::IF);
     /* static */
-    const Keyword Keyword::ENUM("enum", true);
+    const Keyword Keyword::INT(EnumKeyword::INT);
     /* static */
-    const Keyword Keyword::FLOAT("float", true);
+    const Keyword Keyword::LONG(EnumKeyword::LONG);
     /* static */
-    const Keyword Keyword::IF("if", false);
+    const Keyword Keyword::RETURN(EnumKeyword::RETURN);
     /* static */
-    const Keyword Keyword::INT("int", true);
+    const Keyword Keyword::SHORT(EnumKeyword::SHORT);
     /* static */
-    const Keyword Keyword::LONG("long", true);
+    const Keyword Keyword::SIGNED(EnumKeyword::SIGNED);
     /* static */
-    const Keyword Keyword::RETURN("return", false);
+    const Keyword Keyword::STRUCT(EnumKeyword::STRUCT);
     /* static */
-    const Keyword Keyword::SHORT("short", true);
+    const Keyword Keyword::SWITCH(EnumKeyword::SWITCH);
     /* static */
-    const Keyword Keyword::STRUCT("struct", true);
+    const Keyword Keyword::UNSIGNED(EnumKeyword::UNSIGNED);
     /* static */
-    const Keyword Keyword::VOID("void", true);
+    const Keyword Keyword::VOID(EnumKeyword::VOID);
     /* static */
-    const Keyword Keyword::WHILE("while", false);
+    const Keyword Keyword::WHILE(EnumKeyword::WHILE);
 
-    Keyword::Keyword(std::string&& name, const bool isAType) CMM_NOEXCEPT : name(std::move(name)), isAType(isAType)
+    // Every Keyword instance, so that one missing for an EnumKeyword fails to compile.
+    static const Keyword* const allKeywords[] = {
+        &Keyword::BREAK, &Keyword::CASE, &Keyword::CHAR, &Keyword::DEFAULT, &Keyword::DOUBLE, &Keyword::ELSE,
+        &Keyword::ENUM, &Keyword::FLOAT, &Keyword::IF, &Keyword::INT, &Keyword::LONG, &Keyword::RETURN,
+        &Keyword::SHORT, &Keyword::SIGNED, &Keyword::STRUCT, &Keyword::SWITCH, &Keyword::UNSIGNED, &Keyword::VOID,
+        &Keyword::WHILE
+    };
+
+    static_assert(std::size(allKeywords) == static_cast<std::size_t>(EnumKeyword::COUNT), "Every EnumKeyword needs a Keyword instance");
+
+    Keyword::Keyword(const EnumKeyword keyword) : keyword(keyword), name(getKeywordInfo(keyword).name),
+        isAType(getKeywordInfo(keyword).isAType)
     {
     }
 
@@ -57,6 +84,11 @@ namespace cmm
         return name;
     }
 
+    EnumKeyword Keyword::getEnumKeyword() const CMM_NOEXCEPT
+    {
+        return keyword;
+    }
+
     bool Keyword::isType() const CMM_NOEXCEPT
     {
         return isAType;
@@ -83,7 +115,10 @@ namespace cmm
     /* static */
     void Keyword::oneTimeInitKeywords()
     {
-        if (keywords.empty())
+        // Note: Keywords may be looked up from more than one parser thread at a time.
+        static std::once_flag initFlag;
+
+        std::call_once(initFlag, []()
         {
             // Helper function for quickly creating Keyword entries into the map.
             static auto addKeyword = [&] (const Keyword* keyword)
@@ -97,41 +132,13 @@ namespace cmm
                 }
             };
 
-            // TODO: Commenting out what we aren't currently supporting.
-            // addKeyword("auto", false);
-            // addKeyword("break", false);
-            // addKeyword("case", false);
-            addKeyword(&Keyword::CHAR);
-            // addKeyword("const", false);
-            // addKeyword("continue", false);
-            // addKeyword("default", false);
-            // addKeyword("do", false);
-            addKeyword(&Keyword::DOUBLE);
-            addKeyword(&Keyword::ELSE);
-            addKeyword(&Keyword::ENUM);
-            // addKeyword("extern", false);
-            addKeyword(&Keyword::FLOAT);
-            // addKeyword("for", false);
-            // addKeyword("goto", false);
-            addKeyword(&Keyword::IF);
-            addKeyword(&Keyword::INT);
-            addKeyword(&Keyword::LONG);
-            // addKeyword("register", false);
-            addKeyword(&Keyword::RETURN);
-            addKeyword(&Keyword::STRUCT);
-            addKeyword(&Keyword::SHORT);
-            // addKeyword("signed", false);
-            // addKeyword("sizeof", false);
-            // addKeyword("static", false);
-            // addKeyword("struct", true);
-            // addKeyword("switch", false);
-            // addKeyword("typedef", false);
-            // addKeyword("union", false);
-            // addKeyword("unsigned", false);
-            addKeyword(&Keyword::VOID);
-            // addKeyword("volatile", false);
-            addKeyword(&Keyword::WHILE);
-        }
+            // TODO: Not currently supported: auto, const, continue, do, extern, for, goto, register,
+            //       sizeof, static, typedef, union and volatile.
+            for (const auto* keyword : allKeywords)
+            {
+                addKeyword(keyword);
+            }
+        });
     }
 }
 
@@ -12,6 +12,7 @@
 #include <cmm/Token.h>
 
 // std includes
+#include <algorithm>
 #include <limits>
 #include <optional>
 #include <sstream>
@@ -40,8 +41,9 @@ namespace cmm
     static std::optional<f64> validateDouble(const std::string& str)
     {
 #if !OS_WIN
-        mpf_class value(str);
-        return value ? std::make_optional<f64>(value.get_d()) : std::nullopt;
+        // Note: Check set_str's result rather than the value itself, which is falsy for '0.0'.
+        mpf_class value;
+        return value.set_str(str, 10) == 0 ? std::make_optional<f64>(value.get_d()) : std::nullopt;
 #else
         std::size_t parseCount = 0;
         const f64 value = std::stod(str, &parseCount);
@@ -72,6 +74,11 @@ namespace cmm
         builder.reserve(0x40);
     }
 
+    Lexer::Lexer(std::string&& text, const Location& location) CMM_NOEXCEPT : text(std::move(text)), index(0), location(location)
+    {
+        builder.reserve(0x40);
+    }
+
     Location Lexer::getLocation() const CMM_NOEXCEPT
     {
         return location;
@@ -125,6 +132,14 @@ namespace cmm
         return Snapshot(index, location);
     }
 
+    Lexer Lexer::slice(const Snapshot& begin, const Snapshot& end) const
+    {
+        const auto beginIndex = std::min(begin.getIndex(), text.size());
+        const auto endIndex = std::min(std::max(beginIndex, end.getIndex()), text.size());
+
+        return Lexer(text.substr(beginIndex, endIndex - beginIndex), begin.getLocation());
+    }
+
     void Lexer::consumeWhitespace()
     {
         while (true)
@@ -607,13 +622,41 @@ namespace cmm
             case CHAR_COLON:
             case CHAR_COMMA:
             case CHAR_SEMI_COLON:
-            case CHAR_AMPERSAND:
             case CHAR_ASTERISK:
+            case CHAR_CARET:
+            case CHAR_PERCENT:
+                token.setCharSymbol(currentChar);
+                return true;
+            case CHAR_AMPERSAND:
+            case CHAR_EQUALS:
+            case CHAR_EXCLAMATION:
             case CHAR_GT:
             case CHAR_LT:
-            case CHAR_EQUALS:
-                token.setCharSymbol(currentChar);
+            case CHAR_PIPE:
+            {
+                // Operators that may be the first half of a two character operator
+                // (i.e. '&&', '==', '!=', '>=', '>>', '<=', '<<', '||').
+                const char lookaheadChar = peekNextChar();
+                const bool isDoubled = lookaheadChar == currentChar &&
+                    currentChar != CHAR_EXCLAMATION;
+                const bool isFollowedByEquals = lookaheadChar == CHAR_EQUALS &&
+                    currentChar != CHAR_AMPERSAND && currentChar != CHAR_PIPE;
+
+                if (isDoubled || isFollowedByEquals)
+                {
+                    nextChar();
+
+                    const char symbol[] = { currentChar, lookaheadChar, CHAR_NULL };
+                    token.setStringSymbol(symbol);
+                }
+
+                else
+                {
+                    token.setCharSymbol(currentChar);
+                }
+
                 return true;
+            }
             case CHAR_EOF:
                 return false;
             default:
@@ -1,20 +1,126 @@
 // Our includes
 #include <cmm/NodeList.h>
 #include <cmm/Parser.h>
+#include <cmm/Reporter.h>
+#include <cmm/ir/Module.h>
+#include <cmm/ir/Verifier.h>
+#include <cmm/opt/LoopVectorize.h>
+#include <cmm/opt/PassManager.h>
+#include <cmm/platform/IRPlatformLLVM.h>
 #include <cmm/platform/PlatformLLVM.h>
 #include <cmm/visit/Analyzer.h>
 // #include <cmm/visit/Dump.h>
 #include <cmm/visit/Encode.h>
+#include <cmm/visit/Lower.h>
 
 // std includes
+#include <algorithm>
+#include <cctype>
 // #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <string>
 
 using namespace cmm;
 
-int main()
+int main(int argc, char* argv[])
 {
+    bool stats = false;
+    bool memoizeParse = false;
+    opt::EnumOptLevel optLevel = opt::EnumOptLevel::O2;
+    std::string passes;
+    u32 vectorWidth = opt::LoopVectorize::defaultVectorWidth;
+    u32 parseThreadCount = 1;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+
+        if (arg == "--stats")
+        {
+            stats = true;
+        }
+
+        // Use the packrat memo table while parsing (its counters are printed with --stats).
+        else if (arg == "--memoize-parse")
+        {
+            memoizeParse = true;
+        }
+
+        else if (arg == "-O0")
+        {
+            optLevel = opt::EnumOptLevel::O0;
+        }
+
+        else if (arg == "-O1")
+        {
+            optLevel = opt::EnumOptLevel::O1;
+        }
+
+        else if (arg == "-O2")
+        {
+            optLevel = opt::EnumOptLevel::O2;
+        }
+
+        else if (arg.rfind("--passes=", 0) == 0)
+        {
+            passes = arg.substr(std::string("--passes=").size());
+        }
+
+        // The number of threads parsing top-level function bodies (1 parses sequentially).
+        else if (arg.rfind("--parse-threads=", 0) == 0)
+        {
+            const std::string value = arg.substr(std::string("--parse-threads=").size());
+            const bool isNumber = !value.empty() && value.size() <= 3
+                && std::all_of(value.cbegin(), value.cend(), [](const char ch) { return std::isdigit(static_cast<unsigned char>(ch)) != 0; });
+
+            parseThreadCount = isNumber ? static_cast<u32>(std::stoul(value)) : 0;
+
+            if (parseThreadCount == 0)
+            {
+                std::cerr << "Invalid parse thread count '" << value << "' (expected 1 to 999)" << std::endl;
+                return -1;
+            }
+        }
+
+        // The width in bits of the target's vector registers (0 disables vectorization).
+        else if (arg.rfind("--vector-width=", 0) == 0)
+        {
+            const std::string value = arg.substr(std::string("--vector-width=").size());
+            const bool isNumber = !value.empty() && value.size() <= 4
+                && std::all_of(value.cbegin(), value.cend(), [](const char ch) { return std::isdigit(static_cast<unsigned char>(ch)) != 0; });
+
+            vectorWidth = isNumber ? static_cast<u32>(std::stoul(value)) : 1;
+
+            if (vectorWidth != 0 && (vectorWidth < 64 || vectorWidth > 1024 || (vectorWidth & (vectorWidth - 1)) != 0))
+            {
+                std::cerr << "Invalid vector width '" << value << "' (expected 0 or a power of two from 64 to 1024)" << std::endl;
+                return -1;
+            }
+        }
+
+        else
+        {
+            std::cerr << "Unknown option '" << arg << "'" << std::endl;
+            return -1;
+        }
+    }
+
+    // An explicit pipeline replaces the one of the optimization level.
+    opt::PassManager passManager;
+    passManager.setVectorWidth(vectorWidth);
+
+    if (passes.empty())
+    {
+        passManager.addDefaultPipeline(optLevel);
+    }
+
+    else if (std::string pipelineError; !passManager.addPipeline(passes, &pipelineError))
+    {
+        std::cerr << pipelineError << std::endl;
+        return -1;
+    }
+
     // std::string input = "struct Vec2 { int x; int y; }; int sum(int x, int y) { return x + y; } int main() { int a; a = 10; int b; b = 32; int c; c = sum(a, b); return c; }";
     // std::string input = "int main() { int a; a = 10; if (a + 1) { a = 20; } else { a = 30; } return a; }";
     // std::string input = "void func(); int main() { float a; a = 10.0F; float b; b = 16.0F; float c; c = (2.0F * -b) + a; int result; result = (int) c; return result; }";
@@ -30,8 +136,15 @@ int main()
     std::string input = "struct FILE* fopen(char* filename, char* mode); int fclose(struct FILE*); int fputs(char* str, struct FILE*); int main() { struct FILE* file; file = fopen(\"test.txt\", \"w\"); fputs(\"Hello, world!\", file); fclose(file); return 0; }";
     std::string errorMessage;
     Parser parser(input);
+    parser.setParseThreadCount(parseThreadCount);
+    parser.setMemoizationEnabled(memoizeParse);
     auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
 
+    if (stats && memoizeParse)
+    {
+        std::cerr << "Parser memo table:\n" << parser.getMemoStats().toString() << std::endl;
+    }
+
     if (compUnitPtr != nullptr)
     {
         // Dump dump;
@@ -40,10 +153,43 @@ int main()
         Analyzer analyzer;
         analyzer.visit(*compUnitPtr);
 
-        PlatformLLVM platform;
+        if (Reporter::instance().getErrorCount() > 0)
+        {
+            return -1;
+        }
+
+        // Legacy path: Encode straight from the AST.
+        // PlatformLLVM platform;
+        // std::ostringstream os;
+        // Encode encoder(&platform, os);
+        // encoder.visit(*compUnitPtr);
+
+        ir::Module module("main");
+        Lower lower(module);
+        lower.visit(*compUnitPtr);
+
+        passManager.run(module);
+
+        if (stats)
+        {
+            passManager.printStatistics(std::cerr);
+        }
+
+        ir::Verifier verifier;
+
+        if (!verifier.verify(module))
+        {
+            for (const auto& error : verifier.getErrors())
+            {
+                std::cerr << "[IR]: " << error << std::endl;
+            }
+
+            return -1;
+        }
+
+        IRPlatformLLVM platform;
         std::ostringstream os;
-        Encode encoder(&platform, os);
-        encoder.visit(*compUnitPtr);
+        platform.emit(module, os);
 
         std::cout << "Output:\n" << os.str() << std::endl;
     }
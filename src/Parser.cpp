@@ -11,17 +11,22 @@
 #include <cmm/Enumerator.h>
 #include <cmm/Keyword.h>
 #include <cmm/NodeList.h>
-#include <cmm/ParserPredictor.h>
+#include <cmm/ParserDispatchTable.h>
+#include <cmm/ParserMemo.h>
 #include <cmm/Reporter.h>
 #include <cmm/Snapshot.h>
 #include <cmm/Token.h>
 
 // std includes
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <optional>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -33,7 +38,148 @@
 
 namespace cmm
 {
-    static EnumTable currentEnumTable;
+    // Note: thread_local since top-level function bodies may be parsed on worker threads.
+    static thread_local EnumTable currentEnumTable;
+
+    // The packrat memo table for the current thread's parse or nullptr if disabled.
+    static thread_local ParserMemo* currentParserMemo = nullptr;
+
+    /**
+     * A top-level statement's span of the input as found by the brace matching pre-pass.
+     */
+    struct TopLevelSegment
+    {
+        // The start of the segment (inclusive).
+        Snapshot begin;
+
+        // The end of the segment (exclusive).
+        Snapshot end;
+
+        // Whether the segment ends with a top-level '{...}' body (i.e. a function definition).
+        bool isFunctionDefinition;
+    };
+
+    /**
+     * The result of parsing a single TopLevelSegment.
+     */
+    struct TopLevelSegmentResult
+    {
+        // The parsed statement or nullptr on failure.
+        std::unique_ptr<StatementNode> statement;
+
+        // The enums defined while parsing this segment.
+        EnumTable enumTable;
+
+        // The first error message reported while parsing this segment.
+        std::string errorMessage;
+
+        // The errors and warnings reported while parsing this segment, held back until the
+        // segments are stitched back together in source order.
+        Reporter::DeferredReportList reports;
+
+        // The memo table's counters for this segment.
+        ParserMemoStats memoStats;
+    };
+
+    /**
+     * A block whose '{' was consumed, but not its '}' yet.
+     */
+    struct OpenBlock
+    {
+        /**
+         * Constructor.
+         *
+         * @param snapshot the Snapshot of the lexer at the block's '{'.
+         */
+        explicit OpenBlock(const Snapshot& snapshot) : snapshot(snapshot)
+        {
+        }
+
+        // The lexer at the block's '{'.
+        Snapshot snapshot;
+
+        // The Location of the '{'.
+        Location beginLoc;
+
+        // The statements parsed so far.
+        BlockNode::StatementList statements;
+    };
+
+    /**
+     * The binding power and associativity of a binary operator.
+     */
+    struct BinOpPrecedence
+    {
+        // Higher binds tighter.  Starts at 1 so that 1 may be used as the lowest minimum precedence.
+        u32 precedence;
+
+        // Whether 'a op b op c' groups as 'a op (b op c)'.
+        bool rightAssociative;
+    };
+
+    // Indexed by EnumBinOpNodeType, follows the C operator precedence rules.
+    static CMM_CONSTEXPR std::array<BinOpPrecedence, static_cast<std::size_t>(EnumBinOpNodeType::COUNT)> binOpPrecedenceTable = {{
+        { 1, true },   // ASSIGNMENT
+        { 10, false }, // ADD
+        { 10, false }, // SUBTRACT
+        { 11, false }, // MULTIPLY
+        { 11, false }, // DIVIDE
+        { 7, false },  // CMP_EQ
+        { 7, false },  // CMP_NE
+        { 8, false },  // CMP_GE
+        { 8, false },  // CMP_GT
+        { 8, false },  // CMP_LE
+        { 8, false },  // CMP_LT
+        { 11, false }, // MODULUS
+        { 6, false },  // BITWISE_AND
+        { 4, false },  // BITWISE_OR
+        { 5, false },  // BITWISE_XOR
+        { 9, false },  // SHIFT_LEFT
+        { 9, false },  // SHIFT_RIGHT
+        { 3, false },  // LOGICAL_AND
+        { 2, false }   // LOGICAL_OR
+    }};
+
+    // The minimum precedence that accepts any binary operator.
+    static CMM_CONSTEXPR u32 lowestBinOpPrecedence = 1;
+
+    /**
+     * Runs a parse rule through the current thread's ParserMemo (if any).  If the same rule
+     * already failed at the same position, fail immediately and leave the lexer exactly
+     * where the original attempt did.
+     *
+     * @param rule the EnumParseRule being attempted.
+     * @param parseFunc the un-memoized parse function.
+     * @param lexer the Lexer.
+     * @param errorMessage pointer to the error message.
+     * @return the parse function's result.
+     */
+    template<class ResultType>
+    static ResultType parseMemoized(const EnumParseRule rule, ResultType (*parseFunc)(Lexer&, std::string*), Lexer& lexer, std::string* errorMessage)
+    {
+        if (currentParserMemo == nullptr)
+        {
+            return parseFunc(lexer, errorMessage);
+        }
+
+        const auto startIndex = lexer.snap().getIndex();
+        const auto* failureEnd = currentParserMemo->findFailure(rule, startIndex);
+
+        if (failureEnd != nullptr)
+        {
+            lexer.restore(*failureEnd);
+            return nullptr;
+        }
+
+        auto result = parseFunc(lexer, errorMessage);
+
+        if (result == nullptr)
+        {
+            currentParserMemo->addFailure(rule, startIndex, lexer.snap());
+        }
+
+        return result;
+    }
 
     // TODO: This should be broken out into a different class or file.
     template<class T>
@@ -73,16 +219,25 @@ namespace cmm
     static bool testExpectChar(Lexer& lexer, std::string* errorMessage, const char ch);
 
     static TranslationUnitNode parseTranslationUnit(Lexer& lexer, std::string* errorMessage);
+    static std::optional<TranslationUnitNode> parseTranslationUnitParallel(Lexer& lexer, std::string* errorMessage, const u32 threadCount, ParserMemoStats* memoStats);
+    static std::optional<std::vector<TopLevelSegment>> splitTopLevelSegments(Lexer& lexer);
+    static TopLevelSegmentResult parseTopLevelSegment(Lexer lexer, const bool memoize);
 
     // Statements:
+    static std::unique_ptr<StatementNode> parseBreakStatement(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<CaseStatementNode> parseCaseStatement(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<StatementNode> parseDeclarationStatement(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<StatementNode> parseDeclarationStatementUncached(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<StatementNode> parseExpressionStatement(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<StatementNode> parseIfElseStatement(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<StatementNode> parseReturnStatement(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<ReturnStatementNode> parseReturnStatementStrict(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<StatementNode> parseSwitchStatement(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<StatementNode> parseWhileStatement(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<StatementNode> parseStatement(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<StatementNode> parseBlockStatementNode(Lexer& lexer, std::string* errorMessage);
     static std::optional<std::vector<std::unique_ptr<StatementNode>>> parseOneOrMoreStatements(Lexer& lexer, std::string* errorMessage);
+    static bool isSwitchLabelOrEnd(Lexer& lexer);
 
     // Other utility parsing functions
     static std::optional<BlockNode> parseBlockStatement(Lexer& lexer, std::string* errorMessage);
@@ -93,34 +248,106 @@ namespace cmm
     static std::optional<std::vector<ArgNode>> parseFunctionCallArgs(Lexer& lexer, std::string* errorMessage);
     static std::optional<std::vector<ParameterNode>> parseFunctionParameters(Lexer& lexer, std::string* errorMessage);
     static std::optional<u32> parsePointerInderectionCount(Lexer& lexer, std::string* errorMessage, Location* location); // TODO: Make location not optional?
+    static std::optional<u32> parseArrayDeclarator(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<ExpressionNode> buildDerefNode(const u32 count, std::unique_ptr<ExpressionNode>&& expr);
 
     // Expression types:
     static std::unique_ptr<ExpressionNode> parseExpression(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<ExpressionNode> parseFunctionCallOrVariable(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<ExpressionNode> parseFunctionCallOrVariableUncached(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<ExpressionNode> parseCastExpression(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<ExpressionNode> parseCastExpressionUncached(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<ExpressionNode> parseParenExpression(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<ExpressionNode> parseParenExpressionUncached(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<ExpressionNode> parseParenOrCastExpression(Lexer& lexer, std::string* errorMessage);
+    static bool isCastAhead(Lexer& lexer);
     static std::unique_ptr<ExpressionNode> parsePrimaryExpression(Lexer& lexer, std::string* errorMessage);
-    static std::unique_ptr<ExpressionNode> parseMultiplyDivideBinOpNode(Lexer& lexer, std::string* errorMessage);
-    static std::unique_ptr<ExpressionNode> parseAddSubBinOpNode(Lexer& lexer, std::string* errorMessage);
-    static std::unique_ptr<ExpressionNode> parseAssignmentBinOpNode(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<ExpressionNode> parseBinaryOperand(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<ExpressionNode> parseBinaryExpression(Lexer& lexer, std::string* errorMessage, const u32 minPrecedence);
 
     // Terminal nodes:
     static std::optional<std::pair<EnumFieldAccessType, std::string>> parseFieldAccessNode(Lexer& lexer, std::string* errorMessage);
+    static std::unique_ptr<ExpressionNode> parseArrayIndex(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<ExpressionNode> parseLitteralOrLRValueNode(Lexer& lexer, std::string* errorMessage);
     static std::unique_ptr<ExpressionNode> parseUnaryExpression(Lexer& lexer, std::string* errorMessage);
     static std::optional<VariableNode> parseVariableNode(Lexer& lexer, std::string* errorMessage);
 
     static std::optional<TypeNode> parseTypeNode(Lexer& lexer, std::string* errorMessage);
+    static bool isIntegerTypeName(const std::string& name) CMM_NOEXCEPT;
+
+    using StatementParseFunc = std::unique_ptr<StatementNode> (*)(Lexer&, std::string*);
+    using ExpressionParseFunc = std::unique_ptr<ExpressionNode> (*)(Lexer&, std::string*);
+
+    // Statement parse functions keyed by the statement's first token.  Anything
+    // not in the table is parsed as an expression statement.
+    static CMM_CONSTEXPR auto statementDispatchTable = []()
+    {
+        ParserDispatchTable<StatementParseFunc> table;
+        table.registerFunction(EnumKeyword::RETURN, parseReturnStatement);
+        table.registerFunction(EnumKeyword::IF, parseIfElseStatement);
+        table.registerFunction(EnumKeyword::WHILE, parseWhileStatement);
+        table.registerFunction(EnumKeyword::SWITCH, parseSwitchStatement);
+        table.registerFunction(EnumKeyword::BREAK, parseBreakStatement);
+        table.registerFunction(CHAR_LCURLY_BRACKET, parseBlockStatementNode);
+
+        for (std::size_t i = 0; i < keywordInfoTable.size(); ++i)
+        {
+            if (keywordInfoTable[i].isAType)
+            {
+                table.registerFunction(static_cast<EnumKeyword>(i), parseDeclarationStatement);
+            }
+        }
 
-    Parser::Parser(const std::string& input) : lexer(input)
+        return table;
+    }();
+
+    // Binary operand parse functions keyed by the operand's first token.  Anything
+    // not in the table is parsed as a literal, variable, call, etc.
+    // Note: Previously, we tried to parse a Cast or Paren expression node up front for
+    // the whole expression.  This will not work for BinOpNodes that start with a Cast or
+    // Paren expression because it will not expect 'extra' tokens past the closing expression.
+    // This causes expressions such as 'a = (2 + 3) * 2;' to fail.
+    static CMM_CONSTEXPR auto expressionDispatchTable = []()
+    {
+        ParserDispatchTable<ExpressionParseFunc> table;
+        table.registerFunction(CHAR_LPAREN, parseParenOrCastExpression);
+
+        return table;
+    }();
+
+    Parser::Parser(const std::string& input) : lexer(input), parseThreadCount(1), memoize(false)
     {
     }
 
-    Parser::Parser(std::string&& input) CMM_NOEXCEPT : lexer(std::move(input))
+    Parser::Parser(std::string&& input) CMM_NOEXCEPT : lexer(std::move(input)), parseThreadCount(1), memoize(false)
     {
     }
 
+    u32 Parser::getParseThreadCount() const CMM_NOEXCEPT
+    {
+        return parseThreadCount;
+    }
+
+    void Parser::setParseThreadCount(const u32 threadCount) CMM_NOEXCEPT
+    {
+        parseThreadCount = std::max<u32>(threadCount, 1);
+    }
+
+    bool Parser::isMemoizationEnabled() const CMM_NOEXCEPT
+    {
+        return memoize;
+    }
+
+    void Parser::setMemoizationEnabled(const bool enable) CMM_NOEXCEPT
+    {
+        memoize = enable;
+    }
+
+    const ParserMemoStats& Parser::getMemoStats() const CMM_NOEXCEPT
+    {
+        return memoStats;
+    }
+
     std::unique_ptr<CompilationUnitNode> Parser::parseCompilationUnit(std::string* errorMessage)
     {
         static Reporter& reporter = Reporter::instance();
@@ -130,7 +357,27 @@ namespace cmm
             return nullptr;
         }
 
-        auto translationUnit = parseTranslationUnit(lexer, errorMessage);
+        std::optional<TranslationUnitNode> optTranslationUnit;
+        memoStats = ParserMemoStats();
+
+        if (parseThreadCount > 1)
+        {
+            optTranslationUnit = parseTranslationUnitParallel(lexer, errorMessage, parseThreadCount, memoize ? &memoStats : nullptr);
+        }
+
+        // Either single threaded or the speculative parse did not apply to this input.
+        if (!optTranslationUnit.has_value())
+        {
+            ParserMemo memo;
+            currentParserMemo = memoize ? &memo : nullptr;
+
+            optTranslationUnit = parseTranslationUnit(lexer, errorMessage);
+
+            currentParserMemo = nullptr;
+            memoStats += memo.getStats();
+        }
+
+        auto& translationUnit = *optTranslationUnit;
 
         // Make sure no other tokens are left in the lexer's token stream.
         if (!lexer.completedOrWhitespaceOnly())
@@ -187,84 +434,102 @@ namespace cmm
     std::optional<BlockNode> parseBlockStatement(Lexer& lexer, std::string* errorMessage, const std::optional<std::unordered_set<EnumNodeType>>& validNodeTypes)
     {
         static Reporter& reporter = Reporter::instance();
-        auto snapshot = lexer.snap();
         auto token = newToken();
         bool result = lexer.peekNextToken(token);
 
         if (!result || !token.isCharSymbol() || token.asCharSymbol() != CHAR_LCURLY_BRACKET)
         {
-            lexer.restore(snapshot);
             return std::nullopt;
         }
 
-        // Save the location as the start of the BlockNode.
-        Location beginLoc;
-
-        // Consume token
-        lexer.nextToken(token, errorMessage, &beginLoc);
+        // Directly nested blocks ('{ { { ... } } }') are parsed with an explicit stack of the
+        // blocks still open rather than by recursing through parseStatement once per level.
+        // The restrictions (if any) only apply to the statements of the outermost block.
+        const bool canNestBlocks = validNodeTypes == std::nullopt || validNodeTypes->find(EnumNodeType::BLOCK) != validNodeTypes->end();
+        std::vector<OpenBlock> openBlocks;
 
-        BlockNode::StatementList statements;
-        statements.reserve(0x10);
-
-        //{
         while (true)
         {
+            // Open a block, where the lexer is at its '{'.
+            if (result && token.isCharSymbol() && token.asCharSymbol() == CHAR_LCURLY_BRACKET
+                && (openBlocks.size() != 1 || canNestBlocks))
+            {
+                auto& openBlock = openBlocks.emplace_back(lexer.snap());
+
+                // Consume token
+                lexer.nextToken(token, errorMessage, &openBlock.beginLoc);
+                openBlock.statements.reserve(0x10);
+                result = lexer.peekNextToken(token);
+                continue;
+            }
+
             auto currentStatement = parseStatement(lexer, errorMessage);
 
             if (currentStatement != nullptr)
             {
                 // Check if there are restrictions and if there are, make sure the types match.
-                if (validNodeTypes == std::nullopt || validNodeTypes->find(currentStatement->getType()) != validNodeTypes->end())
-                {
-                    statements.push_back(std::unique_ptr<StatementNode>(static_cast<StatementNode*>(currentStatement.release())));
-                }
-
-                // Invalid, bail out as invalid
-                else
+                if (openBlocks.size() == 1 && validNodeTypes != std::nullopt && validNodeTypes->find(currentStatement->getType()) == validNodeTypes->end())
                 {
-                    lexer.restore(snapshot);
+                    // Invalid, bail out as invalid
+                    lexer.restore(openBlocks.front().snapshot);
                     return std::nullopt;
                 }
+
+                openBlocks.back().statements.emplace_back(std::move(currentStatement));
+                result = lexer.peekNextToken(token);
+                continue;
             }
 
-            else
+            result = lexer.peekNextToken(token);
+
+            if (!result || !token.isCharSymbol() || token.asCharSymbol() != CHAR_RCURLY_BRACKET)
             {
-                break;
-            }
-        }
-        //}
+                // Same as the blocks failing one at a time from the innermost out, i.e. each
+                // enclosing block then finds its nested block's '{' where it expected a '}'.
+                while (!openBlocks.empty())
+                {
+                    std::ostringstream builder;
+                    builder << "Expected a closing '}' bracket";
 
-        result = lexer.peekNextToken(token);
+                    // If it was a valid lex, we can also include the token...
+                    if (result)
+                    {
+                        builder << ", but found '" << token.toString() << "'";
+                    }
 
-        if (!result || !token.isCharSymbol() || token.asCharSymbol() != CHAR_RCURLY_BRACKET)
-        {
-            std::ostringstream builder;
-            builder << "Expected a closing '}' bracket";
+                    std::string err = builder.str();
+                    reporter.error(err, lexer.getLocation());
 
-            // If it was a valid lex, we can also include the token...
-            if (result)
-            {
-                builder << ", but found '" << token.toString() << "'";
-            }
+                    if (canWriteErrorMessage(errorMessage))
+                    {
+                        *errorMessage = std::move(err);
+                    }
 
-            std::string err = builder.str();
-            reporter.error(err, lexer.getLocation());
+                    lexer.restore(openBlocks.back().snapshot);
+                    openBlocks.pop_back();
+                    result = lexer.peekNextToken(token);
+                }
 
-            if (canWriteErrorMessage(errorMessage))
-            {
-                *errorMessage = std::move(err);
+                return std::nullopt;
             }
 
-            lexer.restore(snapshot);
-            return std::nullopt;
-        }
+            Location endLoc;
 
-        Location endLoc;
+            // Consume token
+            lexer.nextToken(token, errorMessage, &endLoc);
 
-        // Consume token
-        lexer.nextToken(token, errorMessage, &endLoc);
+            auto& closedBlock = openBlocks.back();
+            BlockNode blockNode(closedBlock.beginLoc, endLoc, std::move(closedBlock.statements));
+            openBlocks.pop_back();
 
-        return std::make_optional<BlockNode>(beginLoc, endLoc, std::move(statements));
+            if (openBlocks.empty())
+            {
+                return std::make_optional<BlockNode>(std::move(blockNode));
+            }
+
+            openBlocks.back().statements.emplace_back(std::make_unique<BlockNode>(std::move(blockNode)));
+            result = lexer.peekNextToken(token);
+        }
     }
 
     /* static */
@@ -758,53 +1023,235 @@ namespace cmm
     }
 
     /* static */
-    std::unique_ptr<StatementNode> parseStatement(Lexer& lexer, std::string* errorMessage)
+    std::unique_ptr<StatementNode> parseSwitchStatement(Lexer& lexer, std::string* errorMessage)
     {
-        static ParserPredictor<std::unique_ptr<StatementNode>(Lexer&, std::string*)> predictor;
+        static Reporter& reporter = Reporter::instance();
 
-        if (predictor.empty())
+        const auto snapshot = lexer.snap();
+        auto token = newToken();
+
+        // Save the location as the start of the SwitchStatementNode.
+        Location location;
+        bool result = lexer.nextToken(token, errorMessage, &location);
+
+        // Look for 'switch'
+        if (!result || !token.isStringSymbol() || token.asStringSymbol() != "switch")
         {
-            auto token = newToken();
-            token.setStringSymbol(Keyword::RETURN.getName());
-            predictor.registerFunction(token, parseReturnStatement);
+            lexer.restore(snapshot);
+            return nullptr;
+        }
+
+        // Look for '('
+        result = lexer.nextToken(token, errorMessage);
 
-            token.setStringSymbol(Keyword::IF.getName());
-            predictor.registerFunction(token, parseIfElseStatement);
+        if (!result || !token.isCharSymbol() || token.asCharSymbol() != CHAR_LPAREN)
+        {
+            if (canWriteErrorMessage(errorMessage))
+            {
+                *errorMessage = "expected '(' following the start of a switch statement.";
+                reporter.error(*errorMessage, lexer.getLocation());
+            }
 
-            token.setStringSymbol(Keyword::WHILE.getName());
-            predictor.registerFunction(token, parseWhileStatement);
+            lexer.restore(snapshot);
+            return nullptr;
+        }
 
-            token.setCharSymbol(CHAR_LCURLY_BRACKET);
+        // Expect the expression to switch on
+        auto conditional = parseExpression(lexer, errorMessage);
 
-            static const auto parseBlockStatementWrapper = [](Lexer& lexer, std::string* errorMessage) -> std::unique_ptr<StatementNode>
+        if (conditional == nullptr)
+        {
+            if (canWriteErrorMessage(errorMessage))
             {
-                auto optionalBlockNode = parseBlockStatement(lexer, errorMessage);
-                return optionalBlockNode.has_value() ? std::make_unique<BlockNode>(std::move(*optionalBlockNode)) : nullptr;
-            };
+                *errorMessage = "expected an expression to switch on.";
+                reporter.error(*errorMessage, lexer.getLocation());
+            }
 
-            predictor.registerFunction(token, parseBlockStatementWrapper);
+            lexer.restore(snapshot);
+            return nullptr;
+        }
 
-            Keyword::registerPrimitiveKeywordsByName([&](const std::string& keywordName)
-                    {
-                        token.setStringSymbol(keywordName);
-                        predictor.registerFunction(token, parseDeclarationStatement);
-                    });
+        // Expect closing paren
+        result = lexer.nextToken(token, errorMessage);
+
+        if (!result || !token.isCharSymbol() || token.asCharSymbol() != CHAR_RPAREN)
+        {
+            if (canWriteErrorMessage(errorMessage))
+            {
+                *errorMessage = "expected ')' following the end of a switch statement's expression.";
+                reporter.error(*errorMessage, lexer.getLocation());
+            }
+
+            lexer.restore(snapshot);
+            return nullptr;
+        }
+
+        // The body must be a block made of labels and the statements following them.
+        result = lexer.nextToken(token, errorMessage);
+
+        if (!result || !token.isCharSymbol() || token.asCharSymbol() != CHAR_LCURLY_BRACKET)
+        {
+            if (canWriteErrorMessage(errorMessage))
+            {
+                *errorMessage = "expected '{' following a switch statement's expression.";
+                reporter.error(*errorMessage, lexer.getLocation());
+            }
+
+            lexer.restore(snapshot);
+            return nullptr;
+        }
+
+        SwitchStatementNode::CaseList cases;
+
+        while (true)
+        {
+            result = lexer.peekNextToken(token);
+
+            if (result && token.isCharSymbol() && token.asCharSymbol() == CHAR_RCURLY_BRACKET)
+            {
+                // Consume the '}'
+                lexer.nextToken(token, errorMessage);
+                break;
+            }
+
+            auto caseStatementPtr = parseCaseStatement(lexer, errorMessage);
+
+            if (caseStatementPtr == nullptr)
+            {
+                if (canWriteErrorMessage(errorMessage))
+                {
+                    *errorMessage = "expected 'case', 'default' or '}' within a switch statement.";
+                    reporter.error(*errorMessage, lexer.getLocation());
+                }
+
+                lexer.restore(snapshot);
+                return nullptr;
+            }
+
+            cases.emplace_back(std::move(caseStatementPtr));
+        }
+
+        return std::make_unique<SwitchStatementNode>(location, std::move(conditional), std::move(cases));
+    }
+
+    /* static */
+    std::unique_ptr<CaseStatementNode> parseCaseStatement(Lexer& lexer, std::string* errorMessage)
+    {
+        static Reporter& reporter = Reporter::instance();
+
+        const auto snapshot = lexer.snap();
+        auto token = newToken();
+
+        // Save the location as the start of the CaseStatementNode.
+        Location location;
+        bool result = lexer.nextToken(token, errorMessage, &location);
+
+        if (!result || !token.isStringSymbol())
+        {
+            lexer.restore(snapshot);
+            return nullptr;
+        }
+
+        // 'default' has no expression.
+        std::unique_ptr<ExpressionNode> expression;
+
+        if (token.asStringSymbol() == "case")
+        {
+            expression = parseExpression(lexer, errorMessage);
+
+            if (expression == nullptr)
+            {
+                if (canWriteErrorMessage(errorMessage))
+                {
+                    *errorMessage = "expected an expression following 'case'.";
+                    reporter.error(*errorMessage, lexer.getLocation());
+                }
+
+                lexer.restore(snapshot);
+                return nullptr;
+            }
+        }
+
+        else if (token.asStringSymbol() != "default")
+        {
+            lexer.restore(snapshot);
+            return nullptr;
+        }
+
+        if (!expectChar(lexer, errorMessage, CHAR_COLON))
+        {
+            if (canWriteErrorMessage(errorMessage))
+            {
+                *errorMessage = "expected ':' following a 'case' or 'default' label.";
+                reporter.error(*errorMessage, lexer.getLocation());
+            }
+
+            lexer.restore(snapshot);
+            return nullptr;
+        }
+
+        // Statements up to the next label or the end of the switch.  A statement failing to
+        // parse is left for the caller to report.
+        CaseStatementNode::StatementList statements;
+
+        while (!isSwitchLabelOrEnd(lexer))
+        {
+            auto statement = parseStatement(lexer, errorMessage);
+
+            if (statement == nullptr)
+            {
+                break;
+            }
+
+            statements.emplace_back(std::move(statement));
+        }
+
+        return std::make_unique<CaseStatementNode>(location, std::move(expression), std::move(statements));
+    }
+
+    /* static */
+    std::unique_ptr<StatementNode> parseBreakStatement(Lexer& lexer, std::string* errorMessage)
+    {
+        const auto snapshot = lexer.snap();
+        auto token = newToken();
+
+        // Save the location as the start of the BreakStatementNode.
+        Location location;
+        bool result = lexer.nextToken(token, errorMessage, &location);
+
+        if (!result || !token.isStringSymbol() || token.asStringSymbol() != "break" || !expectSemicolon(lexer, errorMessage))
+        {
+            lexer.restore(snapshot);
+            return nullptr;
         }
 
+        return std::make_unique<BreakStatementNode>(location);
+    }
+
+    /* static */
+    std::unique_ptr<StatementNode> parseBlockStatementNode(Lexer& lexer, std::string* errorMessage)
+    {
+        auto optionalBlockNode = parseBlockStatement(lexer, errorMessage);
+        return optionalBlockNode.has_value() ? std::make_unique<BlockNode>(std::move(*optionalBlockNode)) : nullptr;
+    }
+
+    /* static */
+    std::unique_ptr<StatementNode> parseStatement(Lexer& lexer, std::string* errorMessage)
+    {
         auto tokenLookahead = newToken();
         const bool result = lexer.peekNextToken(tokenLookahead);
 
         if (result)
         {
-            auto predictionContext = predictor.predict(tokenLookahead);
+            const auto parseFunc = statementDispatchTable.dispatch(tokenLookahead);
 
-            if (predictionContext.has_value())
+            if (parseFunc != nullptr)
             {
-                return predictor.call<std::unique_ptr<StatementNode>>(*predictionContext, lexer, errorMessage);
+                return parseFunc(lexer, errorMessage);
             }
         }
 
-        // TODO: See if we can get this in the predictor as well.  Leaving for now...
+        // TODO: See if we can get this in the dispatch table as well.  Leaving for now...
         const auto snapshot = lexer.snap();
         std::unique_ptr<StatementNode> node = parseExpressionStatement(lexer, errorMessage);
 
@@ -837,6 +1284,24 @@ namespace cmm
         return std::make_optional(std::move(results));
     }
 
+    /* static */
+    bool isSwitchLabelOrEnd(Lexer& lexer)
+    {
+        auto token = newToken();
+
+        if (!lexer.peekNextToken(token))
+        {
+            return true;
+        }
+
+        else if (token.isCharSymbol())
+        {
+            return token.asCharSymbol() == CHAR_RCURLY_BRACKET;
+        }
+
+        return token.isStringSymbol() && (token.asStringSymbol() == "case" || token.asStringSymbol() == "default");
+    }
+
     /* static */
     std::optional<std::vector<ArgNode>> parseFunctionCallArgs(Lexer& lexer, std::string* errorMessage)
     {
@@ -955,6 +1420,52 @@ namespace cmm
         return std::make_optional(count);
     }
 
+    /* static */
+    std::optional<u32> parseArrayDeclarator(Lexer& lexer, std::string* errorMessage)
+    {
+        static auto& reporter = Reporter::instance();
+        auto snapshot = lexer.snap();
+        auto token = newToken();
+
+        if (!lexer.peekNextToken(token) || !token.isCharSymbol() || token.asCharSymbol() != CHAR_LSQUARE_BRACKET)
+        {
+            return std::nullopt;
+        }
+
+        Location location;
+        lexer.nextToken(token, errorMessage, &location);
+        bool lexResult = lexer.nextToken(token, errorMessage);
+        u32 length = 0;
+
+        // An unsized '[]' (only valid for parameters).
+        if (lexResult && token.isCharSymbol() && token.asCharSymbol() == CHAR_RSQUARE_BRACKET)
+        {
+            return std::make_optional(length);
+        }
+
+        if (lexResult && token.getType() == TokenType::INT32 && token.asInt32() > 0)
+        {
+            length = static_cast<u32>(token.asInt32());
+            lexResult = lexer.nextToken(token, errorMessage);
+
+            if (lexResult && token.isCharSymbol() && token.asCharSymbol() == CHAR_RSQUARE_BRACKET)
+            {
+                return std::make_optional(length);
+            }
+        }
+
+        const char* message = "Expected a positive integer array size followed by ']'";
+        reporter.error(message, location);
+
+        if (canWriteErrorMessage(errorMessage))
+        {
+            *errorMessage = message;
+        }
+
+        lexer.restore(snapshot);
+        return std::nullopt;
+    }
+
     /* static */
     std::unique_ptr<ExpressionNode> buildDerefNode(const u32 count, std::unique_ptr<ExpressionNode>&& expr)
     {
@@ -1041,6 +1552,12 @@ namespace cmm
                         // This is the 'func(int x)' case.
                         if (variableNodeOpt.has_value())
                         {
+                            // Like C, an array parameter ('int x[]' or 'int x[8]') is a pointer.
+                            if (parseArrayDeclarator(lexer, errorMessage).has_value())
+                            {
+                                ++typeOpt->getDatatype().pointers;
+                            }
+
                             // TODO: Should probably verify it is safe to do this
                             // without checking the optional for 'has_value'.
                             params.emplace_back(typeOpt->getLocation(), std::move(*typeOpt), std::move(*variableNodeOpt));
@@ -1055,60 +1572,279 @@ namespace cmm
                         }
                     }
 
-                    // Failed prediction, restore and continue with the assumption this is just a variable.
-                    else
-                    {
-                        if (canWriteErrorMessage(errorMessage))
-                        {
-                            std::ostringstream os;
-                            os << "Encountered an un-expected token: " << toString(token.getType());
-                            *errorMessage = os.str();
+                    // Failed prediction, restore and continue with the assumption this is just a variable.
+                    else
+                    {
+                        if (canWriteErrorMessage(errorMessage))
+                        {
+                            std::ostringstream os;
+                            os << "Encountered an un-expected token: " << toString(token.getType());
+                            *errorMessage = os.str();
+
+                            reporter.error(*errorMessage, lexer.getLocation());
+                        }
+
+                        lexer.restore(snapshot);
+                        return std::nullopt;
+                    }
+
+                    // Peek ahead
+                    result = lexer.peekNextToken(token);
+
+                    // Check to see if the next char is a comma and if so consume that now.
+                    if (result && token.isCharSymbol() && token.asCharSymbol() == CHAR_COMMA)
+                    {
+                        // Consume the comma
+                        lexer.nextToken(token, errorMessage);
+
+                        // Now do the peek ahead again for the next iteration.
+                        result = lexer.peekNextToken(token);
+                    }
+                }
+
+                // If we get to this point, result must be false OR we forget to return.
+                // Assume the first case and report as an error.
+                if (canWriteErrorMessage(errorMessage))
+                {
+                    std::ostringstream os;
+                    // TODO: Come up with a better error message.
+                    os << "Failed to lookahead to the next token at " << lexer.getLocation();
+                    *errorMessage = os.str();
+
+                    reporter.error(*errorMessage, lexer.getLocation());
+                }
+
+                lexer.restore(snapshot);
+                return std::nullopt;
+            }
+
+            // Failed prediction, restore and continue with the assumption this is just a variable.
+            else
+            {
+                lexer.restore(snapshot);
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /* static */
+    std::optional<TranslationUnitNode> parseTranslationUnitParallel(Lexer& lexer, std::string* errorMessage, const u32 threadCount, ParserMemoStats* memoStats)
+    {
+        const auto startSnapshot = lexer.snap();
+        auto optSegments = splitTopLevelSegments(lexer);
+
+        if (!optSegments.has_value())
+        {
+            return std::nullopt;
+        }
+
+        const auto& segments = *optSegments;
+        std::vector<std::size_t> functionIndices;
+
+        for (std::size_t i = 0; i < segments.size(); ++i)
+        {
+            if (segments[i].isFunctionDefinition)
+            {
+                functionIndices.push_back(i);
+            }
+        }
+
+        // Not worth spinning up any threads.
+        if (functionIndices.size() < 2)
+        {
+            return std::nullopt;
+        }
+
+        std::vector<TopLevelSegmentResult> results(segments.size());
+        std::atomic<std::size_t> nextFunctionIndex(0);
+
+        // Each worker pulls the next un-parsed function body until none are left.
+        const auto parseFunctionBodies = [&]()
+        {
+            for (auto i = nextFunctionIndex++; i < functionIndices.size(); i = nextFunctionIndex++)
+            {
+                const auto& segment = segments[functionIndices[i]];
+                results[functionIndices[i]] = parseTopLevelSegment(lexer.slice(segment.begin, segment.end), memoStats != nullptr);
+            }
+        };
+
+        const auto workerCount = std::min<std::size_t>(threadCount - 1, functionIndices.size());
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
+
+        for (std::size_t i = 0; i < workerCount; ++i)
+        {
+            workers.emplace_back(parseFunctionBodies);
+        }
+
+        // The main thread handles everything that isn't a function body and then helps out.
+        for (std::size_t i = 0; i < segments.size(); ++i)
+        {
+            if (!segments[i].isFunctionDefinition)
+            {
+                results[i] = parseTopLevelSegment(lexer.slice(segments[i].begin, segments[i].end), memoStats != nullptr);
+            }
+        }
+
+        parseFunctionBodies();
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        // Stitch everything back together in source order.
+        TranslationUnitNode::StatementList statements;
+        statements.reserve(segments.size());
+        EnumTable enumTable;
+        std::size_t reportedCount = 0;
+
+        for (std::size_t i = 0; i < segments.size(); ++i)
+        {
+            reportedCount = i + 1;
+            auto& result = results[i];
+
+            if (memoStats != nullptr)
+            {
+                *memoStats += result.memoStats;
+            }
+
+            if (!result.errorMessage.empty() && canWriteErrorMessage(errorMessage))
+            {
+                *errorMessage = result.errorMessage;
+            }
+
+            // Same as the sequential parse, stop at the first bad statement and leave the lexer there.
+            if (result.statement == nullptr)
+            {
+                lexer.restore(segments[i].begin);
+                break;
+            }
+
+            // An enum was defined more than once across segments.  The sequential parse reports this
+            // where it happens, so let it do so.
+            if (!enumTable.merge(std::move(result.enumTable)))
+            {
+                lexer.restore(startSnapshot);
+                return std::nullopt;
+            }
+
+            statements.emplace_back(std::move(result.statement));
+
+            if (i + 1 == segments.size())
+            {
+                lexer.restore(segments[i].end);
+            }
+        }
+
+        // Only report what the sequential parse would have, i.e. nothing past the first bad statement.
+        static Reporter& reporter = Reporter::instance();
+
+        for (std::size_t i = 0; i < reportedCount; ++i)
+        {
+            reporter.replay(results[i].reports);
+        }
 
-                            reporter.error(*errorMessage, lexer.getLocation());
-                        }
+        if (statements.empty())
+        {
+            return std::make_optional<TranslationUnitNode>();
+        }
 
-                        lexer.restore(snapshot);
-                        return std::nullopt;
-                    }
+        const auto location = statements[0]->getLocation();
+        return std::make_optional<TranslationUnitNode>(location, std::move(statements), std::move(enumTable));
+    }
 
-                    // Peek ahead
-                    result = lexer.peekNextToken(token);
+    /* static */
+    std::optional<std::vector<TopLevelSegment>> splitTopLevelSegments(Lexer& lexer)
+    {
+        // Brace matching pre-pass.  A top-level statement ends with either a ';' outside of any
+        // braces or a closing '}' whose '{' immediately followed a ')', i.e. a function body.
+        // Anything unexpected bails out and lets the sequential parser report the problem.
+        const auto startSnapshot = lexer.snap();
 
-                    // Check to see if the next char is a comma and if so consume that now.
-                    if (result && token.isCharSymbol() && token.asCharSymbol() == CHAR_COMMA)
-                    {
-                        // Consume the comma
-                        lexer.nextToken(token, errorMessage);
+        std::vector<TopLevelSegment> segments;
+        auto segmentBegin = lexer.snap();
+        auto token = newToken();
+        u32 depth = 0;
+        bool lastWasRParen = false;
+        bool isFunctionBody = false;
+        bool segmentHasTokens = false;
+        bool valid = true;
 
-                        // Now do the peek ahead again for the next iteration.
-                        result = lexer.peekNextToken(token);
-                    }
-                }
+        while (valid && lexer.nextToken(token))
+        {
+            segmentHasTokens = true;
+            const bool isCharSymbol = token.isCharSymbol();
+            const char ch = isCharSymbol ? token.asCharSymbol() : '\0';
 
-                // If we get to this point, result must be false OR we forget to return.
-                // Assume the first case and report as an error.
-                if (canWriteErrorMessage(errorMessage))
+            if (isCharSymbol && ch == CHAR_LCURLY_BRACKET)
+            {
+                if (depth++ == 0)
                 {
-                    std::ostringstream os;
-                    // TODO: Come up with a better error message.
-                    os << "Failed to lookahead to the next token at " << lexer.getLocation();
-                    *errorMessage = os.str();
+                    isFunctionBody = lastWasRParen;
+                }
+            }
 
-                    reporter.error(*errorMessage, lexer.getLocation());
+            else if (isCharSymbol && ch == CHAR_RCURLY_BRACKET)
+            {
+                if (depth == 0)
+                {
+                    valid = false;
                 }
 
-                lexer.restore(snapshot);
-                return std::nullopt;
+                else if (--depth == 0 && isFunctionBody)
+                {
+                    const auto segmentEnd = lexer.snap();
+                    segments.push_back(TopLevelSegment { segmentBegin, segmentEnd, true });
+                    segmentBegin = segmentEnd;
+                    segmentHasTokens = false;
+                    isFunctionBody = false;
+                }
             }
 
-            // Failed prediction, restore and continue with the assumption this is just a variable.
-            else
+            else if (isCharSymbol && ch == CHAR_SEMI_COLON && depth == 0)
             {
-                lexer.restore(snapshot);
+                const auto segmentEnd = lexer.snap();
+                segments.push_back(TopLevelSegment { segmentBegin, segmentEnd, false });
+                segmentBegin = segmentEnd;
+                segmentHasTokens = false;
             }
+
+            lastWasRParen = isCharSymbol && ch == CHAR_RPAREN;
         }
 
-        return std::nullopt;
+        valid = valid && depth == 0 && !segmentHasTokens && lexer.completedOrWhitespaceOnly();
+        lexer.restore(startSnapshot);
+
+        return valid ? std::make_optional(std::move(segments)) : std::nullopt;
+    }
+
+    /* static */
+    TopLevelSegmentResult parseTopLevelSegment(Lexer lexer, const bool memoize)
+    {
+        TopLevelSegmentResult result;
+
+        // Each segment gets a clean slate and hands its enums back to be merged in order.
+        // Note: The memo table is keyed by positions in this segment's lexer, so it is per segment as well.
+        static Reporter& reporter = Reporter::instance();
+        ParserMemo memo;
+        currentParserMemo = memoize ? &memo : nullptr;
+        currentEnumTable = EnumTable();
+        reporter.setDeferredReports(&result.reports);
+        result.statement = parseStatement(lexer, &result.errorMessage);
+
+        reporter.setDeferredReports(nullptr);
+        currentParserMemo = nullptr;
+        result.memoStats = memo.getStats();
+
+        if (result.statement != nullptr && !lexer.completedOrWhitespaceOnly())
+        {
+            result.statement = nullptr;
+        }
+
+        result.enumTable = std::move(currentEnumTable);
+        return result;
     }
 
     /* static */
@@ -1136,6 +1872,12 @@ namespace cmm
 
     /* static */
     std::unique_ptr<StatementNode> parseDeclarationStatement(Lexer& lexer, std::string* errorMessage)
+    {
+        return parseMemoized(EnumParseRule::DECLARATION_STATEMENT, parseDeclarationStatementUncached, lexer, errorMessage);
+    }
+
+    /* static */
+    std::unique_ptr<StatementNode> parseDeclarationStatementUncached(Lexer& lexer, std::string* errorMessage)
     {
         static auto& reporter = Reporter::instance();
         auto snapshot = lexer.snap();
@@ -1307,6 +2049,37 @@ namespace cmm
             }
         }
 
+        // A fixed-size array (ex. 'int a[8];').
+        const auto optionalArrayLength = parseArrayDeclarator(lexer, errorMessage);
+
+        if (optionalArrayLength.has_value())
+        {
+            Location errLocation;
+
+            if (*optionalArrayLength == 0)
+            {
+                const char* message = "Array declaration requires a size";
+                reporter.error(message, optVariableName->getLocation());
+
+                if (canWriteErrorMessage(errorMessage))
+                {
+                    *errorMessage = message;
+                }
+
+                return nullptr;
+            }
+
+            type->getDatatype().arrayLength = *optionalArrayLength;
+
+            if (expectSemicolon(lexer, errorMessage, &errLocation))
+            {
+                return std::make_unique<VariableDeclarationStatementNode>(type->getLocation(), *type, std::move(*optVariableName));
+            }
+
+            reporter.error("Expected a closing semi-colon", errLocation);
+            return nullptr;
+        }
+
         // Lookahead to see if this is a function declaration or definition before
         // committing to this being a variable.
         auto optionalFunctionArgs = parseFunctionParameters(lexer, errorMessage);
@@ -1348,40 +2121,8 @@ namespace cmm
     /* static */
     std::unique_ptr<ExpressionNode> parseExpression(Lexer& lexer, std::string* errorMessage)
     {
-        static ParserPredictor<std::unique_ptr<ExpressionNode>(Lexer&, std::string*)> predictor;
-
-        if (predictor.empty())
-        {
-            const Token token(CHAR_LPAREN, true);
-
-            // Note: Previously, we tried to parse a Cast or Paren expression node here.
-            // This will not work for BinOpNodes that contain Paren expressions because
-            // it will not expect 'extra' tokens past the closing expression.
-            // This causes expressions such as 'a = (2 + 3) * 2;' to fail.
-            predictor.registerFunction(token, parseCastExpression);
-        }
-
-        auto tokenLookahead = newToken();
-        const bool lexResult = lexer.peekNextToken(tokenLookahead);
-
-        if (lexResult)
-        {
-            auto predictionContext = predictor.predict(tokenLookahead);
-
-            if (predictionContext.has_value())
-            {
-                auto predictorResult = predictor.call<std::unique_ptr<ExpressionNode>>(*predictionContext, lexer, errorMessage);
-
-                // Only early exit if the predictor was correct.  Else, continue parsing like normal.
-                if (predictorResult != nullptr)
-                {
-                    return predictorResult;
-                }
-            }
-        }
-
         const auto snapshot = lexer.snap();
-        auto node = parseAssignmentBinOpNode(lexer, errorMessage);
+        auto node = parseBinaryExpression(lexer, errorMessage, lowestBinOpPrecedence);
 
         if (node == nullptr)
         {
@@ -1394,6 +2135,12 @@ namespace cmm
 
     /* static */
     std::unique_ptr<ExpressionNode> parseFunctionCallOrVariable(Lexer& lexer, std::string* errorMessage)
+    {
+        return parseMemoized(EnumParseRule::FUNCTION_CALL_OR_VARIABLE, parseFunctionCallOrVariableUncached, lexer, errorMessage);
+    }
+
+    /* static */
+    std::unique_ptr<ExpressionNode> parseFunctionCallOrVariableUncached(Lexer& lexer, std::string* errorMessage)
     {
         // Options are:
         // func()
@@ -1535,6 +2282,12 @@ namespace cmm
 
     /* static */
     std::unique_ptr<ExpressionNode> parseCastExpression(Lexer& lexer, std::string* errorMessage)
+    {
+        return parseMemoized(EnumParseRule::CAST_EXPRESSION, parseCastExpressionUncached, lexer, errorMessage);
+    }
+
+    /* static */
+    std::unique_ptr<ExpressionNode> parseCastExpressionUncached(Lexer& lexer, std::string* errorMessage)
     {
         auto snapshot = lexer.snap();
         auto token = newToken();
@@ -1573,9 +2326,10 @@ namespace cmm
             return nullptr;
         }
 
-        // Expect expression being casted:
+        // Expect expression being casted.  A cast binds tighter than any binary operator,
+        // i.e. '(int) a + 1' is '((int) a) + 1'.
         const auto tempLocation = lexer.snap().getLocation();
-        auto exprToCast = parseExpression(lexer, errorMessage);
+        auto exprToCast = parseBinaryOperand(lexer, errorMessage);
 
         if (exprToCast == nullptr)
         {
@@ -1598,6 +2352,12 @@ namespace cmm
 
     /* static */
     std::unique_ptr<ExpressionNode> parseParenExpression(Lexer& lexer, std::string* errorMessage)
+    {
+        return parseMemoized(EnumParseRule::PAREN_EXPRESSION, parseParenExpressionUncached, lexer, errorMessage);
+    }
+
+    /* static */
+    std::unique_ptr<ExpressionNode> parseParenExpressionUncached(Lexer& lexer, std::string* errorMessage)
     {
         static Reporter& reporter = Reporter::instance();
         const auto snapshot = lexer.snap();
@@ -1642,6 +2402,38 @@ namespace cmm
         return std::make_unique<ParenExpressionNode>(subexpression->getLocation(), std::move(subexpression));
     }
 
+    /* static */
+    std::unique_ptr<ExpressionNode> parseParenOrCastExpression(Lexer& lexer, std::string* errorMessage)
+    {
+        return isCastAhead(lexer) ? parseCastExpression(lexer, errorMessage) : parseParenExpression(lexer, errorMessage);
+    }
+
+    /* static */
+    bool isCastAhead(Lexer& lexer)
+    {
+        // A cast is a '(' followed by a type, possibly after the pointer indirection ('(*int)').
+        const auto snapshot = lexer.snap();
+        auto token = newToken();
+        bool lexResult = lexer.nextToken(token);
+        bool result = false;
+
+        if (lexResult && token.isCharSymbol() && token.asCharSymbol() == CHAR_LPAREN)
+        {
+            do
+            {
+                lexResult = lexer.nextToken(token);
+            }
+            while (lexResult && token.isCharSymbol() && token.asCharSymbol() == CHAR_ASTERISK);
+
+            const auto kind = lexResult ? getFirstTokenKind(token) : FIRST_TOKEN_KIND_COUNT;
+            result = kind >= FIRST_TOKEN_KEYWORD_OFFSET && kind < FIRST_TOKEN_TYPE_OFFSET
+                && keywordInfoTable[kind - FIRST_TOKEN_KEYWORD_OFFSET].isAType;
+        }
+
+        lexer.restore(snapshot);
+        return result;
+    }
+
     /* static */
     std::unique_ptr<ExpressionNode> parsePrimaryExpression(Lexer& lexer, std::string* errorMessage)
     {
@@ -1664,6 +2456,17 @@ namespace cmm
                     const auto location = result->getLocation();
                     auto temp = std::move(result);
                     result = std::make_unique<FieldAccessNode>(location, std::move(temp), std::move(optionalFieldAccessPair->second), optionalFieldAccessPair->first);
+                    continue;
+                }
+
+                auto index = parseArrayIndex(lexer, errorMessage);
+
+                if (index != nullptr)
+                {
+                    doLoop = true;
+                    const auto location = result->getLocation();
+                    auto temp = std::move(result);
+                    result = std::make_unique<ArrayIndexNode>(location, std::move(temp), std::move(index));
                 }
             }
             while (doLoop);
@@ -1673,60 +2476,31 @@ namespace cmm
     }
 
     /* static */
-    std::unique_ptr<ExpressionNode> parseMultiplyDivideBinOpNode(Lexer& lexer, std::string* errorMessage)
+    std::unique_ptr<ExpressionNode> parseBinaryOperand(Lexer& lexer, std::string* errorMessage)
     {
-        auto left = parseParenExpression(lexer, errorMessage);
-
-        if (left == nullptr)
-        {
-            return nullptr;
-        }
-
         auto token = newToken();
-        bool lexResult = lexer.peekNextToken(token);
-
-        // For saving the starting token.
-        Location location;
-        Location* locationPtr = nullptr;
 
-        while (lexResult)
+        if (lexer.peekNextToken(token))
         {
-            if (token.isCharSymbol() && (token.asCharSymbol() == CHAR_ASTERISK || token.asCharSymbol() == CHAR_FORWARD_SLASH))
-            {
-                // Valid bin type accept the token
-
-                if (locationPtr == nullptr)
-                {
-                    locationPtr = &location;
-                    lexer.nextToken(token, errorMessage, locationPtr);
-                }
-
-                else
-                {
-                    lexer.nextToken(token, errorMessage);
-                }
-            }
+            const auto parseFunc = expressionDispatchTable.dispatch(token);
 
-            else
+            if (parseFunc != nullptr)
             {
-                return left;
+                return parseFunc(lexer, errorMessage);
             }
-
-            const auto actualBinOp = token.asCharSymbol() == CHAR_ASTERISK ? EnumBinOpNodeType::MULTIPLY : EnumBinOpNodeType::DIVIDE;
-            auto right = parseExpression(lexer, errorMessage);
-            left = std::make_unique<BinOpNode>(left->getLocation(), actualBinOp, std::move(left), std::move(right));
-
-            // Lookahead for next iteration.
-            lexResult = lexer.peekNextToken(token);
         }
 
-        return left;
+        return parseParenExpression(lexer, errorMessage);
     }
 
     /* static */
-    std::unique_ptr<ExpressionNode> parseAddSubBinOpNode(Lexer& lexer, std::string* errorMessage)
+    std::unique_ptr<ExpressionNode> parseBinaryExpression(Lexer& lexer, std::string* errorMessage, const u32 minPrecedence)
     {
-        auto left = parseMultiplyDivideBinOpNode(lexer, errorMessage);
+        // Precedence climbing: parse an operand, then keep folding operators into
+        // the left hand side for as long as they bind at least as tight as 'minPrecedence'.
+        // Left associative operators recurse with a strictly higher minimum so that
+        // chains such as 'a - b - c' build left-leaning trees in a single loop.
+        auto left = parseBinaryOperand(lexer, errorMessage);
 
         if (left == nullptr)
         {
@@ -1734,91 +2508,39 @@ namespace cmm
         }
 
         auto token = newToken();
-        bool lexResult = lexer.peekNextToken(token);
 
-        // For saving the starting token.
-        Location location;
-        Location* locationPtr = nullptr;
-
-        while (lexResult)
+        while (lexer.peekNextToken(token))
         {
-            if (token.isCharSymbol() && (token.asCharSymbol() == CHAR_PLUS || token.asCharSymbol() == CHAR_MINUS))
-            {
-                // Valid bin type accept the token
-
-                if (locationPtr == nullptr)
-                {
-                    locationPtr = &location;
-                    lexResult = lexer.nextToken(token, errorMessage, locationPtr);
-                }
-
-                else
-                {
-                    lexResult = lexer.nextToken(token, errorMessage);
-                }
-            }
+            const auto optionalBinOpType = isEnumBinOpType(token);
 
-            else
+            if (!optionalBinOpType.has_value())
             {
-                return left;
+                break;
             }
 
-            const auto actualBinOp = token.asCharSymbol() == CHAR_PLUS ? EnumBinOpNodeType::ADD: EnumBinOpNodeType::SUBTRACT;
-            auto right = parseExpression(lexer, errorMessage);
-            left = std::make_unique<BinOpNode>(left->getLocation(), actualBinOp, std::move(left), std::move(right));
-
-            // Lookahead for next iteration.
-            lexer.peekNextToken(token);
-        }
-
-        return left;
-    }
-
-    /* static */
-    std::unique_ptr<ExpressionNode> parseAssignmentBinOpNode(Lexer& lexer, std::string* errorMessage)
-    {
-        auto left = parseAddSubBinOpNode(lexer, errorMessage);
-
-        if (left == nullptr)
-        {
-            return nullptr;
-        }
-
-        auto token = newToken();
-        bool lexResult = lexer.peekNextToken(token);
-
-        // For saving the starting token.
-        Location location;
-        Location* locationPtr = nullptr;
+            const auto& binOpPrecedence = binOpPrecedenceTable[static_cast<std::size_t>(*optionalBinOpType)];
 
-        while (lexResult)
-        {
-            if (token.isCharSymbol() && token.asCharSymbol() == CHAR_EQUALS)
+            if (binOpPrecedence.precedence < minPrecedence)
             {
-                // Valid bin type accept the token
+                break;
+            }
 
-                if (locationPtr == nullptr)
-                {
-                    locationPtr = &location;
-                    lexResult = lexer.nextToken(token, errorMessage, locationPtr);
-                }
+            // Valid bin type accept the token
+            const auto snapshot = lexer.snap();
+            lexer.nextToken(token, errorMessage);
 
-                else
-                {
-                    lexResult = lexer.nextToken(token, errorMessage);
-                }
-            }
+            const u32 nextMinPrecedence = binOpPrecedence.rightAssociative ? binOpPrecedence.precedence : binOpPrecedence.precedence + 1;
+            auto right = parseBinaryExpression(lexer, errorMessage, nextMinPrecedence);
 
-            else
+            // Leave the dangling operator for the caller to report.
+            if (right == nullptr)
             {
-                return left;
+                lexer.restore(snapshot);
+                break;
             }
 
-            auto right = parseExpression(lexer, errorMessage);
-            left = std::make_unique<BinOpNode>(left->getLocation(), EnumBinOpNodeType::ASSIGNMENT, std::move(left), std::move(right));
-
-            // Lookahead for next iteration.
-            lexer.peekNextToken(token);
+            const auto location = left->getLocation();
+            left = std::make_unique<BinOpNode>(location, *optionalBinOpType, std::move(left), std::move(right));
         }
 
         return left;
@@ -1883,6 +2605,33 @@ namespace cmm
         return nullptr;
     }
 
+    /* static */
+    std::unique_ptr<ExpressionNode> parseArrayIndex(Lexer& lexer, std::string* errorMessage)
+    {
+        static auto& reporter = Reporter::instance();
+        const auto snapshot = lexer.snap();
+        auto token = newToken();
+
+        if (!lexer.peekNextToken(token) || !token.isCharSymbol() || token.asCharSymbol() != CHAR_LSQUARE_BRACKET)
+        {
+            return nullptr;
+        }
+
+        Location location;
+        lexer.nextToken(token, errorMessage, &location);
+        auto index = parseExpression(lexer, errorMessage);
+
+        if (index != nullptr && expectChar(lexer, errorMessage, CHAR_RSQUARE_BRACKET))
+        {
+            return index;
+        }
+
+        reporter.error("Expected an index expression followed by ']'", location);
+        lexer.restore(snapshot);
+
+        return nullptr;
+    }
+
     /* static */
     std::optional<std::pair<EnumFieldAccessType, std::string>> parseFieldAccessNode(Lexer& lexer, std::string* errorMessage)
     {
@@ -2002,6 +2751,14 @@ namespace cmm
 
         std::unique_ptr<ExpressionNode> result = std::make_unique<VariableNode>(std::move(*optionalVariable));
 
+        // Subscripts bind tighter than any unary operator (ex. '++a[i]' or '*p[i]').
+        for (auto index = parseArrayIndex(lexer, errorMessage); index != nullptr; index = parseArrayIndex(lexer, errorMessage))
+        {
+            const auto location = result->getLocation();
+            auto temp = std::move(result);
+            result = std::make_unique<ArrayIndexNode>(location, std::move(temp), std::move(index));
+        }
+
         // This infers optionalDimensionCount must have a value > 0 (see above).
         if (optionalPrefixEnumUnaryOpType.has_value())
         {
@@ -2088,10 +2845,25 @@ namespace cmm
         }
 
         auto type = token.asStringSymbol();
+        bool unsignedInt = false;
+
+        // A signedness specifier either precedes an integer type or is an int on its own (ex. 'unsigned x;').
+        if (type == Keyword::SIGNED.getName() || type == Keyword::UNSIGNED.getName())
+        {
+            unsignedInt = type == Keyword::UNSIGNED.getName();
+            type = Keyword::INT.getName();
+            lexResult = lexer.peekNextToken(token);
+
+            if (lexResult && token.isStringSymbol() && isIntegerTypeName(token.asStringSymbol()))
+            {
+                type = token.asStringSymbol();
+                lexer.nextToken(token, errorMessage);
+            }
+        }
 
         if (isCType(type))
         {
-            const auto enumType = getCType(token.asStringSymbol());
+            const auto enumType = getCType(type);
 
             if (enumType.has_value())
             {
@@ -2123,16 +2895,24 @@ namespace cmm
 
                 if (optionalDimensionCount.has_value())
                 {
-                    return std::make_optional<TypeNode>(dimLocation, CType(enumType.value(), *optionalDimensionCount, std::move(structOrEnumName)));
+                    return std::make_optional<TypeNode>(dimLocation, CType(enumType.value(), *optionalDimensionCount,
+                        std::move(structOrEnumName), unsignedInt));
                 }
 
                 // else
-                return std::make_optional<TypeNode>(location, CType(enumType.value(), 0, std::move(structOrEnumName)));
+                return std::make_optional<TypeNode>(location, CType(enumType.value(), 0, std::move(structOrEnumName), unsignedInt));
             }
         }
 
         return std::nullopt;
     }
+
+    /* static */
+    bool isIntegerTypeName(const std::string& name) CMM_NOEXCEPT
+    {
+        return name == Keyword::CHAR.getName() || name == Keyword::SHORT.getName() ||
+            name == Keyword::INT.getName() || name == Keyword::LONG.getName();
+    }
 }
 
 #if OS_WIN
@@ -0,0 +1,32 @@
+/**
+ * A dense, constexpr buildable table for dispatching a parse function from the first token.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ParserDispatchTable.h>
+
+namespace cmm
+{
+    std::size_t getFirstTokenKind(const Token& token) CMM_NOEXCEPT
+    {
+        if (token.isCharSymbol())
+        {
+            return getFirstTokenKind(token.asCharSymbol());
+        }
+
+        else if (token.isStringSymbol())
+        {
+            const auto optionalKeyword = findEnumKeyword(token.asStringSymbol());
+
+            if (optionalKeyword.has_value())
+            {
+                return getFirstTokenKind(*optionalKeyword);
+            }
+        }
+
+        return getFirstTokenKind(token.getType());
+    }
+}
@@ -0,0 +1,138 @@
+/**
+ * A packrat style memo table for parse rules that may be retried from the same position.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ParserMemo.h>
+
+// std includes
+#include <sstream>
+
+namespace cmm
+{
+    const char* toString(const EnumParseRule rule) CMM_NOEXCEPT
+    {
+        switch (rule)
+        {
+        case EnumParseRule::FUNCTION_CALL_OR_VARIABLE:
+            return "FUNCTION_CALL_OR_VARIABLE";
+        case EnumParseRule::CAST_EXPRESSION:
+            return "CAST_EXPRESSION";
+        case EnumParseRule::PAREN_EXPRESSION:
+            return "PAREN_EXPRESSION";
+        case EnumParseRule::DECLARATION_STATEMENT:
+            return "DECLARATION_STATEMENT";
+        default:
+            return "Unknown EnumParseRule";
+        }
+
+        return nullptr;
+    }
+
+    ParserMemoRuleStats& ParserMemoStats::operator[] (const EnumParseRule rule) CMM_NOEXCEPT
+    {
+        return rules[static_cast<std::size_t>(rule)];
+    }
+
+    const ParserMemoRuleStats& ParserMemoStats::operator[] (const EnumParseRule rule) const CMM_NOEXCEPT
+    {
+        return rules[static_cast<std::size_t>(rule)];
+    }
+
+    ParserMemoStats& ParserMemoStats::operator+= (const ParserMemoStats& other) CMM_NOEXCEPT
+    {
+        for (std::size_t i = 0; i < rules.size(); ++i)
+        {
+            rules[i].lookups += other.rules[i].lookups;
+            rules[i].hits += other.rules[i].hits;
+            rules[i].stores += other.rules[i].stores;
+        }
+
+        return *this;
+    }
+
+    std::size_t ParserMemoStats::totalLookups() const CMM_NOEXCEPT
+    {
+        std::size_t result = 0;
+
+        for (const auto& ruleStats : rules)
+        {
+            result += ruleStats.lookups;
+        }
+
+        return result;
+    }
+
+    std::size_t ParserMemoStats::totalHits() const CMM_NOEXCEPT
+    {
+        std::size_t result = 0;
+
+        for (const auto& ruleStats : rules)
+        {
+            result += ruleStats.hits;
+        }
+
+        return result;
+    }
+
+    f64 ParserMemoStats::hitRate() const CMM_NOEXCEPT
+    {
+        const auto lookups = totalLookups();
+        return lookups > 0 ? static_cast<f64>(totalHits()) / static_cast<f64>(lookups) : 0.0;
+    }
+
+    std::string ParserMemoStats::toString() const
+    {
+        std::ostringstream os;
+
+        for (std::size_t i = 0; i < rules.size(); ++i)
+        {
+            const auto& ruleStats = rules[i];
+            os << cmm::toString(static_cast<EnumParseRule>(i)) << ": lookups=" << ruleStats.lookups
+               << " hits=" << ruleStats.hits << " stores=" << ruleStats.stores << '\n';
+        }
+
+        os << "hit rate: " << (hitRate() * 100.0) << '%';
+        return os.str();
+    }
+
+    const Snapshot* ParserMemo::findFailure(const EnumParseRule rule, const std::size_t index)
+    {
+        auto& ruleStats = stats[rule];
+        ++ruleStats.lookups;
+
+        const auto findResult = failures.find(makeKey(rule, index));
+
+        if (findResult != failures.cend())
+        {
+            ++ruleStats.hits;
+            return &findResult->second;
+        }
+
+        return nullptr;
+    }
+
+    void ParserMemo::addFailure(const EnumParseRule rule, const std::size_t index, const Snapshot& end)
+    {
+        const auto [iter, inserted] = failures.emplace(makeKey(rule, index), end);
+
+        if (inserted)
+        {
+            ++stats[rule].stores;
+        }
+    }
+
+    const ParserMemoStats& ParserMemo::getStats() const CMM_NOEXCEPT
+    {
+        return stats;
+    }
+
+    /* static */
+    std::size_t ParserMemo::makeKey(const EnumParseRule rule, const std::size_t index) CMM_NOEXCEPT
+    {
+        return index * static_cast<std::size_t>(EnumParseRule::COUNT) + static_cast<std::size_t>(rule);
+    }
+}
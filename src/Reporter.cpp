@@ -10,6 +10,9 @@
 
 namespace cmm
 {
+    /* static */
+    thread_local Reporter::DeferredReportList* Reporter::deferredReports = nullptr;
+
     Reporter::Reporter() CMM_NOEXCEPT : errors(0), warnings(0), canPrint(true)
     {
     }
@@ -52,6 +55,27 @@ namespace cmm
         this->canPrint = enable;
     }
 
+    void Reporter::setDeferredReports(DeferredReportList* reports) CMM_NOEXCEPT
+    {
+        deferredReports = reports;
+    }
+
+    void Reporter::replay(const DeferredReportList& reports)
+    {
+        for (const auto& report : reports)
+        {
+            if (report.isError)
+            {
+                error(report.message, report.location);
+            }
+
+            else
+            {
+                warn(report.message, report.location);
+            }
+        }
+    }
+
     void Reporter::reset()
     {
         errors = 0;
@@ -37,6 +37,11 @@ namespace cmm
         return expression.get();
     }
 
+    void ReturnStatementNode::setExpression(std::unique_ptr<ExpressionNode>&& expression) CMM_NOEXCEPT
+    {
+        this->expression = std::move(expression);
+    }
+
     CType* ReturnStatementNode::getDatatype() const CMM_NOEXCEPT
     {
         return hasExpression() ? &expression->getDatatype() : nullptr;
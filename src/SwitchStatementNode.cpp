@@ -0,0 +1,78 @@
+/**
+ * An AST node for representing a switch statement.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/SwitchStatementNode.h>
+#include <cmm/DerefNode.h>
+#include <cmm/ExpressionNode.h>
+
+namespace cmm
+{
+    SwitchStatementNode::SwitchStatementNode(const Location& location, std::unique_ptr<ExpressionNode>&& conditional,
+        CaseList&& cases) CMM_NOEXCEPT : StatementNode(EnumNodeType::SWITCH_STATEMENT, location),
+        conditional(std::move(conditional)), cases(std::move(cases))
+    {
+    }
+
+    ExpressionNode* SwitchStatementNode::getConditional() CMM_NOEXCEPT
+    {
+        return conditional.get();
+    }
+
+    const ExpressionNode* SwitchStatementNode::getConditional() const CMM_NOEXCEPT
+    {
+        return conditional.get();
+    }
+
+    void SwitchStatementNode::setConditional(std::unique_ptr<ExpressionNode>&& expression) CMM_NOEXCEPT
+    {
+        conditional = std::move(expression);
+    }
+
+    void SwitchStatementNode::derefConditional()
+    {
+        const auto location = conditional->getLocation();
+        auto temp = std::move(conditional);
+        conditional = std::make_unique<DerefNode>(location, std::move(temp));
+    }
+
+    SwitchStatementNode::size_type SwitchStatementNode::size() const CMM_NOEXCEPT
+    {
+        return cases.size();
+    }
+
+    SwitchStatementNode::CaseListIter SwitchStatementNode::begin() CMM_NOEXCEPT
+    {
+        return cases.begin();
+    }
+
+    SwitchStatementNode::CaseListConstIter SwitchStatementNode::cbegin() const CMM_NOEXCEPT
+    {
+        return cases.cbegin();
+    }
+
+    SwitchStatementNode::CaseListIter SwitchStatementNode::end() CMM_NOEXCEPT
+    {
+        return cases.end();
+    }
+
+    SwitchStatementNode::CaseListConstIter SwitchStatementNode::cend() const CMM_NOEXCEPT
+    {
+        return cases.cend();
+    }
+
+    VisitorResult SwitchStatementNode::accept(Visitor* visitor) /* override */
+    {
+        return visitor->visit(*this);
+    }
+
+    std::string SwitchStatementNode::toString() const /* override */
+    {
+        return "SwitchStatementNode";
+    }
+}
+
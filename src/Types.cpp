@@ -11,6 +11,7 @@
 
 // std includes
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -18,6 +19,7 @@ namespace cmm
 {
 
     static std::map<std::string, EnumCType> ctypeMap;
+    static std::once_flag ctypeMapInitFlag;
 
     static void initCTypeMap()
     {
@@ -37,7 +39,8 @@ namespace cmm
 
     static std::optional<CType> promoOrTruncateLookup(const CType& from, const CType& to, std::unordered_map<EnumCType, std::unordered_set<EnumCType>>& theMap)
     {
-        if (from.pointers != to.pointers)
+        // Arrays are never converted as a whole (only after decaying to a pointer).
+        if (from.pointers != to.pointers || from.isArray() || to.isArray())
         {
             return std::nullopt;
         }
@@ -61,16 +64,19 @@ namespace cmm
         return std::nullopt;
     }
 
-    CType::CType() CMM_NOEXCEPT : type(EnumCType::NULL_T), pointers(0xFFFF), optTypeName(std::nullopt)
+    CType::CType() CMM_NOEXCEPT : type(EnumCType::NULL_T), pointers(0xFFFF), optTypeName(std::nullopt), unsignedInt(false),
+        arrayLength(0)
     {
     }
 
-    CType::CType(const EnumCType type, const u16 pointers, std::optional<std::string>&& optTypeName) CMM_NOEXCEPT :
-        type(type), pointers(pointers), optTypeName(std::move(optTypeName))
+    CType::CType(const EnumCType type, const u16 pointers, std::optional<std::string>&& optTypeName,
+        const bool unsignedInt) CMM_NOEXCEPT : type(type), pointers(pointers), optTypeName(std::move(optTypeName)),
+        unsignedInt(unsignedInt), arrayLength(0)
     {
     }
 
-    CType::CType(const CType& other) : type(other.type), pointers(other.pointers), optTypeName(std::nullopt)
+    CType::CType(const CType& other) : type(other.type), pointers(other.pointers), optTypeName(std::nullopt),
+        unsignedInt(other.unsignedInt), arrayLength(other.arrayLength)
     {
         if (other.optTypeName.has_value())
         {
@@ -79,7 +85,8 @@ namespace cmm
     }
 
     CType::CType(CType&& other) CMM_NOEXCEPT : type(other.type), pointers(other.pointers),
-        optTypeName(std::move(other.optTypeName))
+        optTypeName(std::move(other.optTypeName)), unsignedInt(other.unsignedInt),
+        arrayLength(other.arrayLength)
     {
     }
 
@@ -90,6 +97,8 @@ namespace cmm
             type = other.type;
             pointers = other.pointers;
             optTypeName = other.optTypeName;
+            unsignedInt = other.unsignedInt;
+            arrayLength = other.arrayLength;
         }
 
         return *this;
@@ -102,6 +111,8 @@ namespace cmm
             type = other.type;
             pointers = other.pointers;
             optTypeName = std::move(other.optTypeName);
+            unsignedInt = other.unsignedInt;
+            arrayLength = other.arrayLength;
         }
 
         return *this;
@@ -109,19 +120,19 @@ namespace cmm
 
     bool CType::isEnum() const CMM_NOEXCEPT
     {
-        const bool result = pointers == 0 && type == EnumCType::ENUM;
+        const bool result = pointers == 0 && arrayLength == 0 && type == EnumCType::ENUM;
         return result;
     }
 
     bool CType::isFloatingPoint() const CMM_NOEXCEPT
     {
-        const bool result = pointers == 0 && (type == EnumCType::FLOAT || type == EnumCType::DOUBLE);
+        const bool result = pointers == 0 && arrayLength == 0 && (type == EnumCType::FLOAT || type == EnumCType::DOUBLE);
         return result;
     }
 
     bool CType::isInt() const CMM_NOEXCEPT
     {
-        const bool result = pointers == 0 &&
+        const bool result = pointers == 0 && arrayLength == 0 &&
             (type == EnumCType::CHAR || type == EnumCType::ENUM  ||
             type == EnumCType::INT8  || type == EnumCType::INT16 ||
             type == EnumCType::INT32 || type == EnumCType::INT64);
@@ -129,19 +140,66 @@ namespace cmm
         return result;
     }
 
+    bool CType::isSignedInt() const CMM_NOEXCEPT
+    {
+        return isInt() && !unsignedInt;
+    }
+
+    bool CType::isUnsignedInt() const CMM_NOEXCEPT
+    {
+        return isInt() && unsignedInt;
+    }
+
     bool CType::isPointerType() const CMM_NOEXCEPT
     {
-        return pointers > 0;
+        return pointers > 0 && arrayLength == 0;
+    }
+
+    bool CType::isArray() const CMM_NOEXCEPT
+    {
+        return arrayLength > 0;
+    }
+
+    CType CType::getElementType() const
+    {
+        CType result(*this);
+
+        if (isArray())
+        {
+            result.arrayLength = 0;
+        }
+
+        else if (pointers > 0)
+        {
+            --result.pointers;
+        }
+
+        return result;
+    }
+
+    CType CType::decay() const
+    {
+        CType result(*this);
+
+        // Like C, an array used as a value becomes a pointer to its first element.
+        if (isArray())
+        {
+            result.arrayLength = 0;
+            ++result.pointers;
+        }
+
+        return result;
     }
 
     bool CType::isString() const CMM_NOEXCEPT
     {
-        return type == EnumCType::CHAR && pointers == 1;
+        return type == EnumCType::CHAR && pointers == 1 && arrayLength == 0;
     }
 
     bool CType::operator== (const CType& other) const CMM_NOEXCEPT
     {
-        return type == other.type && pointers == other.pointers && optTypeName == other.optTypeName;
+        return type == other.type && pointers == other.pointers && optTypeName == other.optTypeName &&
+            unsignedInt == other.unsignedInt && arrayLength == other.arrayLength;
     }
 
     bool CType::operator!= (const CType& other) const CMM_NOEXCEPT
@@ -223,6 +281,12 @@ namespace cmm
             }
         }
 
+        // Only the signedness differs (ex. int to unsigned int), the bits are kept as is.
+        if (from.type == to.type && from.unsignedInt != to.unsignedInt && from.isInt() && to.isInt())
+        {
+            return std::make_optional<CType>(to);
+        }
+
         return promoOrTruncateLookup(from, to, promoMap);
     }
 
@@ -244,20 +308,14 @@ namespace cmm
 
     bool isCType(const std::string& str) CMM_NOEXCEPT
     {
-        if (ctypeMap.empty())
-        {
-            initCTypeMap();
-        }
+        std::call_once(ctypeMapInitFlag, initCTypeMap);
 
         return ctypeMap.find(str) != ctypeMap.cend();
     }
 
     std::optional<EnumCType> getCType(const std::string& str) CMM_NOEXCEPT
     {
-        if (ctypeMap.empty())
-        {
-            initCTypeMap();
-        }
+        std::call_once(ctypeMapInitFlag, initCTypeMap);
 
         const auto findResult = ctypeMap.find(str);
         return findResult != ctypeMap.cend() ? std::make_optional(findResult->second) : std::nullopt;
@@ -332,11 +390,44 @@ namespace cmm
                 return std::make_optional<EnumBinOpNodeType>(EnumBinOpNodeType::MULTIPLY);
             case CHAR_FORWARD_SLASH: // divide
                 return std::make_optional<EnumBinOpNodeType>(EnumBinOpNodeType::DIVIDE);
+            case CHAR_PERCENT: // modulus
+                return std::make_optional<EnumBinOpNodeType>(EnumBinOpNodeType::MODULUS);
+            case CHAR_EQUALS:
+                return std::make_optional<EnumBinOpNodeType>(EnumBinOpNodeType::ASSIGNMENT);
+            case CHAR_GT:
+                return std::make_optional<EnumBinOpNodeType>(EnumBinOpNodeType::CMP_GT);
+            case CHAR_LT:
+                return std::make_optional<EnumBinOpNodeType>(EnumBinOpNodeType::CMP_LT);
+            case CHAR_AMPERSAND:
+                return std::make_optional<EnumBinOpNodeType>(EnumBinOpNodeType::BITWISE_AND);
+            case CHAR_PIPE:
+                return std::make_optional<EnumBinOpNodeType>(EnumBinOpNodeType::BITWISE_OR);
+            case CHAR_CARET:
+                return std::make_optional<EnumBinOpNodeType>(EnumBinOpNodeType::BITWISE_XOR);
             default:
                 return std::nullopt;
             }
         }
 
+        else if (token.isStringSymbol())
+        {
+            static const std::unordered_map<std::string, EnumBinOpNodeType> stringSymbolMap = {
+                { "==", EnumBinOpNodeType::CMP_EQ }, { "!=", EnumBinOpNodeType::CMP_NE },
+                { ">=", EnumBinOpNodeType::CMP_GE }, { "<=", EnumBinOpNodeType::CMP_LE },
+                { "<<", EnumBinOpNodeType::SHIFT_LEFT }, { ">>", EnumBinOpNodeType::SHIFT_RIGHT },
+                { "&&", EnumBinOpNodeType::LOGICAL_AND }, { "||", EnumBinOpNodeType::LOGICAL_OR }
+            };
+
+            const auto findResult = stringSymbolMap.find(token.asStringSymbol());
+
+            if (findResult != stringSymbolMap.cend())
+            {
+                return std::make_optional<EnumBinOpNodeType>(findResult->second);
+            }
+
+            return std::nullopt;
+        }
+
         // Should be unreachable.
         return std::nullopt;
     }
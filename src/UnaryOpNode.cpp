@@ -11,22 +11,24 @@
 #include <cmm/Token.h>
 
 // std includes
+#include <mutex>
 #include <unordered_map>
 
 namespace cmm
 {
     static std::unordered_map<std::string, EnumUnaryOpType> opTypeTable;
+    static std::once_flag opTypeTableInitFlag;
 
     static void oneTimeInitUnaryOpTypeTable()
     {
-        if (opTypeTable.empty())
+        std::call_once(opTypeTableInitFlag, []()
         {
             opTypeTable.emplace("&", EnumUnaryOpType::ADDRESS_OF);
             opTypeTable.emplace("-", EnumUnaryOpType::NEGATIVE);
             opTypeTable.emplace("+", EnumUnaryOpType::POSITIVE);
             opTypeTable.emplace("--", EnumUnaryOpType::DECREMENT);
             opTypeTable.emplace("++", EnumUnaryOpType::INCREMENT);
-        }
+        });
     }
 
     const char* toString(const EnumUnaryOpType opType) CMM_NOEXCEPT
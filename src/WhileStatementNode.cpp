@@ -30,6 +30,11 @@ namespace cmm
         return conditional.get();
     }
 
+    void WhileStatementNode::setConditional(std::unique_ptr<ExpressionNode>&& expression) CMM_NOEXCEPT
+    {
+        conditional = std::move(expression);
+    }
+
     StatementNode* WhileStatementNode::getStatement() CMM_NOEXCEPT
     {
         return statement.get();
@@ -0,0 +1,402 @@
+/**
+ * Simple, conservative alias queries over IR pointers.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/Constant.h>
+#include <cmm/ir/Function.h>
+#include <cmm/ir/Instruction.h>
+#include <cmm/ir/Type.h>
+
+// std includes
+#include <algorithm>
+#include <vector>
+
+namespace cmm::ir
+{
+    // A pointer as a constant path of indices from the pointer a chain of GEPs starts at.
+    struct AccessPath
+    {
+        const Value* root = nullptr;
+        const Type* rootType = nullptr;
+        std::vector<s64> indices;
+    };
+
+    /**
+     * Flattens a chain of inbounds GEPs with constant indices (ex. v3.v2.x).
+     *
+     * @param pointer the pointer Value.
+     * @param path the AccessPath to fill in.
+     * @return bool true if the pointer is such a chain, else false.
+     */
+    static bool getAccessPath(const Value* pointer, AccessPath& path)
+    {
+        std::vector<const Instruction*> chain;
+
+        while (pointer->getKind() == EnumValueKind::INSTRUCTION)
+        {
+            const auto* instruction = static_cast<const Instruction*>(pointer);
+
+            if (instruction->getOpcode() != EnumOpcode::GET_ELEMENT_PTR || !instruction->hasFlag(EnumInstructionFlag::INBOUNDS))
+            {
+                break;
+            }
+
+            for (std::size_t i = 1; i < instruction->getNumOperands(); ++i)
+            {
+                if (instruction->getOperand(i)->getKind() != EnumValueKind::CONSTANT_INT)
+                {
+                    return false;
+                }
+            }
+
+            chain.push_back(instruction);
+            pointer = instruction->getOperand(0);
+        }
+
+        if (chain.empty())
+        {
+            return false;
+        }
+
+        path.root = pointer;
+        path.rootType = chain.back()->getAuxType();
+        path.indices.clear();
+
+        for (auto iter = chain.crbegin(); iter != chain.crend(); ++iter)
+        {
+            const auto* gep = *iter;
+            const auto first = static_cast<const ConstantInt*>(gep->getOperand(1))->getValue();
+
+            // An outer GEP continues the path only if it stays within the element reached.
+            if (iter != chain.crbegin() && first != 0)
+            {
+                return false;
+            }
+
+            if (iter == chain.crbegin())
+            {
+                path.indices.push_back(first);
+            }
+
+            for (std::size_t i = 2; i < gep->getNumOperands(); ++i)
+            {
+                path.indices.push_back(static_cast<const ConstantInt*>(gep->getOperand(i))->getValue());
+            }
+        }
+
+        return true;
+    }
+
+    const Value* getUnderlyingObject(const Value* pointer) CMM_NOEXCEPT
+    {
+        while (pointer->getKind() == EnumValueKind::INSTRUCTION)
+        {
+            const auto* instruction = static_cast<const Instruction*>(pointer);
+
+            if (instruction->getOpcode() != EnumOpcode::GET_ELEMENT_PTR && instruction->getOpcode() != EnumOpcode::BITCAST)
+            {
+                break;
+            }
+
+            pointer = instruction->getOperand(0);
+        }
+
+        return pointer;
+    }
+
+    bool isIdentifiedObject(const Value* value) CMM_NOEXCEPT
+    {
+        return value->getKind() == EnumValueKind::GLOBAL_VARIABLE
+            || (value->getKind() == EnumValueKind::INSTRUCTION && static_cast<const Instruction*>(value)->getOpcode() == EnumOpcode::ALLOCA);
+    }
+
+    bool isDereferenceablePointer(const Value* pointer)
+    {
+        if (isIdentifiedObject(pointer))
+        {
+            return true;
+        }
+
+        // Only the first index may step outside the object, so it has to be zero.
+        AccessPath path;
+        return getAccessPath(pointer, path) && isIdentifiedObject(path.root) && path.indices.front() == 0;
+    }
+
+    bool mayAlias(const Value* first, const Value* second)
+    {
+        if (first == second)
+        {
+            return true;
+        }
+
+        const auto* firstObject = getUnderlyingObject(first);
+        const auto* secondObject = getUnderlyingObject(second);
+
+        if (firstObject != secondObject && isIdentifiedObject(firstObject) && isIdentifiedObject(secondObject))
+        {
+            return false;
+        }
+
+        // Distinct constant paths into the same aggregate (ex. v.x and v.y) can't overlap.
+        AccessPath firstPath;
+        AccessPath secondPath;
+
+        if (getAccessPath(first, firstPath) && getAccessPath(second, secondPath)
+            && firstPath.root == secondPath.root && firstPath.rootType == secondPath.rootType)
+        {
+            const auto [firstMismatch, secondMismatch] = std::mismatch(firstPath.indices.cbegin(), firstPath.indices.cend(),
+                                                                       secondPath.indices.cbegin(), secondPath.indices.cend());
+
+            if (firstMismatch != firstPath.indices.cend() && secondMismatch != secondPath.indices.cend())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Gets whether a pointer's address may be captured.
+     *
+     * @param pointer the pointer Value.
+     * @param trustNoCapture whether passing it to a nocapture argument of a call is fine.
+     * @return bool.
+     */
+    static bool isCaptured(const Value* pointer, const bool trustNoCapture)
+    {
+        for (const auto* user : pointer->getUsers())
+        {
+            switch (user->getOpcode())
+            {
+            case EnumOpcode::LOAD:
+                // fallthrough
+            case EnumOpcode::ICMP:
+                break;
+            case EnumOpcode::STORE:
+                // Storing the pointer itself (rather than storing through it) captures it.
+                if (user->getOperand(0) == pointer)
+                {
+                    return true;
+                }
+
+                break;
+            case EnumOpcode::GET_ELEMENT_PTR:
+                // fallthrough
+            case EnumOpcode::BITCAST:
+                if (isCaptured(user, trustNoCapture))
+                {
+                    return true;
+                }
+
+                break;
+            case EnumOpcode::CALL:
+            {
+                const auto* callee = user->getCalledFunction();
+
+                if (!trustNoCapture || callee == nullptr || user->getOperand(0) == pointer)
+                {
+                    return true;
+                }
+
+                for (std::size_t i = 1; i < user->getNumOperands(); ++i)
+                {
+                    // Variadic arguments have no attributes to go by.
+                    if (user->getOperand(i) == pointer && (i > callee->argSize() || !callee->getArg(i - 1)->hasAttribute(EnumArgumentAttribute::NO_CAPTURE)))
+                    {
+                        return true;
+                    }
+                }
+
+                break;
+            }
+            default:
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Gets whether two types accessed through pointers can never name the same memory in a
+     * valid C program: distinct scalar types, where char (i8) may alias anything and all
+     * pointers are treated as one type.
+     *
+     * @param first the first pointee Type.
+     * @param second the second pointee Type.
+     * @return bool.
+     */
+    static bool isTypeDisjoint(const Type* first, const Type* second) CMM_NOEXCEPT
+    {
+        const auto isScalar = [](const Type* type) { return type->isInt() || type->isFloatingPoint() || type->isPointer(); };
+
+        if (first == second || !isScalar(first) || !isScalar(second) || (first->isPointer() && second->isPointer()))
+        {
+            return false;
+        }
+
+        return !(first->isInt() && first->getBits() == 8) && !(second->isInt() && second->getBits() == 8);
+    }
+
+    const char* toString(const EnumAliasResult result) CMM_NOEXCEPT
+    {
+        switch (result)
+        {
+        case EnumAliasResult::NO_ALIAS:
+            return "NoAlias";
+        case EnumAliasResult::MAY_ALIAS:
+            return "MayAlias";
+        case EnumAliasResult::MUST_ALIAS:
+            return "MustAlias";
+        default:
+            return "Unknown EnumAliasResult";
+        }
+
+        return nullptr;
+    }
+
+    bool mayEscape(const Value* pointer)
+    {
+        return isCaptured(pointer, false);
+    }
+
+    bool mayBeCaptured(const Value* pointer)
+    {
+        return isCaptured(pointer, true);
+    }
+
+    AliasAnalysis::AliasAnalysis(const Function& function)
+    {
+        for (const auto& block : function)
+        {
+            for (const auto& instruction : *block)
+            {
+                if (instruction->getOpcode() == EnumOpcode::ALLOCA)
+                {
+                    (mayBeCaptured(instruction.get()) ? addressTaken : privateObjects).insert(instruction.get());
+                }
+            }
+        }
+    }
+
+    EnumAliasResult AliasAnalysis::alias(const Value* first, const Value* second) const
+    {
+        if (first == second)
+        {
+            return EnumAliasResult::MUST_ALIAS;
+        }
+
+        else if (!ir::mayAlias(first, second) || isTypeDisjoint(first->getType()->getElementType(), second->getType()->getElementType()))
+        {
+            return EnumAliasResult::NO_ALIAS;
+        }
+
+        AccessPath firstPath;
+        AccessPath secondPath;
+
+        if (getAccessPath(first, firstPath) && getAccessPath(second, secondPath) && firstPath.root == secondPath.root
+            && firstPath.rootType == secondPath.rootType && firstPath.indices == secondPath.indices)
+        {
+            return EnumAliasResult::MUST_ALIAS;
+        }
+
+        const auto* firstObject = getUnderlyingObject(first);
+        const auto* secondObject = getUnderlyingObject(second);
+
+        if (firstObject == secondObject)
+        {
+            return EnumAliasResult::MAY_ALIAS;
+        }
+
+        // Nothing but the local itself can point into a local whose address is never taken.
+        else if (isPrivateObject(firstObject) || isPrivateObject(secondObject))
+        {
+            return EnumAliasResult::NO_ALIAS;
+        }
+
+        // A noalias argument's memory is only reached through it while the function runs.
+        const auto isNoAliasArgument = [](const Value* object)
+        {
+            return object->getKind() == EnumValueKind::ARGUMENT && static_cast<const Argument*>(object)->hasAttribute(EnumArgumentAttribute::NO_ALIAS);
+        };
+
+        const auto isKnownObject = [](const Value* object)
+        {
+            return object->getKind() == EnumValueKind::ARGUMENT || isIdentifiedObject(object);
+        };
+
+        if ((isNoAliasArgument(firstObject) && isKnownObject(secondObject)) || (isNoAliasArgument(secondObject) && isKnownObject(firstObject)))
+        {
+            return EnumAliasResult::NO_ALIAS;
+        }
+
+        return EnumAliasResult::MAY_ALIAS;
+    }
+
+    bool AliasAnalysis::mayAlias(const Value* first, const Value* second) const
+    {
+        return alias(first, second) != EnumAliasResult::NO_ALIAS;
+    }
+
+    bool AliasAnalysis::mayAccess(const Instruction& instruction, const Value* pointer) const
+    {
+        switch (instruction.getOpcode())
+        {
+        case EnumOpcode::LOAD:
+            return mayAlias(instruction.getOperand(0), pointer);
+        case EnumOpcode::STORE:
+            return mayAlias(instruction.getOperand(1), pointer);
+        case EnumOpcode::CALL:
+        {
+            const auto* object = getUnderlyingObject(pointer);
+
+            if (instruction.getCalledFunction()->hasAttribute(EnumFunctionAttribute::READ_NONE))
+            {
+                return false;
+            }
+
+            else if (!isPrivateObject(object))
+            {
+                return true;
+            }
+
+            // The callee can still use a local passed to it (as a nocapture argument).
+            for (std::size_t i = 1; i < instruction.getNumOperands(); ++i)
+            {
+                const auto* arg = instruction.getOperand(i);
+
+                if (arg->getType()->isPointer() && getUnderlyingObject(arg) == object)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+        default:
+            return instruction.mayReadMemory() || instruction.mayWriteMemory();
+        }
+    }
+
+    bool AliasAnalysis::isAddressTaken(const Value* object) const
+    {
+        return addressTaken.find(object) != addressTaken.cend();
+    }
+
+    const std::unordered_set<const Value*>& AliasAnalysis::getAddressTaken() const CMM_NOEXCEPT
+    {
+        return addressTaken;
+    }
+
+    bool AliasAnalysis::isPrivateObject(const Value* object) const
+    {
+        // Allocas created after the analysis ran aren't known to be private.
+        return privateObjects.find(object) != privateObjects.cend();
+    }
+}
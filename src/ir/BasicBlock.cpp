@@ -0,0 +1,214 @@
+/**
+ * A basic block in the cmm IR: a straight line list of instructions ending in a terminator.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/BasicBlock.h>
+#include <cmm/ir/Function.h>
+
+// std includes
+#include <algorithm>
+
+namespace cmm::ir
+{
+    BasicBlock::BasicBlock(Type* labelType, std::string name) : Value(EnumValueKind::BASIC_BLOCK, labelType, std::move(name)),
+        parent(nullptr)
+    {
+    }
+
+    /* virtual */
+    BasicBlock::~BasicBlock()
+    {
+        // Drop every reference first so instructions can be destroyed in any order
+        // (ex. a PHI using a value defined later in the same block).
+        for (auto& instruction : instructions)
+        {
+            instruction->dropAllReferences();
+        }
+
+        instructions.clear();
+    }
+
+    Function* BasicBlock::getParent() const CMM_NOEXCEPT
+    {
+        return parent;
+    }
+
+    bool BasicBlock::empty() const CMM_NOEXCEPT
+    {
+        return instructions.empty();
+    }
+
+    std::size_t BasicBlock::size() const CMM_NOEXCEPT
+    {
+        return instructions.size();
+    }
+
+    BasicBlock::InstructionList::iterator BasicBlock::begin() CMM_NOEXCEPT
+    {
+        return instructions.begin();
+    }
+
+    BasicBlock::InstructionList::iterator BasicBlock::end() CMM_NOEXCEPT
+    {
+        return instructions.end();
+    }
+
+    BasicBlock::InstructionList::const_iterator BasicBlock::begin() const CMM_NOEXCEPT
+    {
+        return instructions.cbegin();
+    }
+
+    BasicBlock::InstructionList::const_iterator BasicBlock::end() const CMM_NOEXCEPT
+    {
+        return instructions.cend();
+    }
+
+    Instruction* BasicBlock::front() const CMM_NOEXCEPT
+    {
+        return instructions.empty() ? nullptr : instructions.front().get();
+    }
+
+    Instruction* BasicBlock::back() const CMM_NOEXCEPT
+    {
+        return instructions.empty() ? nullptr : instructions.back().get();
+    }
+
+    Instruction* BasicBlock::getTerminator() const CMM_NOEXCEPT
+    {
+        auto* last = back();
+        return last != nullptr && last->isTerminator() ? last : nullptr;
+    }
+
+    Instruction* BasicBlock::getFirstNonPhi() const CMM_NOEXCEPT
+    {
+        for (const auto& instruction : instructions)
+        {
+            if (instruction->getOpcode() != EnumOpcode::PHI)
+            {
+                return instruction.get();
+            }
+        }
+
+        return nullptr;
+    }
+
+    Instruction* BasicBlock::append(std::unique_ptr<Instruction>&& instruction)
+    {
+        return insertBefore(nullptr, std::move(instruction));
+    }
+
+    Instruction* BasicBlock::insertBefore(Instruction* position, std::unique_ptr<Instruction>&& instruction)
+    {
+        auto* result = instruction.get();
+        const auto iter = position != nullptr ? position->position : instructions.end();
+
+        result->parent = this;
+        result->position = instructions.insert(iter, std::move(instruction));
+
+        return result;
+    }
+
+    std::unique_ptr<Instruction> BasicBlock::remove(Instruction* instruction)
+    {
+        auto result = std::move(*instruction->position);
+        instructions.erase(instruction->position);
+        result->parent = nullptr;
+
+        return result;
+    }
+
+    std::vector<BasicBlock*> BasicBlock::getPredecessors() const
+    {
+        std::vector<BasicBlock*> result;
+
+        for (const auto* user : users)
+        {
+            if (user->isTerminator() && user->getParent() != nullptr)
+            {
+                auto* pred = user->getParent();
+
+                if (std::find(result.cbegin(), result.cend(), pred) == result.cend())
+                {
+                    result.push_back(pred);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<BasicBlock*> BasicBlock::getSuccessors() const
+    {
+        const auto* terminator = getTerminator();
+
+        if (terminator == nullptr)
+        {
+            return {};
+        }
+
+        auto result = terminator->getSuccessors();
+
+        // Keep each successor once (ex. "br i1 %c, label %a, label %a").
+        std::vector<BasicBlock*> unique;
+        unique.reserve(result.size());
+
+        for (auto* succ : result)
+        {
+            if (std::find(unique.cbegin(), unique.cend(), succ) == unique.cend())
+            {
+                unique.push_back(succ);
+            }
+        }
+
+        return unique;
+    }
+
+    BasicBlock* BasicBlock::getSinglePredecessor() const
+    {
+        const auto preds = getPredecessors();
+        return preds.size() == 1 ? preds.front() : nullptr;
+    }
+
+    void BasicBlock::removeFromSuccessorPhis()
+    {
+        for (auto* succ : getSuccessors())
+        {
+            for (auto& instruction : *succ)
+            {
+                if (instruction->getOpcode() != EnumOpcode::PHI)
+                {
+                    break;
+                }
+
+                for (std::size_t i = instruction->getNumIncoming(); i-- > 0;)
+                {
+                    if (instruction->getIncomingBlock(i) == this)
+                    {
+                        instruction->removeIncoming(i);
+                    }
+                }
+            }
+        }
+    }
+
+    void BasicBlock::eraseFromParent()
+    {
+        parent->remove(this);
+    }
+
+    void BasicBlock::spliceInto(Instruction* position, BasicBlock* other)
+    {
+        auto first = position->position;
+
+        for (auto iter = first; iter != instructions.end(); ++iter)
+        {
+            (*iter)->parent = other;
+        }
+
+        other->instructions.splice(other->instructions.end(), instructions, first, instructions.end());
+    }
+}
@@ -0,0 +1,179 @@
+/**
+ * Call graph of a cmm IR module.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/ir/CallGraph.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <algorithm>
+
+namespace cmm::ir
+{
+    static const std::vector<Instruction*> emptyCalls;
+
+    CallGraph::CallGraph(const Module& module)
+    {
+        recalculate(module);
+    }
+
+    void CallGraph::recalculate(const Module& module)
+    {
+        nodes.clear();
+        bottomUpOrder.clear();
+
+        std::vector<Function*> defined;
+
+        for (const auto& function : module.getFunctions())
+        {
+            auto& node = nodes[function.get()];
+
+            if (function->isDeclaration())
+            {
+                continue;
+            }
+
+            defined.push_back(function.get());
+
+            for (const auto& block : *function)
+            {
+                for (const auto& instruction : *block)
+                {
+                    if (instruction->getOpcode() == EnumOpcode::CALL)
+                    {
+                        node.calls.push_back(instruction.get());
+                        nodes[instruction->getCalledFunction()].callSites.push_back(instruction.get());
+                    }
+                }
+            }
+        }
+
+        // Tarjan's strongly connected components; components complete callees first.
+        struct Frame
+        {
+            Function* function;
+            std::size_t nextCall;
+        };
+
+        std::unordered_map<const Function*, u32> indices;
+        std::unordered_map<const Function*, u32> lowLinks;
+        std::vector<Function*> componentStack;
+        std::vector<Frame> frames;
+        u32 nextIndex = 0;
+        u32 nextComponent = 1;
+
+        for (auto* root : defined)
+        {
+            if (indices.find(root) != indices.cend())
+            {
+                continue;
+            }
+
+            frames.push_back({ root, 0 });
+            indices[root] = lowLinks[root] = nextIndex++;
+            componentStack.push_back(root);
+
+            while (!frames.empty())
+            {
+                auto& frame = frames.back();
+                const auto& calls = nodes[frame.function].calls;
+
+                if (frame.nextCall < calls.size())
+                {
+                    auto* callee = calls[frame.nextCall++]->getCalledFunction();
+
+                    if (callee->isDeclaration())
+                    {
+                        continue;
+                    }
+
+                    else if (callee == frame.function)
+                    {
+                        nodes[callee].recursive = true;
+                    }
+
+                    const auto findResult = indices.find(callee);
+
+                    if (findResult == indices.cend())
+                    {
+                        indices[callee] = lowLinks[callee] = nextIndex++;
+                        componentStack.push_back(callee);
+                        frames.push_back({ callee, 0 });
+                    }
+
+                    // Still on the stack means it is part of the component being formed.
+                    else if (nodes[callee].component == 0)
+                    {
+                        lowLinks[frame.function] = std::min(lowLinks[frame.function], findResult->second);
+                    }
+
+                    continue;
+                }
+
+                auto* function = frame.function;
+                frames.pop_back();
+
+                if (!frames.empty())
+                {
+                    auto* caller = frames.back().function;
+                    lowLinks[caller] = std::min(lowLinks[caller], lowLinks[function]);
+                }
+
+                if (lowLinks[function] != indices[function])
+                {
+                    continue;
+                }
+
+                const auto first = std::find(componentStack.cbegin(), componentStack.cend(), function);
+                const bool cycle = componentStack.cend() - first > 1;
+
+                for (auto iter = first; iter != componentStack.cend(); ++iter)
+                {
+                    auto& node = nodes[*iter];
+                    node.component = nextComponent;
+                    node.recursive |= cycle;
+                    bottomUpOrder.push_back(*iter);
+                }
+
+                componentStack.erase(first, componentStack.cend());
+                ++nextComponent;
+            }
+        }
+    }
+
+    const std::vector<Instruction*>& CallGraph::getCalls(const Function* caller) const
+    {
+        const auto findResult = nodes.find(caller);
+        return findResult != nodes.cend() ? findResult->second.calls : emptyCalls;
+    }
+
+    const std::vector<Instruction*>& CallGraph::getCallSites(const Function* callee) const
+    {
+        const auto findResult = nodes.find(callee);
+        return findResult != nodes.cend() ? findResult->second.callSites : emptyCalls;
+    }
+
+    bool CallGraph::isRecursive(const Function* function) const CMM_NOEXCEPT
+    {
+        const auto findResult = nodes.find(function);
+        return findResult != nodes.cend() && findResult->second.recursive;
+    }
+
+    bool CallGraph::isSameComponent(const Function* first, const Function* second) const CMM_NOEXCEPT
+    {
+        const auto firstResult = nodes.find(first);
+        const auto secondResult = nodes.find(second);
+
+        return firstResult != nodes.cend() && secondResult != nodes.cend() && firstResult->second.component != 0
+            && firstResult->second.component == secondResult->second.component;
+    }
+
+    const std::vector<Function*>& CallGraph::getBottomUpOrder() const CMM_NOEXCEPT
+    {
+        return bottomUpOrder;
+    }
+}
@@ -0,0 +1,76 @@
+/**
+ * Constant values in the cmm IR.  Constants are uniqued by the owning Module.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/Constant.h>
+#include <cmm/ir/Type.h>
+
+namespace cmm::ir
+{
+    ConstantInt::ConstantInt(Type* type, const s64 value) : Value(EnumValueKind::CONSTANT_INT, type),
+        value(normalize(value, type->getBits()))
+    {
+    }
+
+    s64 ConstantInt::getValue() const CMM_NOEXCEPT
+    {
+        return value;
+    }
+
+    u64 ConstantInt::getZExtValue() const CMM_NOEXCEPT
+    {
+        const u32 bits = type->getBits();
+        const u64 asU64 = static_cast<u64>(value);
+
+        return bits >= 64 ? asU64 : asU64 & ((static_cast<u64>(1) << bits) - 1);
+    }
+
+    bool ConstantInt::isZero() const CMM_NOEXCEPT
+    {
+        return value == 0;
+    }
+
+    bool ConstantInt::isOne() const CMM_NOEXCEPT
+    {
+        return getZExtValue() == 1;
+    }
+
+    bool ConstantInt::isAllOnes() const CMM_NOEXCEPT
+    {
+        return value == -1;
+    }
+
+    /* static */
+    s64 ConstantInt::normalize(const s64 value, const u32 bits) CMM_NOEXCEPT
+    {
+        if (bits == 0 || bits >= 64)
+        {
+            return value;
+        }
+
+        const u32 shift = 64 - bits;
+        return static_cast<s64>(static_cast<u64>(value) << shift) >> shift;
+    }
+
+    ConstantFP::ConstantFP(Type* type, const f64 value) : Value(EnumValueKind::CONSTANT_FP, type),
+        value(type->getKind() == EnumTypeKind::FLOAT ? static_cast<f64>(static_cast<f32>(value)) : value)
+    {
+    }
+
+    f64 ConstantFP::getValue() const CMM_NOEXCEPT
+    {
+        return value;
+    }
+
+    ConstantNull::ConstantNull(Type* type) : Value(EnumValueKind::CONSTANT_NULL, type)
+    {
+    }
+
+    ConstantUndef::ConstantUndef(Type* type) : Value(EnumValueKind::CONSTANT_UNDEF, type)
+    {
+    }
+}
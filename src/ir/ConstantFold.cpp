@@ -0,0 +1,403 @@
+/**
+ * Evaluation of IR operations over constant operands.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/ir/ConstantFold.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <cmath>
+#include <limits>
+
+namespace cmm::ir
+{
+    static bool isFloat(const Type* type) CMM_NOEXCEPT
+    {
+        return type->getKind() == EnumTypeKind::FLOAT;
+    }
+
+    static s64 minSigned(const u32 bits) CMM_NOEXCEPT
+    {
+        return bits >= 64 ? std::numeric_limits<s64>::min() : -(static_cast<s64>(1) << (bits - 1));
+    }
+
+    bool isFoldableConstant(const Value* value) CMM_NOEXCEPT
+    {
+        switch (value->getKind())
+        {
+        case EnumValueKind::CONSTANT_INT:
+            // fallthrough
+        case EnumValueKind::CONSTANT_FP:
+            // fallthrough
+        case EnumValueKind::CONSTANT_NULL:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static Value* foldIntBinary(Module& module, const EnumOpcode opcode, const ConstantInt* left, const ConstantInt* right)
+    {
+        auto* type = left->getType();
+        const u32 bits = type->getBits();
+        const s64 a = left->getValue();
+        const s64 b = right->getValue();
+        const u64 ua = left->getZExtValue();
+        const u64 ub = right->getZExtValue();
+        u64 result;
+
+        switch (opcode)
+        {
+        case EnumOpcode::ADD:
+            result = static_cast<u64>(a) + static_cast<u64>(b);
+            break;
+        case EnumOpcode::SUB:
+            result = static_cast<u64>(a) - static_cast<u64>(b);
+            break;
+        case EnumOpcode::MUL:
+            result = static_cast<u64>(a) * static_cast<u64>(b);
+            break;
+        case EnumOpcode::SDIV:
+            // fallthrough
+        case EnumOpcode::SREM:
+            if (b == 0 || (b == -1 && a == minSigned(bits)))
+            {
+                return nullptr;
+            }
+
+            result = static_cast<u64>(opcode == EnumOpcode::SDIV ? a / b : a % b);
+            break;
+        case EnumOpcode::UDIV:
+            // fallthrough
+        case EnumOpcode::UREM:
+            if (ub == 0)
+            {
+                return nullptr;
+            }
+
+            result = opcode == EnumOpcode::UDIV ? ua / ub : ua % ub;
+            break;
+        case EnumOpcode::SHL:
+            // fallthrough
+        case EnumOpcode::LSHR:
+            // fallthrough
+        case EnumOpcode::ASHR:
+            if (ub >= bits)
+            {
+                return nullptr;
+            }
+
+            result = opcode == EnumOpcode::SHL ? ua << ub : opcode == EnumOpcode::LSHR ? ua >> ub : static_cast<u64>(a >> ub);
+            break;
+        case EnumOpcode::AND:
+            result = ua & ub;
+            break;
+        case EnumOpcode::OR:
+            result = ua | ub;
+            break;
+        case EnumOpcode::XOR:
+            result = ua ^ ub;
+            break;
+        default:
+            return nullptr;
+        }
+
+        return module.getConstantInt(type, static_cast<s64>(result));
+    }
+
+    static Value* foldFPBinary(Module& module, const EnumOpcode opcode, const ConstantFP* left, const ConstantFP* right)
+    {
+        auto* type = left->getType();
+        f64 a = left->getValue();
+        f64 b = right->getValue();
+
+        // Evaluate 'float' in single precision so results round exactly like at runtime.
+        if (isFloat(type))
+        {
+            const f32 fa = static_cast<f32>(a);
+            const f32 fb = static_cast<f32>(b);
+
+            switch (opcode)
+            {
+            case EnumOpcode::FADD:
+                return module.getConstantFP(type, fa + fb);
+            case EnumOpcode::FSUB:
+                return module.getConstantFP(type, fa - fb);
+            case EnumOpcode::FMUL:
+                return module.getConstantFP(type, fa * fb);
+            case EnumOpcode::FDIV:
+                return module.getConstantFP(type, fa / fb);
+            case EnumOpcode::FREM:
+                return module.getConstantFP(type, std::fmod(fa, fb));
+            default:
+                return nullptr;
+            }
+        }
+
+        switch (opcode)
+        {
+        case EnumOpcode::FADD:
+            return module.getConstantFP(type, a + b);
+        case EnumOpcode::FSUB:
+            return module.getConstantFP(type, a - b);
+        case EnumOpcode::FMUL:
+            return module.getConstantFP(type, a * b);
+        case EnumOpcode::FDIV:
+            return module.getConstantFP(type, a / b);
+        case EnumOpcode::FREM:
+            return module.getConstantFP(type, std::fmod(a, b));
+        default:
+            return nullptr;
+        }
+    }
+
+    Value* foldBinary(Module& module, const EnumOpcode opcode, Value* left, Value* right)
+    {
+        if (left->getKind() == EnumValueKind::CONSTANT_INT && right->getKind() == EnumValueKind::CONSTANT_INT)
+        {
+            return foldIntBinary(module, opcode, static_cast<ConstantInt*>(left), static_cast<ConstantInt*>(right));
+        }
+
+        else if (left->getKind() == EnumValueKind::CONSTANT_FP && right->getKind() == EnumValueKind::CONSTANT_FP)
+        {
+            return foldFPBinary(module, opcode, static_cast<ConstantFP*>(left), static_cast<ConstantFP*>(right));
+        }
+
+        return nullptr;
+    }
+
+    Value* foldCompare(Module& module, const EnumCmpPredicate predicate, Value* left, Value* right)
+    {
+        bool result;
+
+        if (left->getKind() == EnumValueKind::CONSTANT_FP && right->getKind() == EnumValueKind::CONSTANT_FP)
+        {
+            const f64 a = static_cast<ConstantFP*>(left)->getValue();
+            const f64 b = static_cast<ConstantFP*>(right)->getValue();
+            const bool unordered = std::isnan(a) || std::isnan(b);
+
+            switch (predicate)
+            {
+            case EnumCmpPredicate::OEQ:
+                result = !unordered && !(a < b) && !(a > b);
+                break;
+            case EnumCmpPredicate::ONE:
+                result = !unordered && (a < b || a > b);
+                break;
+            case EnumCmpPredicate::OGT:
+                result = !unordered && a > b;
+                break;
+            case EnumCmpPredicate::OGE:
+                result = !unordered && a >= b;
+                break;
+            case EnumCmpPredicate::OLT:
+                result = !unordered && a < b;
+                break;
+            case EnumCmpPredicate::OLE:
+                result = !unordered && a <= b;
+                break;
+            case EnumCmpPredicate::UNE:
+                result = unordered || a < b || a > b;
+                break;
+            default:
+                return nullptr;
+            }
+
+            return result ? module.getTrue() : module.getFalse();
+        }
+
+        // Null pointers compare as zero.
+        const auto asInt = [](const Value* value, s64& s, u64& u) -> bool
+        {
+            if (value->getKind() == EnumValueKind::CONSTANT_INT)
+            {
+                s = static_cast<const ConstantInt*>(value)->getValue();
+                u = static_cast<const ConstantInt*>(value)->getZExtValue();
+                return true;
+            }
+
+            else if (value->getKind() == EnumValueKind::CONSTANT_NULL)
+            {
+                s = 0;
+                u = 0;
+                return true;
+            }
+
+            return false;
+        };
+
+        s64 a, b;
+        u64 ua, ub;
+
+        if (!asInt(left, a, ua) || !asInt(right, b, ub))
+        {
+            return nullptr;
+        }
+
+        switch (predicate)
+        {
+        case EnumCmpPredicate::EQ:
+            result = ua == ub;
+            break;
+        case EnumCmpPredicate::NE:
+            result = ua != ub;
+            break;
+        case EnumCmpPredicate::SGT:
+            result = a > b;
+            break;
+        case EnumCmpPredicate::SGE:
+            result = a >= b;
+            break;
+        case EnumCmpPredicate::SLT:
+            result = a < b;
+            break;
+        case EnumCmpPredicate::SLE:
+            result = a <= b;
+            break;
+        case EnumCmpPredicate::UGT:
+            result = ua > ub;
+            break;
+        case EnumCmpPredicate::UGE:
+            result = ua >= ub;
+            break;
+        case EnumCmpPredicate::ULT:
+            result = ua < ub;
+            break;
+        case EnumCmpPredicate::ULE:
+            result = ua <= ub;
+            break;
+        default:
+            return nullptr;
+        }
+
+        return result ? module.getTrue() : module.getFalse();
+    }
+
+    Value* foldCast(Module& module, const EnumOpcode opcode, Value* value, Type* type)
+    {
+        const auto kind = value->getKind();
+
+        if (kind == EnumValueKind::CONSTANT_INT)
+        {
+            const auto* constant = static_cast<ConstantInt*>(value);
+
+            switch (opcode)
+            {
+            case EnumOpcode::TRUNC:
+                // fallthrough
+            case EnumOpcode::SEXT:
+                return module.getConstantInt(type, constant->getValue());
+            case EnumOpcode::ZEXT:
+                return module.getConstantInt(type, static_cast<s64>(constant->getZExtValue()));
+            case EnumOpcode::SI_TO_FP:
+                return module.getConstantFP(type, isFloat(type) ? static_cast<f32>(constant->getValue()) : static_cast<f64>(constant->getValue()));
+            case EnumOpcode::UI_TO_FP:
+                return module.getConstantFP(type, isFloat(type) ? static_cast<f32>(constant->getZExtValue()) : static_cast<f64>(constant->getZExtValue()));
+            case EnumOpcode::INT_TO_PTR:
+                return constant->isZero() ? module.getNull(type) : nullptr;
+            default:
+                return nullptr;
+            }
+        }
+
+        else if (kind == EnumValueKind::CONSTANT_FP)
+        {
+            const f64 fp = static_cast<ConstantFP*>(value)->getValue();
+
+            switch (opcode)
+            {
+            case EnumOpcode::FP_TRUNC:
+                // fallthrough
+            case EnumOpcode::FP_EXT:
+                return module.getConstantFP(type, fp);
+            case EnumOpcode::FP_TO_SI:
+            {
+                // Out of range (or NaN) conversions are undefined, leave them for runtime.
+                const f64 truncated = std::trunc(fp);
+                const u32 bits = type->getBits();
+                const f64 low = static_cast<f64>(minSigned(bits));
+
+                if (!(truncated >= low && truncated < -low))
+                {
+                    return nullptr;
+                }
+
+                return module.getConstantInt(type, static_cast<s64>(truncated));
+            }
+            case EnumOpcode::FP_TO_UI:
+            {
+                const f64 truncated = std::trunc(fp);
+                const f64 high = std::ldexp(1.0, static_cast<s32>(type->getBits()));
+
+                if (!(truncated >= 0.0 && truncated < high))
+                {
+                    return nullptr;
+                }
+
+                return module.getConstantInt(type, static_cast<s64>(static_cast<u64>(truncated)));
+            }
+            default:
+                return nullptr;
+            }
+        }
+
+        else if (kind == EnumValueKind::CONSTANT_NULL)
+        {
+            switch (opcode)
+            {
+            case EnumOpcode::BITCAST:
+                return module.getNull(type);
+            case EnumOpcode::PTR_TO_INT:
+                return module.getConstantInt(type, 0);
+            default:
+                return nullptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+    Value* foldInstruction(Module& module, const Instruction& instruction, const std::vector<Value*>& operands)
+    {
+        for (const auto* operand : operands)
+        {
+            if (!isFoldableConstant(operand))
+            {
+                return nullptr;
+            }
+        }
+
+        const auto opcode = instruction.getOpcode();
+
+        if (instruction.isBinaryOp())
+        {
+            return foldBinary(module, opcode, operands[0], operands[1]);
+        }
+
+        else if (instruction.isCompare())
+        {
+            return foldCompare(module, instruction.getPredicate(), operands[0], operands[1]);
+        }
+
+        else if (instruction.isCast())
+        {
+            return foldCast(module, opcode, operands[0], instruction.getType());
+        }
+
+        else if (opcode == EnumOpcode::FNEG)
+        {
+            return module.getConstantFP(instruction.getType(), -static_cast<ConstantFP*>(operands[0])->getValue());
+        }
+
+        else if (opcode == EnumOpcode::SELECT && operands[0]->getKind() == EnumValueKind::CONSTANT_INT)
+        {
+            return static_cast<ConstantInt*>(operands[0])->isZero() ? operands[2] : operands[1];
+        }
+
+        return nullptr;
+    }
+}
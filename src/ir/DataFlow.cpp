@@ -0,0 +1,379 @@
+/**
+ * A generic worklist solver for bit vector dataflow problems over the CFG of a cmm IR function.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/ir/DataFlow.h>
+#include <cmm/ir/Function.h>
+
+// std includes
+#include <algorithm>
+#include <deque>
+#include <utility>
+
+namespace cmm::ir
+{
+    static constexpr std::size_t BITS_PER_WORD = 64;
+
+    /**
+     * Gets the number of words needed to hold a number of bits.
+     *
+     * @param bits the number of bits.
+     * @return std::size_t.
+     */
+    static std::size_t getWordCount(const std::size_t bits) CMM_NOEXCEPT
+    {
+        return (bits + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    }
+
+    BitVector::BitVector(const std::size_t size, const bool value) : bits(size), words(getWordCount(size), value ? ~0ULL : 0ULL)
+    {
+        clearUnusedBits();
+    }
+
+    bool BitVector::operator== (const BitVector& other) const CMM_NOEXCEPT
+    {
+        return bits == other.bits && words == other.words;
+    }
+
+    bool BitVector::operator!= (const BitVector& other) const CMM_NOEXCEPT
+    {
+        return !(*this == other);
+    }
+
+    std::size_t BitVector::size() const CMM_NOEXCEPT
+    {
+        return bits;
+    }
+
+    void BitVector::resize(const std::size_t size)
+    {
+        bits = size;
+        words.resize(getWordCount(size), 0);
+        clearUnusedBits();
+    }
+
+    bool BitVector::test(const std::size_t index) const CMM_NOEXCEPT
+    {
+        return (words[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1;
+    }
+
+    void BitVector::set(const std::size_t index) CMM_NOEXCEPT
+    {
+        words[index / BITS_PER_WORD] |= 1ULL << (index % BITS_PER_WORD);
+    }
+
+    void BitVector::reset(const std::size_t index) CMM_NOEXCEPT
+    {
+        words[index / BITS_PER_WORD] &= ~(1ULL << (index % BITS_PER_WORD));
+    }
+
+    void BitVector::setAll() CMM_NOEXCEPT
+    {
+        std::fill(words.begin(), words.end(), ~0ULL);
+        clearUnusedBits();
+    }
+
+    void BitVector::clear() CMM_NOEXCEPT
+    {
+        std::fill(words.begin(), words.end(), 0ULL);
+    }
+
+    bool BitVector::any() const CMM_NOEXCEPT
+    {
+        return std::any_of(words.cbegin(), words.cend(), [](const u64 word) { return word != 0; });
+    }
+
+    std::size_t BitVector::count() const CMM_NOEXCEPT
+    {
+        std::size_t result = 0;
+
+        for (u64 word : words)
+        {
+            // Clear the lowest set bit until none are left.
+            for (; word != 0; word &= word - 1)
+            {
+                ++result;
+            }
+        }
+
+        return result;
+    }
+
+    std::size_t BitVector::findNext(const std::size_t index) const CMM_NOEXCEPT
+    {
+        if (index >= bits)
+        {
+            return npos;
+        }
+
+        std::size_t wordIndex = index / BITS_PER_WORD;
+        u64 word = words[wordIndex] & (~0ULL << (index % BITS_PER_WORD));
+
+        while (word == 0)
+        {
+            if (++wordIndex == words.size())
+            {
+                return npos;
+            }
+
+            word = words[wordIndex];
+        }
+
+        std::size_t bit = 0;
+
+        for (; (word & 1) == 0; word >>= 1)
+        {
+            ++bit;
+        }
+
+        return wordIndex * BITS_PER_WORD + bit;
+    }
+
+    bool BitVector::unionWith(const BitVector& other) CMM_NOEXCEPT
+    {
+        u64 changed = 0;
+
+        for (std::size_t i = 0; i < words.size(); ++i)
+        {
+            const u64 word = words[i] | other.words[i];
+            changed |= word ^ words[i];
+            words[i] = word;
+        }
+
+        return changed != 0;
+    }
+
+    bool BitVector::intersectWith(const BitVector& other) CMM_NOEXCEPT
+    {
+        u64 changed = 0;
+
+        for (std::size_t i = 0; i < words.size(); ++i)
+        {
+            const u64 word = words[i] & other.words[i];
+            changed |= word ^ words[i];
+            words[i] = word;
+        }
+
+        return changed != 0;
+    }
+
+    bool BitVector::subtract(const BitVector& other) CMM_NOEXCEPT
+    {
+        u64 changed = 0;
+
+        for (std::size_t i = 0; i < words.size(); ++i)
+        {
+            const u64 word = words[i] & ~other.words[i];
+            changed |= word ^ words[i];
+            words[i] = word;
+        }
+
+        return changed != 0;
+    }
+
+    bool BitVector::assignTransfer(const BitVector& gen, const BitVector& in, const BitVector& kill) CMM_NOEXCEPT
+    {
+        u64 changed = 0;
+
+        for (std::size_t i = 0; i < words.size(); ++i)
+        {
+            const u64 word = gen.words[i] | (in.words[i] & ~kill.words[i]);
+            changed |= word ^ words[i];
+            words[i] = word;
+        }
+
+        return changed != 0;
+    }
+
+    void BitVector::clearUnusedBits() CMM_NOEXCEPT
+    {
+        const std::size_t used = bits % BITS_PER_WORD;
+
+        if (used != 0)
+        {
+            words.back() &= (1ULL << used) - 1;
+        }
+    }
+
+    DataFlowSolver::DataFlowSolver(const Function& function, const std::size_t bits, const EnumDataFlowDirection direction,
+        const EnumDataFlowMeet meet) : direction(direction), meet(meet), boundary(bits)
+    {
+        // Post order walk of the CFG with an explicit stack since functions may have
+        // thousands of blocks.
+        std::vector<std::pair<BasicBlock*, std::vector<BasicBlock*>>> stack;
+        std::unordered_map<const BasicBlock*, bool> visited;
+        auto* entry = function.getEntryBlock();
+
+        visited[entry] = true;
+        stack.emplace_back(entry, entry->getSuccessors());
+
+        while (!stack.empty())
+        {
+            auto& [block, blockSuccs] = stack.back();
+
+            if (blockSuccs.empty())
+            {
+                blocks.push_back(block);
+                stack.pop_back();
+                continue;
+            }
+
+            auto* succ = blockSuccs.back();
+            blockSuccs.pop_back();
+
+            if (!visited[succ])
+            {
+                visited[succ] = true;
+                stack.emplace_back(succ, succ->getSuccessors());
+            }
+        }
+
+        std::reverse(blocks.begin(), blocks.end());
+
+        // Unreachable blocks still get a value (and backward problems may still reach them).
+        for (const auto& block : function)
+        {
+            if (!visited[block.get()])
+            {
+                blocks.push_back(block.get());
+            }
+        }
+
+        const auto count = static_cast<u32>(blocks.size());
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            indices.emplace(blocks[i], i);
+        }
+
+        preds.assign(count, {});
+        succs.assign(count, {});
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            for (const auto* succ : blocks[i]->getSuccessors())
+            {
+                const u32 succIndex = indexOf(succ);
+                succs[i].push_back(succIndex);
+                preds[succIndex].push_back(i);
+            }
+        }
+
+        // Start from the top of the lattice: nothing for a union, everything for an intersection.
+        const bool top = meet == EnumDataFlowMeet::INTERSECTION;
+
+        gens.assign(count, BitVector(bits));
+        kills.assign(count, BitVector(bits));
+        ins.assign(count, BitVector(bits, top));
+        outs.assign(count, BitVector(bits, top));
+    }
+
+    BitVector& DataFlowSolver::getGen(const BasicBlock* block)
+    {
+        return gens[indexOf(block)];
+    }
+
+    BitVector& DataFlowSolver::getKill(const BasicBlock* block)
+    {
+        return kills[indexOf(block)];
+    }
+
+    BitVector& DataFlowSolver::getBoundary() CMM_NOEXCEPT
+    {
+        return boundary;
+    }
+
+    std::size_t DataFlowSolver::solve()
+    {
+        const bool forward = direction == EnumDataFlowDirection::FORWARD;
+        const auto count = static_cast<u32>(blocks.size());
+
+        // Viewed in the direction of the problem: where values come from and go to, and
+        // which end of each block is the incoming one.
+        const auto& sources = forward ? preds : succs;
+        const auto& sinks = forward ? succs : preds;
+        auto& incoming = forward ? ins : outs;
+        auto& outgoing = forward ? outs : ins;
+
+        std::deque<u32> worklist;
+        std::vector<bool> queued(count, true);
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            worklist.push_back(forward ? i : count - 1 - i);
+        }
+
+        std::size_t visits = 0;
+
+        while (!worklist.empty())
+        {
+            const u32 index = worklist.front();
+            worklist.pop_front();
+            queued[index] = false;
+            ++visits;
+
+            // The entry (or an exit) starts from the boundary, while a block with nothing
+            // flowing in at all (i.e. unreachable) keeps the top value.
+            auto& value = incoming[index];
+            const bool isBoundary = forward ? index == 0 : sources[index].empty();
+            bool first = !isBoundary;
+
+            if (isBoundary)
+            {
+                value = boundary;
+            }
+
+            for (const u32 source : sources[index])
+            {
+                if (first)
+                {
+                    value = outgoing[source];
+                    first = false;
+                }
+
+                else if (meet == EnumDataFlowMeet::UNION)
+                {
+                    value.unionWith(outgoing[source]);
+                }
+
+                else
+                {
+                    value.intersectWith(outgoing[source]);
+                }
+            }
+
+            if (outgoing[index].assignTransfer(gens[index], value, kills[index]))
+            {
+                for (const u32 sink : sinks[index])
+                {
+                    if (!queued[sink])
+                    {
+                        queued[sink] = true;
+                        worklist.push_back(sink);
+                    }
+                }
+            }
+        }
+
+        return visits;
+    }
+
+    const BitVector& DataFlowSolver::getIn(const BasicBlock* block) const
+    {
+        return ins[indexOf(block)];
+    }
+
+    const BitVector& DataFlowSolver::getOut(const BasicBlock* block) const
+    {
+        return outs[indexOf(block)];
+    }
+
+    u32 DataFlowSolver::indexOf(const BasicBlock* block) const
+    {
+        return indices.at(block);
+    }
+}
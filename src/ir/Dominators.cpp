@@ -0,0 +1,268 @@
+/**
+ * Dominator tree and dominance frontiers of a cmm IR function.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/ir/Dominators.h>
+#include <cmm/ir/Function.h>
+
+// std includes
+#include <algorithm>
+#include <utility>
+
+namespace cmm::ir
+{
+    DominatorTree::DominatorTree(const Function& function)
+    {
+        recalculate(function);
+    }
+
+    void DominatorTree::recalculate(const Function& function)
+    {
+        order.clear();
+        indices.clear();
+
+        // Post order walk of the CFG with an explicit stack since functions may have
+        // thousands of blocks.
+        std::vector<std::pair<BasicBlock*, std::vector<BasicBlock*>>> stack;
+        std::unordered_map<const BasicBlock*, bool> visited;
+        auto* entry = function.getEntryBlock();
+
+        visited[entry] = true;
+        stack.emplace_back(entry, entry->getSuccessors());
+
+        while (!stack.empty())
+        {
+            auto& [block, succs] = stack.back();
+
+            if (succs.empty())
+            {
+                order.push_back(block);
+                stack.pop_back();
+                continue;
+            }
+
+            auto* succ = succs.back();
+            succs.pop_back();
+
+            if (!visited[succ])
+            {
+                visited[succ] = true;
+                stack.emplace_back(succ, succ->getSuccessors());
+            }
+        }
+
+        std::reverse(order.begin(), order.end());
+
+        const auto count = static_cast<u32>(order.size());
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            indices.emplace(order[i], i);
+        }
+
+        // Predecessors by number, ignoring unreachable ones.
+        std::vector<std::vector<u32>> preds(count);
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            for (const auto* pred : order[i]->getPredecessors())
+            {
+                const u32 predIndex = indexOf(pred);
+
+                if (predIndex != npos)
+                {
+                    preds[i].push_back(predIndex);
+                }
+            }
+        }
+
+        // Cooper, Harvey and Kennedy's "A Simple, Fast Dominance Algorithm".
+        idoms.assign(count, npos);
+        idoms[0] = 0;
+
+        const auto intersect = [this](u32 a, u32 b)
+        {
+            while (a != b)
+            {
+                while (a > b)
+                {
+                    a = idoms[a];
+                }
+
+                while (b > a)
+                {
+                    b = idoms[b];
+                }
+            }
+
+            return a;
+        };
+
+        bool changed = true;
+
+        while (changed)
+        {
+            changed = false;
+
+            for (u32 i = 1; i < count; ++i)
+            {
+                u32 newIDom = npos;
+
+                for (const u32 pred : preds[i])
+                {
+                    if (idoms[pred] != npos)
+                    {
+                        newIDom = newIDom == npos ? pred : intersect(pred, newIDom);
+                    }
+                }
+
+                if (idoms[i] != newIDom)
+                {
+                    idoms[i] = newIDom;
+                    changed = true;
+                }
+            }
+        }
+
+        children.assign(count, {});
+
+        for (u32 i = 1; i < count; ++i)
+        {
+            children[idoms[i]].push_back(order[i]);
+        }
+
+        // Number the tree so dominance queries are an interval check.
+        enter.assign(count, 0);
+        exit.assign(count, 0);
+
+        u32 clock = 0;
+        std::vector<std::pair<u32, std::size_t>> walk { { 0, 0 } };
+        enter[0] = clock++;
+
+        while (!walk.empty())
+        {
+            auto& [index, next] = walk.back();
+
+            if (next < children[index].size())
+            {
+                const u32 child = indexOf(children[index][next++]);
+                enter[child] = clock++;
+                walk.emplace_back(child, 0);
+            }
+
+            else
+            {
+                exit[index] = clock++;
+                walk.pop_back();
+            }
+        }
+
+        // Frontiers: walk up from each predecessor of a join until reaching its idom.
+        frontiers.assign(count, {});
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            if (preds[i].size() < 2)
+            {
+                continue;
+            }
+
+            for (u32 runner : preds[i])
+            {
+                while (runner != idoms[i])
+                {
+                    auto& frontier = frontiers[runner];
+
+                    if (frontier.empty() || frontier.back() != order[i])
+                    {
+                        frontier.push_back(order[i]);
+                    }
+
+                    runner = idoms[runner];
+                }
+            }
+        }
+    }
+
+    bool DominatorTree::isReachable(const BasicBlock* block) const CMM_NOEXCEPT
+    {
+        return indexOf(block) != npos;
+    }
+
+    BasicBlock* DominatorTree::getIDom(const BasicBlock* block) const CMM_NOEXCEPT
+    {
+        const u32 index = indexOf(block);
+        return index == npos || index == 0 ? nullptr : order[idoms[index]];
+    }
+
+    const std::vector<BasicBlock*>& DominatorTree::getChildren(const BasicBlock* block) const
+    {
+        static const std::vector<BasicBlock*> none;
+        const u32 index = indexOf(block);
+
+        return index == npos ? none : children[index];
+    }
+
+    bool DominatorTree::dominates(const BasicBlock* a, const BasicBlock* b) const CMM_NOEXCEPT
+    {
+        const u32 indexB = indexOf(b);
+
+        if (indexB == npos)
+        {
+            return true;
+        }
+
+        const u32 indexA = indexOf(a);
+
+        return indexA != npos && enter[indexA] <= enter[indexB] && exit[indexB] <= exit[indexA];
+    }
+
+    bool DominatorTree::dominates(const Instruction* def, const Instruction* user) const
+    {
+        const auto* defBlock = def->getParent();
+        const auto* userBlock = user->getParent();
+
+        if (defBlock != userBlock)
+        {
+            return dominates(defBlock, userBlock);
+        }
+
+        for (const auto& instruction : *defBlock)
+        {
+            if (instruction.get() == def)
+            {
+                return true;
+            }
+
+            else if (instruction.get() == user)
+            {
+                return false;
+            }
+        }
+
+        return false;
+    }
+
+    const std::vector<BasicBlock*>& DominatorTree::getFrontier(const BasicBlock* block) const
+    {
+        static const std::vector<BasicBlock*> none;
+        const u32 index = indexOf(block);
+
+        return index == npos ? none : frontiers[index];
+    }
+
+    const std::vector<BasicBlock*>& DominatorTree::getReversePostOrder() const CMM_NOEXCEPT
+    {
+        return order;
+    }
+
+    u32 DominatorTree::indexOf(const BasicBlock* block) const CMM_NOEXCEPT
+    {
+        const auto findResult = indices.find(block);
+        return findResult != indices.cend() ? findResult->second : npos;
+    }
+}
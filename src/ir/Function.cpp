@@ -0,0 +1,235 @@
+/**
+ * A function (and its arguments) in the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/Function.h>
+#include <cmm/ir/Module.h>
+
+namespace cmm::ir
+{
+    Argument::Argument(Type* type, Function* parent, const u32 index, std::string name) :
+        Value(EnumValueKind::ARGUMENT, type, std::move(name)), parent(parent), index(index), attributes(EnumArgumentAttribute::NO_ARG_ATTRIBUTES)
+    {
+    }
+
+    Function* Argument::getParent() const CMM_NOEXCEPT
+    {
+        return parent;
+    }
+
+    u32 Argument::getIndex() const CMM_NOEXCEPT
+    {
+        return index;
+    }
+
+    u8 Argument::getAttributes() const CMM_NOEXCEPT
+    {
+        return attributes;
+    }
+
+    bool Argument::hasAttribute(const EnumArgumentAttribute attribute) const CMM_NOEXCEPT
+    {
+        return (attributes & attribute) != 0;
+    }
+
+    void Argument::setAttribute(const EnumArgumentAttribute attribute, const bool enable) CMM_NOEXCEPT
+    {
+        if (enable)
+        {
+            attributes |= attribute;
+        }
+
+        else
+        {
+            attributes &= static_cast<u8>(~attribute);
+        }
+    }
+
+    Function::Function(Type* functionType, const std::string& name, Module* parent) :
+        Value(EnumValueKind::FUNCTION, functionType->getPointerTo(), name), parent(parent),
+        functionType(functionType), linkage(EnumLinkage::EXTERNAL),
+        attributes(EnumFunctionAttribute::NO_FUNCTION_ATTRIBUTES)
+    {
+        const auto& params = functionType->getFields();
+        args.reserve(params.size());
+
+        for (std::size_t i = 0; i < params.size(); ++i)
+        {
+            args.emplace_back(std::make_unique<Argument>(params[i], this, static_cast<u32>(i)));
+        }
+    }
+
+    /* virtual */
+    Function::~Function()
+    {
+        // Drop every reference first so instructions can be destroyed in any order.
+        for (auto& block : blocks)
+        {
+            for (auto& instruction : *block)
+            {
+                instruction->dropAllReferences();
+            }
+        }
+
+        blocks.clear();
+    }
+
+    Module* Function::getParent() const CMM_NOEXCEPT
+    {
+        return parent;
+    }
+
+    Type* Function::getFunctionType() const CMM_NOEXCEPT
+    {
+        return functionType;
+    }
+
+    Type* Function::getReturnType() const CMM_NOEXCEPT
+    {
+        return functionType->getElementType();
+    }
+
+    EnumLinkage Function::getLinkage() const CMM_NOEXCEPT
+    {
+        return linkage;
+    }
+
+    void Function::setLinkage(const EnumLinkage linkage) CMM_NOEXCEPT
+    {
+        this->linkage = linkage;
+    }
+
+    u8 Function::getAttributes() const CMM_NOEXCEPT
+    {
+        return attributes;
+    }
+
+    bool Function::hasAttribute(const EnumFunctionAttribute attribute) const CMM_NOEXCEPT
+    {
+        return (attributes & attribute) != 0;
+    }
+
+    void Function::setAttribute(const EnumFunctionAttribute attribute, const bool enable) CMM_NOEXCEPT
+    {
+        if (enable)
+        {
+            attributes |= attribute;
+        }
+
+        else
+        {
+            attributes &= static_cast<u8>(~attribute);
+        }
+    }
+
+    bool Function::onlyReadsMemory() const CMM_NOEXCEPT
+    {
+        return (attributes & (EnumFunctionAttribute::READ_NONE | EnumFunctionAttribute::READ_ONLY)) != 0;
+    }
+
+    bool Function::isSideEffectFree() const CMM_NOEXCEPT
+    {
+        return onlyReadsMemory() && hasAttribute(EnumFunctionAttribute::NO_UNWIND) && hasAttribute(EnumFunctionAttribute::WILL_RETURN);
+    }
+
+    bool Function::isDeclaration() const CMM_NOEXCEPT
+    {
+        return blocks.empty();
+    }
+
+    std::size_t Function::argSize() const CMM_NOEXCEPT
+    {
+        return args.size();
+    }
+
+    Argument* Function::getArg(const std::size_t index) const CMM_NOEXCEPT
+    {
+        return args[index].get();
+    }
+
+    bool Function::empty() const CMM_NOEXCEPT
+    {
+        return blocks.empty();
+    }
+
+    std::size_t Function::size() const CMM_NOEXCEPT
+    {
+        return blocks.size();
+    }
+
+    Function::BlockList::iterator Function::begin() CMM_NOEXCEPT
+    {
+        return blocks.begin();
+    }
+
+    Function::BlockList::iterator Function::end() CMM_NOEXCEPT
+    {
+        return blocks.end();
+    }
+
+    Function::BlockList::const_iterator Function::begin() const CMM_NOEXCEPT
+    {
+        return blocks.cbegin();
+    }
+
+    Function::BlockList::const_iterator Function::end() const CMM_NOEXCEPT
+    {
+        return blocks.cend();
+    }
+
+    BasicBlock* Function::getEntryBlock() const CMM_NOEXCEPT
+    {
+        return blocks.empty() ? nullptr : blocks.front().get();
+    }
+
+    BasicBlock* Function::createBlock(const std::string& name)
+    {
+        return insertBlockAfter(nullptr, std::make_unique<BasicBlock>(parent->getTypes().getLabel(), name));
+    }
+
+    BasicBlock* Function::insertBlockAfter(BasicBlock* position, std::unique_ptr<BasicBlock>&& block)
+    {
+        auto* result = block.get();
+        const auto iter = position != nullptr ? std::next(position->position) : blocks.end();
+
+        result->parent = this;
+        result->position = blocks.insert(iter, std::move(block));
+
+        return result;
+    }
+
+    std::unique_ptr<BasicBlock> Function::remove(BasicBlock* block)
+    {
+        auto result = std::move(*block->position);
+        blocks.erase(block->position);
+        result->parent = nullptr;
+
+        return result;
+    }
+
+    void Function::moveBlockAfter(BasicBlock* block, BasicBlock* position)
+    {
+        if (block == position)
+        {
+            return;
+        }
+
+        blocks.splice(std::next(position->position), blocks, block->position);
+    }
+
+    std::size_t Function::getInstructionCount() const CMM_NOEXCEPT
+    {
+        std::size_t result = 0;
+
+        for (const auto& block : blocks)
+        {
+            result += block->size();
+        }
+
+        return result;
+    }
+}
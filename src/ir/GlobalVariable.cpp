@@ -0,0 +1,71 @@
+/**
+ * A module level variable in the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/GlobalVariable.h>
+#include <cmm/ir/Type.h>
+
+namespace cmm::ir
+{
+    const char* toString(const EnumLinkage linkage) CMM_NOEXCEPT
+    {
+        switch (linkage)
+        {
+        case EnumLinkage::EXTERNAL:
+            return "external";
+        case EnumLinkage::INTERNAL:
+            return "internal";
+        case EnumLinkage::PRIVATE:
+            return "private";
+        default:
+            return "Unknown EnumLinkage";
+        }
+
+        return nullptr;
+    }
+
+    GlobalVariable::GlobalVariable(Type* valueType, const std::string& name, const EnumLinkage linkage, const bool constant) :
+        Value(EnumValueKind::GLOBAL_VARIABLE, valueType->getPointerTo(), name), valueType(valueType),
+        linkage(linkage), constant(constant), alignment(0)
+    {
+    }
+
+    Type* GlobalVariable::getValueType() const CMM_NOEXCEPT
+    {
+        return valueType;
+    }
+
+    EnumLinkage GlobalVariable::getLinkage() const CMM_NOEXCEPT
+    {
+        return linkage;
+    }
+
+    bool GlobalVariable::isConstantGlobal() const CMM_NOEXCEPT
+    {
+        return constant;
+    }
+
+    const std::optional<std::string>& GlobalVariable::getStringInitializer() const CMM_NOEXCEPT
+    {
+        return stringInitializer;
+    }
+
+    void GlobalVariable::setStringInitializer(const std::string& str)
+    {
+        stringInitializer = str;
+    }
+
+    u32 GlobalVariable::getAlignment() const CMM_NOEXCEPT
+    {
+        return alignment;
+    }
+
+    void GlobalVariable::setAlignment(const u32 alignment) CMM_NOEXCEPT
+    {
+        this->alignment = alignment;
+    }
+}
@@ -0,0 +1,207 @@
+/**
+ * A helper for creating and inserting IR instructions.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/IRBuilder.h>
+
+namespace cmm::ir
+{
+    IRBuilder::IRBuilder(Module& module) CMM_NOEXCEPT : module(module), block(nullptr), before(nullptr)
+    {
+    }
+
+    Module& IRBuilder::getModule() CMM_NOEXCEPT
+    {
+        return module;
+    }
+
+    TypeContext& IRBuilder::getTypes() CMM_NOEXCEPT
+    {
+        return module.getTypes();
+    }
+
+    void IRBuilder::setInsertPoint(BasicBlock* block) CMM_NOEXCEPT
+    {
+        this->block = block;
+        before = nullptr;
+    }
+
+    void IRBuilder::setInsertPoint(Instruction* instruction) CMM_NOEXCEPT
+    {
+        block = instruction->getParent();
+        before = instruction;
+    }
+
+    BasicBlock* IRBuilder::getInsertBlock() const CMM_NOEXCEPT
+    {
+        return block;
+    }
+
+    bool IRBuilder::isTerminated() const CMM_NOEXCEPT
+    {
+        return before == nullptr && block != nullptr && block->getTerminator() != nullptr;
+    }
+
+    Instruction* IRBuilder::insert(std::unique_ptr<Instruction>&& instruction)
+    {
+        return block->insertBefore(before, std::move(instruction));
+    }
+
+    Instruction* IRBuilder::createAlloca(Type* type, const std::string& name)
+    {
+        auto instruction = std::make_unique<Instruction>(EnumOpcode::ALLOCA, type->getPointerTo(), std::vector<Value*>(), name);
+        instruction->setAuxType(type);
+
+        return insert(std::move(instruction));
+    }
+
+    Instruction* IRBuilder::createLoad(Value* pointer, const std::string& name)
+    {
+        auto* type = pointer->getType()->getElementType();
+        return insert(std::make_unique<Instruction>(EnumOpcode::LOAD, type, std::vector<Value*> { pointer }, name));
+    }
+
+    Instruction* IRBuilder::createStore(Value* value, Value* pointer)
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::STORE, getTypes().getVoid(), std::vector<Value*> { value, pointer }));
+    }
+
+    Instruction* IRBuilder::createGEP(Type* sourceType, Value* pointer, const std::vector<Value*>& indices, const std::string& name)
+    {
+        // The first index steps over the pointer itself, the rest index into aggregates.
+        Type* resultType = sourceType;
+
+        for (std::size_t i = 1; i < indices.size(); ++i)
+        {
+            if (resultType->isStruct())
+            {
+                const auto* index = static_cast<const ConstantInt*>(indices[i]);
+                resultType = resultType->getFields()[static_cast<std::size_t>(index->getValue())];
+            }
+
+            else
+            {
+                resultType = resultType->getElementType();
+            }
+        }
+
+        std::vector<Value*> operands;
+        operands.reserve(indices.size() + 1);
+        operands.push_back(pointer);
+        operands.insert(operands.end(), indices.cbegin(), indices.cend());
+
+        auto instruction = std::make_unique<Instruction>(EnumOpcode::GET_ELEMENT_PTR, resultType->getPointerTo(), operands, name);
+        instruction->setAuxType(sourceType);
+        instruction->setFlag(EnumInstructionFlag::INBOUNDS);
+
+        return insert(std::move(instruction));
+    }
+
+    Instruction* IRBuilder::createStructGEP(Value* pointer, const u32 fieldIndex, const std::string& name)
+    {
+        auto* structType = pointer->getType()->getElementType();
+        auto* i32 = getTypes().getInt(32);
+
+        return createGEP(structType, pointer, { module.getConstantInt(i32, 0), module.getConstantInt(i32, fieldIndex) }, name);
+    }
+
+    Instruction* IRBuilder::createBinary(const EnumOpcode opcode, Value* left, Value* right, const std::string& name)
+    {
+        return insert(std::make_unique<Instruction>(opcode, left->getType(), std::vector<Value*> { left, right }, name));
+    }
+
+    Instruction* IRBuilder::createFNeg(Value* value, const std::string& name)
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::FNEG, value->getType(), std::vector<Value*> { value }, name));
+    }
+
+    Instruction* IRBuilder::createICmp(const EnumCmpPredicate predicate, Value* left, Value* right, const std::string& name)
+    {
+        auto instruction = std::make_unique<Instruction>(EnumOpcode::ICMP, getTypes().getBool(), std::vector<Value*> { left, right }, name);
+        instruction->setPredicate(predicate);
+
+        return insert(std::move(instruction));
+    }
+
+    Instruction* IRBuilder::createFCmp(const EnumCmpPredicate predicate, Value* left, Value* right, const std::string& name)
+    {
+        auto instruction = std::make_unique<Instruction>(EnumOpcode::FCMP, getTypes().getBool(), std::vector<Value*> { left, right }, name);
+        instruction->setPredicate(predicate);
+
+        return insert(std::move(instruction));
+    }
+
+    Instruction* IRBuilder::createCast(const EnumOpcode opcode, Value* value, Type* type, const std::string& name)
+    {
+        return insert(std::make_unique<Instruction>(opcode, type, std::vector<Value*> { value }, name));
+    }
+
+    Instruction* IRBuilder::createSelect(Value* cond, Value* trueValue, Value* falseValue, const std::string& name)
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::SELECT, trueValue->getType(),
+            std::vector<Value*> { cond, trueValue, falseValue }, name));
+    }
+
+    Instruction* IRBuilder::createPhi(Type* type, const std::string& name)
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::PHI, type, std::vector<Value*>(), name));
+    }
+
+    Instruction* IRBuilder::createCall(Function* function, const std::vector<Value*>& args, const std::string& name)
+    {
+        std::vector<Value*> operands;
+        operands.reserve(args.size() + 1);
+        operands.push_back(function);
+        operands.insert(operands.end(), args.cbegin(), args.cend());
+
+        return insert(std::make_unique<Instruction>(EnumOpcode::CALL, function->getReturnType(), operands, name));
+    }
+
+    Instruction* IRBuilder::createExtractElement(Value* vector, Value* index, const std::string& name)
+    {
+        auto* type = vector->getType()->getElementType();
+        return insert(std::make_unique<Instruction>(EnumOpcode::EXTRACT_ELEMENT, type, std::vector<Value*> { vector, index }, name));
+    }
+
+    Instruction* IRBuilder::createInsertElement(Value* vector, Value* value, Value* index, const std::string& name)
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::INSERT_ELEMENT, vector->getType(),
+            std::vector<Value*> { vector, value, index }, name));
+    }
+
+    Instruction* IRBuilder::createBr(BasicBlock* dest)
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::BR, getTypes().getVoid(), std::vector<Value*> { dest }));
+    }
+
+    Instruction* IRBuilder::createCondBr(Value* cond, BasicBlock* trueDest, BasicBlock* falseDest)
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::COND_BR, getTypes().getVoid(),
+            std::vector<Value*> { cond, trueDest, falseDest }));
+    }
+
+    Instruction* IRBuilder::createSwitch(Value* cond, BasicBlock* defaultDest)
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::SWITCH, getTypes().getVoid(),
+            std::vector<Value*> { cond, defaultDest }));
+    }
+
+    Instruction* IRBuilder::createRet(Value* value)
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::RET, getTypes().getVoid(), std::vector<Value*> { value }));
+    }
+
+    Instruction* IRBuilder::createRetVoid()
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::RET, getTypes().getVoid()));
+    }
+
+    Instruction* IRBuilder::createUnreachable()
+    {
+        return insert(std::make_unique<Instruction>(EnumOpcode::UNREACHABLE, getTypes().getVoid()));
+    }
+}
@@ -0,0 +1,585 @@
+/**
+ * An instruction in the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/Instruction.h>
+#include <cmm/ir/BasicBlock.h>
+#include <cmm/ir/Function.h>
+#include <cmm/ir/Type.h>
+
+// std includes
+#include <algorithm>
+
+namespace cmm::ir
+{
+    const char* toString(const EnumOpcode opcode) CMM_NOEXCEPT
+    {
+        switch (opcode)
+        {
+        case EnumOpcode::RET:
+            return "ret";
+        case EnumOpcode::BR:
+            // fallthrough
+        case EnumOpcode::COND_BR:
+            return "br";
+        case EnumOpcode::SWITCH:
+            return "switch";
+        case EnumOpcode::UNREACHABLE:
+            return "unreachable";
+        case EnumOpcode::ADD:
+            return "add";
+        case EnumOpcode::SUB:
+            return "sub";
+        case EnumOpcode::MUL:
+            return "mul";
+        case EnumOpcode::SDIV:
+            return "sdiv";
+        case EnumOpcode::UDIV:
+            return "udiv";
+        case EnumOpcode::SREM:
+            return "srem";
+        case EnumOpcode::UREM:
+            return "urem";
+        case EnumOpcode::SHL:
+            return "shl";
+        case EnumOpcode::LSHR:
+            return "lshr";
+        case EnumOpcode::ASHR:
+            return "ashr";
+        case EnumOpcode::AND:
+            return "and";
+        case EnumOpcode::OR:
+            return "or";
+        case EnumOpcode::XOR:
+            return "xor";
+        case EnumOpcode::FADD:
+            return "fadd";
+        case EnumOpcode::FSUB:
+            return "fsub";
+        case EnumOpcode::FMUL:
+            return "fmul";
+        case EnumOpcode::FDIV:
+            return "fdiv";
+        case EnumOpcode::FREM:
+            return "frem";
+        case EnumOpcode::FNEG:
+            return "fneg";
+        case EnumOpcode::ALLOCA:
+            return "alloca";
+        case EnumOpcode::LOAD:
+            return "load";
+        case EnumOpcode::STORE:
+            return "store";
+        case EnumOpcode::GET_ELEMENT_PTR:
+            return "getelementptr";
+        case EnumOpcode::TRUNC:
+            return "trunc";
+        case EnumOpcode::ZEXT:
+            return "zext";
+        case EnumOpcode::SEXT:
+            return "sext";
+        case EnumOpcode::FP_TRUNC:
+            return "fptrunc";
+        case EnumOpcode::FP_EXT:
+            return "fpext";
+        case EnumOpcode::FP_TO_SI:
+            return "fptosi";
+        case EnumOpcode::FP_TO_UI:
+            return "fptoui";
+        case EnumOpcode::SI_TO_FP:
+            return "sitofp";
+        case EnumOpcode::UI_TO_FP:
+            return "uitofp";
+        case EnumOpcode::PTR_TO_INT:
+            return "ptrtoint";
+        case EnumOpcode::INT_TO_PTR:
+            return "inttoptr";
+        case EnumOpcode::BITCAST:
+            return "bitcast";
+        case EnumOpcode::ICMP:
+            return "icmp";
+        case EnumOpcode::FCMP:
+            return "fcmp";
+        case EnumOpcode::PHI:
+            return "phi";
+        case EnumOpcode::SELECT:
+            return "select";
+        case EnumOpcode::CALL:
+            return "call";
+        case EnumOpcode::EXTRACT_ELEMENT:
+            return "extractelement";
+        case EnumOpcode::INSERT_ELEMENT:
+            return "insertelement";
+        default:
+            return "Unknown EnumOpcode";
+        }
+
+        return nullptr;
+    }
+
+    const char* toString(const EnumCmpPredicate predicate) CMM_NOEXCEPT
+    {
+        switch (predicate)
+        {
+        case EnumCmpPredicate::EQ:
+            return "eq";
+        case EnumCmpPredicate::NE:
+            return "ne";
+        case EnumCmpPredicate::SGT:
+            return "sgt";
+        case EnumCmpPredicate::SGE:
+            return "sge";
+        case EnumCmpPredicate::SLT:
+            return "slt";
+        case EnumCmpPredicate::SLE:
+            return "sle";
+        case EnumCmpPredicate::UGT:
+            return "ugt";
+        case EnumCmpPredicate::UGE:
+            return "uge";
+        case EnumCmpPredicate::ULT:
+            return "ult";
+        case EnumCmpPredicate::ULE:
+            return "ule";
+        case EnumCmpPredicate::OEQ:
+            return "oeq";
+        case EnumCmpPredicate::ONE:
+            return "one";
+        case EnumCmpPredicate::OGT:
+            return "ogt";
+        case EnumCmpPredicate::OGE:
+            return "oge";
+        case EnumCmpPredicate::OLT:
+            return "olt";
+        case EnumCmpPredicate::OLE:
+            return "ole";
+        case EnumCmpPredicate::UNE:
+            return "une";
+        default:
+            return "Unknown EnumCmpPredicate";
+        }
+
+        return nullptr;
+    }
+
+    EnumCmpPredicate getSwappedPredicate(const EnumCmpPredicate predicate) CMM_NOEXCEPT
+    {
+        switch (predicate)
+        {
+        case EnumCmpPredicate::SGT:
+            return EnumCmpPredicate::SLT;
+        case EnumCmpPredicate::SGE:
+            return EnumCmpPredicate::SLE;
+        case EnumCmpPredicate::SLT:
+            return EnumCmpPredicate::SGT;
+        case EnumCmpPredicate::SLE:
+            return EnumCmpPredicate::SGE;
+        case EnumCmpPredicate::UGT:
+            return EnumCmpPredicate::ULT;
+        case EnumCmpPredicate::UGE:
+            return EnumCmpPredicate::ULE;
+        case EnumCmpPredicate::ULT:
+            return EnumCmpPredicate::UGT;
+        case EnumCmpPredicate::ULE:
+            return EnumCmpPredicate::UGE;
+        case EnumCmpPredicate::OGT:
+            return EnumCmpPredicate::OLT;
+        case EnumCmpPredicate::OGE:
+            return EnumCmpPredicate::OLE;
+        case EnumCmpPredicate::OLT:
+            return EnumCmpPredicate::OGT;
+        case EnumCmpPredicate::OLE:
+            return EnumCmpPredicate::OGE;
+        default:
+            // EQ, NE, OEQ, ONE and UNE are symmetric.
+            return predicate;
+        }
+    }
+
+    std::optional<EnumCmpPredicate> getInversePredicate(const EnumCmpPredicate predicate) CMM_NOEXCEPT
+    {
+        switch (predicate)
+        {
+        case EnumCmpPredicate::EQ:
+            return EnumCmpPredicate::NE;
+        case EnumCmpPredicate::NE:
+            return EnumCmpPredicate::EQ;
+        case EnumCmpPredicate::SGT:
+            return EnumCmpPredicate::SLE;
+        case EnumCmpPredicate::SGE:
+            return EnumCmpPredicate::SLT;
+        case EnumCmpPredicate::SLT:
+            return EnumCmpPredicate::SGE;
+        case EnumCmpPredicate::SLE:
+            return EnumCmpPredicate::SGT;
+        case EnumCmpPredicate::UGT:
+            return EnumCmpPredicate::ULE;
+        case EnumCmpPredicate::UGE:
+            return EnumCmpPredicate::ULT;
+        case EnumCmpPredicate::ULT:
+            return EnumCmpPredicate::UGE;
+        case EnumCmpPredicate::ULE:
+            return EnumCmpPredicate::UGT;
+        case EnumCmpPredicate::OEQ:
+            return EnumCmpPredicate::UNE;
+        default:
+            return std::nullopt;
+        }
+    }
+
+    Instruction::Instruction(const EnumOpcode opcode, Type* type, const std::vector<Value*>& operands, std::string name) :
+        Value(EnumValueKind::INSTRUCTION, type, std::move(name)), opcode(opcode), parent(nullptr),
+        predicate(EnumCmpPredicate::EQ), flags(EnumInstructionFlag::NO_FLAGS), alignment(0), auxType(nullptr)
+    {
+        this->operands.reserve(operands.size());
+
+        for (auto* operand : operands)
+        {
+            addOperand(operand);
+        }
+    }
+
+    /* virtual */
+    Instruction::~Instruction()
+    {
+        dropAllReferences();
+    }
+
+    EnumOpcode Instruction::getOpcode() const CMM_NOEXCEPT
+    {
+        return opcode;
+    }
+
+    BasicBlock* Instruction::getParent() const CMM_NOEXCEPT
+    {
+        return parent;
+    }
+
+    Function* Instruction::getFunction() const CMM_NOEXCEPT
+    {
+        return parent != nullptr ? parent->getParent() : nullptr;
+    }
+
+    Instruction* Instruction::getNextInstruction() const CMM_NOEXCEPT
+    {
+        if (parent == nullptr)
+        {
+            return nullptr;
+        }
+
+        const auto next = std::next(position);
+        return next != parent->end() ? next->get() : nullptr;
+    }
+
+    std::size_t Instruction::getNumOperands() const CMM_NOEXCEPT
+    {
+        return operands.size();
+    }
+
+    Value* Instruction::getOperand(const std::size_t index) const CMM_NOEXCEPT
+    {
+        return operands[index];
+    }
+
+    const std::vector<Value*>& Instruction::getOperands() const CMM_NOEXCEPT
+    {
+        return operands;
+    }
+
+    void Instruction::setOperand(const std::size_t index, Value* value)
+    {
+        auto*& operand = operands[index];
+
+        if (operand == value)
+        {
+            return;
+        }
+
+        operand->removeUser(this);
+        operand = value;
+        operand->addUser(this);
+    }
+
+    void Instruction::addOperand(Value* value)
+    {
+        operands.push_back(value);
+        value->addUser(this);
+    }
+
+    void Instruction::removeOperand(const std::size_t index)
+    {
+        operands[index]->removeUser(this);
+        operands.erase(operands.begin() + index);
+    }
+
+    void Instruction::replaceUsesOfWith(Value* from, Value* to)
+    {
+        for (std::size_t i = 0; i < operands.size(); ++i)
+        {
+            if (operands[i] == from)
+            {
+                setOperand(i, to);
+            }
+        }
+    }
+
+    void Instruction::dropAllReferences()
+    {
+        for (auto* operand : operands)
+        {
+            operand->removeUser(this);
+        }
+
+        operands.clear();
+    }
+
+    EnumCmpPredicate Instruction::getPredicate() const CMM_NOEXCEPT
+    {
+        return predicate;
+    }
+
+    void Instruction::setPredicate(const EnumCmpPredicate predicate) CMM_NOEXCEPT
+    {
+        this->predicate = predicate;
+    }
+
+    u8 Instruction::getFlags() const CMM_NOEXCEPT
+    {
+        return flags;
+    }
+
+    bool Instruction::hasFlag(const EnumInstructionFlag flag) const CMM_NOEXCEPT
+    {
+        return (flags & flag) != 0;
+    }
+
+    void Instruction::setFlag(const EnumInstructionFlag flag, const bool enable) CMM_NOEXCEPT
+    {
+        if (enable)
+        {
+            flags |= flag;
+        }
+
+        else
+        {
+            flags &= static_cast<u8>(~flag);
+        }
+    }
+
+    Type* Instruction::getAuxType() const CMM_NOEXCEPT
+    {
+        return auxType;
+    }
+
+    void Instruction::setAuxType(Type* type) CMM_NOEXCEPT
+    {
+        auxType = type;
+    }
+
+    u32 Instruction::getAlignment() const CMM_NOEXCEPT
+    {
+        return alignment;
+    }
+
+    void Instruction::setAlignment(const u32 alignment) CMM_NOEXCEPT
+    {
+        this->alignment = alignment;
+    }
+
+    bool Instruction::isTerminator() const CMM_NOEXCEPT
+    {
+        return opcode <= EnumOpcode::UNREACHABLE;
+    }
+
+    bool Instruction::isBinaryOp() const CMM_NOEXCEPT
+    {
+        return opcode >= EnumOpcode::ADD && opcode <= EnumOpcode::FREM;
+    }
+
+    bool Instruction::isCast() const CMM_NOEXCEPT
+    {
+        return opcode >= EnumOpcode::TRUNC && opcode <= EnumOpcode::BITCAST;
+    }
+
+    bool Instruction::isCommutative() const CMM_NOEXCEPT
+    {
+        switch (opcode)
+        {
+        case EnumOpcode::ADD:
+        case EnumOpcode::MUL:
+        case EnumOpcode::AND:
+        case EnumOpcode::OR:
+        case EnumOpcode::XOR:
+        case EnumOpcode::FADD:
+        case EnumOpcode::FMUL:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool Instruction::isCompare() const CMM_NOEXCEPT
+    {
+        return opcode == EnumOpcode::ICMP || opcode == EnumOpcode::FCMP;
+    }
+
+    bool Instruction::mayReadMemory() const CMM_NOEXCEPT
+    {
+        return opcode == EnumOpcode::LOAD || (opcode == EnumOpcode::CALL && !getCalledFunction()->hasAttribute(EnumFunctionAttribute::READ_NONE));
+    }
+
+    bool Instruction::mayWriteMemory() const CMM_NOEXCEPT
+    {
+        return opcode == EnumOpcode::STORE || (opcode == EnumOpcode::CALL && !getCalledFunction()->onlyReadsMemory());
+    }
+
+    bool Instruction::mayHaveSideEffects() const CMM_NOEXCEPT
+    {
+        // A call that may not return (or may unwind) has an effect even if it writes nothing.
+        return isTerminator() || mayWriteMemory() || (opcode == EnumOpcode::CALL && !getCalledFunction()->isSideEffectFree());
+    }
+
+    Function* Instruction::getCalledFunction() const CMM_NOEXCEPT
+    {
+        return opcode == EnumOpcode::CALL ? static_cast<Function*>(operands[0]) : nullptr;
+    }
+
+    std::vector<BasicBlock*> Instruction::getSuccessors() const
+    {
+        std::vector<BasicBlock*> result;
+
+        switch (opcode)
+        {
+        case EnumOpcode::BR:
+            result.push_back(static_cast<BasicBlock*>(operands[0]));
+            break;
+        case EnumOpcode::COND_BR:
+            result.push_back(static_cast<BasicBlock*>(operands[1]));
+            result.push_back(static_cast<BasicBlock*>(operands[2]));
+            break;
+        case EnumOpcode::SWITCH:
+            result.push_back(getDefaultDest());
+
+            for (std::size_t i = 0; i < getNumCases(); ++i)
+            {
+                result.push_back(getCaseDest(i));
+            }
+
+            break;
+        default:
+            break;
+        }
+
+        return result;
+    }
+
+    void Instruction::replaceSuccessor(BasicBlock* from, BasicBlock* to)
+    {
+        if (isTerminator())
+        {
+            replaceUsesOfWith(from, to);
+        }
+    }
+
+    std::size_t Instruction::getNumIncoming() const CMM_NOEXCEPT
+    {
+        return operands.size() / 2;
+    }
+
+    Value* Instruction::getIncomingValue(const std::size_t index) const CMM_NOEXCEPT
+    {
+        return operands[index * 2];
+    }
+
+    BasicBlock* Instruction::getIncomingBlock(const std::size_t index) const CMM_NOEXCEPT
+    {
+        return static_cast<BasicBlock*>(operands[index * 2 + 1]);
+    }
+
+    void Instruction::setIncomingValue(const std::size_t index, Value* value)
+    {
+        setOperand(index * 2, value);
+    }
+
+    void Instruction::addIncoming(Value* value, BasicBlock* block)
+    {
+        addOperand(value);
+        addOperand(block);
+    }
+
+    void Instruction::removeIncoming(const std::size_t index)
+    {
+        removeOperand(index * 2 + 1);
+        removeOperand(index * 2);
+    }
+
+    Value* Instruction::getIncomingValueForBlock(const BasicBlock* block) const CMM_NOEXCEPT
+    {
+        for (std::size_t i = 0; i < getNumIncoming(); ++i)
+        {
+            if (getIncomingBlock(i) == block)
+            {
+                return getIncomingValue(i);
+            }
+        }
+
+        return nullptr;
+    }
+
+    BasicBlock* Instruction::getDefaultDest() const CMM_NOEXCEPT
+    {
+        return static_cast<BasicBlock*>(operands[1]);
+    }
+
+    std::size_t Instruction::getNumCases() const CMM_NOEXCEPT
+    {
+        return (operands.size() - 2) / 2;
+    }
+
+    Value* Instruction::getCaseValue(const std::size_t index) const CMM_NOEXCEPT
+    {
+        return operands[2 + index * 2];
+    }
+
+    BasicBlock* Instruction::getCaseDest(const std::size_t index) const CMM_NOEXCEPT
+    {
+        return static_cast<BasicBlock*>(operands[3 + index * 2]);
+    }
+
+    void Instruction::addCase(Value* value, BasicBlock* block)
+    {
+        addOperand(value);
+        addOperand(block);
+    }
+
+    void Instruction::eraseFromParent()
+    {
+        parent->remove(this);
+    }
+
+    std::unique_ptr<Instruction> Instruction::removeFromParent()
+    {
+        return parent->remove(this);
+    }
+
+    void Instruction::moveBefore(Instruction* position)
+    {
+        auto self = removeFromParent();
+        position->getParent()->insertBefore(position, std::move(self));
+    }
+
+    std::unique_ptr<Instruction> Instruction::clone() const
+    {
+        auto result = std::make_unique<Instruction>(opcode, type, operands, name);
+        result->predicate = predicate;
+        result->flags = flags;
+        result->alignment = alignment;
+        result->auxType = auxType;
+
+        return result;
+    }
+}
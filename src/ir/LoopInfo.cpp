@@ -0,0 +1,365 @@
+/**
+ * Natural loops of a cmm IR function.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/ir/LoopInfo.h>
+#include <cmm/ir/Dominators.h>
+#include <cmm/ir/IRBuilder.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <algorithm>
+
+namespace cmm::ir
+{
+    Loop::Loop(BasicBlock* header) : header(header), parent(nullptr)
+    {
+    }
+
+    BasicBlock* Loop::getHeader() const CMM_NOEXCEPT
+    {
+        return header;
+    }
+
+    Loop* Loop::getParentLoop() const CMM_NOEXCEPT
+    {
+        return parent;
+    }
+
+    const std::vector<Loop*>& Loop::getSubLoops() const CMM_NOEXCEPT
+    {
+        return subLoops;
+    }
+
+    u32 Loop::getDepth() const CMM_NOEXCEPT
+    {
+        u32 depth = 1;
+
+        for (const auto* outer = parent; outer != nullptr; outer = outer->parent)
+        {
+            ++depth;
+        }
+
+        return depth;
+    }
+
+    const std::vector<BasicBlock*>& Loop::getBlocks() const CMM_NOEXCEPT
+    {
+        return blocks;
+    }
+
+    bool Loop::contains(const BasicBlock* block) const
+    {
+        return blockSet.find(block) != blockSet.cend();
+    }
+
+    bool Loop::contains(const Instruction* instruction) const
+    {
+        return contains(instruction->getParent());
+    }
+
+    bool Loop::contains(const Loop* loop) const CMM_NOEXCEPT
+    {
+        for (; loop != nullptr; loop = loop->parent)
+        {
+            if (loop == this)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool Loop::isLoopInvariant(const Value* value) const
+    {
+        return value->getKind() != EnumValueKind::INSTRUCTION || !contains(static_cast<const Instruction*>(value));
+    }
+
+    std::vector<BasicBlock*> Loop::getLatches() const
+    {
+        std::vector<BasicBlock*> result;
+
+        for (auto* pred : header->getPredecessors())
+        {
+            if (contains(pred))
+            {
+                result.push_back(pred);
+            }
+        }
+
+        return result;
+    }
+
+    BasicBlock* Loop::getLatch() const
+    {
+        const auto latches = getLatches();
+        return latches.size() == 1 ? latches.front() : nullptr;
+    }
+
+    BasicBlock* Loop::getPreheader() const
+    {
+        BasicBlock* result = nullptr;
+
+        for (auto* pred : header->getPredecessors())
+        {
+            if (contains(pred))
+            {
+                continue;
+            }
+
+            else if (result != nullptr)
+            {
+                return nullptr;
+            }
+
+            result = pred;
+        }
+
+        return result != nullptr && result->getSuccessors().size() == 1 ? result : nullptr;
+    }
+
+    std::vector<BasicBlock*> Loop::getExitBlocks() const
+    {
+        std::vector<BasicBlock*> result;
+
+        for (const auto* block : blocks)
+        {
+            for (auto* succ : block->getSuccessors())
+            {
+                if (!contains(succ) && std::find(result.cbegin(), result.cend(), succ) == result.cend())
+                {
+                    result.push_back(succ);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    LoopInfo::LoopInfo(const DominatorTree& dominators)
+    {
+        recalculate(dominators);
+    }
+
+    void LoopInfo::recalculate(const DominatorTree& dominators)
+    {
+        loops.clear();
+        topLevelLoops.clear();
+        loopOfBlock.clear();
+
+        const auto& order = dominators.getReversePostOrder();
+        std::unordered_map<const BasicBlock*, std::size_t> orderIndices;
+
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            orderIndices.emplace(order[i], i);
+        }
+
+        // Headers are visited in reverse post order, so a loop is always found before the
+        // loops nested in it.
+        for (auto* header : order)
+        {
+            std::vector<BasicBlock*> worklist;
+
+            for (auto* pred : header->getPredecessors())
+            {
+                if (dominators.isReachable(pred) && dominators.dominates(header, pred))
+                {
+                    worklist.push_back(pred);
+                }
+            }
+
+            if (worklist.empty())
+            {
+                continue;
+            }
+
+            auto loop = std::make_unique<Loop>(header);
+            loop->blockSet.insert(header);
+            loop->blocks.push_back(header);
+
+            while (!worklist.empty())
+            {
+                auto* block = worklist.back();
+                worklist.pop_back();
+
+                if (loop->blockSet.insert(block).second)
+                {
+                    loop->blocks.push_back(block);
+
+                    for (auto* pred : block->getPredecessors())
+                    {
+                        if (dominators.isReachable(pred))
+                        {
+                            worklist.push_back(pred);
+                        }
+                    }
+                }
+            }
+
+            // Sorting just the loop's blocks keeps a long chain of loops linear, rather than
+            // walking the whole function once per loop.
+            std::sort(loop->blocks.begin(), loop->blocks.end(), [&orderIndices](const BasicBlock* a, const BasicBlock* b)
+                {
+                    return orderIndices[a] < orderIndices[b];
+                });
+
+            // The innermost enclosing loop is the most recently found one holding the header,
+            // which is the one the header was last mapped to.
+            auto* outer = getLoopFor(header);
+
+            if (outer != nullptr)
+            {
+                loop->parent = outer;
+                outer->subLoops.push_back(loop.get());
+            }
+
+            else
+            {
+                topLevelLoops.push_back(loop.get());
+            }
+
+            for (const auto* block : loop->blocks)
+            {
+                loopOfBlock[block] = loop.get();
+            }
+
+            loops.push_back(std::move(loop));
+        }
+    }
+
+    bool LoopInfo::empty() const CMM_NOEXCEPT
+    {
+        return loops.empty();
+    }
+
+    std::size_t LoopInfo::size() const CMM_NOEXCEPT
+    {
+        return loops.size();
+    }
+
+    Loop* LoopInfo::getLoopFor(const BasicBlock* block) const
+    {
+        const auto findResult = loopOfBlock.find(block);
+        return findResult != loopOfBlock.cend() ? findResult->second : nullptr;
+    }
+
+    const std::vector<Loop*>& LoopInfo::getTopLevelLoops() const CMM_NOEXCEPT
+    {
+        return topLevelLoops;
+    }
+
+    std::vector<Loop*> LoopInfo::getLoopsInnermostFirst() const
+    {
+        std::vector<Loop*> result;
+        result.reserve(loops.size());
+
+        for (auto iter = loops.rbegin(); iter != loops.rend(); ++iter)
+        {
+            result.push_back(iter->get());
+        }
+
+        return result;
+    }
+
+    BasicBlock* LoopInfo::insertPreheader(Loop* loop)
+    {
+        if (auto* existing = loop->getPreheader(); existing != nullptr)
+        {
+            return existing;
+        }
+
+        auto* header = loop->getHeader();
+        std::vector<BasicBlock*> outside;
+
+        for (auto* pred : header->getPredecessors())
+        {
+            if (!loop->contains(pred))
+            {
+                outside.push_back(pred);
+            }
+        }
+
+        if (outside.empty())
+        {
+            return nullptr;
+        }
+
+        // Lay the new block out right before the header.
+        auto* function = header->getParent();
+        auto& module = *function->getParent();
+        BasicBlock* previous = nullptr;
+
+        for (auto& block : *function)
+        {
+            if (block.get() == header)
+            {
+                break;
+            }
+
+            previous = block.get();
+        }
+
+        const std::string name = header->hasName() ? header->getName() + ".preheader" : "preheader";
+        auto* preheader = function->insertBlockAfter(previous, std::make_unique<BasicBlock>(module.getTypes().getLabel(), name));
+
+        for (auto* pred : outside)
+        {
+            pred->getTerminator()->replaceSuccessor(header, preheader);
+        }
+
+        IRBuilder builder(module);
+        builder.setInsertPoint(preheader);
+
+        // The header's phis now get a single entry for the preheader, merging the outside
+        // values there first when there were several.
+        for (auto& instruction : *header)
+        {
+            auto* phi = instruction.get();
+
+            if (phi->getOpcode() != EnumOpcode::PHI)
+            {
+                break;
+            }
+
+            else if (outside.size() == 1)
+            {
+                phi->replaceUsesOfWith(outside.front(), preheader);
+                continue;
+            }
+
+            auto* merged = builder.createPhi(phi->getType(), phi->getName());
+
+            for (std::size_t i = phi->getNumIncoming(); i-- > 0;)
+            {
+                if (!loop->contains(phi->getIncomingBlock(i)))
+                {
+                    merged->addIncoming(phi->getIncomingValue(i), phi->getIncomingBlock(i));
+                    phi->removeIncoming(i);
+                }
+            }
+
+            phi->addIncoming(merged, preheader);
+        }
+
+        builder.createBr(header);
+
+        for (auto* outer = loop->getParentLoop(); outer != nullptr; outer = outer->getParentLoop())
+        {
+            outer->blocks.insert(std::find(outer->blocks.cbegin(), outer->blocks.cend(), header), preheader);
+            outer->blockSet.insert(preheader);
+        }
+
+        if (loop->getParentLoop() != nullptr)
+        {
+            loopOfBlock[preheader] = loop->getParentLoop();
+        }
+
+        return preheader;
+    }
+}
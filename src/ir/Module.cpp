@@ -0,0 +1,229 @@
+/**
+ * A module (i.e. the IR of one translation unit) in the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <cstring>
+
+namespace cmm::ir
+{
+    Module::Module(const std::string& name) : name(name)
+    {
+    }
+
+    Module::~Module()
+    {
+        // Calls reference other functions, so drop every reference before destroying any function.
+        for (auto& function : functions)
+        {
+            for (auto& block : *function)
+            {
+                for (auto& instruction : *block)
+                {
+                    instruction->dropAllReferences();
+                }
+            }
+        }
+
+        functions.clear();
+    }
+
+    const std::string& Module::getName() const CMM_NOEXCEPT
+    {
+        return name;
+    }
+
+    TypeContext& Module::getTypes() CMM_NOEXCEPT
+    {
+        return types;
+    }
+
+    const TypeContext& Module::getTypes() const CMM_NOEXCEPT
+    {
+        return types;
+    }
+
+    Module::FunctionList& Module::getFunctions() CMM_NOEXCEPT
+    {
+        return functions;
+    }
+
+    const Module::FunctionList& Module::getFunctions() const CMM_NOEXCEPT
+    {
+        return functions;
+    }
+
+    const Module::GlobalList& Module::getGlobals() const CMM_NOEXCEPT
+    {
+        return globals;
+    }
+
+    Function* Module::getOrInsertFunction(const std::string& name, Type* functionType)
+    {
+        auto& function = functionMap[name];
+
+        if (function == nullptr)
+        {
+            functions.emplace_back(std::make_unique<Function>(functionType, name, this));
+            function = functions.back().get();
+        }
+
+        return function;
+    }
+
+    Function* Module::getFunction(const std::string& name) const
+    {
+        const auto findResult = functionMap.find(name);
+        return findResult != functionMap.cend() ? findResult->second : nullptr;
+    }
+
+    void Module::eraseFunction(Function* function)
+    {
+        functionMap.erase(function->getName());
+
+        for (auto iter = functions.begin(); iter != functions.end(); ++iter)
+        {
+            if (iter->get() == function)
+            {
+                functions.erase(iter);
+                break;
+            }
+        }
+    }
+
+    GlobalVariable* Module::createGlobal(Type* valueType, const std::string& name, const EnumLinkage linkage, const bool constant)
+    {
+        globals.emplace_back(std::make_unique<GlobalVariable>(valueType, name, linkage, constant));
+
+        auto* global = globals.back().get();
+        globalMap[name] = global;
+
+        return global;
+    }
+
+    GlobalVariable* Module::getGlobal(const std::string& name) const
+    {
+        const auto findResult = globalMap.find(name);
+        return findResult != globalMap.cend() ? findResult->second : nullptr;
+    }
+
+    GlobalVariable* Module::getOrCreateCString(const std::string& str)
+    {
+        auto& global = cstringMap[str];
+
+        if (global == nullptr)
+        {
+            // +1 for the null terminator.
+            auto* arrayType = types.getArray(types.getInt(8), str.size() + 1);
+            const std::string globalName = ".str." + std::to_string(cstringMap.size() - 1);
+
+            global = createGlobal(arrayType, globalName, EnumLinkage::PRIVATE, true);
+            global->setStringInitializer(str);
+        }
+
+        return global;
+    }
+
+    ConstantInt* Module::getConstantInt(Type* type, const s64 value)
+    {
+        const s64 normalized = ConstantInt::normalize(value, type->getBits());
+        auto& constant = intConstants[std::make_pair(type, normalized)];
+
+        if (constant == nullptr)
+        {
+            constant = std::make_unique<ConstantInt>(type, normalized);
+        }
+
+        return constant.get();
+    }
+
+    ConstantInt* Module::getTrue()
+    {
+        return getConstantInt(types.getBool(), 1);
+    }
+
+    ConstantInt* Module::getFalse()
+    {
+        return getConstantInt(types.getBool(), 0);
+    }
+
+    ConstantFP* Module::getConstantFP(Type* type, const f64 value)
+    {
+        const f64 rounded = type->getKind() == EnumTypeKind::FLOAT ? static_cast<f64>(static_cast<f32>(value)) : value;
+
+        // Note: Key on the bit pattern so 0.0 and -0.0 (and NaNs) stay distinct.
+        u64 bits;
+        std::memcpy(&bits, &rounded, sizeof(bits));
+
+        auto& constant = fpConstants[std::make_pair(type, bits)];
+
+        if (constant == nullptr)
+        {
+            constant = std::make_unique<ConstantFP>(type, rounded);
+        }
+
+        return constant.get();
+    }
+
+    ConstantNull* Module::getNull(Type* type)
+    {
+        auto& constant = nullConstants[type];
+
+        if (constant == nullptr)
+        {
+            constant = std::make_unique<ConstantNull>(type);
+        }
+
+        return constant.get();
+    }
+
+    ConstantUndef* Module::getUndef(Type* type)
+    {
+        auto& constant = undefConstants[type];
+
+        if (constant == nullptr)
+        {
+            constant = std::make_unique<ConstantUndef>(type);
+        }
+
+        return constant.get();
+    }
+
+    Value* Module::getZero(Type* type)
+    {
+        if (type->isInt())
+        {
+            return getConstantInt(type, 0);
+        }
+
+        else if (type->isFloatingPoint())
+        {
+            return getConstantFP(type, 0.0);
+        }
+
+        else if (type->isPointer())
+        {
+            return getNull(type);
+        }
+
+        return getUndef(type);
+    }
+
+    std::size_t Module::getInstructionCount() const CMM_NOEXCEPT
+    {
+        std::size_t result = 0;
+
+        for (const auto& function : functions)
+        {
+            result += function->getInstructionCount();
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,506 @@
+/**
+ * Pretty-printer for the cmm IR.  The textual form intentionally follows LLVM's
+ * assembly syntax (typed pointers), so a printed module can be fed to llvm-as.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/Printer.h>
+#include <cmm/ir/Module.h>
+#include <cmm/ir/SlotTracker.h>
+
+// std includes
+#include <cstdio>
+#include <ostream>
+#include <sstream>
+
+namespace cmm::ir
+{
+    Printer::Printer(std::ostream& os, const bool annotate) CMM_NOEXCEPT : os(os), annotate(annotate)
+    {
+    }
+
+    void Printer::print(const Module& module)
+    {
+        const auto& structs = module.getTypes().getStructs();
+
+        for (const auto* type : structs)
+        {
+            printStructType(*type);
+            os << '\n';
+        }
+
+        if (!structs.empty())
+        {
+            os << '\n';
+        }
+
+        for (const auto& global : module.getGlobals())
+        {
+            printGlobal(*global);
+            os << '\n';
+        }
+
+        if (!module.getGlobals().empty())
+        {
+            os << '\n';
+        }
+
+        for (const auto& function : module.getFunctions())
+        {
+            print(*function);
+            os << '\n';
+        }
+    }
+
+    void Printer::print(const Function& function)
+    {
+        SlotTracker slots;
+        slots.incorporate(function);
+
+        printFunctionHeader(function, slots);
+
+        if (function.isDeclaration())
+        {
+            os << '\n';
+            return;
+        }
+
+        os << "\n{\n";
+        bool first = true;
+
+        for (const auto& block : function)
+        {
+            if (!first)
+            {
+                os << '\n';
+            }
+
+            first = false;
+            printBlockLabel(*block, slots);
+
+            for (const auto& instruction : *block)
+            {
+                os << "  ";
+                printInstruction(*instruction, slots);
+                os << '\n';
+            }
+        }
+
+        os << "}\n";
+    }
+
+    void Printer::printStructType(const Type& type)
+    {
+        os << type.toString() << " = type ";
+
+        if (type.isOpaque())
+        {
+            os << "opaque";
+            return;
+        }
+
+        os << "{ ";
+        const auto& fields = type.getFields();
+
+        for (std::size_t i = 0; i < fields.size(); ++i)
+        {
+            if (i > 0)
+            {
+                os << ", ";
+            }
+
+            os << fields[i]->toString();
+        }
+
+        os << " }";
+    }
+
+    void Printer::printGlobal(const GlobalVariable& global)
+    {
+        auto* valueType = global.getValueType();
+        os << '@' << global.getName() << " = ";
+
+        switch (global.getLinkage())
+        {
+        case EnumLinkage::INTERNAL:
+            os << "internal ";
+            break;
+        case EnumLinkage::PRIVATE:
+            os << "private unnamed_addr ";
+            break;
+        default:
+            break;
+        }
+
+        os << (global.isConstantGlobal() ? "constant " : "global ") << valueType->toString() << ' ';
+
+        const auto& stringInitializer = global.getStringInitializer();
+
+        if (stringInitializer.has_value())
+        {
+            os << "c\"" << escapeCString(*stringInitializer) << "\\00\", align 1";
+        }
+
+        else if (valueType->isInt())
+        {
+            os << '0';
+        }
+
+        else if (valueType->isFloatingPoint())
+        {
+            os << SlotTracker::formatFloatingPoint(0.0);
+        }
+
+        else if (valueType->isPointer())
+        {
+            os << "null";
+        }
+
+        else
+        {
+            os << "zeroinitializer";
+        }
+
+        if (global.getAlignment() != 0 && !stringInitializer.has_value())
+        {
+            os << ", align " << global.getAlignment();
+        }
+    }
+
+    void Printer::printFunctionHeader(const Function& function, SlotTracker& slots)
+    {
+        const bool isDeclaration = function.isDeclaration();
+        os << (isDeclaration ? "declare " : "define ");
+
+        if (!isDeclaration && function.getLinkage() == EnumLinkage::INTERNAL)
+        {
+            os << "internal ";
+        }
+
+        os << function.getReturnType()->toString() << " @" << function.getName() << '(';
+
+        for (std::size_t i = 0; i < function.argSize(); ++i)
+        {
+            if (i > 0)
+            {
+                os << ", ";
+            }
+
+            const auto* arg = function.getArg(i);
+            os << arg->getType()->toString();
+
+            if (arg->hasAttribute(EnumArgumentAttribute::NO_ALIAS))
+            {
+                os << " noalias";
+            }
+
+            if (arg->hasAttribute(EnumArgumentAttribute::NO_CAPTURE))
+            {
+                os << " nocapture";
+            }
+
+            if (!isDeclaration)
+            {
+                os << ' ' << slots.formatOperand(arg);
+            }
+        }
+
+        os << ')';
+
+        if (function.hasAttribute(EnumFunctionAttribute::READ_NONE))
+        {
+            os << " readnone";
+        }
+
+        else if (function.hasAttribute(EnumFunctionAttribute::READ_ONLY))
+        {
+            os << " readonly";
+        }
+
+        if (function.hasAttribute(EnumFunctionAttribute::NO_UNWIND))
+        {
+            os << " nounwind";
+        }
+
+        if (function.hasAttribute(EnumFunctionAttribute::WILL_RETURN))
+        {
+            os << " willreturn";
+        }
+    }
+
+    void Printer::printBlockLabel(const BasicBlock& block, SlotTracker& slots)
+    {
+        os << slots.getName(&block) << ':';
+
+        if (annotate)
+        {
+            const auto preds = block.getPredecessors();
+
+            if (!preds.empty())
+            {
+                os << "    ; preds = ";
+
+                for (std::size_t i = 0; i < preds.size(); ++i)
+                {
+                    if (i > 0)
+                    {
+                        os << ", ";
+                    }
+
+                    os << slots.formatOperand(preds[i]);
+                }
+            }
+        }
+
+        os << '\n';
+    }
+
+    void Printer::printInstruction(const Instruction& instruction, SlotTracker& slots)
+    {
+        const EnumOpcode opcode = instruction.getOpcode();
+
+        if (!instruction.getType()->isVoid())
+        {
+            os << slots.formatOperand(&instruction) << " = ";
+        }
+
+        switch (opcode)
+        {
+        case EnumOpcode::RET:
+            os << "ret ";
+
+            if (instruction.getNumOperands() == 0)
+            {
+                os << "void";
+            }
+
+            else
+            {
+                printTypedOperand(0, instruction, slots);
+            }
+
+            break;
+        case EnumOpcode::BR:
+            os << "br label " << slots.formatOperand(instruction.getOperand(0));
+            break;
+        case EnumOpcode::COND_BR:
+            os << "br ";
+            printTypedOperand(0, instruction, slots);
+            os << ", label " << slots.formatOperand(instruction.getOperand(1))
+               << ", label " << slots.formatOperand(instruction.getOperand(2));
+            break;
+        case EnumOpcode::SWITCH:
+            os << "switch ";
+            printTypedOperand(0, instruction, slots);
+            os << ", label " << slots.formatOperand(instruction.getDefaultDest()) << " [";
+
+            for (std::size_t i = 0; i < instruction.getNumCases(); ++i)
+            {
+                const auto* caseValue = instruction.getCaseValue(i);
+                os << "\n    " << caseValue->getType()->toString() << ' ' << slots.formatOperand(caseValue)
+                   << ", label " << slots.formatOperand(instruction.getCaseDest(i));
+            }
+
+            os << "\n  ]";
+            break;
+        case EnumOpcode::UNREACHABLE:
+            os << "unreachable";
+            break;
+        case EnumOpcode::FNEG:
+            os << "fneg ";
+            printTypedOperand(0, instruction, slots);
+            break;
+        case EnumOpcode::ALLOCA:
+            os << "alloca " << instruction.getAuxType()->toString();
+            break;
+        case EnumOpcode::LOAD:
+            os << "load " << instruction.getType()->toString() << ", ";
+            printTypedOperand(0, instruction, slots);
+            break;
+        case EnumOpcode::STORE:
+            os << "store ";
+            printTypedOperand(0, instruction, slots);
+            os << ", ";
+            printTypedOperand(1, instruction, slots);
+            break;
+        case EnumOpcode::GET_ELEMENT_PTR:
+            os << "getelementptr " << (instruction.hasFlag(EnumInstructionFlag::INBOUNDS) ? "inbounds " : "")
+               << instruction.getAuxType()->toString();
+
+            for (std::size_t i = 0; i < instruction.getNumOperands(); ++i)
+            {
+                os << ", ";
+                printTypedOperand(i, instruction, slots);
+            }
+
+            break;
+        case EnumOpcode::ICMP:
+            // fallthrough
+        case EnumOpcode::FCMP:
+            os << toString(opcode) << ' ' << toString(instruction.getPredicate()) << ' ';
+            printTypedOperand(0, instruction, slots);
+            os << ", " << slots.formatOperand(instruction.getOperand(1));
+            break;
+        case EnumOpcode::PHI:
+            os << "phi " << instruction.getType()->toString() << ' ';
+
+            for (std::size_t i = 0; i < instruction.getNumIncoming(); ++i)
+            {
+                if (i > 0)
+                {
+                    os << ", ";
+                }
+
+                os << "[ " << slots.formatOperand(instruction.getIncomingValue(i)) << ", "
+                   << slots.formatOperand(instruction.getIncomingBlock(i)) << " ]";
+            }
+
+            break;
+        case EnumOpcode::SELECT:
+            os << "select ";
+            printTypedOperand(0, instruction, slots);
+            os << ", ";
+            printTypedOperand(1, instruction, slots);
+            os << ", ";
+            printTypedOperand(2, instruction, slots);
+            break;
+        case EnumOpcode::CALL:
+        {
+            if (instruction.hasFlag(EnumInstructionFlag::MUST_TAIL))
+            {
+                os << "musttail ";
+            }
+
+            else if (instruction.hasFlag(EnumInstructionFlag::TAIL))
+            {
+                os << "tail ";
+            }
+
+            const auto* function = instruction.getCalledFunction();
+            os << "call " << function->getReturnType()->toString() << ' ' << slots.formatOperand(function) << '(';
+
+            for (std::size_t i = 1; i < instruction.getNumOperands(); ++i)
+            {
+                if (i > 1)
+                {
+                    os << ", ";
+                }
+
+                printTypedOperand(i, instruction, slots);
+            }
+
+            os << ')';
+        }
+            break;
+        case EnumOpcode::EXTRACT_ELEMENT:
+            os << "extractelement ";
+            printTypedOperand(0, instruction, slots);
+            os << ", ";
+            printTypedOperand(1, instruction, slots);
+            break;
+        case EnumOpcode::INSERT_ELEMENT:
+            os << "insertelement ";
+            printTypedOperand(0, instruction, slots);
+            os << ", ";
+            printTypedOperand(1, instruction, slots);
+            os << ", ";
+            printTypedOperand(2, instruction, slots);
+            break;
+        default:
+            if (instruction.isCast())
+            {
+                os << toString(opcode) << ' ';
+                printTypedOperand(0, instruction, slots);
+                os << " to " << instruction.getType()->toString();
+            }
+
+            else if (instruction.isBinaryOp())
+            {
+                os << toString(opcode) << ' ';
+
+                if (instruction.hasFlag(EnumInstructionFlag::NUW))
+                {
+                    os << "nuw ";
+                }
+
+                if (instruction.hasFlag(EnumInstructionFlag::NSW))
+                {
+                    os << "nsw ";
+                }
+
+                if (instruction.hasFlag(EnumInstructionFlag::EXACT))
+                {
+                    os << "exact ";
+                }
+
+                printTypedOperand(0, instruction, slots);
+                os << ", " << slots.formatOperand(instruction.getOperand(1));
+            }
+
+            else
+            {
+                os << "; unknown opcode " << static_cast<u32>(opcode);
+            }
+
+            break;
+        }
+
+        if (instruction.getAlignment() != 0)
+        {
+            os << ", align " << instruction.getAlignment();
+        }
+    }
+
+    /* static */
+    std::string Printer::escapeCString(const std::string& str)
+    {
+        std::string result;
+        result.reserve(str.size());
+
+        for (const char ch : str)
+        {
+            const auto asUnsigned = static_cast<unsigned char>(ch);
+
+            if (asUnsigned < 0x20 || asUnsigned >= 0x7F || ch == '"' || ch == '\\')
+            {
+                char buffer[4];
+                std::snprintf(buffer, sizeof(buffer), "\\%02X", asUnsigned);
+                result += buffer;
+            }
+
+            else
+            {
+                result += ch;
+            }
+        }
+
+        return result;
+    }
+
+    void Printer::printTypedOperand(const std::size_t index, const Instruction& instruction, SlotTracker& slots)
+    {
+        const auto* operand = instruction.getOperand(index);
+        os << operand->getType()->toString() << ' ' << slots.formatOperand(operand);
+    }
+
+    std::string toString(const Module& module)
+    {
+        std::ostringstream os;
+        Printer printer(os);
+        printer.print(module);
+
+        return os.str();
+    }
+
+    std::string toString(const Function& function)
+    {
+        std::ostringstream os;
+        Printer printer(os);
+        printer.print(function);
+
+        return os.str();
+    }
+}
@@ -0,0 +1,158 @@
+/**
+ * Assigns unique printable names to the values of a function.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/SlotTracker.h>
+#include <cmm/ir/Constant.h>
+#include <cmm/ir/Function.h>
+#include <cmm/ir/Type.h>
+
+// std includes
+#include <cstdio>
+#include <cstring>
+
+namespace cmm::ir
+{
+    void SlotTracker::incorporate(const Function& function)
+    {
+        names.clear();
+        taken.clear();
+        tempCounter = 0;
+        labelCounter = 0;
+        paramCounter = 0;
+
+        // Named values first so generated names never steal a user's name.
+        for (std::size_t i = 0; i < function.argSize(); ++i)
+        {
+            const auto* arg = function.getArg(i);
+
+            if (arg->hasName())
+            {
+                assign(arg, arg->getName());
+            }
+        }
+
+        for (const auto& block : function)
+        {
+            if (block->hasName())
+            {
+                assign(block.get(), block->getName());
+            }
+
+            for (const auto& instruction : *block)
+            {
+                if (instruction->hasName() && !instruction->getType()->isVoid())
+                {
+                    assign(instruction.get(), instruction->getName());
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < function.argSize(); ++i)
+        {
+            const auto* arg = function.getArg(i);
+
+            if (!arg->hasName())
+            {
+                assign(arg, "p_" + std::to_string(paramCounter++));
+            }
+        }
+
+        for (const auto& block : function)
+        {
+            if (!block->hasName())
+            {
+                assign(block.get(), "l_" + std::to_string(labelCounter++));
+            }
+
+            for (const auto& instruction : *block)
+            {
+                if (!instruction->hasName() && !instruction->getType()->isVoid())
+                {
+                    assign(instruction.get(), "t_" + std::to_string(tempCounter++));
+                }
+            }
+        }
+    }
+
+    const std::string& SlotTracker::getName(const Value* value)
+    {
+        auto& name = names[value];
+
+        // Values created after numbering (or from another function) still get a stable name.
+        if (name.empty())
+        {
+            std::string base = value->hasName() ? value->getName() : "t_" + std::to_string(tempCounter++);
+            std::string candidate = base;
+
+            for (std::size_t suffix = 1; taken.find(candidate) != taken.cend(); ++suffix)
+            {
+                candidate = base + '.' + std::to_string(suffix);
+            }
+
+            taken.insert(candidate);
+            name = std::move(candidate);
+        }
+
+        return name;
+    }
+
+    std::string SlotTracker::formatOperand(const Value* value)
+    {
+        switch (value->getKind())
+        {
+        case EnumValueKind::CONSTANT_INT:
+        {
+            const auto* constant = static_cast<const ConstantInt*>(value);
+
+            if (constant->getType()->isInt(1))
+            {
+                return constant->isZero() ? "false" : "true";
+            }
+
+            return std::to_string(constant->getValue());
+        }
+        case EnumValueKind::CONSTANT_FP:
+            return formatFloatingPoint(static_cast<const ConstantFP*>(value)->getValue());
+        case EnumValueKind::CONSTANT_NULL:
+            return "null";
+        case EnumValueKind::CONSTANT_UNDEF:
+            return "undef";
+        case EnumValueKind::FUNCTION:
+            // fallthrough
+        case EnumValueKind::GLOBAL_VARIABLE:
+            return '@' + value->getName();
+        default:
+            return '%' + getName(value);
+        }
+    }
+
+    /* static */
+    std::string SlotTracker::formatFloatingPoint(const f64 value)
+    {
+        u64 bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "0x%016llX", static_cast<unsigned long long>(bits));
+
+        return buffer;
+    }
+
+    void SlotTracker::assign(const Value* value, const std::string& base)
+    {
+        std::string candidate = base;
+
+        for (std::size_t suffix = 1; taken.find(candidate) != taken.cend(); ++suffix)
+        {
+            candidate = base + '.' + std::to_string(suffix);
+        }
+
+        taken.insert(candidate);
+        names[value] = std::move(candidate);
+    }
+}
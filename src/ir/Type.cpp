@@ -0,0 +1,371 @@
+/**
+ * Types used by the cmm mid-level IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/Type.h>
+
+// std includes
+#include <algorithm>
+
+namespace cmm::ir
+{
+    Type::Type(const EnumTypeKind kind) CMM_NOEXCEPT : kind(kind), bits(0), count(0), elementType(nullptr),
+        pointerTo(nullptr), context(nullptr), hasBody(false)
+    {
+    }
+
+    EnumTypeKind Type::getKind() const CMM_NOEXCEPT
+    {
+        return kind;
+    }
+
+    bool Type::isVoid() const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::VOID;
+    }
+
+    bool Type::isLabel() const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::LABEL;
+    }
+
+    bool Type::isInt() const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::INT;
+    }
+
+    bool Type::isInt(const u32 bits) const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::INT && this->bits == bits;
+    }
+
+    bool Type::isFloatingPoint() const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::FLOAT || kind == EnumTypeKind::DOUBLE;
+    }
+
+    bool Type::isPointer() const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::POINTER;
+    }
+
+    bool Type::isStruct() const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::STRUCT;
+    }
+
+    bool Type::isArray() const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::ARRAY;
+    }
+
+    bool Type::isVector() const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::VECTOR;
+    }
+
+    bool Type::isFunction() const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::FUNCTION;
+    }
+
+    bool Type::isSingleValue() const CMM_NOEXCEPT
+    {
+        return isInt() || isFloatingPoint() || isPointer() || isVector();
+    }
+
+    u32 Type::getBits() const CMM_NOEXCEPT
+    {
+        return bits;
+    }
+
+    Type* Type::getElementType() const CMM_NOEXCEPT
+    {
+        return elementType;
+    }
+
+    Type* Type::getScalarType() CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::VECTOR ? elementType : this;
+    }
+
+    u64 Type::getCount() const CMM_NOEXCEPT
+    {
+        return count;
+    }
+
+    const std::string& Type::getName() const CMM_NOEXCEPT
+    {
+        return name;
+    }
+
+    const std::vector<Type*>& Type::getFields() const CMM_NOEXCEPT
+    {
+        return fields;
+    }
+
+    void Type::setFields(std::vector<Type*>&& fields)
+    {
+        this->fields = std::move(fields);
+        hasBody = true;
+    }
+
+    bool Type::isOpaque() const CMM_NOEXCEPT
+    {
+        return kind == EnumTypeKind::STRUCT && !hasBody;
+    }
+
+    Type* Type::getPointerTo()
+    {
+        if (pointerTo == nullptr)
+        {
+            pointerTo = context->getPointer(this);
+        }
+
+        return pointerTo;
+    }
+
+    u64 Type::getSizeInBytes() const CMM_NOEXCEPT
+    {
+        switch (kind)
+        {
+        case EnumTypeKind::INT:
+            return bits <= 8 ? 1 : (bits + 7) / 8;
+        case EnumTypeKind::FLOAT:
+            return 4;
+        case EnumTypeKind::DOUBLE:
+            // fallthrough
+        case EnumTypeKind::POINTER:
+            return 8;
+        case EnumTypeKind::ARRAY:
+            // fallthrough
+        case EnumTypeKind::VECTOR:
+            return elementType->getSizeInBytes() * count;
+        case EnumTypeKind::STRUCT:
+        {
+            u64 size = 0;
+
+            for (const auto* field : fields)
+            {
+                const u64 align = field->getAlignment();
+                size = (size + align - 1) / align * align;
+                size += field->getSizeInBytes();
+            }
+
+            const u64 align = getAlignment();
+            return (size + align - 1) / align * align;
+        }
+        default:
+            return 0;
+        }
+    }
+
+    u64 Type::getAlignment() const CMM_NOEXCEPT
+    {
+        switch (kind)
+        {
+        case EnumTypeKind::ARRAY:
+            return elementType->getAlignment();
+        case EnumTypeKind::VECTOR:
+            return getSizeInBytes();
+        case EnumTypeKind::STRUCT:
+        {
+            u64 align = 1;
+
+            for (const auto* field : fields)
+            {
+                align = std::max(align, field->getAlignment());
+            }
+
+            return align;
+        }
+        default:
+        {
+            const u64 size = getSizeInBytes();
+            return size == 0 ? 1 : size;
+        }
+        }
+    }
+
+    std::string Type::toString() const
+    {
+        switch (kind)
+        {
+        case EnumTypeKind::VOID:
+            return "void";
+        case EnumTypeKind::LABEL:
+            return "label";
+        case EnumTypeKind::INT:
+            return "i" + std::to_string(bits);
+        case EnumTypeKind::FLOAT:
+            return "float";
+        case EnumTypeKind::DOUBLE:
+            return "double";
+        case EnumTypeKind::POINTER:
+            return elementType->toString() + '*';
+        case EnumTypeKind::STRUCT:
+            return "%struct." + name;
+        case EnumTypeKind::ARRAY:
+            return '[' + std::to_string(count) + " x " + elementType->toString() + ']';
+        case EnumTypeKind::VECTOR:
+            return '<' + std::to_string(count) + " x " + elementType->toString() + '>';
+        case EnumTypeKind::FUNCTION:
+        {
+            std::string result = elementType->toString();
+            result += " (";
+
+            for (std::size_t i = 0; i < fields.size(); ++i)
+            {
+                if (i > 0)
+                {
+                    result += ", ";
+                }
+
+                result += fields[i]->toString();
+            }
+
+            result += ')';
+            return result;
+        }
+        default:
+            return "Unknown type";
+        }
+    }
+
+    TypeContext::TypeContext() : voidType(create(EnumTypeKind::VOID)), labelType(create(EnumTypeKind::LABEL)),
+        floatType(create(EnumTypeKind::FLOAT)), doubleType(create(EnumTypeKind::DOUBLE))
+    {
+    }
+
+    Type* TypeContext::getVoid() CMM_NOEXCEPT
+    {
+        return voidType;
+    }
+
+    Type* TypeContext::getLabel() CMM_NOEXCEPT
+    {
+        return labelType;
+    }
+
+    Type* TypeContext::getBool() CMM_NOEXCEPT
+    {
+        return getInt(1);
+    }
+
+    Type* TypeContext::getInt(const u32 bits)
+    {
+        auto& type = intTypes[bits];
+
+        if (type == nullptr)
+        {
+            type = create(EnumTypeKind::INT);
+            type->bits = bits;
+        }
+
+        return type;
+    }
+
+    Type* TypeContext::getFloat() CMM_NOEXCEPT
+    {
+        return floatType;
+    }
+
+    Type* TypeContext::getDouble() CMM_NOEXCEPT
+    {
+        return doubleType;
+    }
+
+    Type* TypeContext::getPointer(Type* pointee)
+    {
+        if (pointee->pointerTo == nullptr)
+        {
+            auto* type = create(EnumTypeKind::POINTER);
+            type->elementType = pointee;
+            pointee->pointerTo = type;
+        }
+
+        return pointee->pointerTo;
+    }
+
+    Type* TypeContext::getArray(Type* elementType, const u64 count)
+    {
+        auto& type = arrayTypes[std::make_pair(elementType, count)];
+
+        if (type == nullptr)
+        {
+            type = create(EnumTypeKind::ARRAY);
+            type->elementType = elementType;
+            type->count = count;
+        }
+
+        return type;
+    }
+
+    Type* TypeContext::getVector(Type* elementType, const u64 count)
+    {
+        auto& type = vectorTypes[std::make_pair(elementType, count)];
+
+        if (type == nullptr)
+        {
+            type = create(EnumTypeKind::VECTOR);
+            type->elementType = elementType;
+            type->count = count;
+        }
+
+        return type;
+    }
+
+    Type* TypeContext::getFunction(Type* returnType, const std::vector<Type*>& params)
+    {
+        auto& type = functionTypes[std::make_pair(returnType, params)];
+
+        if (type == nullptr)
+        {
+            type = create(EnumTypeKind::FUNCTION);
+            type->elementType = returnType;
+            type->fields = params;
+            type->hasBody = true;
+        }
+
+        return type;
+    }
+
+    Type* TypeContext::getStruct(const std::string& name)
+    {
+        auto& type = structTypes[name];
+
+        if (type == nullptr)
+        {
+            type = create(EnumTypeKind::STRUCT);
+            type->name = name;
+            structOrder.push_back(type);
+        }
+
+        return type;
+    }
+
+    Type* TypeContext::findStruct(const std::string& name) const
+    {
+        const auto findResult = structTypes.find(name);
+        return findResult != structTypes.cend() ? findResult->second : nullptr;
+    }
+
+    const std::vector<Type*>& TypeContext::getStructs() const CMM_NOEXCEPT
+    {
+        return structOrder;
+    }
+
+    Type* TypeContext::create(const EnumTypeKind kind)
+    {
+        storage.emplace_back(new Type(kind));
+
+        auto* type = storage.back().get();
+        type->context = this;
+
+        return type;
+    }
+}
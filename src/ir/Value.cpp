@@ -0,0 +1,116 @@
+/**
+ * The base class of everything that can be used as an operand in the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/Value.h>
+#include <cmm/ir/Instruction.h>
+
+// std includes
+#include <algorithm>
+
+namespace cmm::ir
+{
+    Value::Value(const EnumValueKind kind, Type* type, std::string name) : kind(kind), type(type), name(std::move(name))
+    {
+    }
+
+    EnumValueKind Value::getKind() const CMM_NOEXCEPT
+    {
+        return kind;
+    }
+
+    Type* Value::getType() const CMM_NOEXCEPT
+    {
+        return type;
+    }
+
+    void Value::setType(Type* type) CMM_NOEXCEPT
+    {
+        this->type = type;
+    }
+
+    const std::string& Value::getName() const CMM_NOEXCEPT
+    {
+        return name;
+    }
+
+    void Value::setName(const std::string& name)
+    {
+        this->name = name;
+    }
+
+    bool Value::hasName() const CMM_NOEXCEPT
+    {
+        return !name.empty();
+    }
+
+    bool Value::isConstant() const CMM_NOEXCEPT
+    {
+        return kind == EnumValueKind::CONSTANT_INT || kind == EnumValueKind::CONSTANT_FP ||
+               kind == EnumValueKind::CONSTANT_NULL || kind == EnumValueKind::CONSTANT_UNDEF;
+    }
+
+    bool Value::tracksUses() const CMM_NOEXCEPT
+    {
+        return !isConstant();
+    }
+
+    const std::vector<Instruction*>& Value::getUsers() const CMM_NOEXCEPT
+    {
+        return users;
+    }
+
+    bool Value::hasUses() const CMM_NOEXCEPT
+    {
+        return !users.empty();
+    }
+
+    std::size_t Value::getUseCount() const CMM_NOEXCEPT
+    {
+        return users.size();
+    }
+
+    void Value::replaceAllUsesWith(Value* other)
+    {
+        if (other == this)
+        {
+            return;
+        }
+
+        // Note: Copy since replacing operands mutates our user list.
+        const auto usersCopy = users;
+
+        for (auto* user : usersCopy)
+        {
+            user->replaceUsesOfWith(this, other);
+        }
+    }
+
+    void Value::addUser(Instruction* user)
+    {
+        if (tracksUses())
+        {
+            users.push_back(user);
+        }
+    }
+
+    void Value::removeUser(Instruction* user) CMM_NOEXCEPT
+    {
+        if (!tracksUses())
+        {
+            return;
+        }
+
+        // Note: Most removals are of recently added users, so search from the back.
+        const auto findResult = std::find(users.rbegin(), users.rend(), user);
+
+        if (findResult != users.rend())
+        {
+            users.erase(std::next(findResult).base());
+        }
+    }
+}
@@ -0,0 +1,493 @@
+/**
+ * Structural and type checks for the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/ir/Verifier.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <algorithm>
+
+namespace cmm::ir
+{
+    std::size_t Verifier::UseHash::operator() (const Use& use) const CMM_NOEXCEPT
+    {
+        return std::hash<const Value*>()(use.first) * 31 + std::hash<const Instruction*>()(use.second);
+    }
+
+    bool Verifier::verify(const Module& module)
+    {
+        const std::size_t before = errors.size();
+
+        // Globals and functions are used across functions, so index their use lists once per module.
+        clearUseIndex();
+
+        for (const auto& function : module.getFunctions())
+        {
+            verifyFunction(*function);
+        }
+
+        clearUseIndex();
+
+        return errors.size() == before;
+    }
+
+    bool Verifier::verify(const Function& function)
+    {
+        clearUseIndex();
+        const bool result = verifyFunction(function);
+        clearUseIndex();
+
+        return result;
+    }
+
+    bool Verifier::verifyFunction(const Function& function)
+    {
+        const std::size_t before = errors.size();
+
+        if (function.isDeclaration())
+        {
+            return true;
+        }
+
+        positions.clear();
+
+        for (const auto& block : function)
+        {
+            std::size_t index = 0;
+
+            for (const auto& instruction : *block)
+            {
+                positions.emplace(instruction.get(), index++);
+            }
+        }
+
+        dominators.emplace(function);
+
+        if (!function.getEntryBlock()->getPredecessors().empty())
+        {
+            fail(function, "entry block has predecessors");
+        }
+
+        for (const auto& block : function)
+        {
+            verifyBlock(function, *block);
+        }
+
+        dominators.reset();
+
+        return errors.size() == before;
+    }
+
+    const std::vector<std::string>& Verifier::getErrors() const CMM_NOEXCEPT
+    {
+        return errors;
+    }
+
+    void Verifier::clear() CMM_NOEXCEPT
+    {
+        errors.clear();
+    }
+
+    void Verifier::verifyBlock(const Function& function, const BasicBlock& block)
+    {
+        const std::string blockName = "block '" + block.getName() + "'";
+
+        if (block.getParent() != &function)
+        {
+            fail(function, blockName + " has the wrong parent");
+        }
+
+        if (block.empty())
+        {
+            fail(function, blockName + " is empty");
+            return;
+        }
+
+        if (!block.back()->isTerminator())
+        {
+            fail(function, blockName + " does not end in a terminator");
+        }
+
+        const auto preds = block.getPredecessors();
+        bool seenNonPhi = false;
+
+        for (const auto& instruction : block)
+        {
+            if (instruction->getParent() != &block)
+            {
+                fail(function, blockName + " contains an instruction with the wrong parent");
+            }
+
+            if (instruction->isTerminator() && instruction.get() != block.back())
+            {
+                fail(function, blockName + " has a terminator before its end");
+            }
+
+            if (instruction->getOpcode() == EnumOpcode::PHI)
+            {
+                if (seenNonPhi)
+                {
+                    fail(function, blockName + " has a phi after a non-phi instruction");
+                }
+
+                if (instruction->getNumIncoming() != preds.size())
+                {
+                    fail(function, blockName + " has a phi whose incoming count does not match its predecessors");
+                }
+
+                for (const auto* pred : preds)
+                {
+                    if (instruction->getIncomingValueForBlock(pred) == nullptr)
+                    {
+                        fail(function, blockName + " has a phi missing an entry for predecessor '" + pred->getName() + "'");
+                    }
+                }
+            }
+
+            else
+            {
+                seenNonPhi = true;
+            }
+
+            verifyInstruction(function, block, *instruction);
+        }
+    }
+
+    void Verifier::verifyInstruction(const Function& function, const BasicBlock& block, const Instruction& instruction)
+    {
+        const bool isPhi = instruction.getOpcode() == EnumOpcode::PHI;
+
+        for (std::size_t i = 0; i < instruction.getNumOperands(); ++i)
+        {
+            const auto* operand = instruction.getOperand(i);
+
+            if (operand == nullptr)
+            {
+                fail(function, std::string("null operand in '") + toString(instruction.getOpcode()) + "'");
+                continue;
+            }
+
+            verifyOperand(function, instruction, operand);
+
+            if (operand->getKind() != EnumValueKind::INSTRUCTION)
+            {
+                continue;
+            }
+
+            // A definition must dominate each use.  For a phi the use happens at the end of
+            // the incoming block, so only the incoming block needs to be dominated.
+            const auto* def = static_cast<const Instruction*>(operand);
+
+            if (isPhi)
+            {
+                const auto* incoming = instruction.getIncomingBlock(i / 2);
+
+                if (def->getParent() != nullptr && !dominators->dominates(def->getParent(), incoming))
+                {
+                    fail(function, "phi incoming value does not dominate the end of block '" + incoming->getName() + "'");
+                }
+            }
+
+            else if (def->getParent() == &block)
+            {
+                if (positions[def] >= positions[&instruction])
+                {
+                    fail(function, std::string("use before definition in '") + toString(instruction.getOpcode()) + "'");
+                }
+            }
+
+            else if (def->getParent() != nullptr && !dominators->dominates(def->getParent(), &block))
+            {
+                fail(function, std::string("definition does not dominate its use in '") + toString(instruction.getOpcode()) + "'");
+            }
+        }
+
+        verifyTypes(instruction);
+    }
+
+    void Verifier::verifyTypes(const Instruction& instruction)
+    {
+        auto* function = instruction.getFunction();
+        const auto opcode = instruction.getOpcode();
+        const std::string name = toString(opcode);
+        auto* type = instruction.getType();
+        const auto& operands = instruction.getOperands();
+
+        const auto expectOperands = [&](const std::size_t count) -> bool
+        {
+            if (operands.size() != count)
+            {
+                fail(*function, "'" + name + "' expects " + std::to_string(count) + " operands");
+                return false;
+            }
+
+            return std::none_of(operands.cbegin(), operands.cend(), [](const Value* v) { return v == nullptr; });
+        };
+
+        switch (opcode)
+        {
+        case EnumOpcode::RET:
+        {
+            auto* returnType = function->getReturnType();
+
+            if (returnType->isVoid() ? !operands.empty()
+                : (operands.size() != 1 || operands[0] == nullptr || operands[0]->getType() != returnType))
+            {
+                fail(*function, "'ret' does not match the function's return type " + returnType->toString());
+            }
+        }
+            break;
+        case EnumOpcode::BR:
+            if (expectOperands(1) && operands[0]->getKind() != EnumValueKind::BASIC_BLOCK)
+            {
+                fail(*function, "'br' target is not a block");
+            }
+
+            break;
+        case EnumOpcode::COND_BR:
+            if (expectOperands(3))
+            {
+                if (!operands[0]->getType()->isInt(1))
+                {
+                    fail(*function, "conditional 'br' requires an i1 condition");
+                }
+
+                if (operands[1]->getKind() != EnumValueKind::BASIC_BLOCK || operands[2]->getKind() != EnumValueKind::BASIC_BLOCK)
+                {
+                    fail(*function, "conditional 'br' target is not a block");
+                }
+            }
+
+            break;
+        case EnumOpcode::SWITCH:
+            if (operands.size() < 2 || operands.size() % 2 != 0 || !operands[0]->getType()->isInt())
+            {
+                fail(*function, "malformed 'switch'");
+                break;
+            }
+
+            for (std::size_t i = 0; i < instruction.getNumCases(); ++i)
+            {
+                if (instruction.getCaseValue(i)->getKind() != EnumValueKind::CONSTANT_INT
+                    || instruction.getCaseValue(i)->getType() != operands[0]->getType())
+                {
+                    fail(*function, "'switch' case is not a constant of the condition's type");
+                }
+            }
+
+            break;
+        case EnumOpcode::FNEG:
+            if (expectOperands(1) && (!type->getScalarType()->isFloatingPoint() || operands[0]->getType() != type))
+            {
+                fail(*function, "'fneg' requires a floating point operand of the result type");
+            }
+
+            break;
+        case EnumOpcode::ALLOCA:
+            if (!type->isPointer() || instruction.getAuxType() == nullptr || type->getElementType() != instruction.getAuxType())
+            {
+                fail(*function, "'alloca' result is not a pointer to the allocated type");
+            }
+
+            break;
+        case EnumOpcode::LOAD:
+            if (expectOperands(1) && (!operands[0]->getType()->isPointer() || operands[0]->getType()->getElementType() != type))
+            {
+                fail(*function, "'load' pointer type does not match the loaded type " + type->toString());
+            }
+
+            break;
+        case EnumOpcode::STORE:
+            if (expectOperands(2) && (!operands[1]->getType()->isPointer()
+                || operands[1]->getType()->getElementType() != operands[0]->getType()))
+            {
+                fail(*function, "'store' pointer type does not match the stored type " + operands[0]->getType()->toString());
+            }
+
+            break;
+        case EnumOpcode::GET_ELEMENT_PTR:
+            if (operands.empty() || instruction.getAuxType() == nullptr || !type->isPointer()
+                || operands[0]->getType() != instruction.getAuxType()->getPointerTo())
+            {
+                fail(*function, "malformed 'getelementptr'");
+            }
+
+            break;
+        case EnumOpcode::ICMP:
+        case EnumOpcode::FCMP:
+            if (expectOperands(2))
+            {
+                const bool fp = opcode == EnumOpcode::FCMP;
+
+                if (!type->isInt(1) || operands[0]->getType() != operands[1]->getType()
+                    || operands[0]->getType()->isFloatingPoint() != fp)
+                {
+                    fail(*function, "'" + name + "' operands must share a " + (fp ? "floating point" : "non floating point") + " type");
+                }
+            }
+
+            break;
+        case EnumOpcode::PHI:
+            for (std::size_t i = 0; i < instruction.getNumIncoming(); ++i)
+            {
+                if (instruction.getIncomingValue(i) == nullptr || instruction.getIncomingValue(i)->getType() != type)
+                {
+                    fail(*function, "'phi' incoming value does not match the phi's type");
+                }
+            }
+
+            break;
+        case EnumOpcode::SELECT:
+            if (expectOperands(3) && (!operands[0]->getType()->isInt(1) || operands[1]->getType() != type
+                || operands[2]->getType() != type))
+            {
+                fail(*function, "malformed 'select'");
+            }
+
+            break;
+        case EnumOpcode::CALL:
+        {
+            const auto* callee = instruction.getCalledFunction();
+
+            if (callee == nullptr)
+            {
+                fail(*function, "'call' without a callee");
+                break;
+            }
+
+            const auto& params = callee->getFunctionType()->getFields();
+
+            if (operands.size() != params.size() + 1 || type != callee->getReturnType())
+            {
+                fail(*function, "'call' to '" + callee->getName() + "' does not match its signature");
+                break;
+            }
+
+            for (std::size_t i = 0; i < params.size(); ++i)
+            {
+                if (operands[i + 1]->getType() != params[i])
+                {
+                    fail(*function, "'call' to '" + callee->getName() + "' has a mismatched argument " + std::to_string(i));
+                }
+            }
+
+            if (instruction.hasFlag(EnumInstructionFlag::MUST_TAIL))
+            {
+                const auto* next = instruction.getNextInstruction();
+
+                if (callee->getFunctionType() != function->getFunctionType() || next == nullptr || next->getOpcode() != EnumOpcode::RET
+                    || (next->getNumOperands() > 0 && next->getOperand(0) != &instruction))
+                {
+                    fail(*function, "'musttail' call to '" + callee->getName() + "' is not returned directly or has a different prototype");
+                }
+            }
+        }
+            break;
+        case EnumOpcode::EXTRACT_ELEMENT:
+            if (expectOperands(2) && (!operands[0]->getType()->isVector() || operands[0]->getType()->getElementType() != type
+                || !operands[1]->getType()->isInt()))
+            {
+                fail(*function, "malformed 'extractelement'");
+            }
+
+            break;
+        case EnumOpcode::INSERT_ELEMENT:
+            if (expectOperands(3) && (!type->isVector() || operands[0]->getType() != type
+                || operands[1]->getType() != type->getElementType() || !operands[2]->getType()->isInt()))
+            {
+                fail(*function, "malformed 'insertelement'");
+            }
+
+            break;
+        default:
+            if (instruction.isBinaryOp())
+            {
+                // Vectors of ints or floating point values work lane by lane.
+                const bool fp = opcode >= EnumOpcode::FADD;
+                auto* scalarType = type->getScalarType();
+
+                if (expectOperands(2) && (operands[0]->getType() != type || operands[1]->getType() != type
+                    || scalarType->isFloatingPoint() != fp || !(fp || scalarType->isInt())))
+                {
+                    fail(*function, "'" + name + "' operands do not match the result type " + type->toString());
+                }
+            }
+
+            else if (instruction.isCast())
+            {
+                expectOperands(1);
+            }
+
+            break;
+        }
+    }
+
+    void Verifier::verifyOperand(const Function& function, const Instruction& instruction, const Value* operand)
+    {
+        const std::string name = toString(instruction.getOpcode());
+
+        switch (operand->getKind())
+        {
+        case EnumValueKind::ARGUMENT:
+            if (static_cast<const Argument*>(operand)->getParent() != &function)
+            {
+                fail(function, "'" + name + "' uses an argument of another function");
+            }
+
+            break;
+        case EnumValueKind::BASIC_BLOCK:
+            if (static_cast<const BasicBlock*>(operand)->getParent() != &function)
+            {
+                fail(function, "'" + name + "' references a block of another function");
+            }
+
+            break;
+        case EnumValueKind::INSTRUCTION:
+        {
+            const auto* def = static_cast<const Instruction*>(operand);
+
+            if (def->getParent() == nullptr || def->getFunction() != &function)
+            {
+                fail(function, "'" + name + "' uses an instruction that is not in this function");
+            }
+        }
+            break;
+        default:
+            break;
+        }
+
+        if (operand->tracksUses())
+        {
+            // Note: Searching the use list for every operand is quadratic in the number of uses of
+            // a value, so index each value's use list the first time it is seen instead.
+            if (indexedValues.insert(operand).second)
+            {
+                for (const auto* user : operand->getUsers())
+                {
+                    listedUses.emplace(operand, user);
+                }
+            }
+
+            if (listedUses.find(Use(operand, &instruction)) == listedUses.cend())
+            {
+                fail(function, "'" + name + "' is missing from the use list of its operand");
+            }
+        }
+    }
+
+    void Verifier::clearUseIndex() CMM_NOEXCEPT
+    {
+        indexedValues.clear();
+        listedUses.clear();
+    }
+
+    void Verifier::fail(const Function& function, const std::string& message)
+    {
+        errors.emplace_back("in function '" + function.getName() + "': " + message);
+    }
+}
@@ -0,0 +1,129 @@
+/**
+ * Infers the nocapture and noalias attributes of pointer arguments.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/ArgumentAttributes.h>
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/Module.h>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    ArgumentAttributes::ArgumentAttributes() CMM_NOEXCEPT : noCaptureCount(0), noAliasCount(0)
+    {
+    }
+
+    bool ArgumentAttributes::run(Module& module)
+    {
+        bool changed = false;
+        bool iterate = true;
+
+        while (iterate)
+        {
+            iterate = false;
+
+            for (auto& function : module.getFunctions())
+            {
+                iterate |= run(*function);
+            }
+
+            changed |= iterate;
+        }
+
+        return changed;
+    }
+
+    bool ArgumentAttributes::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        const std::size_t before = noCaptureCount + noAliasCount;
+
+        for (std::size_t i = 0; i < function.argSize(); ++i)
+        {
+            auto* arg = function.getArg(i);
+
+            if (!arg->getType()->isPointer())
+            {
+                continue;
+            }
+
+            if (!arg->hasAttribute(EnumArgumentAttribute::NO_CAPTURE) && !mayBeCaptured(arg))
+            {
+                arg->setAttribute(EnumArgumentAttribute::NO_CAPTURE);
+                ++noCaptureCount;
+            }
+
+            if (!arg->hasAttribute(EnumArgumentAttribute::NO_ALIAS) && isNoAlias(*arg))
+            {
+                arg->setAttribute(EnumArgumentAttribute::NO_ALIAS);
+                ++noAliasCount;
+            }
+        }
+
+        return noCaptureCount + noAliasCount != before;
+    }
+
+    std::size_t ArgumentAttributes::getNoCaptureCount() const CMM_NOEXCEPT
+    {
+        return noCaptureCount;
+    }
+
+    std::size_t ArgumentAttributes::getNoAliasCount() const CMM_NOEXCEPT
+    {
+        return noAliasCount;
+    }
+
+    /* static */
+    bool ArgumentAttributes::isNoAlias(const Argument& arg)
+    {
+        if (!arg.getType()->isPointer() || !arg.hasUses())
+        {
+            return false;
+        }
+
+        for (const auto& block : *arg.getParent())
+        {
+            for (const auto& instruction : *block)
+            {
+                const Value* pointer = nullptr;
+
+                switch (instruction->getOpcode())
+                {
+                case EnumOpcode::LOAD:
+                    pointer = instruction->getOperand(0);
+                    break;
+                case EnumOpcode::STORE:
+                    pointer = instruction->getOperand(1);
+                    break;
+                default:
+                    // A call could reach the same memory through a global or another argument.
+                    if (instruction->mayReadMemory() || instruction->mayWriteMemory())
+                    {
+                        return false;
+                    }
+
+                    continue;
+                }
+
+                const auto* object = getUnderlyingObject(pointer);
+
+                if (object != &arg && (object->getKind() != EnumValueKind::INSTRUCTION
+                    || static_cast<const Instruction*>(object)->getOpcode() != EnumOpcode::ALLOCA))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,371 @@
+/**
+ * Sparse conditional constant propagation (Wegman and Zadeck): folds instructions over
+ * constants and propagates the results through phis, ignoring paths that can't be taken.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/ConstantPropagation.h>
+#include <cmm/ir/ConstantFold.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    namespace
+    {
+        // An element of the lattice: unknown (not yet reached) -> constant -> overdefined.
+        struct LatticeValue
+        {
+            enum class EnumState : u8
+            {
+                UNKNOWN = 0, CONSTANT, OVERDEFINED
+            };
+
+            EnumState state = EnumState::UNKNOWN;
+            Value* constant = nullptr;
+
+            bool operator== (const LatticeValue& other) const CMM_NOEXCEPT
+            {
+                return state == other.state && constant == other.constant;
+            }
+
+            bool operator!= (const LatticeValue& other) const CMM_NOEXCEPT
+            {
+                return !(*this == other);
+            }
+
+            static LatticeValue overdefined() CMM_NOEXCEPT
+            {
+                return { EnumState::OVERDEFINED, nullptr };
+            }
+        };
+
+        class Solver
+        {
+        public:
+
+            explicit Solver(Module& module) : module(module)
+            {
+            }
+
+            void solve(Function& function)
+            {
+                markBlock(function.getEntryBlock());
+
+                while (!blockWorklist.empty() || !instructionWorklist.empty())
+                {
+                    while (!instructionWorklist.empty())
+                    {
+                        auto* instruction = instructionWorklist.back();
+                        instructionWorklist.pop_back();
+
+                        for (auto* user : instruction->getUsers())
+                        {
+                            if (executable.find(user->getParent()) != executable.cend())
+                            {
+                                visit(*user);
+                            }
+                        }
+                    }
+
+                    while (!blockWorklist.empty())
+                    {
+                        auto* block = blockWorklist.back();
+                        blockWorklist.pop_back();
+
+                        for (auto& instruction : *block)
+                        {
+                            visit(*instruction);
+                        }
+                    }
+                }
+            }
+
+            bool isExecutable(const BasicBlock* block) const
+            {
+                return executable.find(block) != executable.cend();
+            }
+
+            Value* getConstant(const Instruction* instruction) const
+            {
+                const auto findResult = values.find(instruction);
+                return findResult != values.cend() && findResult->second.state == LatticeValue::EnumState::CONSTANT ?
+                    findResult->second.constant : nullptr;
+            }
+
+        private:
+
+            LatticeValue get(Value* value) const
+            {
+                if (isFoldableConstant(value))
+                {
+                    return { LatticeValue::EnumState::CONSTANT, value };
+                }
+
+                else if (value->getKind() != EnumValueKind::INSTRUCTION)
+                {
+                    return LatticeValue::overdefined();
+                }
+
+                const auto findResult = values.find(static_cast<Instruction*>(value));
+                return findResult != values.cend() ? findResult->second : LatticeValue();
+            }
+
+            void update(Instruction& instruction, const LatticeValue& value)
+            {
+                auto& current = values[&instruction];
+
+                if (current != value)
+                {
+                    current = value;
+                    instructionWorklist.push_back(&instruction);
+                }
+            }
+
+            bool markBlock(BasicBlock* block)
+            {
+                if (executable.insert(block).second)
+                {
+                    blockWorklist.push_back(block);
+                    return true;
+                }
+
+                return false;
+            }
+
+            void markEdge(BasicBlock* from, BasicBlock* to)
+            {
+                if (!edges.emplace(from, to).second)
+                {
+                    return;
+                }
+
+                // An already executable block only needs its phis revisited for the new edge.
+                if (!markBlock(to))
+                {
+                    for (auto& instruction : *to)
+                    {
+                        if (instruction->getOpcode() != EnumOpcode::PHI)
+                        {
+                            break;
+                        }
+
+                        visit(*instruction);
+                    }
+                }
+            }
+
+            void visitPhi(Instruction& phi)
+            {
+                LatticeValue result;
+
+                for (std::size_t i = 0; i < phi.getNumIncoming(); ++i)
+                {
+                    auto* incoming = phi.getIncomingValue(i);
+
+                    // Undef may take on whatever value the other entries agree on.
+                    if (edges.find({ phi.getIncomingBlock(i), phi.getParent() }) == edges.cend()
+                        || incoming->getKind() == EnumValueKind::CONSTANT_UNDEF)
+                    {
+                        continue;
+                    }
+
+                    const auto value = get(incoming);
+
+                    if (value.state == LatticeValue::EnumState::OVERDEFINED
+                        || (value.state == LatticeValue::EnumState::CONSTANT && result.state == LatticeValue::EnumState::CONSTANT
+                            && value.constant != result.constant))
+                    {
+                        result = LatticeValue::overdefined();
+                        break;
+                    }
+
+                    else if (value.state == LatticeValue::EnumState::CONSTANT)
+                    {
+                        result = value;
+                    }
+                }
+
+                update(phi, result);
+            }
+
+            void visit(Instruction& instruction)
+            {
+                auto* block = instruction.getParent();
+
+                switch (instruction.getOpcode())
+                {
+                case EnumOpcode::PHI:
+                    visitPhi(instruction);
+                    return;
+                case EnumOpcode::BR:
+                    markEdge(block, static_cast<BasicBlock*>(instruction.getOperand(0)));
+                    return;
+                case EnumOpcode::COND_BR:
+                {
+                    const auto cond = get(instruction.getOperand(0));
+                    auto* trueDest = static_cast<BasicBlock*>(instruction.getOperand(1));
+                    auto* falseDest = static_cast<BasicBlock*>(instruction.getOperand(2));
+
+                    if (cond.state == LatticeValue::EnumState::CONSTANT && cond.constant->getKind() == EnumValueKind::CONSTANT_INT)
+                    {
+                        markEdge(block, static_cast<ConstantInt*>(cond.constant)->isZero() ? falseDest : trueDest);
+                    }
+
+                    else if (cond.state != LatticeValue::EnumState::UNKNOWN)
+                    {
+                        markEdge(block, trueDest);
+                        markEdge(block, falseDest);
+                    }
+                }
+                    return;
+                case EnumOpcode::SWITCH:
+                {
+                    const auto cond = get(instruction.getOperand(0));
+
+                    if (cond.state == LatticeValue::EnumState::UNKNOWN)
+                    {
+                        return;
+                    }
+
+                    for (std::size_t i = 0; i < instruction.getNumCases(); ++i)
+                    {
+                        if (cond.state != LatticeValue::EnumState::CONSTANT || instruction.getCaseValue(i) == cond.constant)
+                        {
+                            markEdge(block, instruction.getCaseDest(i));
+
+                            if (cond.state == LatticeValue::EnumState::CONSTANT)
+                            {
+                                return;
+                            }
+                        }
+                    }
+
+                    markEdge(block, instruction.getDefaultDest());
+                }
+                    return;
+                default:
+                    break;
+                }
+
+                if (instruction.getType()->isVoid())
+                {
+                    return;
+                }
+
+                else if (!instruction.isBinaryOp() && !instruction.isCompare() && !instruction.isCast()
+                    && instruction.getOpcode() != EnumOpcode::FNEG && instruction.getOpcode() != EnumOpcode::SELECT)
+                {
+                    update(instruction, LatticeValue::overdefined());
+                    return;
+                }
+
+                std::vector<Value*> operands;
+                operands.reserve(instruction.getNumOperands());
+
+                for (auto* operand : instruction.getOperands())
+                {
+                    const auto value = get(operand);
+
+                    if (value.state == LatticeValue::EnumState::OVERDEFINED)
+                    {
+                        update(instruction, LatticeValue::overdefined());
+                        return;
+                    }
+
+                    else if (value.state == LatticeValue::EnumState::UNKNOWN)
+                    {
+                        return;
+                    }
+
+                    operands.push_back(value.constant);
+                }
+
+                auto* folded = foldInstruction(module, instruction, operands);
+                update(instruction, folded != nullptr ? LatticeValue { LatticeValue::EnumState::CONSTANT, folded } : LatticeValue::overdefined());
+            }
+
+        private:
+
+            // The module constants are created in.
+            Module& module;
+
+            // The lattice value of each instruction (absent means unknown).
+            std::unordered_map<const Instruction*, LatticeValue> values;
+
+            // The blocks and CFG edges found to be executable.
+            std::unordered_set<const BasicBlock*> executable;
+            std::set<std::pair<const BasicBlock*, const BasicBlock*>> edges;
+
+            std::vector<BasicBlock*> blockWorklist;
+            std::vector<Instruction*> instructionWorklist;
+        };
+    }
+
+    ConstantPropagation::ConstantPropagation() CMM_NOEXCEPT : foldedCount(0)
+    {
+    }
+
+    bool ConstantPropagation::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& function : module.getFunctions())
+        {
+            changed |= run(*function);
+        }
+
+        return changed;
+    }
+
+    bool ConstantPropagation::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        Solver solver(*function.getParent());
+        solver.solve(function);
+
+        const std::size_t before = foldedCount;
+
+        for (auto& block : function)
+        {
+            if (!solver.isExecutable(block.get()))
+            {
+                continue;
+            }
+
+            for (auto iter = block->begin(); iter != block->end();)
+            {
+                auto* instruction = (iter++)->get();
+                auto* constant = solver.getConstant(instruction);
+
+                if (constant != nullptr)
+                {
+                    instruction->replaceAllUsesWith(constant);
+                    instruction->eraseFromParent();
+                    ++foldedCount;
+                }
+            }
+        }
+
+        return foldedCount != before;
+    }
+
+    std::size_t ConstantPropagation::getFoldedCount() const CMM_NOEXCEPT
+    {
+        return foldedCount;
+    }
+}
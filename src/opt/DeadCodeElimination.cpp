@@ -0,0 +1,449 @@
+/**
+ * Dead code and dead store elimination.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/DeadCodeElimination.h>
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <unordered_map>
+#include <unordered_set>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    /**
+     * Removes every phi entry of a block for an incoming block.
+     *
+     * @param block the BasicBlock with the phis.
+     * @param pred the incoming BasicBlock to remove.
+     */
+    static void removePhiEntries(BasicBlock* block, const BasicBlock* pred)
+    {
+        for (auto& instruction : *block)
+        {
+            if (instruction->getOpcode() != EnumOpcode::PHI)
+            {
+                break;
+            }
+
+            for (std::size_t i = instruction->getNumIncoming(); i-- > 0;)
+            {
+                if (instruction->getIncomingBlock(i) == pred)
+                {
+                    instruction->removeIncoming(i);
+                }
+            }
+        }
+    }
+
+    DeadCodeElimination::DeadCodeElimination() CMM_NOEXCEPT : removedInstructionCount(0), removedStoreCount(0), removedBlockCount(0)
+    {
+    }
+
+    bool DeadCodeElimination::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& function : module.getFunctions())
+        {
+            changed |= run(*function);
+        }
+
+        return changed;
+    }
+
+    bool DeadCodeElimination::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        bool changed = false;
+        bool progress = true;
+
+        // Each step can expose more work for the others (ex. a folded branch leaves a block
+        // unreachable, whose removal leaves its values unused).
+        while (progress)
+        {
+            progress = foldConstantBranches(function);
+            progress |= removeUnreachableBlocks(function);
+            progress |= mergeBlocks(function);
+            progress |= removeDeadStores(function);
+            progress |= removeDeadInstructions(function);
+            changed |= progress;
+        }
+
+        return changed;
+    }
+
+    std::size_t DeadCodeElimination::getRemovedInstructionCount() const CMM_NOEXCEPT
+    {
+        return removedInstructionCount;
+    }
+
+    std::size_t DeadCodeElimination::getRemovedStoreCount() const CMM_NOEXCEPT
+    {
+        return removedStoreCount;
+    }
+
+    std::size_t DeadCodeElimination::getRemovedBlockCount() const CMM_NOEXCEPT
+    {
+        return removedBlockCount;
+    }
+
+    bool DeadCodeElimination::foldConstantBranches(Function& function)
+    {
+        auto* voidType = function.getParent()->getTypes().getVoid();
+        bool changed = false;
+
+        for (auto& blockPtr : function)
+        {
+            auto* block = blockPtr.get();
+            auto* terminator = block->getTerminator();
+
+            if (terminator == nullptr
+                || (terminator->getOpcode() != EnumOpcode::COND_BR && terminator->getOpcode() != EnumOpcode::SWITCH)
+                || terminator->getOperand(0)->getKind() != EnumValueKind::CONSTANT_INT)
+            {
+                continue;
+            }
+
+            BasicBlock* taken;
+
+            if (terminator->getOpcode() == EnumOpcode::COND_BR)
+            {
+                const bool cond = !static_cast<ConstantInt*>(terminator->getOperand(0))->isZero();
+                taken = static_cast<BasicBlock*>(terminator->getOperand(cond ? 1 : 2));
+            }
+
+            else
+            {
+                taken = terminator->getDefaultDest();
+
+                for (std::size_t i = 0; i < terminator->getNumCases(); ++i)
+                {
+                    if (terminator->getCaseValue(i) == terminator->getOperand(0))
+                    {
+                        taken = terminator->getCaseDest(i);
+                        break;
+                    }
+                }
+            }
+
+            for (auto* succ : block->getSuccessors())
+            {
+                if (succ != taken)
+                {
+                    removePhiEntries(succ, block);
+                }
+            }
+
+            terminator->eraseFromParent();
+            block->append(std::make_unique<Instruction>(EnumOpcode::BR, voidType, std::vector<Value*> { taken }));
+            changed = true;
+        }
+
+        return changed;
+    }
+
+    bool DeadCodeElimination::removeUnreachableBlocks(Function& function)
+    {
+        std::unordered_set<const BasicBlock*> reachable;
+        std::vector<BasicBlock*> worklist { function.getEntryBlock() };
+        reachable.insert(worklist.front());
+
+        while (!worklist.empty())
+        {
+            auto* block = worklist.back();
+            worklist.pop_back();
+
+            for (auto* succ : block->getSuccessors())
+            {
+                if (reachable.insert(succ).second)
+                {
+                    worklist.push_back(succ);
+                }
+            }
+        }
+
+        std::vector<BasicBlock*> unreachable;
+
+        for (auto& block : function)
+        {
+            if (reachable.find(block.get()) == reachable.cend())
+            {
+                unreachable.push_back(block.get());
+            }
+        }
+
+        if (unreachable.empty())
+        {
+            return false;
+        }
+
+        auto& module = *function.getParent();
+
+        for (auto* block : unreachable)
+        {
+            for (auto* succ : block->getSuccessors())
+            {
+                removePhiEntries(succ, block);
+            }
+
+            // Dead blocks may still use each other's values, so let go of everything first.
+            for (auto& instruction : *block)
+            {
+                if (instruction->hasUses())
+                {
+                    instruction->replaceAllUsesWith(module.getUndef(instruction->getType()));
+                }
+
+                instruction->dropAllReferences();
+            }
+        }
+
+        for (auto* block : unreachable)
+        {
+            removedInstructionCount += block->size();
+            ++removedBlockCount;
+            function.remove(block);
+        }
+
+        return true;
+    }
+
+    bool DeadCodeElimination::mergeBlocks(Function& function)
+    {
+        bool changed = false;
+        auto* entry = function.getEntryBlock();
+
+        for (auto iter = function.begin(); iter != function.end();)
+        {
+            auto* block = (iter++)->get();
+            auto* pred = block->getSinglePredecessor();
+
+            if (block == entry || pred == nullptr || pred == block || pred->getTerminator()->getOpcode() != EnumOpcode::BR)
+            {
+                continue;
+            }
+
+            // With a single predecessor every phi has exactly one entry.
+            while (block->front()->getOpcode() == EnumOpcode::PHI)
+            {
+                auto* phi = block->front();
+                phi->replaceAllUsesWith(phi->getIncomingValue(0));
+                erase(phi);
+            }
+
+            erase(pred->getTerminator());
+            block->spliceInto(block->front(), pred);
+
+            // Successors' phis now come from the predecessor.
+            block->replaceAllUsesWith(pred);
+            function.remove(block);
+            ++removedBlockCount;
+            changed = true;
+        }
+
+        return changed;
+    }
+
+    bool DeadCodeElimination::removeDeadStores(Function& function)
+    {
+        bool changed = false;
+
+        // Stores to a local that is never read (and whose address never escapes) are dead.
+        for (auto& block : function)
+        {
+            for (auto& instruction : *block)
+            {
+                if (instruction->getOpcode() != EnumOpcode::ALLOCA)
+                {
+                    continue;
+                }
+
+                std::vector<Instruction*> stores;
+                std::vector<const Instruction*> addresses { instruction.get() };
+                bool read = false;
+
+                while (!addresses.empty() && !read)
+                {
+                    const auto* address = addresses.back();
+                    addresses.pop_back();
+
+                    for (auto* user : address->getUsers())
+                    {
+                        const auto opcode = user->getOpcode();
+
+                        if (opcode == EnumOpcode::STORE && user->getOperand(1) == address && user->getOperand(0) != address)
+                        {
+                            stores.push_back(user);
+                        }
+
+                        else if ((opcode == EnumOpcode::GET_ELEMENT_PTR && user->getOperand(0) == address) || opcode == EnumOpcode::BITCAST)
+                        {
+                            addresses.push_back(user);
+                        }
+
+                        else
+                        {
+                            // A load, or the address escaping (call, stored, converted...).
+                            read = true;
+                            break;
+                        }
+                    }
+                }
+
+                if (!read && !stores.empty())
+                {
+                    for (auto* store : stores)
+                    {
+                        ++removedStoreCount;
+                        erase(store);
+                    }
+
+                    changed = true;
+                }
+            }
+        }
+
+        // Within a block, a store is dead if the same address is stored to again, or the
+        // function returns, before anything (a load or a call) may read it.
+        const AliasAnalysis aliasAnalysis(function);
+
+        for (auto& block : function)
+        {
+            std::unordered_map<const Value*, Instruction*> pending;
+
+            for (auto iter = block->begin(); iter != block->end();)
+            {
+                auto* instruction = (iter++)->get();
+
+                if (instruction->getOpcode() == EnumOpcode::STORE)
+                {
+                    auto& previous = pending[instruction->getOperand(1)];
+
+                    if (previous != nullptr)
+                    {
+                        ++removedStoreCount;
+                        erase(previous);
+                        changed = true;
+                    }
+
+                    previous = instruction;
+                }
+
+                else if (instruction->getOpcode() == EnumOpcode::RET)
+                {
+                    // The function's locals are gone once it returns.
+                    for (const auto& [pointer, store] : pending)
+                    {
+                        const auto* object = getUnderlyingObject(pointer);
+
+                        if (object->getKind() == EnumValueKind::INSTRUCTION && static_cast<const Instruction*>(object)->getOpcode() == EnumOpcode::ALLOCA)
+                        {
+                            ++removedStoreCount;
+                            erase(store);
+                            changed = true;
+                        }
+                    }
+                }
+
+                else if (instruction->mayReadMemory())
+                {
+                    for (auto entry = pending.begin(); entry != pending.end();)
+                    {
+                        if (aliasAnalysis.mayAccess(*instruction, entry->first))
+                        {
+                            entry = pending.erase(entry);
+                        }
+
+                        else
+                        {
+                            ++entry;
+                        }
+                    }
+                }
+            }
+        }
+
+        return changed;
+    }
+
+    bool DeadCodeElimination::removeDeadInstructions(Function& function)
+    {
+        std::unordered_set<const Instruction*> live;
+        std::vector<const Instruction*> worklist;
+
+        for (auto& block : function)
+        {
+            for (auto& instruction : *block)
+            {
+                if (instruction->mayHaveSideEffects())
+                {
+                    live.insert(instruction.get());
+                    worklist.push_back(instruction.get());
+                }
+            }
+        }
+
+        while (!worklist.empty())
+        {
+            const auto* instruction = worklist.back();
+            worklist.pop_back();
+
+            for (const auto* operand : instruction->getOperands())
+            {
+                if (operand != nullptr && operand->getKind() == EnumValueKind::INSTRUCTION)
+                {
+                    const auto* def = static_cast<const Instruction*>(operand);
+
+                    if (live.insert(def).second)
+                    {
+                        worklist.push_back(def);
+                    }
+                }
+            }
+        }
+
+        std::vector<Instruction*> dead;
+
+        for (auto& block : function)
+        {
+            for (auto& instruction : *block)
+            {
+                if (live.find(instruction.get()) == live.cend())
+                {
+                    dead.push_back(instruction.get());
+                }
+            }
+        }
+
+        // Dead phis may form cycles, so drop every reference before erasing any.
+        for (auto* instruction : dead)
+        {
+            instruction->dropAllReferences();
+        }
+
+        for (auto* instruction : dead)
+        {
+            erase(instruction);
+        }
+
+        return !dead.empty();
+    }
+
+    void DeadCodeElimination::erase(Instruction* instruction)
+    {
+        ++removedInstructionCount;
+        instruction->eraseFromParent();
+    }
+}
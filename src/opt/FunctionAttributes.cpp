@@ -0,0 +1,181 @@
+/**
+ * Infers readnone/readonly/nounwind/willreturn bottom-up over the call graph.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/FunctionAttributes.h>
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/CallGraph.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <algorithm>
+#include <unordered_map>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    /**
+     * Gets whether a pointer is into one of the function's own locals, which the caller
+     * can't see.
+     *
+     * @param pointer the pointer Value.
+     * @return bool.
+     */
+    static bool isLocalMemory(const Value* pointer) CMM_NOEXCEPT
+    {
+        const auto* object = getUnderlyingObject(pointer);
+        return object->getKind() == EnumValueKind::INSTRUCTION && static_cast<const Instruction*>(object)->getOpcode() == EnumOpcode::ALLOCA;
+    }
+
+    FunctionAttributes::FunctionAttributes() CMM_NOEXCEPT : inferredCount(0)
+    {
+    }
+
+    bool FunctionAttributes::run(Module& module)
+    {
+        const CallGraph callGraph(module);
+        return run(module, callGraph);
+    }
+
+    bool FunctionAttributes::run(Module&, const CallGraph& callGraph)
+    {
+        const std::size_t before = inferredCount;
+        const auto& order = callGraph.getBottomUpOrder();
+
+        // The members of a cycle are next to each other.
+        for (auto first = order.cbegin(); first != order.cend();)
+        {
+            auto last = std::find_if(first, order.cend(), [&](const Function* function) { return !callGraph.isSameComponent(*first, function); });
+            infer(std::vector<Function*>(first, last), callGraph.isRecursive(*first));
+            first = last;
+        }
+
+        return inferredCount != before;
+    }
+
+    std::size_t FunctionAttributes::getInferredCount() const CMM_NOEXCEPT
+    {
+        return inferredCount;
+    }
+
+    /* static */
+    bool FunctionAttributes::hasCycle(const Function& function)
+    {
+        // Iterative DFS: an edge to a block still on the stack closes a cycle.
+        enum class EnumColor : u8 { WHITE = 0, GRAY, BLACK };
+        std::unordered_map<const BasicBlock*, EnumColor> colors;
+        std::vector<std::pair<const BasicBlock*, std::size_t>> stack;
+
+        stack.emplace_back(function.getEntryBlock(), 0);
+        colors[function.getEntryBlock()] = EnumColor::GRAY;
+
+        while (!stack.empty())
+        {
+            auto& [block, next] = stack.back();
+            const auto successors = block->getSuccessors();
+
+            if (next == successors.size())
+            {
+                colors[block] = EnumColor::BLACK;
+                stack.pop_back();
+                continue;
+            }
+
+            const auto* succ = successors[next++];
+            auto& color = colors[succ];
+
+            if (color == EnumColor::GRAY)
+            {
+                return true;
+            }
+
+            else if (color == EnumColor::WHITE)
+            {
+                color = EnumColor::GRAY;
+                stack.emplace_back(succ, 0);
+            }
+        }
+
+        return false;
+    }
+
+    void FunctionAttributes::infer(const std::vector<Function*>& component, const bool recursive)
+    {
+        bool reads = false;
+        bool writes = false;
+        bool willReturn = !recursive;
+
+        for (const auto* function : component)
+        {
+            willReturn &= !hasCycle(*function);
+
+            for (const auto& block : *function)
+            {
+                for (const auto& instruction : *block)
+                {
+                    switch (instruction->getOpcode())
+                    {
+                    case EnumOpcode::LOAD:
+                        reads |= !isLocalMemory(instruction->getOperand(0));
+                        break;
+                    case EnumOpcode::STORE:
+                        writes |= !isLocalMemory(instruction->getOperand(1));
+                        break;
+                    case EnumOpcode::CALL:
+                    {
+                        const auto* callee = instruction->getCalledFunction();
+
+                        if (std::find(component.cbegin(), component.cend(), callee) != component.cend())
+                        {
+                            break;
+                        }
+
+                        reads |= !callee->hasAttribute(EnumFunctionAttribute::READ_NONE);
+                        writes |= !callee->onlyReadsMemory();
+                        willReturn &= callee->hasAttribute(EnumFunctionAttribute::WILL_RETURN);
+                        break;
+                    }
+                    default:
+                        break;
+                    }
+                }
+            }
+        }
+
+        // There are no exceptions in C, so nothing we define can unwind.
+        u8 attributes = EnumFunctionAttribute::NO_UNWIND;
+
+        if (!reads && !writes)
+        {
+            attributes |= EnumFunctionAttribute::READ_NONE;
+        }
+
+        else if (!writes)
+        {
+            attributes |= EnumFunctionAttribute::READ_ONLY;
+        }
+
+        if (willReturn)
+        {
+            attributes |= EnumFunctionAttribute::WILL_RETURN;
+        }
+
+        for (auto* function : component)
+        {
+            for (const auto attribute : { EnumFunctionAttribute::READ_NONE, EnumFunctionAttribute::READ_ONLY,
+                                          EnumFunctionAttribute::NO_UNWIND, EnumFunctionAttribute::WILL_RETURN })
+            {
+                if ((attributes & attribute) != 0 && !function->hasAttribute(attribute))
+                {
+                    function->setAttribute(attribute);
+                    ++inferredCount;
+                }
+            }
+        }
+    }
+}
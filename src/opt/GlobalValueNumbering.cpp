@@ -0,0 +1,348 @@
+/**
+ * Dominator scoped value numbering (common subexpression elimination).
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/GlobalValueNumbering.h>
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/Dominators.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    namespace
+    {
+        // What makes two pure instructions compute the same value.
+        struct ExpressionKey
+        {
+            EnumOpcode opcode;
+            EnumCmpPredicate predicate;
+            Type* type;
+            Type* auxType;
+            std::vector<Value*> operands;
+
+            bool operator== (const ExpressionKey& other) const CMM_NOEXCEPT
+            {
+                return opcode == other.opcode && predicate == other.predicate && type == other.type
+                    && auxType == other.auxType && operands == other.operands;
+            }
+        };
+
+        struct ExpressionKeyHash
+        {
+            std::size_t operator() (const ExpressionKey& key) const CMM_NOEXCEPT
+            {
+                std::size_t hash = static_cast<std::size_t>(key.opcode) ^ (static_cast<std::size_t>(key.predicate) << 8);
+                hash = hash * 31 + std::hash<const Type*>()(key.type);
+
+                for (const auto* operand : key.operands)
+                {
+                    hash = hash * 31 + std::hash<const Value*>()(operand);
+                }
+
+                return hash;
+            }
+        };
+
+        // A load is keyed by its address and loaded type.
+        using LoadKey = std::pair<const Value*, const Type*>;
+
+        struct LoadKeyHash
+        {
+            std::size_t operator() (const LoadKey& key) const CMM_NOEXCEPT
+            {
+                return std::hash<const Value*>()(key.first) * 31 + std::hash<const Type*>()(key.second);
+            }
+        };
+
+        // The value known to be in memory, valid while the memory generation is unchanged.
+        struct AvailableLoad
+        {
+            Value* value;
+            u32 generation;
+        };
+
+        // A hash table whose changes can be rolled back when leaving a dominator tree scope.
+        template<class Key, class T, class Hash>
+        class ScopedTable
+        {
+        public:
+
+            T* find(const Key& key)
+            {
+                auto findResult = table.find(key);
+                return findResult != table.end() ? &findResult->second : nullptr;
+            }
+
+            void insert(const Key& key, T value)
+            {
+                auto findResult = table.find(key);
+                undo.emplace_back(key, findResult != table.end() ? std::optional<T>(findResult->second) : std::nullopt);
+                table.insert_or_assign(key, std::move(value));
+            }
+
+            template<class Predicate>
+            void eraseIf(Predicate predicate)
+            {
+                for (auto iter = table.begin(); iter != table.end();)
+                {
+                    if (predicate(iter->first))
+                    {
+                        undo.emplace_back(iter->first, std::optional<T>(iter->second));
+                        iter = table.erase(iter);
+                    }
+
+                    else
+                    {
+                        ++iter;
+                    }
+                }
+            }
+
+            std::size_t mark() const CMM_NOEXCEPT
+            {
+                return undo.size();
+            }
+
+            void rollback(const std::size_t mark)
+            {
+                while (undo.size() > mark)
+                {
+                    auto& [key, previous] = undo.back();
+
+                    if (previous.has_value())
+                    {
+                        table.insert_or_assign(key, std::move(*previous));
+                    }
+
+                    else
+                    {
+                        table.erase(key);
+                    }
+
+                    undo.pop_back();
+                }
+            }
+
+        private:
+
+            std::unordered_map<Key, T, Hash> table;
+            std::vector<std::pair<Key, std::optional<T>>> undo;
+        };
+
+        // A dominator tree node being walked.
+        struct Scope
+        {
+            BasicBlock* block;
+            std::size_t expressionMark;
+            std::size_t loadMark;
+            u32 generation;
+            std::size_t nextChild;
+        };
+
+        bool isPureExpression(const Instruction& instruction) CMM_NOEXCEPT
+        {
+            // A readnone call only depends on its arguments.
+            return instruction.isBinaryOp() || instruction.isCast() || instruction.isCompare()
+                || instruction.getOpcode() == EnumOpcode::FNEG || instruction.getOpcode() == EnumOpcode::GET_ELEMENT_PTR
+                || instruction.getOpcode() == EnumOpcode::SELECT || instruction.getOpcode() == EnumOpcode::PHI
+                || (instruction.getOpcode() == EnumOpcode::CALL && instruction.getCalledFunction()->hasAttribute(EnumFunctionAttribute::READ_NONE));
+        }
+
+        ExpressionKey makeKey(const Instruction& instruction)
+        {
+            ExpressionKey key { instruction.getOpcode(), EnumCmpPredicate::EQ, instruction.getType(), nullptr, instruction.getOperands() };
+
+            if (instruction.getOpcode() == EnumOpcode::GET_ELEMENT_PTR)
+            {
+                key.auxType = instruction.getAuxType();
+            }
+
+            else if (instruction.isCompare())
+            {
+                key.predicate = instruction.getPredicate();
+
+                // a < b and b > a are the same comparison.
+                if (std::less<const Value*>()(key.operands[1], key.operands[0]))
+                {
+                    std::swap(key.operands[0], key.operands[1]);
+                    key.predicate = getSwappedPredicate(key.predicate);
+                }
+            }
+
+            else if (instruction.isCommutative() && std::less<const Value*>()(key.operands[1], key.operands[0]))
+            {
+                std::swap(key.operands[0], key.operands[1]);
+            }
+
+            return key;
+        }
+    }
+
+    GlobalValueNumbering::GlobalValueNumbering() CMM_NOEXCEPT : eliminatedCount(0), eliminatedLoadCount(0)
+    {
+    }
+
+    bool GlobalValueNumbering::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& function : module.getFunctions())
+        {
+            changed |= run(*function);
+        }
+
+        return changed;
+    }
+
+    bool GlobalValueNumbering::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        const DominatorTree dominators(function);
+        return run(function, dominators);
+    }
+
+    bool GlobalValueNumbering::run(Function& function, const DominatorTree& dominators)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        const AliasAnalysis aliasAnalysis(function);
+        return run(function, dominators, aliasAnalysis);
+    }
+
+    bool GlobalValueNumbering::run(Function& function, const DominatorTree& dominators, const AliasAnalysis& aliasAnalysis)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        const std::size_t before = eliminatedCount + eliminatedLoadCount;
+
+        ScopedTable<ExpressionKey, Instruction*, ExpressionKeyHash> expressions;
+        ScopedTable<LoadKey, AvailableLoad, LoadKeyHash> loads;
+
+        // A join of paths may change memory behind our back: each one starts a new generation,
+        // invalidating every load recorded before it.
+        u32 lastGeneration = 0;
+        std::vector<Scope> stack;
+        stack.push_back({ function.getEntryBlock(), 0, 0, lastGeneration, 0 });
+
+        while (!stack.empty())
+        {
+            auto& scope = stack.back();
+
+            if (scope.nextChild == 0)
+            {
+                scope.expressionMark = expressions.mark();
+                scope.loadMark = loads.mark();
+
+                for (auto iter = scope.block->begin(); iter != scope.block->end();)
+                {
+                    auto* instruction = (iter++)->get();
+                    const auto opcode = instruction->getOpcode();
+
+                    if (isPureExpression(*instruction))
+                    {
+                        const auto key = makeKey(*instruction);
+                        auto** available = expressions.find(key);
+
+                        if (available == nullptr)
+                        {
+                            expressions.insert(key, instruction);
+                            continue;
+                        }
+
+                        // The kept instruction may only promise what both did (nsw, inbounds...).
+                        (*available)->setFlag(static_cast<EnumInstructionFlag>(~instruction->getFlags() & 0xFF), false);
+                        instruction->replaceAllUsesWith(*available);
+                        instruction->eraseFromParent();
+                        ++eliminatedCount;
+                    }
+
+                    else if (opcode == EnumOpcode::LOAD)
+                    {
+                        const LoadKey key { instruction->getOperand(0), instruction->getType() };
+                        auto* available = loads.find(key);
+
+                        if (available == nullptr || available->generation != scope.generation)
+                        {
+                            loads.insert(key, { instruction, scope.generation });
+                            continue;
+                        }
+
+                        instruction->replaceAllUsesWith(available->value);
+                        instruction->eraseFromParent();
+                        ++eliminatedLoadCount;
+                    }
+
+                    else if (opcode == EnumOpcode::STORE)
+                    {
+                        auto* value = instruction->getOperand(0);
+                        auto* pointer = instruction->getOperand(1);
+
+                        loads.eraseIf([&aliasAnalysis, pointer](const LoadKey& key) { return aliasAnalysis.mayAlias(key.first, pointer); });
+                        loads.insert({ pointer, value->getType() }, { value, scope.generation });
+                    }
+
+                    else if (opcode == EnumOpcode::CALL && instruction->mayWriteMemory())
+                    {
+                        // Locals whose address is never taken are out of the callee's reach.
+                        loads.eraseIf([&aliasAnalysis, instruction](const LoadKey& key) { return aliasAnalysis.mayAccess(*instruction, key.first); });
+                    }
+
+                    else if (instruction->mayWriteMemory())
+                    {
+                        scope.generation = ++lastGeneration;
+                    }
+                }
+            }
+
+            const auto& children = dominators.getChildren(scope.block);
+
+            if (scope.nextChild < children.size())
+            {
+                auto* child = children[scope.nextChild++];
+
+                // Memory only carries over to a block entered solely from this one.
+                const u32 generation = child->getSinglePredecessor() == scope.block ? scope.generation : ++lastGeneration;
+                stack.push_back({ child, 0, 0, generation, 0 });
+                continue;
+            }
+
+            expressions.rollback(scope.expressionMark);
+            loads.rollback(scope.loadMark);
+            stack.pop_back();
+        }
+
+        return eliminatedCount + eliminatedLoadCount != before;
+    }
+
+    std::size_t GlobalValueNumbering::getEliminatedCount() const CMM_NOEXCEPT
+    {
+        return eliminatedCount;
+    }
+
+    std::size_t GlobalValueNumbering::getEliminatedLoadCount() const CMM_NOEXCEPT
+    {
+        return eliminatedLoadCount;
+    }
+}
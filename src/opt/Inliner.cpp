@@ -0,0 +1,211 @@
+/**
+ * Inlines calls to small and single call site functions.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/Inliner.h>
+#include <cmm/ir/CallGraph.h>
+#include <cmm/ir/IRBuilder.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <unordered_map>
+#include <utility>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    Inliner::Inliner(const std::size_t threshold) CMM_NOEXCEPT : threshold(threshold), inlinedCount(0)
+    {
+    }
+
+    bool Inliner::run(Module& module)
+    {
+        const CallGraph callGraph(module);
+        return run(module, callGraph);
+    }
+
+    bool Inliner::run(Module& module, const CallGraph& callGraph)
+    {
+        const std::size_t before = inlinedCount;
+
+        for (auto* function : callGraph.getBottomUpOrder())
+        {
+            // Copied since inlining erases the calls as it goes.
+            const auto calls = callGraph.getCalls(function);
+
+            for (auto* call : calls)
+            {
+                if (shouldInline(callGraph, call))
+                {
+                    inlineCall(call);
+                    ++inlinedCount;
+                }
+            }
+        }
+
+        return inlinedCount != before;
+    }
+
+    /* static */
+    void Inliner::inlineCall(Instruction* call)
+    {
+        auto* block = call->getParent();
+        auto* caller = block->getParent();
+        auto* callee = call->getCalledFunction();
+        auto& module = *caller->getParent();
+        IRBuilder builder(module);
+
+        // Split the block after the call; what follows becomes the merge block returns go to.
+        auto* exit = caller->insertBlockAfter(block, std::make_unique<BasicBlock>(module.getTypes().getLabel(), callee->getName() + ".exit"));
+        Instruction* next = nullptr;
+
+        for (auto iter = block->begin(); iter != block->end(); ++iter)
+        {
+            if (iter->get() == call)
+            {
+                next = std::next(iter)->get();
+                break;
+            }
+        }
+
+        block->spliceInto(next, exit);
+
+        for (auto* succ : exit->getSuccessors())
+        {
+            for (auto& instruction : *succ)
+            {
+                if (instruction->getOpcode() != EnumOpcode::PHI)
+                {
+                    break;
+                }
+
+                instruction->replaceUsesOfWith(block, exit);
+            }
+        }
+
+        // Copy the callee's blocks, renaming as we go: parameters become the call's arguments
+        // and every block and local refers to its own copy.
+        std::unordered_map<const Value*, Value*> valueMap;
+        std::vector<Instruction*> copies;
+        BasicBlock* position = block;
+
+        for (std::size_t i = 0; i < callee->argSize(); ++i)
+        {
+            valueMap[callee->getArg(i)] = call->getOperand(i + 1);
+        }
+
+        for (const auto& calleeBlock : *callee)
+        {
+            const std::string name = calleeBlock->hasName() ? callee->getName() + "." + calleeBlock->getName() : callee->getName();
+            position = caller->insertBlockAfter(position, std::make_unique<BasicBlock>(module.getTypes().getLabel(), name));
+            valueMap[calleeBlock.get()] = position;
+
+            for (const auto& instruction : *calleeBlock)
+            {
+                auto* copy = position->append(instruction->clone());
+
+                // A tail call in the callee isn't one in the caller, whose locals it may use.
+                copy->setFlag(EnumInstructionFlag::TAIL, false);
+                copy->setFlag(EnumInstructionFlag::MUST_TAIL, false);
+
+                valueMap[instruction.get()] = copy;
+                copies.push_back(copy);
+            }
+        }
+
+        std::vector<std::pair<Value*, BasicBlock*>> returns;
+
+        for (auto* copy : copies)
+        {
+            for (std::size_t i = 0; i < copy->getNumOperands(); ++i)
+            {
+                const auto findResult = valueMap.find(copy->getOperand(i));
+
+                if (findResult != valueMap.cend())
+                {
+                    copy->setOperand(i, findResult->second);
+                }
+            }
+
+            if (copy->getOpcode() == EnumOpcode::RET)
+            {
+                returns.emplace_back(copy->getNumOperands() > 0 ? copy->getOperand(0) : nullptr, copy->getParent());
+                builder.setInsertPoint(copy);
+                builder.createBr(exit);
+                copy->eraseFromParent();
+            }
+        }
+
+        if (call->hasUses())
+        {
+            Value* result;
+
+            if (returns.empty())
+            {
+                result = module.getUndef(call->getType());
+            }
+
+            else if (returns.size() == 1)
+            {
+                result = returns.front().first;
+            }
+
+            else
+            {
+                builder.setInsertPoint(exit->front());
+                auto* phi = builder.createPhi(call->getType(), call->getName());
+
+                for (const auto& [value, returnBlock] : returns)
+                {
+                    phi->addIncoming(value, returnBlock);
+                }
+
+                result = phi;
+            }
+
+            call->replaceAllUsesWith(result);
+        }
+
+        auto* calleeEntry = static_cast<BasicBlock*>(valueMap[callee->getEntryBlock()]);
+        builder.setInsertPoint(call);
+        builder.createBr(calleeEntry);
+        call->eraseFromParent();
+
+        // The callee's stack slots belong in the caller's entry block, so they are allocated
+        // once (and can still be promoted) even if the call was in a loop.
+        auto* callerEntry = caller->getEntryBlock();
+        auto* firstInstruction = callerEntry->front();
+
+        for (auto iter = calleeEntry->begin(); iter != calleeEntry->end();)
+        {
+            auto* instruction = (iter++)->get();
+
+            if (instruction->getOpcode() == EnumOpcode::ALLOCA)
+            {
+                instruction->moveBefore(firstInstruction);
+            }
+        }
+    }
+
+    std::size_t Inliner::getInlinedCount() const CMM_NOEXCEPT
+    {
+        return inlinedCount;
+    }
+
+    bool Inliner::shouldInline(const CallGraph& callGraph, const Instruction* call) const
+    {
+        const auto* callee = call->getCalledFunction();
+
+        if (callee->isDeclaration() || callGraph.isRecursive(callee))
+        {
+            return false;
+        }
+
+        return callee->getInstructionCount() <= threshold || callGraph.getCallSites(callee).size() == 1;
+    }
+}
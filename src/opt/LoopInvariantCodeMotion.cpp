@@ -0,0 +1,215 @@
+/**
+ * Loop invariant code motion.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/LoopInvariantCodeMotion.h>
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/Dominators.h>
+#include <cmm/ir/LoopInfo.h>
+#include <cmm/ir/Module.h>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    /**
+     * Gets whether an instruction runs whenever its loop is entered, i.e. it is in the
+     * header with no call that might not return before it.
+     *
+     * @param loop the Loop.
+     * @param instruction the Instruction.
+     * @return bool.
+     */
+    static bool isGuaranteedToExecute(const Loop& loop, const Instruction& instruction)
+    {
+        if (instruction.getParent() != loop.getHeader())
+        {
+            return false;
+        }
+
+        for (const auto& other : *loop.getHeader())
+        {
+            if (other.get() == &instruction)
+            {
+                return true;
+            }
+
+            else if (other->getOpcode() == EnumOpcode::CALL && !other->getCalledFunction()->hasAttribute(EnumFunctionAttribute::WILL_RETURN))
+            {
+                return false;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Gets whether a division or remainder can never trap.
+     *
+     * @param instruction the Instruction.
+     * @return bool.
+     */
+    static bool isSafeDivision(const Instruction& instruction) CMM_NOEXCEPT
+    {
+        const auto* divisor = instruction.getOperand(1);
+
+        if (divisor->getKind() != EnumValueKind::CONSTANT_INT || static_cast<const ConstantInt*>(divisor)->isZero())
+        {
+            return false;
+        }
+
+        // INT_MIN / -1 overflows.
+        const auto opcode = instruction.getOpcode();
+        return opcode == EnumOpcode::UDIV || opcode == EnumOpcode::UREM || !static_cast<const ConstantInt*>(divisor)->isAllOnes();
+    }
+
+    LoopInvariantCodeMotion::LoopInvariantCodeMotion() CMM_NOEXCEPT : hoistedCount(0)
+    {
+    }
+
+    bool LoopInvariantCodeMotion::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& function : module.getFunctions())
+        {
+            changed |= run(*function);
+        }
+
+        return changed;
+    }
+
+    bool LoopInvariantCodeMotion::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        const DominatorTree dominators(function);
+        LoopInfo loopInfo(dominators);
+
+        return run(function, loopInfo);
+    }
+
+    bool LoopInvariantCodeMotion::run(Function& function, LoopInfo& loopInfo)
+    {
+        if (function.isDeclaration() || loopInfo.empty())
+        {
+            return false;
+        }
+
+        const AliasAnalysis aliasAnalysis(function);
+        return run(function, loopInfo, aliasAnalysis);
+    }
+
+    bool LoopInvariantCodeMotion::run(Function& function, LoopInfo& loopInfo, const AliasAnalysis& aliasAnalysis)
+    {
+        if (function.isDeclaration() || loopInfo.empty())
+        {
+            return false;
+        }
+
+        const std::size_t before = hoistedCount;
+
+        for (auto* loop : loopInfo.getLoopsInnermostFirst())
+        {
+            auto* preheader = loopInfo.insertPreheader(loop);
+
+            if (preheader == nullptr)
+            {
+                continue;
+            }
+
+            std::vector<const Instruction*> clobbers;
+
+            for (const auto* block : loop->getBlocks())
+            {
+                for (const auto& instruction : *block)
+                {
+                    if (instruction->mayWriteMemory())
+                    {
+                        clobbers.push_back(instruction.get());
+                    }
+                }
+            }
+
+            // Reverse post order visits operands before their users, so whole invariant
+            // expressions move in one sweep.
+            auto* position = preheader->getTerminator();
+
+            for (auto* block : loop->getBlocks())
+            {
+                for (auto iter = block->begin(); iter != block->end();)
+                {
+                    auto* instruction = (iter++)->get();
+
+                    if (canHoist(*loop, *instruction, clobbers, aliasAnalysis))
+                    {
+                        instruction->moveBefore(position);
+                        ++hoistedCount;
+                    }
+                }
+            }
+        }
+
+        return hoistedCount != before;
+    }
+
+    std::size_t LoopInvariantCodeMotion::getHoistedCount() const CMM_NOEXCEPT
+    {
+        return hoistedCount;
+    }
+
+    /* static */
+    bool LoopInvariantCodeMotion::canHoist(const Loop& loop, const Instruction& instruction,
+                                           const std::vector<const Instruction*>& clobbers, const AliasAnalysis& aliasAnalysis)
+    {
+        for (const auto* operand : instruction.getOperands())
+        {
+            if (!loop.isLoopInvariant(operand))
+            {
+                return false;
+            }
+        }
+
+        switch (instruction.getOpcode())
+        {
+        case EnumOpcode::LOAD:
+        {
+            const auto* pointer = instruction.getOperand(0);
+
+            for (const auto* clobber : clobbers)
+            {
+                if (aliasAnalysis.mayAccess(*clobber, pointer))
+                {
+                    return false;
+                }
+            }
+
+            // Hoisting runs the load even when the loop doesn't, so it must not be able to trap.
+            return isDereferenceablePointer(pointer) || isGuaranteedToExecute(loop, instruction);
+        }
+        case EnumOpcode::SDIV:
+            // fallthrough
+        case EnumOpcode::UDIV:
+            // fallthrough
+        case EnumOpcode::SREM:
+            // fallthrough
+        case EnumOpcode::UREM:
+            return isSafeDivision(instruction) || isGuaranteedToExecute(loop, instruction);
+        case EnumOpcode::FNEG:
+            // fallthrough
+        case EnumOpcode::GET_ELEMENT_PTR:
+            // fallthrough
+        case EnumOpcode::SELECT:
+            return true;
+        default:
+            return instruction.isBinaryOp() || instruction.isCast() || instruction.isCompare();
+        }
+    }
+}
@@ -0,0 +1,194 @@
+/**
+ * Induction variable strength reduction.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/LoopStrengthReduction.h>
+#include <cmm/ir/ConstantFold.h>
+#include <cmm/ir/Dominators.h>
+#include <cmm/ir/IRBuilder.h>
+#include <cmm/ir/LoopInfo.h>
+#include <cmm/ir/Module.h>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    /**
+     * Creates a binary operator at the builder's insertion point, unless it folds.
+     *
+     * @param builder the IRBuilder.
+     * @param opcode the EnumOpcode.
+     * @param left the left Value.
+     * @param right the right Value.
+     * @return pointer to the Value.
+     */
+    static Value* createFoldedBinary(IRBuilder& builder, const EnumOpcode opcode, Value* left, Value* right)
+    {
+        if (isFoldableConstant(left) && isFoldableConstant(right))
+        {
+            if (auto* folded = foldBinary(builder.getModule(), opcode, left, right); folded != nullptr)
+            {
+                return folded;
+            }
+        }
+
+        return builder.createBinary(opcode, left, right);
+    }
+
+    LoopStrengthReduction::LoopStrengthReduction() CMM_NOEXCEPT : reducedCount(0)
+    {
+    }
+
+    bool LoopStrengthReduction::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& function : module.getFunctions())
+        {
+            changed |= run(*function);
+        }
+
+        return changed;
+    }
+
+    bool LoopStrengthReduction::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        const DominatorTree dominators(function);
+        const LoopInfo loopInfo(dominators);
+
+        return run(function, loopInfo);
+    }
+
+    bool LoopStrengthReduction::run(Function& function, const LoopInfo& loopInfo)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        const std::size_t before = reducedCount;
+
+        for (auto* loop : loopInfo.getLoopsInnermostFirst())
+        {
+            reduce(*loop);
+        }
+
+        return reducedCount != before;
+    }
+
+    std::size_t LoopStrengthReduction::getReducedCount() const CMM_NOEXCEPT
+    {
+        return reducedCount;
+    }
+
+    void LoopStrengthReduction::reduce(Loop& loop)
+    {
+        auto* header = loop.getHeader();
+        auto* preheader = loop.getPreheader();
+        auto* latch = loop.getLatch();
+
+        if (preheader == nullptr || latch == nullptr)
+        {
+            return;
+        }
+
+        // Collected first since reducing adds phis to the header.
+        std::vector<Instruction*> phis;
+
+        for (auto& instruction : *header)
+        {
+            if (instruction->getOpcode() != EnumOpcode::PHI)
+            {
+                break;
+            }
+
+            else if (instruction->getType()->isInt() && instruction->getNumIncoming() == 2)
+            {
+                phis.push_back(instruction.get());
+            }
+        }
+
+        IRBuilder builder(*header->getParent()->getParent());
+
+        for (auto* phi : phis)
+        {
+            // A basic induction variable: i = phi [ init, preheader ], [ i +/- step, latch ].
+            auto* init = phi->getIncomingValueForBlock(preheader);
+            auto* next = phi->getIncomingValueForBlock(latch);
+
+            if (init == nullptr || next == nullptr || next->getKind() != EnumValueKind::INSTRUCTION)
+            {
+                continue;
+            }
+
+            auto* increment = static_cast<Instruction*>(next);
+            const auto opcode = increment->getOpcode();
+            Value* step = nullptr;
+
+            if (opcode == EnumOpcode::ADD && increment->getOperand(0) == phi)
+            {
+                step = increment->getOperand(1);
+            }
+
+            else if (opcode == EnumOpcode::ADD && increment->getOperand(1) == phi)
+            {
+                step = increment->getOperand(0);
+            }
+
+            else if (opcode == EnumOpcode::SUB && increment->getOperand(0) == phi)
+            {
+                step = increment->getOperand(1);
+            }
+
+            if (step == nullptr || !loop.isLoopInvariant(step))
+            {
+                continue;
+            }
+
+            // Copied since reducing erases users.
+            const auto users = phi->getUsers();
+
+            for (auto* user : users)
+            {
+                if (user->getOpcode() != EnumOpcode::MUL || !loop.contains(user))
+                {
+                    continue;
+                }
+
+                auto* factor = user->getOperand(0) == phi ? user->getOperand(1) : user->getOperand(0);
+
+                if (factor == phi || !loop.isLoopInvariant(factor))
+                {
+                    continue;
+                }
+
+                // i * c == init * c + k * (step * c), wrapping included.
+                builder.setInsertPoint(preheader->getTerminator());
+                auto* start = createFoldedBinary(builder, EnumOpcode::MUL, init, factor);
+                auto* stride = createFoldedBinary(builder, EnumOpcode::MUL, step, factor);
+
+                builder.setInsertPoint(header->front());
+                auto* scaled = builder.createPhi(phi->getType(), user->getName());
+
+                builder.setInsertPoint(latch->getTerminator());
+                auto* scaledNext = builder.createBinary(opcode, scaled, stride);
+
+                scaled->addIncoming(start, preheader);
+                scaled->addIncoming(scaledNext, latch);
+
+                user->replaceAllUsesWith(scaled);
+                user->eraseFromParent();
+                ++reducedCount;
+            }
+        }
+    }
+}
@@ -0,0 +1,857 @@
+/**
+ * Loop vectorization.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/LoopVectorize.h>
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/ConstantFold.h>
+#include <cmm/ir/Dominators.h>
+#include <cmm/ir/IRBuilder.h>
+#include <cmm/ir/LoopInfo.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    namespace
+    {
+        // A reduction: r = phi [ init, preheader ], [ r op x, latch ].
+        struct Reduction
+        {
+            Instruction* phi;
+            Instruction* update;
+        };
+
+        // What the analysis found out about a vectorizable loop.
+        struct CountedLoop
+        {
+            BasicBlock* preheader;
+            BasicBlock* header;
+            BasicBlock* latch;
+
+            // i = phi [ start, preheader ], [ i + 1, latch ] while i < bound.
+            Instruction* inductionVariable;
+            Instruction* increment;
+            Value* start;
+            Value* bound;
+
+            std::vector<Reduction> reductions;
+
+            // The sext(i) used as the last index of the addresses.
+            std::unordered_set<const Instruction*> indices;
+
+            // The addresses (GEPs) of the i-th elements loaded or stored.
+            std::vector<Instruction*> addresses;
+
+            // The pairs of addresses into memory that may overlap, checked at run time.
+            std::vector<std::pair<Instruction*, Instruction*>> overlapChecks;
+
+            // The size of the widest element in bits (fixes the number of lanes).
+            u32 widestBits;
+        };
+    }
+
+    /**
+     * Gets whether a type can be the element type of a vector.
+     *
+     * @param type the Type.
+     * @return bool.
+     */
+    static bool isVectorElementType(const Type* type) CMM_NOEXCEPT
+    {
+        return (type->isInt() && type->getBits() >= 8 && type->getBits() <= 64) || type->isFloatingPoint();
+    }
+
+    /**
+     * Gets the identity value of a reduction's operator, i.e. the initial value of the
+     * lanes other than the first.
+     *
+     * @param module the Module.
+     * @param opcode the EnumOpcode of the reduction.
+     * @param type the int Type.
+     * @return pointer to the ConstantInt.
+     */
+    static ConstantInt* getIdentity(Module& module, const EnumOpcode opcode, Type* type)
+    {
+        switch (opcode)
+        {
+        case EnumOpcode::MUL:
+            return module.getConstantInt(type, 1);
+        case EnumOpcode::AND:
+            return module.getConstantInt(type, -1);
+        default:
+            // ADD, OR and XOR.
+            return module.getConstantInt(type, 0);
+        }
+    }
+
+    /**
+     * Gets whether two addresses walk the same elements, i.e. only differ by their last
+     * index (both sext(i)).
+     *
+     * @param first the first GEP.
+     * @param second the second GEP.
+     * @return bool.
+     */
+    static bool isSameStream(const Instruction* first, const Instruction* second)
+    {
+        const auto& firstOperands = first->getOperands();
+        const auto& secondOperands = second->getOperands();
+
+        return first->getAuxType() == second->getAuxType() && firstOperands.size() == secondOperands.size()
+            && std::equal(firstOperands.cbegin(), firstOperands.cend() - 1, secondOperands.cbegin());
+    }
+
+    /**
+     * Creates a binary operator at the builder's insertion point, unless it folds.
+     *
+     * @param builder the IRBuilder.
+     * @param opcode the EnumOpcode.
+     * @param left the left Value.
+     * @param right the right Value.
+     * @return pointer to the Value.
+     */
+    static Value* createFoldedBinary(IRBuilder& builder, const EnumOpcode opcode, Value* left, Value* right)
+    {
+        if (isFoldableConstant(left) && isFoldableConstant(right))
+        {
+            if (auto* folded = foldBinary(builder.getModule(), opcode, left, right); folded != nullptr)
+            {
+                return folded;
+            }
+        }
+
+        return builder.createBinary(opcode, left, right);
+    }
+
+    /**
+     * Creates a cast at the builder's insertion point, unless it folds.
+     *
+     * @param builder the IRBuilder.
+     * @param opcode the EnumOpcode.
+     * @param value the Value to cast.
+     * @param type the Type to cast to.
+     * @return pointer to the Value.
+     */
+    static Value* createFoldedCast(IRBuilder& builder, const EnumOpcode opcode, Value* value, Type* type)
+    {
+        if (isFoldableConstant(value))
+        {
+            if (auto* folded = foldCast(builder.getModule(), opcode, value, type); folded != nullptr)
+            {
+                return folded;
+            }
+        }
+
+        return builder.createCast(opcode, value, type);
+    }
+
+    /**
+     * Finds out whether an instruction of the loop body can be done lane by lane, and
+     * adds it to the instructions that will be.
+     *
+     * @param loop the Loop.
+     * @param counted the CountedLoop found so far.
+     * @param widened the instructions of the body done lane by lane so far.
+     * @param instruction the Instruction.
+     * @return bool.
+     */
+    static bool canWiden(const Loop& loop, CountedLoop& counted, std::unordered_set<const Value*>& widened, Instruction& instruction)
+    {
+        // Operands are either done lane by lane as well or the same for every lane.
+        const auto isWidenable = [&](const Value* operand)
+        {
+            return widened.find(operand) != widened.cend() || loop.isLoopInvariant(operand);
+        };
+
+        const auto opcode = instruction.getOpcode();
+        auto* type = instruction.getType();
+
+        switch (opcode)
+        {
+        case EnumOpcode::GET_ELEMENT_PTR:
+        {
+            // getelementptr T, T* base, sext(i) or getelementptr [N x T], [N x T]* base, 0, sext(i).
+            const auto& operands = instruction.getOperands();
+            const auto* last = operands.back();
+
+            if (operands.size() < 2 || last->getKind() != EnumValueKind::INSTRUCTION
+                || counted.indices.find(static_cast<const Instruction*>(last)) == counted.indices.cend()
+                || !isVectorElementType(type->getElementType())
+                || !std::all_of(operands.cbegin(), operands.cend() - 1, [&](const Value* operand) { return loop.isLoopInvariant(operand); }))
+            {
+                return false;
+            }
+
+            // Only the elements themselves are accessed, the address doesn't go anywhere else.
+            for (const auto* user : instruction.getUsers())
+            {
+                if (!(user->getOpcode() == EnumOpcode::LOAD
+                    || (user->getOpcode() == EnumOpcode::STORE && user->getOperand(1) == &instruction && user->getOperand(0) != &instruction)))
+                {
+                    return false;
+                }
+            }
+
+            counted.addresses.push_back(&instruction);
+            return true;
+        }
+        case EnumOpcode::LOAD:
+        {
+            const auto* address = instruction.getOperand(0);
+
+            if (std::find(counted.addresses.cbegin(), counted.addresses.cend(), address) == counted.addresses.cend())
+            {
+                return false;
+            }
+
+            counted.widestBits = std::max(counted.widestBits, static_cast<u32>(type->getSizeInBytes() * 8));
+        }
+            break;
+        case EnumOpcode::STORE:
+        {
+            const auto* value = instruction.getOperand(0);
+            const auto* address = instruction.getOperand(1);
+
+            if (std::find(counted.addresses.cbegin(), counted.addresses.cend(), address) == counted.addresses.cend() || !isWidenable(value))
+            {
+                return false;
+            }
+
+            counted.widestBits = std::max(counted.widestBits, static_cast<u32>(value->getType()->getSizeInBytes() * 8));
+        }
+            return true;
+        case EnumOpcode::ADD:
+        case EnumOpcode::SUB:
+        case EnumOpcode::MUL:
+        case EnumOpcode::SHL:
+        case EnumOpcode::LSHR:
+        case EnumOpcode::ASHR:
+        case EnumOpcode::AND:
+        case EnumOpcode::OR:
+        case EnumOpcode::XOR:
+        case EnumOpcode::FADD:
+        case EnumOpcode::FSUB:
+        case EnumOpcode::FMUL:
+        case EnumOpcode::FDIV:
+        {
+            // A reduction's update combines the lanes of the reduction with the new values.
+            const bool isReduction = std::any_of(counted.reductions.cbegin(), counted.reductions.cend(),
+                [&](const Reduction& reduction) { return reduction.update == &instruction; });
+
+            for (const auto* operand : instruction.getOperands())
+            {
+                const bool isReductionPhi = isReduction && operand->getKind() == EnumValueKind::INSTRUCTION
+                    && static_cast<const Instruction*>(operand)->getOpcode() == EnumOpcode::PHI;
+
+                if (!isReductionPhi && !isWidenable(operand))
+                {
+                    return false;
+                }
+            }
+        }
+            break;
+        case EnumOpcode::FNEG:
+            // fallthrough
+        case EnumOpcode::TRUNC:
+            // fallthrough
+        case EnumOpcode::ZEXT:
+            // fallthrough
+        case EnumOpcode::SEXT:
+            // fallthrough
+        case EnumOpcode::FP_TRUNC:
+            // fallthrough
+        case EnumOpcode::FP_EXT:
+            // fallthrough
+        case EnumOpcode::FP_TO_SI:
+            // fallthrough
+        case EnumOpcode::FP_TO_UI:
+            // fallthrough
+        case EnumOpcode::SI_TO_FP:
+            // fallthrough
+        case EnumOpcode::UI_TO_FP:
+            if (!isVectorElementType(instruction.getOperand(0)->getType()) || !isWidenable(instruction.getOperand(0)))
+            {
+                return false;
+            }
+
+            counted.widestBits = std::max(counted.widestBits, static_cast<u32>(instruction.getOperand(0)->getType()->getSizeInBytes() * 8));
+            break;
+        default:
+            return false;
+        }
+
+        if (!isVectorElementType(type))
+        {
+            return false;
+        }
+
+        counted.widestBits = std::max(counted.widestBits, static_cast<u32>(type->getSizeInBytes() * 8));
+        widened.insert(&instruction);
+
+        return true;
+    }
+
+    /**
+     * Finds out whether a loop is a counted loop whose body can be done lane by lane.
+     *
+     * @param loop the innermost Loop.
+     * @param aliasAnalysis the AliasAnalysis of the function.
+     * @param counted the CountedLoop to fill in.
+     * @return bool.
+     */
+    static bool analyze(const Loop& loop, const AliasAnalysis& aliasAnalysis, CountedLoop& counted)
+    {
+        // A header testing the condition and a single block body branching back to it.
+        auto* header = loop.getHeader();
+        auto* preheader = loop.getPreheader();
+        auto* latch = loop.getLatch();
+
+        if (!loop.getSubLoops().empty() || preheader == nullptr || latch == nullptr || latch == header || loop.getBlocks().size() != 2)
+        {
+            return false;
+        }
+
+        auto* branch = header->getTerminator();
+
+        if (branch == nullptr || branch->getOpcode() != EnumOpcode::COND_BR || branch->getOperand(1) != latch
+            || branch->getOperand(0)->getKind() != EnumValueKind::INSTRUCTION)
+        {
+            return false;
+        }
+
+        // while (i < bound), with i the only user of the comparison.
+        auto* compare = static_cast<Instruction*>(branch->getOperand(0));
+
+        if (compare->getOpcode() != EnumOpcode::ICMP || compare->getPredicate() != EnumCmpPredicate::SLT || compare->getParent() != header
+            || compare->getUsers().size() != 1 || compare->getOperand(0)->getKind() != EnumValueKind::INSTRUCTION
+            || !loop.isLoopInvariant(compare->getOperand(1)))
+        {
+            return false;
+        }
+
+        counted.preheader = preheader;
+        counted.header = header;
+        counted.latch = latch;
+        counted.inductionVariable = static_cast<Instruction*>(compare->getOperand(0));
+        counted.increment = nullptr;
+        counted.start = nullptr;
+        counted.bound = compare->getOperand(1);
+        counted.widestBits = 0;
+
+        auto* inductionVariable = counted.inductionVariable;
+
+        if (inductionVariable->getOpcode() != EnumOpcode::PHI || inductionVariable->getParent() != header || !inductionVariable->getType()->isInt(32))
+        {
+            return false;
+        }
+
+        // Every phi is either the induction variable or a reduction.
+        for (auto& instruction : *header)
+        {
+            auto* phi = instruction.get();
+
+            if (phi == compare || phi == branch)
+            {
+                continue;
+            }
+
+            else if (phi->getOpcode() != EnumOpcode::PHI || phi->getNumIncoming() != 2)
+            {
+                return false;
+            }
+
+            auto* init = phi->getIncomingValueForBlock(preheader);
+            auto* next = phi->getIncomingValueForBlock(latch);
+
+            if (init == nullptr || next == nullptr || next->getKind() != EnumValueKind::INSTRUCTION
+                || static_cast<Instruction*>(next)->getParent() != latch || next->getUsers().size() != 1)
+            {
+                return false;
+            }
+
+            auto* update = static_cast<Instruction*>(next);
+
+            if (phi == inductionVariable)
+            {
+                // i + 1 without overflow, so sext(i + k) is sext(i) + k.
+                auto* step = update->getOperand(0) == phi ? update->getOperand(1) : update->getOperand(0);
+
+                if (update->getOpcode() != EnumOpcode::ADD || !update->hasFlag(EnumInstructionFlag::NSW)
+                    || step->getKind() != EnumValueKind::CONSTANT_INT || !static_cast<ConstantInt*>(step)->isOne())
+                {
+                    return false;
+                }
+
+                counted.increment = update;
+                counted.start = init;
+                continue;
+            }
+
+            // Integer reductions only: reassociating floating point math changes the result.
+            const auto opcode = update->getOpcode();
+
+            if (!phi->getType()->isInt() || !isVectorElementType(phi->getType())
+                || !(opcode == EnumOpcode::ADD || opcode == EnumOpcode::MUL || opcode == EnumOpcode::AND
+                || opcode == EnumOpcode::OR || opcode == EnumOpcode::XOR)
+                || (update->getOperand(0) == phi) == (update->getOperand(1) == phi))
+            {
+                return false;
+            }
+
+            // The lanes only hold partial results, nothing in the loop may look at them.
+            for (const auto* user : phi->getUsers())
+            {
+                if (user != update && loop.contains(user))
+                {
+                    return false;
+                }
+            }
+
+            counted.reductions.push_back({ phi, update });
+        }
+
+        if (counted.increment == nullptr)
+        {
+            return false;
+        }
+
+        // The induction variable is only compared, incremented and used as an index.
+        for (auto* user : inductionVariable->getUsers())
+        {
+            if (!loop.contains(user) || user == compare || user == counted.increment)
+            {
+                continue;
+            }
+
+            else if (user->getOpcode() != EnumOpcode::SEXT || user->getParent() != latch || !user->getType()->isInt(64))
+            {
+                return false;
+            }
+
+            for (const auto* indexUser : user->getUsers())
+            {
+                if (indexUser->getOpcode() != EnumOpcode::GET_ELEMENT_PTR || indexUser->getOperands().back() != user)
+                {
+                    return false;
+                }
+            }
+
+            counted.indices.insert(user);
+        }
+
+        std::unordered_set<const Value*> widened;
+
+        for (auto& instruction : *latch)
+        {
+            if (instruction.get() == latch->getTerminator() || instruction.get() == counted.increment
+                || counted.indices.find(instruction.get()) != counted.indices.cend())
+            {
+                continue;
+            }
+
+            else if (!canWiden(loop, counted, widened, *instruction))
+            {
+                return false;
+            }
+        }
+
+        if (counted.addresses.empty())
+        {
+            return false;
+        }
+
+        // Different elements accessed by a lane store and a later lane load (or store) must not
+        // overlap.  Accesses of the same stream touch the same element in a single iteration.
+        const auto isStored = [](const Instruction* address)
+        {
+            const auto& users = address->getUsers();
+            return std::any_of(users.cbegin(), users.cend(), [](const Instruction* user) { return user->getOpcode() == EnumOpcode::STORE; });
+        };
+
+        for (std::size_t i = 0; i < counted.addresses.size(); ++i)
+        {
+            for (std::size_t j = i + 1; j < counted.addresses.size(); ++j)
+            {
+                auto* first = counted.addresses[i];
+                auto* second = counted.addresses[j];
+
+                if (isSameStream(first, second) || !(isStored(first) || isStored(second)))
+                {
+                    continue;
+                }
+
+                else if (aliasAnalysis.alias(first, second) == EnumAliasResult::NO_ALIAS)
+                {
+                    continue;
+                }
+
+                const bool checked = std::any_of(counted.overlapChecks.cbegin(), counted.overlapChecks.cend(), [&](const auto& check)
+                {
+                    return (isSameStream(check.first, first) && isSameStream(check.second, second))
+                        || (isSameStream(check.first, second) && isSameStream(check.second, first));
+                });
+
+                if (!checked)
+                {
+                    counted.overlapChecks.emplace_back(first, second);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    LoopVectorize::LoopVectorize(const u32 vectorWidth) CMM_NOEXCEPT : vectorWidth(vectorWidth), vectorizedCount(0)
+    {
+    }
+
+    bool LoopVectorize::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& function : module.getFunctions())
+        {
+            changed |= run(*function);
+        }
+
+        return changed;
+    }
+
+    bool LoopVectorize::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        const DominatorTree dominators(function);
+        const LoopInfo loopInfo(dominators);
+        const AliasAnalysis aliasAnalysis(function);
+
+        return run(function, loopInfo, aliasAnalysis);
+    }
+
+    bool LoopVectorize::run(Function& function, const LoopInfo& loopInfo, const AliasAnalysis& aliasAnalysis)
+    {
+        if (function.isDeclaration() || loopInfo.empty() || vectorWidth == 0)
+        {
+            return false;
+        }
+
+        const std::size_t before = vectorizedCount;
+
+        // Each loop only touches its own blocks and the new ones, so the other loops stay valid.
+        for (auto* loop : loopInfo.getLoopsInnermostFirst())
+        {
+            if (vectorize(*loop, aliasAnalysis))
+            {
+                ++vectorizedCount;
+            }
+        }
+
+        return vectorizedCount != before;
+    }
+
+    u32 LoopVectorize::getVectorWidth() const CMM_NOEXCEPT
+    {
+        return vectorWidth;
+    }
+
+    std::size_t LoopVectorize::getVectorizedCount() const CMM_NOEXCEPT
+    {
+        return vectorizedCount;
+    }
+
+    bool LoopVectorize::vectorize(Loop& loop, const AliasAnalysis& aliasAnalysis)
+    {
+        CountedLoop counted;
+
+        if (!analyze(loop, aliasAnalysis, counted) || counted.widestBits == 0 || vectorWidth / counted.widestBits < 2)
+        {
+            return false;
+        }
+
+        const u32 lanes = vectorWidth / counted.widestBits;
+        auto* preheader = counted.preheader;
+        auto* header = counted.header;
+        auto* latch = counted.latch;
+        auto* function = header->getParent();
+        auto& module = *function->getParent();
+        auto& types = module.getTypes();
+        auto* i32 = types.getInt(32);
+        auto* i64 = types.getInt(64);
+
+        // preheader -> vector.ph -> vector.cond <-> vector.body
+        //                              |
+        //                           vector.end -> header <-> latch (the remaining iterations)
+        BasicBlock* previous = nullptr;
+
+        for (auto& block : *function)
+        {
+            if (block.get() == header)
+            {
+                break;
+            }
+
+            previous = block.get();
+        }
+
+        auto* vectorPreheader = function->insertBlockAfter(previous, std::make_unique<BasicBlock>(types.getLabel(), "vector.ph"));
+        auto* vectorHeader = function->insertBlockAfter(vectorPreheader, std::make_unique<BasicBlock>(types.getLabel(), "vector.cond"));
+        auto* vectorBody = function->insertBlockAfter(vectorHeader, std::make_unique<BasicBlock>(types.getLabel(), "vector.body"));
+        auto* vectorEnd = function->insertBlockAfter(vectorBody, std::make_unique<BasicBlock>(types.getLabel(), "vector.end"));
+
+        IRBuilder builder(module);
+        auto* entryBranch = preheader->getTerminator();
+        builder.setInsertPoint(entryBranch);
+
+        // The indices are computed in 64 bits, where i + lanes - 1 can't overflow.
+        auto* bound = createFoldedCast(builder, EnumOpcode::SEXT, counted.bound, i64);
+        auto* start = counted.overlapChecks.empty() ? nullptr : createFoldedCast(builder, EnumOpcode::SEXT, counted.start, i64);
+
+        // Two arrays don't overlap when one ends before the other starts.  Plain GEPs since the
+        // range is empty (and may point anywhere) when the loop doesn't run.
+        const auto createAddress = [&](Instruction* address, Value* index) -> Value*
+        {
+            auto copy = address->clone();
+            copy->setOperand(copy->getNumOperands() - 1, index);
+            copy->setFlag(EnumInstructionFlag::INBOUNDS, false);
+
+            return builder.createCast(EnumOpcode::PTR_TO_INT, builder.insert(std::move(copy)), i64);
+        };
+
+        Value* noOverlap = nullptr;
+
+        for (const auto& [first, second] : counted.overlapChecks)
+        {
+            auto* firstBegin = createAddress(first, start);
+            auto* firstEnd = createAddress(first, bound);
+            auto* secondBegin = createAddress(second, start);
+            auto* secondEnd = createAddress(second, bound);
+
+            auto* firstBefore = builder.createICmp(EnumCmpPredicate::ULE, firstEnd, secondBegin);
+            auto* secondBefore = builder.createICmp(EnumCmpPredicate::ULE, secondEnd, firstBegin);
+            auto* disjoint = builder.createBinary(EnumOpcode::OR, firstBefore, secondBefore);
+
+            noOverlap = noOverlap == nullptr ? disjoint : builder.createBinary(EnumOpcode::AND, noOverlap, disjoint);
+        }
+
+        if (noOverlap != nullptr)
+        {
+            builder.createCondBr(noOverlap, vectorPreheader, header);
+            entryBranch->eraseFromParent();
+        }
+
+        else
+        {
+            entryBranch->replaceSuccessor(header, vectorPreheader);
+        }
+
+        // vector.ph: the last index a whole vector starts at and the initial lanes.
+        builder.setInsertPoint(vectorPreheader);
+        auto* limit = createFoldedBinary(builder, EnumOpcode::SUB, bound, module.getConstantInt(i64, lanes - 1));
+
+        if (limit->getKind() == EnumValueKind::INSTRUCTION)
+        {
+            static_cast<Instruction*>(limit)->setFlag(EnumInstructionFlag::NSW);
+        }
+
+        const auto createSplat = [&](Value* first, Value* rest) -> Value*
+        {
+            Value* vector = module.getUndef(types.getVector(first->getType(), lanes));
+
+            for (u32 lane = 0; lane < lanes; ++lane)
+            {
+                vector = builder.createInsertElement(vector, lane == 0 ? first : rest, module.getConstantInt(i32, lane));
+            }
+
+            return vector;
+        };
+
+        std::vector<Value*> initialLanes;
+        initialLanes.reserve(counted.reductions.size());
+
+        for (const auto& reduction : counted.reductions)
+        {
+            auto* phi = reduction.phi;
+            initialLanes.push_back(createSplat(phi->getIncomingValueForBlock(preheader), getIdentity(module, reduction.update->getOpcode(), phi->getType())));
+        }
+
+        auto* vectorEntry = builder.createBr(vectorHeader);
+
+        // vector.cond: while (i + lanes - 1 < bound).
+        builder.setInsertPoint(vectorHeader);
+        auto* inductionVariable = counted.inductionVariable;
+        auto* vectorIndex = builder.createPhi(i32, inductionVariable->hasName() ? inductionVariable->getName() + ".vector" : "");
+
+        // The values done lane by lane, the reductions' lanes included.
+        std::unordered_map<const Value*, Value*> lanesOf;
+        std::vector<Instruction*> vectorPhis;
+        vectorPhis.reserve(counted.reductions.size());
+
+        for (const auto& reduction : counted.reductions)
+        {
+            auto* phi = reduction.phi;
+            auto* vectorPhi = builder.createPhi(types.getVector(phi->getType(), lanes), phi->hasName() ? phi->getName() + ".vector" : "");
+
+            vectorPhis.push_back(vectorPhi);
+            lanesOf[phi] = vectorPhi;
+        }
+
+        auto* index = builder.createCast(EnumOpcode::SEXT, vectorIndex, i64);
+        auto* inRange = builder.createICmp(EnumCmpPredicate::SLT, index, limit);
+        builder.createCondBr(inRange, vectorBody, vectorEnd);
+
+        // Values the same for every lane are splat once in vector.ph.
+        const auto getLanes = [&](Value* value) -> Value*
+        {
+            if (auto iter = lanesOf.find(value); iter != lanesOf.cend())
+            {
+                return iter->second;
+            }
+
+            IRBuilder splatBuilder(module);
+            splatBuilder.setInsertPoint(vectorEntry);
+
+            Value* vector = module.getUndef(types.getVector(value->getType(), lanes));
+
+            for (u32 lane = 0; lane < lanes; ++lane)
+            {
+                vector = splatBuilder.createInsertElement(vector, value, module.getConstantInt(i32, lane));
+            }
+
+            lanesOf[value] = vector;
+            return vector;
+        };
+
+        // vector.body: the body, each instruction doing 'lanes' iterations at once.
+        builder.setInsertPoint(vectorBody);
+        std::unordered_map<const Value*, Value*> vectorAddresses;
+
+        for (auto& instruction : *latch)
+        {
+            auto* original = instruction.get();
+            const auto opcode = original->getOpcode();
+
+            if (original == latch->getTerminator() || original == counted.increment
+                || counted.indices.find(original) != counted.indices.cend())
+            {
+                continue;
+            }
+
+            else if (opcode == EnumOpcode::GET_ELEMENT_PTR)
+            {
+                auto copy = original->clone();
+                copy->setOperand(copy->getNumOperands() - 1, index);
+
+                auto* element = builder.insert(std::move(copy));
+                auto* vectorType = types.getVector(element->getType()->getElementType(), lanes);
+                vectorAddresses[original] = builder.createCast(EnumOpcode::BITCAST, element, vectorType->getPointerTo());
+            }
+
+            else if (opcode == EnumOpcode::LOAD)
+            {
+                // Only the elements are known to be aligned, not the whole vector.
+                auto* load = builder.createLoad(vectorAddresses[original->getOperand(0)]);
+                load->setAlignment(static_cast<u32>(original->getType()->getAlignment()));
+                lanesOf[original] = load;
+            }
+
+            else if (opcode == EnumOpcode::STORE)
+            {
+                auto* store = builder.createStore(getLanes(original->getOperand(0)), vectorAddresses[original->getOperand(1)]);
+                store->setAlignment(static_cast<u32>(original->getOperand(0)->getType()->getAlignment()));
+            }
+
+            else if (opcode == EnumOpcode::FNEG)
+            {
+                lanesOf[original] = builder.createFNeg(getLanes(original->getOperand(0)));
+            }
+
+            else if (original->isCast())
+            {
+                lanesOf[original] = builder.createCast(opcode, getLanes(original->getOperand(0)), types.getVector(original->getType(), lanes));
+            }
+
+            else
+            {
+                auto* result = builder.createBinary(opcode, getLanes(original->getOperand(0)), getLanes(original->getOperand(1)));
+                const bool isReduction = std::any_of(counted.reductions.cbegin(), counted.reductions.cend(),
+                    [&](const Reduction& reduction) { return reduction.update == original; });
+
+                // Partial sums may overflow where the whole one in order didn't.
+                if (!isReduction)
+                {
+                    result->setFlag(EnumInstructionFlag::NSW, original->hasFlag(EnumInstructionFlag::NSW));
+                    result->setFlag(EnumInstructionFlag::NUW, original->hasFlag(EnumInstructionFlag::NUW));
+                    result->setFlag(EnumInstructionFlag::EXACT, original->hasFlag(EnumInstructionFlag::EXACT));
+                }
+
+                lanesOf[original] = result;
+            }
+        }
+
+        auto* vectorNext = builder.createBinary(EnumOpcode::ADD, vectorIndex, module.getConstantInt(i32, lanes));
+        vectorNext->setFlag(EnumInstructionFlag::NSW);
+        builder.createBr(vectorHeader);
+
+        vectorIndex->addIncoming(counted.start, vectorPreheader);
+        vectorIndex->addIncoming(vectorNext, vectorBody);
+
+        for (std::size_t i = 0; i < counted.reductions.size(); ++i)
+        {
+            vectorPhis[i]->addIncoming(initialLanes[i], vectorPreheader);
+            vectorPhis[i]->addIncoming(lanesOf[counted.reductions[i].update], vectorBody);
+        }
+
+        // vector.end: the lanes of each reduction are combined, the scalar loop carries on.
+        builder.setInsertPoint(vectorEnd);
+        std::vector<std::pair<Instruction*, Value*>> resumeValues;
+        resumeValues.emplace_back(inductionVariable, vectorIndex);
+
+        for (std::size_t i = 0; i < counted.reductions.size(); ++i)
+        {
+            const auto opcode = counted.reductions[i].update->getOpcode();
+            Value* result = builder.createExtractElement(vectorPhis[i], module.getConstantInt(i32, 0));
+
+            for (u32 lane = 1; lane < lanes; ++lane)
+            {
+                result = builder.createBinary(opcode, result, builder.createExtractElement(vectorPhis[i], module.getConstantInt(i32, lane)));
+            }
+
+            resumeValues.emplace_back(counted.reductions[i].phi, result);
+        }
+
+        builder.createBr(header);
+
+        // Without run time checks the preheader no longer enters the scalar loop.
+        for (auto& [phi, value] : resumeValues)
+        {
+            for (std::size_t i = 0; noOverlap == nullptr && i < phi->getNumIncoming(); ++i)
+            {
+                if (phi->getIncomingBlock(i) == preheader)
+                {
+                    phi->removeIncoming(i);
+                    break;
+                }
+            }
+
+            phi->addIncoming(value, vectorEnd);
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,473 @@
+/**
+ * Promotes stack slots (allocas) of scalars to SSA values with phi nodes at the joins.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/Mem2Reg.h>
+#include <cmm/ir/Dominators.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <unordered_map>
+#include <unordered_set>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    Mem2Reg::Mem2Reg() CMM_NOEXCEPT : promotedCount(0), phiCount(0)
+    {
+    }
+
+    bool Mem2Reg::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& function : module.getFunctions())
+        {
+            changed |= run(*function);
+        }
+
+        return changed;
+    }
+
+    bool Mem2Reg::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        const auto allocas = findPromotable(function);
+
+        if (allocas.empty())
+        {
+            return false;
+        }
+
+        const DominatorTree dominators(function);
+        promote(function, allocas, dominators);
+
+        return true;
+    }
+
+    bool Mem2Reg::run(Function& function, const DominatorTree& dominators)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        const auto allocas = findPromotable(function);
+
+        if (allocas.empty())
+        {
+            return false;
+        }
+
+        promote(function, allocas, dominators);
+
+        return true;
+    }
+
+    std::size_t Mem2Reg::getPromotedCount() const CMM_NOEXCEPT
+    {
+        return promotedCount;
+    }
+
+    std::size_t Mem2Reg::getPhiCount() const CMM_NOEXCEPT
+    {
+        return phiCount;
+    }
+
+    /* static */
+    bool Mem2Reg::isPromotable(const Instruction& alloca)
+    {
+        auto* type = alloca.getAuxType();
+
+        if (type == nullptr || !type->isSingleValue())
+        {
+            return false;
+        }
+
+        for (const auto* user : alloca.getUsers())
+        {
+            switch (user->getOpcode())
+            {
+            case EnumOpcode::LOAD:
+                if (user->getType() != type)
+                {
+                    return false;
+                }
+
+                break;
+            case EnumOpcode::STORE:
+                // Storing the address itself somewhere lets it escape.
+                if (user->getOperand(0) == &alloca || user->getOperand(0)->getType() != type)
+                {
+                    return false;
+                }
+
+                break;
+            default:
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /* static */
+    std::vector<Instruction*> Mem2Reg::findPromotable(Function& function)
+    {
+        // Lower puts every alloca in the entry block, anything elsewhere is left alone.
+        std::vector<Instruction*> allocas;
+
+        for (auto& instruction : *function.getEntryBlock())
+        {
+            if (instruction->getOpcode() == EnumOpcode::ALLOCA && isPromotable(*instruction))
+            {
+                allocas.push_back(instruction.get());
+            }
+        }
+
+        return allocas;
+    }
+
+    void Mem2Reg::promote(Function& function, const std::vector<Instruction*>& allocas, const DominatorTree& dominators)
+    {
+        auto& module = *function.getParent();
+        std::unordered_map<const Value*, std::size_t> allocaIndices;
+
+        for (std::size_t i = 0; i < allocas.size(); ++i)
+        {
+            allocaIndices.emplace(allocas[i], i);
+        }
+
+        const auto indexOf = [&allocaIndices](const Value* pointer) -> std::size_t
+        {
+            const auto findResult = allocaIndices.find(pointer);
+            return findResult != allocaIndices.cend() ? findResult->second : allocaIndices.size();
+        };
+
+        // Place the phis (Cytron et al.) at the iterated dominance frontier of the blocks
+        // that store to each slot, pruned to the blocks where the slot is live.
+        std::unordered_map<const Instruction*, std::size_t> phis;
+        std::vector<Instruction*> placed;
+
+        for (std::size_t i = 0; i < allocas.size(); ++i)
+        {
+            auto* alloca = allocas[i];
+            std::vector<BasicBlock*> defBlocks;
+            std::unordered_set<const BasicBlock*> defSet;
+            std::vector<BasicBlock*> useBlocks;
+
+            for (const auto* user : alloca->getUsers())
+            {
+                auto* block = user->getParent();
+
+                if (user->getOpcode() == EnumOpcode::STORE)
+                {
+                    if (defSet.insert(block).second)
+                    {
+                        defBlocks.push_back(block);
+                    }
+                }
+
+                else
+                {
+                    useBlocks.push_back(block);
+                }
+            }
+
+            // A slot is live into a block that loads it before storing to it, and into
+            // every block that reaches one of those without storing along the way.
+            std::unordered_set<const BasicBlock*> liveIn;
+            std::vector<BasicBlock*> worklist;
+
+            for (auto* block : useBlocks)
+            {
+                if (defSet.find(block) != defSet.cend())
+                {
+                    bool loadsFirst = false;
+
+                    for (const auto& instruction : *block)
+                    {
+                        if (instruction->getOpcode() == EnumOpcode::STORE && instruction->getOperand(1) == alloca)
+                        {
+                            break;
+                        }
+
+                        else if (instruction->getOpcode() == EnumOpcode::LOAD && instruction->getOperand(0) == alloca)
+                        {
+                            loadsFirst = true;
+                            break;
+                        }
+                    }
+
+                    if (!loadsFirst)
+                    {
+                        continue;
+                    }
+                }
+
+                if (liveIn.insert(block).second)
+                {
+                    worklist.push_back(block);
+                }
+            }
+
+            while (!worklist.empty())
+            {
+                auto* block = worklist.back();
+                worklist.pop_back();
+
+                for (auto* pred : block->getPredecessors())
+                {
+                    if (defSet.find(pred) == defSet.cend() && liveIn.insert(pred).second)
+                    {
+                        worklist.push_back(pred);
+                    }
+                }
+            }
+
+            auto name = alloca->getName();
+
+            if (name.size() > 5 && name.compare(name.size() - 5, 5, ".addr") == 0)
+            {
+                name.resize(name.size() - 5);
+            }
+
+            std::unordered_set<const BasicBlock*> hasPhi;
+            worklist = defBlocks;
+
+            while (!worklist.empty())
+            {
+                auto* block = worklist.back();
+                worklist.pop_back();
+
+                for (auto* frontier : dominators.getFrontier(block))
+                {
+                    if (liveIn.find(frontier) == liveIn.cend() || !hasPhi.insert(frontier).second)
+                    {
+                        continue;
+                    }
+
+                    auto phi = std::make_unique<Instruction>(EnumOpcode::PHI, alloca->getAuxType(), std::vector<Value*>(), name);
+                    auto* inserted = frontier->insertBefore(frontier->front(), std::move(phi));
+                    phis.emplace(inserted, i);
+                    placed.push_back(inserted);
+
+                    if (defSet.find(frontier) == defSet.cend())
+                    {
+                        worklist.push_back(frontier);
+                    }
+                }
+            }
+        }
+
+        // Rename: walk the CFG carrying the current value of every slot, filling in the phi
+        // entries on each edge and replacing the loads and stores of each block once.
+        struct RenameState
+        {
+            BasicBlock* block;
+            BasicBlock* pred;
+            std::vector<Value*> values;
+        };
+
+        std::vector<Value*> initial;
+        initial.reserve(allocas.size());
+
+        for (auto* alloca : allocas)
+        {
+            initial.push_back(module.getUndef(alloca->getAuxType()));
+        }
+
+        std::unordered_set<const BasicBlock*> visited;
+        std::vector<RenameState> stack;
+        stack.push_back({ function.getEntryBlock(), nullptr, initial });
+
+        while (!stack.empty())
+        {
+            auto state = std::move(stack.back());
+            stack.pop_back();
+
+            auto* block = state.block;
+            auto& values = state.values;
+
+            for (auto& instruction : *block)
+            {
+                const auto findResult = phis.find(instruction.get());
+
+                if (instruction->getOpcode() != EnumOpcode::PHI)
+                {
+                    break;
+                }
+
+                else if (findResult != phis.cend())
+                {
+                    if (state.pred != nullptr)
+                    {
+                        instruction->addIncoming(values[findResult->second], state.pred);
+                    }
+
+                    values[findResult->second] = instruction.get();
+                }
+            }
+
+            if (!visited.insert(block).second)
+            {
+                continue;
+            }
+
+            for (auto iter = block->begin(); iter != block->end();)
+            {
+                auto* instruction = (iter++)->get();
+
+                if (instruction->getOpcode() == EnumOpcode::LOAD)
+                {
+                    const std::size_t index = indexOf(instruction->getOperand(0));
+
+                    if (index < allocas.size())
+                    {
+                        instruction->replaceAllUsesWith(values[index]);
+                        instruction->eraseFromParent();
+                    }
+                }
+
+                else if (instruction->getOpcode() == EnumOpcode::STORE)
+                {
+                    const std::size_t index = indexOf(instruction->getOperand(1));
+
+                    if (index < allocas.size())
+                    {
+                        values[index] = instruction->getOperand(0);
+                        instruction->eraseFromParent();
+                    }
+                }
+            }
+
+            // Pushed in reverse so the first successor is renamed first.
+            const auto succs = block->getSuccessors();
+
+            for (auto iter = succs.crbegin(); iter != succs.crend(); ++iter)
+            {
+                stack.push_back({ *iter, block, values });
+            }
+        }
+
+        // Blocks that can't be reached never ran the walk above, but their loads and stores
+        // must still go and any phi they branch to needs an entry for them.
+        for (auto& blockPtr : function)
+        {
+            auto* block = blockPtr.get();
+
+            if (visited.find(block) != visited.cend())
+            {
+                continue;
+            }
+
+            for (auto iter = block->begin(); iter != block->end();)
+            {
+                auto* instruction = (iter++)->get();
+
+                if (instruction->getOpcode() == EnumOpcode::LOAD && indexOf(instruction->getOperand(0)) < allocas.size())
+                {
+                    instruction->replaceAllUsesWith(initial[indexOf(instruction->getOperand(0))]);
+                    instruction->eraseFromParent();
+                }
+
+                else if (instruction->getOpcode() == EnumOpcode::STORE && indexOf(instruction->getOperand(1)) < allocas.size())
+                {
+                    instruction->eraseFromParent();
+                }
+            }
+
+            for (auto* succ : block->getSuccessors())
+            {
+                for (auto& instruction : *succ)
+                {
+                    const auto findResult = phis.find(instruction.get());
+
+                    if (instruction->getOpcode() != EnumOpcode::PHI)
+                    {
+                        break;
+                    }
+
+                    else if (findResult != phis.cend())
+                    {
+                        instruction->addIncoming(initial[findResult->second], block);
+                    }
+                }
+            }
+        }
+
+        for (auto* alloca : allocas)
+        {
+            alloca->eraseFromParent();
+        }
+
+        // Fold away phis whose incoming values are all the same (ignoring the phi itself)
+        // and phis that ended up unused.
+        bool changed = true;
+
+        while (changed)
+        {
+            changed = false;
+
+            for (auto& phi : placed)
+            {
+                if (phi == nullptr)
+                {
+                    continue;
+                }
+
+                Value* same = nullptr;
+                bool trivial = true;
+
+                for (std::size_t i = 0; i < phi->getNumIncoming(); ++i)
+                {
+                    auto* incoming = phi->getIncomingValue(i);
+
+                    if (incoming == phi || incoming == same)
+                    {
+                        continue;
+                    }
+
+                    else if (same != nullptr)
+                    {
+                        trivial = false;
+                        break;
+                    }
+
+                    same = incoming;
+                }
+
+                if (trivial || !phi->hasUses())
+                {
+                    if (phi->hasUses())
+                    {
+                        phi->replaceAllUsesWith(same != nullptr ? same : initial[phis[phi]]);
+                    }
+
+                    phi->eraseFromParent();
+                    phi = nullptr;
+                    changed = true;
+                }
+            }
+        }
+
+        for (const auto* phi : placed)
+        {
+            if (phi != nullptr)
+            {
+                ++phiCount;
+            }
+        }
+
+        promotedCount += allocas.size();
+    }
+}
@@ -0,0 +1,824 @@
+/**
+ * Runs a pipeline of optimization passes, caching the analyses they share.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/PassManager.h>
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/CallGraph.h>
+#include <cmm/ir/Dominators.h>
+#include <cmm/ir/LoopInfo.h>
+#include <cmm/ir/Module.h>
+#include <cmm/opt/ArgumentAttributes.h>
+#include <cmm/opt/ConstantPropagation.h>
+#include <cmm/opt/DeadCodeElimination.h>
+#include <cmm/opt/FunctionAttributes.h>
+#include <cmm/opt/GlobalValueNumbering.h>
+#include <cmm/opt/Inliner.h>
+#include <cmm/opt/LoopInvariantCodeMotion.h>
+#include <cmm/opt/LoopStrengthReduction.h>
+#include <cmm/opt/LoopVectorize.h>
+#include <cmm/opt/Mem2Reg.h>
+#include <cmm/opt/Peephole.h>
+#include <cmm/opt/ScalarReplacement.h>
+#include <cmm/opt/TailCallElimination.h>
+
+// std includes
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    namespace
+    {
+        class ScalarReplacementPass : public Pass
+        {
+        public:
+
+            ScalarReplacementPass() : Pass("sroa")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager&) override
+            {
+                return scalarReplacement.run(module);
+            }
+
+            // Allocas, GEPs, loads and stores are rewritten in place, the CFG is untouched.
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::DOMINATORS | EnumAnalysis::LOOPS | EnumAnalysis::CALL_GRAPH;
+            }
+
+            std::string getDetails() const override
+            {
+                std::ostringstream os;
+                os << "split " << scalarReplacement.getSplitCount() << " aggregates";
+                return os.str();
+            }
+
+        private:
+
+            ScalarReplacement scalarReplacement;
+        };
+
+        class Mem2RegPass : public Pass
+        {
+        public:
+
+            Mem2RegPass() : Pass("mem2reg")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager& analyses) override
+            {
+                bool changed = false;
+
+                for (auto& function : module.getFunctions())
+                {
+                    if (!function->isDeclaration())
+                    {
+                        changed |= mem2reg.run(*function, analyses.getDominatorTree(*function));
+                    }
+                }
+
+                return changed;
+            }
+
+            // Only loads, stores and allocas are removed (and phis added), the CFG is untouched.
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::DOMINATORS | EnumAnalysis::LOOPS | EnumAnalysis::CALL_GRAPH;
+            }
+
+            std::string getDetails() const override
+            {
+                std::ostringstream os;
+                os << "promoted " << mem2reg.getPromotedCount() << " allocas, inserted " << mem2reg.getPhiCount() << " phis";
+                return os.str();
+            }
+
+        private:
+
+            Mem2Reg mem2reg;
+        };
+
+        class ArgumentAttributesPass : public Pass
+        {
+        public:
+
+            ArgumentAttributesPass() : Pass("argattrs")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager&) override
+            {
+                return argumentAttributes.run(module);
+            }
+
+            // Only attributes change, but alias results are refined by them.
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::DOMINATORS | EnumAnalysis::LOOPS | EnumAnalysis::CALL_GRAPH;
+            }
+
+            std::string getDetails() const override
+            {
+                std::ostringstream os;
+                os << "marked " << argumentAttributes.getNoCaptureCount() << " nocapture, "
+                   << argumentAttributes.getNoAliasCount() << " noalias";
+                return os.str();
+            }
+
+        private:
+
+            ArgumentAttributes argumentAttributes;
+        };
+
+        class FunctionAttributesPass : public Pass
+        {
+        public:
+
+            FunctionAttributesPass() : Pass("funcattrs")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager& analyses) override
+            {
+                return functionAttributes.run(module, analyses.getCallGraph(module));
+            }
+
+            // Only attributes change, and alias queries read them as they go.
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::ALL_ANALYSES;
+            }
+
+            std::string getDetails() const override
+            {
+                return "inferred " + std::to_string(functionAttributes.getInferredCount()) + " attributes";
+            }
+
+        private:
+
+            FunctionAttributes functionAttributes;
+        };
+
+        class InlinerPass : public Pass
+        {
+        public:
+
+            InlinerPass() : Pass("inline")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager& analyses) override
+            {
+                return inliner.run(module, analyses.getCallGraph(module));
+            }
+
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::NO_ANALYSES;
+            }
+
+            std::string getDetails() const override
+            {
+                return "inlined " + std::to_string(inliner.getInlinedCount()) + " calls";
+            }
+
+        private:
+
+            Inliner inliner;
+        };
+
+        class ConstantPropagationPass : public Pass
+        {
+        public:
+
+            ConstantPropagationPass() : Pass("constprop")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager&) override
+            {
+                return constantPropagation.run(module);
+            }
+
+            // Branches on constants are left for DeadCodeElimination to fold.
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::ALL_ANALYSES;
+            }
+
+            std::string getDetails() const override
+            {
+                return "folded " + std::to_string(constantPropagation.getFoldedCount()) + " instructions";
+            }
+
+        private:
+
+            ConstantPropagation constantPropagation;
+        };
+
+        class GlobalValueNumberingPass : public Pass
+        {
+        public:
+
+            GlobalValueNumberingPass() : Pass("gvn")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager& analyses) override
+            {
+                bool changed = false;
+
+                for (auto& function : module.getFunctions())
+                {
+                    if (!function->isDeclaration())
+                    {
+                        changed |= globalValueNumbering.run(*function, analyses.getDominatorTree(*function), analyses.getAliasAnalysis(*function));
+                    }
+                }
+
+                return changed;
+            }
+
+            // Redundant instructions are removed, but no call or block is.
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::ALL_ANALYSES;
+            }
+
+            std::string getDetails() const override
+            {
+                std::ostringstream os;
+                os << "eliminated " << globalValueNumbering.getEliminatedCount() << " instructions ("
+                   << globalValueNumbering.getEliminatedLoadCount() << " loads)";
+                return os.str();
+            }
+
+        private:
+
+            GlobalValueNumbering globalValueNumbering;
+        };
+
+        class LoopInvariantCodeMotionPass : public Pass
+        {
+        public:
+
+            LoopInvariantCodeMotionPass() : Pass("licm")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager& analyses) override
+            {
+                bool changed = false;
+
+                for (auto& function : module.getFunctions())
+                {
+                    if (!function->isDeclaration())
+                    {
+                        changed |= loopInvariantCodeMotion.run(*function, analyses.getLoopInfo(*function), analyses.getAliasAnalysis(*function));
+                    }
+                }
+
+                return changed;
+            }
+
+            // Inserted preheaders leave the dominator tree stale, hoisting doesn't change what
+            // pointers may alias.
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::CALL_GRAPH | EnumAnalysis::ALIASES;
+            }
+
+            std::string getDetails() const override
+            {
+                return "hoisted " + std::to_string(loopInvariantCodeMotion.getHoistedCount()) + " instructions";
+            }
+
+        private:
+
+            LoopInvariantCodeMotion loopInvariantCodeMotion;
+        };
+
+        class LoopStrengthReductionPass : public Pass
+        {
+        public:
+
+            LoopStrengthReductionPass() : Pass("lsr")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager& analyses) override
+            {
+                bool changed = false;
+
+                for (auto& function : module.getFunctions())
+                {
+                    if (!function->isDeclaration())
+                    {
+                        changed |= loopStrengthReduction.run(*function, analyses.getLoopInfo(*function));
+                    }
+                }
+
+                return changed;
+            }
+
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::ALL_ANALYSES;
+            }
+
+            std::string getDetails() const override
+            {
+                return "reduced " + std::to_string(loopStrengthReduction.getReducedCount()) + " multiplications";
+            }
+
+        private:
+
+            LoopStrengthReduction loopStrengthReduction;
+        };
+
+        class LoopVectorizePass : public Pass
+        {
+        public:
+
+            explicit LoopVectorizePass(const u32 vectorWidth) : Pass("vectorize"), loopVectorize(vectorWidth)
+            {
+            }
+
+            bool run(Module& module, AnalysisManager& analyses) override
+            {
+                bool changed = false;
+
+                for (auto& function : module.getFunctions())
+                {
+                    if (!function->isDeclaration())
+                    {
+                        changed |= loopVectorize.run(*function, analyses.getLoopInfo(*function), analyses.getAliasAnalysis(*function));
+                    }
+                }
+
+                return changed;
+            }
+
+            // New blocks are added around the vectorized loops, no calls are.
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::CALL_GRAPH;
+            }
+
+            std::string getDetails() const override
+            {
+                return "vectorized " + std::to_string(loopVectorize.getVectorizedCount()) + " loops for "
+                    + std::to_string(loopVectorize.getVectorWidth()) + " bit vectors";
+            }
+
+        private:
+
+            LoopVectorize loopVectorize;
+        };
+
+        class PeepholePass : public Pass
+        {
+        public:
+
+            PeepholePass() : Pass("peephole")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager&) override
+            {
+                return peephole.run(module);
+            }
+
+            // Only arithmetic is rewritten.
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::ALL_ANALYSES;
+            }
+
+            std::string getDetails() const override
+            {
+                std::ostringstream os;
+                os << "simplified " << peephole.getSimplifiedCount() << " instructions, strength reduced "
+                   << peephole.getStrengthReducedCount();
+                return os.str();
+            }
+
+        private:
+
+            Peephole peephole;
+        };
+
+        class TailCallEliminationPass : public Pass
+        {
+        public:
+
+            TailCallEliminationPass() : Pass("tailcall")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager&) override
+            {
+                return tailCallElimination.run(module);
+            }
+
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::NO_ANALYSES;
+            }
+
+            std::string getDetails() const override
+            {
+                std::ostringstream os;
+                os << "eliminated " << tailCallElimination.getEliminatedCount() << " recursive calls, marked "
+                   << tailCallElimination.getMarkedCount() << " tail calls";
+                return os.str();
+            }
+
+        private:
+
+            TailCallElimination tailCallElimination;
+        };
+
+        class DeadCodeEliminationPass : public Pass
+        {
+        public:
+
+            DeadCodeEliminationPass() : Pass("dce")
+            {
+            }
+
+            bool run(Module& module, AnalysisManager&) override
+            {
+                return deadCodeElimination.run(module);
+            }
+
+            u8 getPreservedAnalyses() const CMM_NOEXCEPT override
+            {
+                return EnumAnalysis::NO_ANALYSES;
+            }
+
+            std::string getDetails() const override
+            {
+                std::ostringstream os;
+                os << "removed " << deadCodeElimination.getRemovedInstructionCount() << " instructions ("
+                   << deadCodeElimination.getRemovedStoreCount() << " stores), "
+                   << deadCodeElimination.getRemovedBlockCount() << " blocks";
+                return os.str();
+            }
+
+        private:
+
+            DeadCodeElimination deadCodeElimination;
+        };
+    }
+
+    AnalysisManager::AnalysisManager() CMM_NOEXCEPT : computedCount(0)
+    {
+    }
+
+    AnalysisManager::AnalysisManager(AnalysisManager&&) CMM_NOEXCEPT = default;
+
+    AnalysisManager::~AnalysisManager() = default;
+
+    AnalysisManager& AnalysisManager::operator= (AnalysisManager&&) CMM_NOEXCEPT = default;
+
+    const DominatorTree& AnalysisManager::getDominatorTree(const Function& function)
+    {
+        auto& dominatorTree = dominators[&function];
+
+        if (dominatorTree == nullptr)
+        {
+            dominatorTree = std::make_unique<DominatorTree>(function);
+            ++computedCount;
+        }
+
+        return *dominatorTree;
+    }
+
+    LoopInfo& AnalysisManager::getLoopInfo(const Function& function)
+    {
+        auto& loopInfo = loops[&function];
+
+        if (loopInfo == nullptr)
+        {
+            loopInfo = std::make_unique<LoopInfo>(getDominatorTree(function));
+            ++computedCount;
+        }
+
+        return *loopInfo;
+    }
+
+    const CallGraph& AnalysisManager::getCallGraph(const Module& module)
+    {
+        if (callGraph == nullptr)
+        {
+            callGraph = std::make_unique<CallGraph>(module);
+            ++computedCount;
+        }
+
+        return *callGraph;
+    }
+
+    const AliasAnalysis& AnalysisManager::getAliasAnalysis(const Function& function)
+    {
+        auto& aliasAnalysis = aliases[&function];
+
+        if (aliasAnalysis == nullptr)
+        {
+            aliasAnalysis = std::make_unique<AliasAnalysis>(function);
+            ++computedCount;
+        }
+
+        return *aliasAnalysis;
+    }
+
+    void AnalysisManager::invalidate(const u8 preserved)
+    {
+        if ((preserved & EnumAnalysis::DOMINATORS) == 0)
+        {
+            dominators.clear();
+            loops.clear();
+        }
+
+        else if ((preserved & EnumAnalysis::LOOPS) == 0)
+        {
+            loops.clear();
+        }
+
+        if ((preserved & EnumAnalysis::CALL_GRAPH) == 0)
+        {
+            callGraph.reset();
+        }
+
+        if ((preserved & EnumAnalysis::ALIASES) == 0)
+        {
+            aliases.clear();
+        }
+    }
+
+    std::size_t AnalysisManager::getComputedCount() const CMM_NOEXCEPT
+    {
+        return computedCount;
+    }
+
+    Pass::Pass(const std::string& name) : name(name)
+    {
+    }
+
+    const std::string& Pass::getName() const CMM_NOEXCEPT
+    {
+        return name;
+    }
+
+    std::string Pass::getDetails() const
+    {
+        return "";
+    }
+
+    PassManager::PassManager() CMM_NOEXCEPT : vectorWidth(LoopVectorize::defaultVectorWidth)
+    {
+    }
+
+    void PassManager::addPass(std::unique_ptr<Pass> pass)
+    {
+        passes.emplace_back(std::move(pass));
+    }
+
+    u32 PassManager::getVectorWidth() const CMM_NOEXCEPT
+    {
+        return vectorWidth;
+    }
+
+    void PassManager::setVectorWidth(const u32 vectorWidth) CMM_NOEXCEPT
+    {
+        this->vectorWidth = vectorWidth;
+    }
+
+    bool PassManager::addPipeline(const std::string& pipeline, std::string* errorMessage)
+    {
+        std::vector<std::unique_ptr<Pass>> created;
+        std::istringstream is(pipeline);
+        std::string name;
+
+        while (std::getline(is, name, ','))
+        {
+            auto pass = createPass(name, vectorWidth);
+
+            if (pass == nullptr)
+            {
+                if (errorMessage != nullptr)
+                {
+                    *errorMessage = "Unknown pass '" + name + "'";
+                }
+
+                return false;
+            }
+
+            created.emplace_back(std::move(pass));
+        }
+
+        for (auto& pass : created)
+        {
+            passes.emplace_back(std::move(pass));
+        }
+
+        return true;
+    }
+
+    void PassManager::addDefaultPipeline(const EnumOptLevel level)
+    {
+        switch (level)
+        {
+        case EnumOptLevel::O1:
+            addPipeline("sroa,mem2reg,argattrs,funcattrs,tailcall,constprop,peephole,dce", nullptr);
+            break;
+        case EnumOptLevel::O2:
+            // Recursion turned into loops before inlining leaves those functions inlinable and
+            // their loops for the loop passes.  Constants are propagated again once loop strength
+            // reduction exposed new ones.  The peephole pass comes last since the multiplications
+            // it turns into shifts are what loop strength reduction looks for.  Inlining turns
+            // struct arguments into plain copies, so those locals are split and promoted again.
+            // Loops are vectorized once nothing is left to hoist or simplify in their bodies.
+            addPipeline("sroa,mem2reg,argattrs,funcattrs,tailcall,inline,sroa,mem2reg,constprop,gvn,licm,lsr,constprop,peephole,vectorize,dce", nullptr);
+            break;
+        case EnumOptLevel::O0:
+            // fallthrough
+        default:
+            break;
+        }
+    }
+
+    bool PassManager::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& pass : passes)
+        {
+            PassStatistics passStatistics;
+            passStatistics.name = pass->getName();
+            passStatistics.instructionsBefore = module.getInstructionCount();
+
+            const auto start = std::chrono::steady_clock::now();
+            passStatistics.changed = pass->run(module, analyses);
+            const auto end = std::chrono::steady_clock::now();
+
+            passStatistics.milliseconds = std::chrono::duration<f64, std::milli>(end - start).count();
+            passStatistics.instructionsAfter = module.getInstructionCount();
+            passStatistics.details = pass->getDetails();
+
+            // An unchanged module keeps every analysis valid.
+            if (passStatistics.changed)
+            {
+                analyses.invalidate(pass->getPreservedAnalyses());
+                changed = true;
+            }
+
+            statistics.emplace_back(std::move(passStatistics));
+        }
+
+        return changed;
+    }
+
+    std::size_t PassManager::size() const CMM_NOEXCEPT
+    {
+        return passes.size();
+    }
+
+    std::vector<std::string> PassManager::getPassNames() const
+    {
+        std::vector<std::string> names;
+        names.reserve(passes.size());
+
+        for (const auto& pass : passes)
+        {
+            names.push_back(pass->getName());
+        }
+
+        return names;
+    }
+
+    const std::vector<PassStatistics>& PassManager::getStatistics() const CMM_NOEXCEPT
+    {
+        return statistics;
+    }
+
+    void PassManager::printStatistics(std::ostream& os) const
+    {
+        f64 totalMilliseconds = 0.0;
+
+        for (const auto& passStatistics : statistics)
+        {
+            const auto delta = static_cast<s64>(passStatistics.instructionsAfter) - static_cast<s64>(passStatistics.instructionsBefore);
+
+            os << "[stats] " << std::left << std::setw(10) << passStatistics.name << std::right
+               << std::fixed << std::setprecision(3) << std::setw(9) << passStatistics.milliseconds << " ms  "
+               << passStatistics.instructionsBefore << " -> " << passStatistics.instructionsAfter
+               << " instructions (" << std::showpos << delta << std::noshowpos << ")";
+
+            if (!passStatistics.details.empty())
+            {
+                os << ": " << passStatistics.details;
+            }
+
+            os << std::endl;
+            totalMilliseconds += passStatistics.milliseconds;
+        }
+
+        os << "[stats] total " << std::fixed << std::setprecision(3) << totalMilliseconds << " ms, "
+           << analyses.getComputedCount() << " analyses computed" << std::endl;
+    }
+
+    AnalysisManager& PassManager::getAnalysisManager() CMM_NOEXCEPT
+    {
+        return analyses;
+    }
+
+    /* static */
+    std::unique_ptr<Pass> PassManager::createPass(const std::string& name)
+    {
+        return createPass(name, LoopVectorize::defaultVectorWidth);
+    }
+
+    /* static */
+    std::unique_ptr<Pass> PassManager::createPass(const std::string& name, const u32 vectorWidth)
+    {
+        if (name == "mem2reg")
+        {
+            return std::make_unique<Mem2RegPass>();
+        }
+
+        else if (name == "sroa")
+        {
+            return std::make_unique<ScalarReplacementPass>();
+        }
+
+        else if (name == "argattrs")
+        {
+            return std::make_unique<ArgumentAttributesPass>();
+        }
+
+        else if (name == "funcattrs")
+        {
+            return std::make_unique<FunctionAttributesPass>();
+        }
+
+        else if (name == "inline")
+        {
+            return std::make_unique<InlinerPass>();
+        }
+
+        else if (name == "constprop")
+        {
+            return std::make_unique<ConstantPropagationPass>();
+        }
+
+        else if (name == "gvn")
+        {
+            return std::make_unique<GlobalValueNumberingPass>();
+        }
+
+        else if (name == "licm")
+        {
+            return std::make_unique<LoopInvariantCodeMotionPass>();
+        }
+
+        else if (name == "lsr")
+        {
+            return std::make_unique<LoopStrengthReductionPass>();
+        }
+
+        else if (name == "vectorize")
+        {
+            return std::make_unique<LoopVectorizePass>(vectorWidth);
+        }
+
+        else if (name == "peephole")
+        {
+            return std::make_unique<PeepholePass>();
+        }
+
+        else if (name == "tailcall")
+        {
+            return std::make_unique<TailCallEliminationPass>();
+        }
+
+        else if (name == "dce")
+        {
+            return std::make_unique<DeadCodeEliminationPass>();
+        }
+
+        return nullptr;
+    }
+}
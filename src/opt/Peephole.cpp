@@ -0,0 +1,659 @@
+/**
+ * Arithmetic peephole optimizations and strength reduction.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/Peephole.h>
+#include <cmm/ir/ConstantFold.h>
+#include <cmm/ir/IRBuilder.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    /**
+     * Gets a value as an int constant.
+     *
+     * @param value the Value.
+     * @return pointer to the ConstantInt, else nullptr.
+     */
+    static const ConstantInt* asConstantInt(const Value* value) CMM_NOEXCEPT
+    {
+        return value->getKind() == EnumValueKind::CONSTANT_INT ? static_cast<const ConstantInt*>(value) : nullptr;
+    }
+
+    /**
+     * Gets whether a value is the int constant c.
+     *
+     * @param value the Value.
+     * @param c the constant.
+     * @return bool.
+     */
+    static bool isConstantInt(const Value* value, const s64 c) CMM_NOEXCEPT
+    {
+        const auto* constant = asConstantInt(value);
+        return constant != nullptr && constant->getValue() == ConstantInt::normalize(c, value->getType()->getBits());
+    }
+
+    /**
+     * Gets the bits of a double, so constants compare exactly (-0.0 isn't 0.0).
+     *
+     * @param value the f64.
+     * @return u64 bits.
+     */
+    static u64 toBits(const f64 value) CMM_NOEXCEPT
+    {
+        u64 bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        return bits;
+    }
+
+    /**
+     * Gets whether a value is the floating point constant c.
+     *
+     * @param value the Value.
+     * @param c the constant.
+     * @return bool.
+     */
+    static bool isConstantFP(const Value* value, const f64 c) CMM_NOEXCEPT
+    {
+        return value->getKind() == EnumValueKind::CONSTANT_FP && toBits(static_cast<const ConstantFP*>(value)->getValue()) == toBits(c);
+    }
+
+    /**
+     * Gets the value an integer negation (0 - x) negates.
+     *
+     * @param value the Value.
+     * @return pointer to the negated Value, else nullptr if the value isn't a negation.
+     */
+    static Value* getNegated(const Value* value) CMM_NOEXCEPT
+    {
+        if (value->getKind() != EnumValueKind::INSTRUCTION)
+        {
+            return nullptr;
+        }
+
+        const auto* instruction = static_cast<const Instruction*>(value);
+        return instruction->getOpcode() == EnumOpcode::SUB && isConstantInt(instruction->getOperand(0), 0) ? instruction->getOperand(1) : nullptr;
+    }
+
+    static bool isPowerOfTwo(const u64 value) CMM_NOEXCEPT
+    {
+        return value != 0 && (value & (value - 1)) == 0;
+    }
+
+    static u32 log2(u64 value) CMM_NOEXCEPT
+    {
+        u32 result = 0;
+
+        while (value >>= 1)
+        {
+            ++result;
+        }
+
+        return result;
+    }
+
+    Peephole::Peephole() CMM_NOEXCEPT : simplifiedCount(0), strengthReducedCount(0)
+    {
+    }
+
+    bool Peephole::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& function : module.getFunctions())
+        {
+            changed |= run(*function);
+        }
+
+        return changed;
+    }
+
+    bool Peephole::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        IRBuilder builder(*function.getParent());
+        const std::size_t before = simplifiedCount + strengthReducedCount;
+        bool changed;
+
+        // Rewrites can expose more (ex. x * -1 becomes a negation that may cancel another).
+        do
+        {
+            changed = false;
+
+            for (auto& block : function)
+            {
+                for (auto iter = block->begin(); iter != block->end();)
+                {
+                    auto* instruction = (iter++)->get();
+
+                    if (!instruction->isBinaryOp() && instruction->getOpcode() != EnumOpcode::FNEG)
+                    {
+                        continue;
+                    }
+
+                    Value* replacement = simplify(*instruction);
+
+                    if (replacement != nullptr)
+                    {
+                        ++simplifiedCount;
+                    }
+
+                    else
+                    {
+                        builder.setInsertPoint(instruction);
+                        replacement = reduce(*instruction, builder);
+
+                        if (replacement == nullptr)
+                        {
+                            continue;
+                        }
+
+                        ++strengthReducedCount;
+                    }
+
+                    instruction->replaceAllUsesWith(replacement);
+                    instruction->eraseFromParent();
+                    changed = true;
+                }
+            }
+        }
+        while (changed);
+
+        return simplifiedCount + strengthReducedCount != before;
+    }
+
+    std::size_t Peephole::getSimplifiedCount() const CMM_NOEXCEPT
+    {
+        return simplifiedCount;
+    }
+
+    std::size_t Peephole::getStrengthReducedCount() const CMM_NOEXCEPT
+    {
+        return strengthReducedCount;
+    }
+
+    Value* Peephole::simplify(Instruction& instruction)
+    {
+        auto& module = *instruction.getParent()->getParent()->getParent();
+        const auto opcode = instruction.getOpcode();
+
+        if (opcode == EnumOpcode::FNEG)
+        {
+            // Negating flips the sign bit only, so it is its own inverse (NaNs and zeros included).
+            auto* operand = instruction.getOperand(0);
+
+            if (operand->getKind() == EnumValueKind::INSTRUCTION && static_cast<Instruction*>(operand)->getOpcode() == EnumOpcode::FNEG)
+            {
+                return static_cast<Instruction*>(operand)->getOperand(0);
+            }
+
+            return nullptr;
+        }
+
+        auto* left = instruction.getOperand(0);
+        auto* right = instruction.getOperand(1);
+
+        if (isFoldableConstant(left) && isFoldableConstant(right))
+        {
+            return foldBinary(module, opcode, left, right);
+        }
+
+        // Constants go on the right so only one side needs checking below.
+        if (instruction.isCommutative() && isFoldableConstant(left))
+        {
+            std::swap(left, right);
+        }
+
+        auto* type = instruction.getType();
+
+        switch (opcode)
+        {
+        case EnumOpcode::ADD:
+            // fallthrough
+        case EnumOpcode::OR:
+            if (isConstantInt(right, 0))
+            {
+                return left;
+            }
+
+            else if (opcode == EnumOpcode::OR && left == right)
+            {
+                return left;
+            }
+
+            else if (opcode == EnumOpcode::OR && isConstantInt(right, -1))
+            {
+                return right;
+            }
+
+            break;
+        case EnumOpcode::SUB:
+            if (isConstantInt(right, 0))
+            {
+                return left;
+            }
+
+            else if (left == right)
+            {
+                return module.getZero(type);
+            }
+
+            // 0 - (0 - x) == x, even for INT_MIN.
+            else if (isConstantInt(left, 0))
+            {
+                return getNegated(right);
+            }
+
+            break;
+        case EnumOpcode::MUL:
+            // fallthrough
+        case EnumOpcode::AND:
+            if (isConstantInt(right, 0))
+            {
+                return right;
+            }
+
+            else if (opcode == EnumOpcode::MUL && isConstantInt(right, 1))
+            {
+                return left;
+            }
+
+            else if (opcode == EnumOpcode::AND && (left == right || isConstantInt(right, -1)))
+            {
+                return left;
+            }
+
+            break;
+        case EnumOpcode::XOR:
+            if (isConstantInt(right, 0))
+            {
+                return left;
+            }
+
+            else if (left == right)
+            {
+                return module.getZero(type);
+            }
+
+            break;
+        case EnumOpcode::SDIV:
+            // fallthrough
+        case EnumOpcode::UDIV:
+            if (isConstantInt(right, 1))
+            {
+                return left;
+            }
+
+            break;
+        case EnumOpcode::SREM:
+            // fallthrough
+        case EnumOpcode::UREM:
+            if (isConstantInt(right, 1) || (opcode == EnumOpcode::SREM && isConstantInt(right, -1)))
+            {
+                return module.getZero(type);
+            }
+
+            break;
+        case EnumOpcode::SHL:
+            // fallthrough
+        case EnumOpcode::LSHR:
+            // fallthrough
+        case EnumOpcode::ASHR:
+            if (isConstantInt(right, 0))
+            {
+                return left;
+            }
+
+            else if (isConstantInt(left, 0))
+            {
+                return left;
+            }
+
+            break;
+        case EnumOpcode::FMUL:
+            // fallthrough
+        case EnumOpcode::FDIV:
+            // Only exact for 1.0: x + 0.0 isn't x when x is -0.0, and x * 0.0 isn't 0.0 for NaNs.
+            if (isConstantFP(right, 1.0))
+            {
+                return left;
+            }
+
+            break;
+        default:
+            break;
+        }
+
+        return nullptr;
+    }
+
+    Value* Peephole::reduce(Instruction& instruction, IRBuilder& builder)
+    {
+        if (!instruction.isBinaryOp())
+        {
+            return nullptr;
+        }
+
+        auto& module = builder.getModule();
+        const auto opcode = instruction.getOpcode();
+        auto* left = instruction.getOperand(0);
+        auto* right = instruction.getOperand(1);
+
+        if (instruction.isCommutative() && isFoldableConstant(left))
+        {
+            std::swap(left, right);
+        }
+
+        auto* type = instruction.getType();
+        const u32 bits = type->getBits();
+        const auto* constant = asConstantInt(right);
+
+        switch (opcode)
+        {
+        case EnumOpcode::ADD:
+            // x + (0 - y) == x - y
+            if (auto* negated = getNegated(right); negated != nullptr)
+            {
+                return builder.createBinary(EnumOpcode::SUB, left, negated);
+            }
+
+            else if (auto* negatedLeft = getNegated(left); negatedLeft != nullptr)
+            {
+                return builder.createBinary(EnumOpcode::SUB, right, negatedLeft);
+            }
+
+            break;
+        case EnumOpcode::SUB:
+            // x - (0 - y) == x + y
+            if (auto* negated = getNegated(right); negated != nullptr && !isConstantInt(left, 0))
+            {
+                return builder.createBinary(EnumOpcode::ADD, left, negated);
+            }
+
+            break;
+        case EnumOpcode::MUL:
+            if (constant == nullptr)
+            {
+                break;
+            }
+
+            else if (constant->isAllOnes())
+            {
+                return builder.createBinary(EnumOpcode::SUB, module.getZero(type), left);
+            }
+
+            // Wrapping is the same either way, so this holds for any power of two (the sign bit included).
+            else if (isPowerOfTwo(constant->getZExtValue()))
+            {
+                return builder.createBinary(EnumOpcode::SHL, left, module.getConstantInt(type, log2(constant->getZExtValue())));
+            }
+
+            break;
+        case EnumOpcode::UDIV:
+            // fallthrough
+        case EnumOpcode::UREM:
+        {
+            if (constant == nullptr || constant->isZero())
+            {
+                break;
+            }
+
+            const u64 divisor = constant->getZExtValue();
+
+            if (isPowerOfTwo(divisor))
+            {
+                if (opcode == EnumOpcode::UDIV)
+                {
+                    return builder.createBinary(EnumOpcode::LSHR, left, module.getConstantInt(type, log2(divisor)));
+                }
+
+                return builder.createBinary(EnumOpcode::AND, left, module.getConstantInt(type, static_cast<s64>(divisor - 1)));
+            }
+
+            auto* quotient = createUnsignedDivision(builder, left, divisor);
+
+            if (quotient == nullptr || opcode == EnumOpcode::UDIV)
+            {
+                return quotient;
+            }
+
+            // x % d == x - (x / d) * d
+            return builder.createBinary(EnumOpcode::SUB, left, builder.createBinary(EnumOpcode::MUL, quotient, right));
+        }
+        case EnumOpcode::SDIV:
+            // fallthrough
+        case EnumOpcode::SREM:
+        {
+            if (constant == nullptr || constant->isZero() || bits < 2)
+            {
+                break;
+            }
+
+            const s64 divisor = constant->getValue();
+
+            // INT_MIN / -1 is undefined, so the negation's wrapping is as good as any.
+            if (divisor == -1)
+            {
+                return builder.createBinary(EnumOpcode::SUB, module.getZero(type), left);
+            }
+
+            else if (divisor > 0 && isPowerOfTwo(static_cast<u64>(divisor)))
+            {
+                // Rounding toward zero: negative dividends get 2^k - 1 added before shifting.
+                const u32 shift = log2(static_cast<u64>(divisor));
+                auto* sign = builder.createBinary(EnumOpcode::ASHR, left, module.getConstantInt(type, bits - 1));
+                auto* bias = builder.createBinary(EnumOpcode::LSHR, sign, module.getConstantInt(type, bits - shift));
+                auto* biased = builder.createBinary(EnumOpcode::ADD, left, bias);
+
+                if (opcode == EnumOpcode::SDIV)
+                {
+                    return builder.createBinary(EnumOpcode::ASHR, biased, module.getConstantInt(type, shift));
+                }
+
+                // x % 2^k == x - ((x + bias) & -2^k)
+                auto* truncated = builder.createBinary(EnumOpcode::AND, biased, module.getConstantInt(type, -divisor));
+                return builder.createBinary(EnumOpcode::SUB, left, truncated);
+            }
+
+            auto* quotient = createSignedDivision(builder, left, divisor);
+
+            if (quotient == nullptr || opcode == EnumOpcode::SDIV)
+            {
+                return quotient;
+            }
+
+            return builder.createBinary(EnumOpcode::SUB, left, builder.createBinary(EnumOpcode::MUL, quotient, right));
+        }
+        case EnumOpcode::FDIV:
+        {
+            // x / 2^k == x * 2^-k exactly, as long as 2^-k is itself a normal number.
+            if (right->getKind() != EnumValueKind::CONSTANT_FP)
+            {
+                break;
+            }
+
+            const f64 divisor = static_cast<const ConstantFP*>(right)->getValue();
+            const f64 reciprocal = 1.0 / divisor;
+            const bool normal = type->getKind() == EnumTypeKind::FLOAT ? std::isnormal(static_cast<f32>(reciprocal)) && std::isnormal(static_cast<f32>(divisor))
+                                                                       : std::isnormal(reciprocal) && std::isnormal(divisor);
+
+            // A normal power of two has no mantissa bits set (floats are held exactly as doubles).
+            constexpr u64 mantissaMask = (static_cast<u64>(1) << 52) - 1;
+
+            if (normal && (toBits(divisor) & mantissaMask) == 0)
+            {
+                return builder.createBinary(EnumOpcode::FMUL, left, module.getConstantFP(type, reciprocal));
+            }
+
+            break;
+        }
+        default:
+            break;
+        }
+
+        return nullptr;
+    }
+
+    /* static */
+    Value* Peephole::createUnsignedDivision(IRBuilder& builder, Value* dividend, const u64 divisor)
+    {
+        auto& module = builder.getModule();
+        auto* type = dividend->getType();
+        const u32 bits = type->getBits();
+
+        // The multiply-high is done in a type twice as wide.
+        if (bits < 2 || bits > 32)
+        {
+            return nullptr;
+        }
+
+        // Above half the range, the quotient is either 0 or 1.
+        else if (divisor > (static_cast<u64>(1) << (bits - 1)))
+        {
+            auto* compare = builder.createICmp(EnumCmpPredicate::UGE, dividend, module.getConstantInt(type, static_cast<s64>(divisor)));
+            return builder.createCast(EnumOpcode::ZEXT, compare, type);
+        }
+
+        // Granlund and Montgomery: x / d == (x * m) >> p for m = ceil(2^p / d) when
+        // m * d - 2^p <= 2^(p - bits).  Such a p always exists in [bits, bits + log2(d)].
+        const u32 ceilLog2 = log2(divisor) + 1;
+        auto* wide = module.getTypes().getInt(64);
+        u32 shift = bits;
+        u64 multiplier = 0;
+
+        for (; shift <= bits + ceilLog2; ++shift)
+        {
+            const u64 power = static_cast<u64>(1) << shift;
+            multiplier = (power + divisor - 1) / divisor;
+
+            if (multiplier * divisor - power <= (static_cast<u64>(1) << (shift - bits)))
+            {
+                break;
+            }
+        }
+
+        auto* extended = builder.createCast(EnumOpcode::ZEXT, dividend, wide);
+
+        if (multiplier < (static_cast<u64>(1) << bits))
+        {
+            auto* product = builder.createBinary(EnumOpcode::MUL, extended, module.getConstantInt(wide, static_cast<s64>(multiplier)));
+            auto* high = builder.createBinary(EnumOpcode::LSHR, product, module.getConstantInt(wide, shift));
+            return builder.createCast(EnumOpcode::TRUNC, high, type);
+        }
+
+        // The multiplier needs bits + 1 bits, so multiply by the low bits and add the dividend
+        // back in without overflowing: x / d == (((x - t) >> 1) + t) >> (p - bits - 1).
+        shift = bits + ceilLog2;
+        multiplier = ((static_cast<u64>(1) << shift) + divisor - 1) / divisor - (static_cast<u64>(1) << bits);
+
+        auto* product = builder.createBinary(EnumOpcode::MUL, extended, module.getConstantInt(wide, static_cast<s64>(multiplier)));
+        auto* high = builder.createCast(EnumOpcode::TRUNC, builder.createBinary(EnumOpcode::LSHR, product, module.getConstantInt(wide, bits)), type);
+        auto* difference = builder.createBinary(EnumOpcode::SUB, dividend, high);
+        auto* halved = builder.createBinary(EnumOpcode::LSHR, difference, module.getConstantInt(type, 1));
+        auto* sum = builder.createBinary(EnumOpcode::ADD, halved, high);
+
+        return shift - bits - 1 > 0 ? builder.createBinary(EnumOpcode::LSHR, sum, module.getConstantInt(type, shift - bits - 1)) : sum;
+    }
+
+    /* static */
+    Value* Peephole::createSignedDivision(IRBuilder& builder, Value* dividend, const s64 divisor)
+    {
+        auto& module = builder.getModule();
+        auto* type = dividend->getType();
+        const u32 bits = type->getBits();
+
+        if (bits < 2 || bits > 32 || divisor == ConstantInt::normalize(static_cast<s64>(1) << (bits - 1), bits))
+        {
+            return nullptr;
+        }
+
+        // The magic number and shift, from Hacker's Delight (10-1), computed modulo 2^bits.
+        const u64 mask = (static_cast<u64>(1) << bits) - 1;
+        const u64 signBit = static_cast<u64>(1) << (bits - 1);
+        const u64 absDivisor = static_cast<u64>(divisor < 0 ? -divisor : divisor);
+        const u64 t = signBit + (divisor < 0 ? 1 : 0);
+        const u64 absNc = t - 1 - t % absDivisor;
+        u32 p = bits - 1;
+        u64 q1 = signBit / absNc;
+        u64 r1 = signBit - q1 * absNc;
+        u64 q2 = signBit / absDivisor;
+        u64 r2 = signBit - q2 * absDivisor;
+        u64 delta;
+
+        do
+        {
+            ++p;
+            q1 = (q1 << 1) & mask;
+            r1 = (r1 << 1) & mask;
+
+            if (r1 >= absNc)
+            {
+                q1 = (q1 + 1) & mask;
+                r1 = (r1 - absNc) & mask;
+            }
+
+            q2 = (q2 << 1) & mask;
+            r2 = (r2 << 1) & mask;
+
+            if (r2 >= absDivisor)
+            {
+                q2 = (q2 + 1) & mask;
+                r2 = (r2 - absDivisor) & mask;
+            }
+
+            delta = (absDivisor - r2) & mask;
+        }
+        while (q1 < delta || (q1 == delta && r1 == 0));
+
+        s64 magic = ConstantInt::normalize(static_cast<s64>(q2 + 1), bits);
+
+        if (divisor < 0)
+        {
+            magic = ConstantInt::normalize(-magic, bits);
+        }
+
+        const u32 shift = p - bits;
+
+        // q = mulhs(x, magic), corrected when the magic number's sign differs from the divisor's.
+        auto* wide = module.getTypes().getInt(64);
+        auto* extended = builder.createCast(EnumOpcode::SEXT, dividend, wide);
+        auto* product = builder.createBinary(EnumOpcode::MUL, extended, module.getConstantInt(wide, magic));
+        auto* high = builder.createBinary(EnumOpcode::ASHR, product, module.getConstantInt(wide, bits));
+        Value* quotient = builder.createCast(EnumOpcode::TRUNC, high, type);
+
+        if (divisor > 0 && magic < 0)
+        {
+            quotient = builder.createBinary(EnumOpcode::ADD, quotient, dividend);
+        }
+
+        else if (divisor < 0 && magic > 0)
+        {
+            quotient = builder.createBinary(EnumOpcode::SUB, quotient, dividend);
+        }
+
+        if (shift > 0)
+        {
+            quotient = builder.createBinary(EnumOpcode::ASHR, quotient, module.getConstantInt(type, shift));
+        }
+
+        // Round toward zero: add one when the quotient is negative.
+        auto* signBitValue = builder.createBinary(EnumOpcode::LSHR, quotient, module.getConstantInt(type, bits - 1));
+        return builder.createBinary(EnumOpcode::ADD, quotient, signBitValue);
+    }
+}
@@ -0,0 +1,329 @@
+/**
+ * Scalar replacement of aggregates.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/ScalarReplacement.h>
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/IRBuilder.h>
+#include <cmm/ir/Module.h>
+
+// std includes
+#include <algorithm>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    // Splitting a large array into that many slots would only bloat the function.
+    static constexpr u64 MAX_SPLIT_ELEMENTS = 32;
+
+    /**
+     * Gets the number of fields (or elements) of an aggregate that can be split.
+     *
+     * @param type the Type.
+     * @return u64 the number of fields, 0 if the type isn't a splittable aggregate.
+     */
+    static u64 getFieldCount(const Type* type) CMM_NOEXCEPT
+    {
+        if (type->isStruct())
+        {
+            return type->isOpaque() ? 0 : type->getFields().size();
+        }
+
+        else if (type->isArray() && type->getCount() <= MAX_SPLIT_ELEMENTS)
+        {
+            return type->getCount();
+        }
+
+        return 0;
+    }
+
+    /**
+     * Gets the type of a field (or element) of an aggregate.
+     *
+     * @param type the aggregate Type.
+     * @param index the index of the field.
+     * @return pointer to the field's Type.
+     */
+    static Type* getFieldType(const Type* type, const u64 index) CMM_NOEXCEPT
+    {
+        return type->isStruct() ? type->getFields()[static_cast<std::size_t>(index)] : type->getElementType();
+    }
+
+    /**
+     * Gets whether a value is a constant int equal to c.
+     *
+     * @param value the Value.
+     * @param c the constant to compare against.
+     * @return bool.
+     */
+    static bool isConstantInt(const Value* value, const s64 c) CMM_NOEXCEPT
+    {
+        return value->getKind() == EnumValueKind::CONSTANT_INT && static_cast<const ConstantInt*>(value)->getValue() == c;
+    }
+
+    /**
+     * Gets whether a load is one half of an aggregate copy, i.e. the loaded value is
+     * only ever stored somewhere.
+     *
+     * @param value the Value.
+     * @return bool.
+     */
+    static bool isCopyLoad(const Value* value)
+    {
+        if (value->getKind() != EnumValueKind::INSTRUCTION || static_cast<const Instruction*>(value)->getOpcode() != EnumOpcode::LOAD)
+        {
+            return false;
+        }
+
+        for (const auto* user : value->getUsers())
+        {
+            if (user->getOpcode() != EnumOpcode::STORE || user->getOperand(0) != value)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    ScalarReplacement::ScalarReplacement() CMM_NOEXCEPT : splitCount(0)
+    {
+    }
+
+    bool ScalarReplacement::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& function : module.getFunctions())
+        {
+            changed |= run(*function);
+        }
+
+        return changed;
+    }
+
+    bool ScalarReplacement::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        std::vector<Instruction*> worklist;
+
+        for (const auto& instruction : *function.getEntryBlock())
+        {
+            if (instruction->getOpcode() == EnumOpcode::ALLOCA && getFieldCount(instruction->getAuxType()) > 0)
+            {
+                worklist.push_back(instruction.get());
+            }
+        }
+
+        const std::size_t before = splitCount;
+
+        while (!worklist.empty())
+        {
+            auto* alloca = worklist.back();
+            worklist.pop_back();
+
+            if (!isSplittable(*alloca))
+            {
+                continue;
+            }
+
+            // Fields that are aggregates themselves get their own turn.
+            for (auto* field : split(alloca))
+            {
+                if (getFieldCount(field->getAuxType()) > 0)
+                {
+                    worklist.push_back(field);
+                }
+            }
+
+            ++splitCount;
+        }
+
+        return splitCount != before;
+    }
+
+    std::size_t ScalarReplacement::getSplitCount() const CMM_NOEXCEPT
+    {
+        return splitCount;
+    }
+
+    /* static */
+    bool ScalarReplacement::isSplittable(const Instruction& alloca)
+    {
+        if (alloca.getOpcode() != EnumOpcode::ALLOCA || alloca.getParent() != alloca.getParent()->getParent()->getEntryBlock())
+        {
+            return false;
+        }
+
+        auto* type = alloca.getAuxType();
+        const u64 count = getFieldCount(type);
+
+        if (count == 0 || mayEscape(&alloca))
+        {
+            return false;
+        }
+
+        for (const auto* user : alloca.getUsers())
+        {
+            switch (user->getOpcode())
+            {
+            case EnumOpcode::GET_ELEMENT_PTR:
+            {
+                // Only 'p, 0, k' with a constant k in bounds names a single field.
+                if (user->getOperand(0) != &alloca || user->getNumOperands() < 3 || !isConstantInt(user->getOperand(1), 0)
+                    || user->getOperand(2)->getKind() != EnumValueKind::CONSTANT_INT)
+                {
+                    return false;
+                }
+
+                const s64 index = static_cast<const ConstantInt*>(user->getOperand(2))->getValue();
+
+                if (index < 0 || static_cast<u64>(index) >= count)
+                {
+                    return false;
+                }
+
+                break;
+            }
+            case EnumOpcode::LOAD:
+                if (user->getType() != type || !isCopyLoad(user))
+                {
+                    return false;
+                }
+
+                break;
+            case EnumOpcode::STORE:
+                if (user->getOperand(1) != &alloca || user->getOperand(0)->getType() != type || !isCopyLoad(user->getOperand(0)))
+                {
+                    return false;
+                }
+
+                break;
+            default:
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::vector<Instruction*> ScalarReplacement::split(Instruction* alloca)
+    {
+        auto& module = *alloca->getParent()->getParent()->getParent();
+        auto* type = alloca->getAuxType();
+        const u64 count = getFieldCount(type);
+        auto* i32 = module.getTypes().getInt(32);
+        auto* zero = module.getConstantInt(i32, 0);
+        IRBuilder builder(module);
+
+        // Break up the copies first: the loads (from anywhere) of what gets stored into the
+        // alloca and the loads of the alloca (stored anywhere), so only field GEPs are left.
+        std::vector<Instruction*> copies;
+
+        for (auto* user : alloca->getUsers())
+        {
+            auto* load = user->getOpcode() == EnumOpcode::STORE ? static_cast<Instruction*>(user->getOperand(0)) : user;
+
+            if (load->getOpcode() == EnumOpcode::LOAD && std::find(copies.cbegin(), copies.cend(), load) == copies.cend())
+            {
+                copies.push_back(load);
+            }
+        }
+
+        for (auto* load : copies)
+        {
+            std::vector<Value*> values;
+            values.reserve(count);
+            builder.setInsertPoint(load);
+
+            for (u64 i = 0; i < count; ++i)
+            {
+                auto* index = module.getConstantInt(i32, static_cast<s64>(i));
+                auto* pointer = builder.createGEP(type, load->getOperand(0), { zero, index });
+                values.push_back(builder.createLoad(pointer, load->hasName() ? load->getName() + "." + std::to_string(i) : ""));
+            }
+
+            // The stored values are the ones loaded above, so copying field by field at each
+            // store keeps reading the source at the load.
+            const std::vector<Instruction*> stores = load->getUsers();
+
+            for (auto* store : stores)
+            {
+                builder.setInsertPoint(store);
+
+                for (u64 i = 0; i < count; ++i)
+                {
+                    auto* index = module.getConstantInt(i32, static_cast<s64>(i));
+                    builder.createStore(values[i], builder.createGEP(type, store->getOperand(1), { zero, index }));
+                }
+
+                store->eraseFromParent();
+            }
+
+            load->eraseFromParent();
+        }
+
+        std::vector<Instruction*> fields;
+        fields.reserve(count);
+        builder.setInsertPoint(alloca);
+
+        for (u64 i = 0; i < count; ++i)
+        {
+            fields.push_back(builder.createAlloca(getFieldType(type, i), alloca->hasName() ? alloca->getName() + "." + std::to_string(i) : ""));
+        }
+
+        const std::vector<Instruction*> geps = alloca->getUsers();
+
+        for (auto* gep : geps)
+        {
+            const auto index = static_cast<std::size_t>(static_cast<const ConstantInt*>(gep->getOperand(2))->getValue());
+            Value* replacement = fields[index];
+
+            // Deeper indices now step into the field itself.
+            if (gep->getNumOperands() > 3)
+            {
+                std::vector<Value*> indices { gep->getOperand(1) };
+
+                for (std::size_t i = 3; i < gep->getNumOperands(); ++i)
+                {
+                    indices.push_back(gep->getOperand(i));
+                }
+
+                builder.setInsertPoint(gep);
+                replacement = builder.createGEP(fields[index]->getAuxType(), fields[index], indices, gep->getName());
+            }
+
+            gep->replaceAllUsesWith(replacement);
+            gep->eraseFromParent();
+        }
+
+        alloca->eraseFromParent();
+
+        // Fields never accessed are simply dropped.
+        std::vector<Instruction*> used;
+
+        for (auto* field : fields)
+        {
+            if (field->hasUses())
+            {
+                used.push_back(field);
+            }
+
+            else
+            {
+                field->eraseFromParent();
+            }
+        }
+
+        return used;
+    }
+}
@@ -0,0 +1,222 @@
+/**
+ * Tail call elimination.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-19
+ */
+
+// Our includes
+#include <cmm/opt/TailCallElimination.h>
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/IRBuilder.h>
+#include <cmm/ir/Module.h>
+
+namespace cmm::opt
+{
+    using namespace ir;
+
+    TailCallElimination::TailCallElimination() CMM_NOEXCEPT : eliminatedCount(0), markedCount(0)
+    {
+    }
+
+    bool TailCallElimination::run(Module& module)
+    {
+        bool changed = false;
+
+        for (auto& function : module.getFunctions())
+        {
+            changed |= run(*function);
+        }
+
+        return changed;
+    }
+
+    bool TailCallElimination::run(Function& function)
+    {
+        if (function.isDeclaration())
+        {
+            return false;
+        }
+
+        // A local whose address got out may be in use by the callee, so the frame must stay.
+        // Allocas outside of the entry block would be executed again on each iteration.
+        bool entryAllocasOnly = true;
+
+        for (const auto& block : function)
+        {
+            for (const auto& instruction : *block)
+            {
+                if (instruction->getOpcode() != EnumOpcode::ALLOCA)
+                {
+                    continue;
+                }
+
+                else if (mayEscape(instruction.get()))
+                {
+                    return false;
+                }
+
+                else if (block.get() != function.getEntryBlock())
+                {
+                    entryAllocasOnly = false;
+                }
+            }
+        }
+
+        const std::size_t before = eliminatedCount + markedCount;
+        std::vector<Instruction*> selfCalls;
+
+        for (auto* call : findTailCalls(function))
+        {
+            auto* callee = call->getCalledFunction();
+
+            if (callee == &function && entryAllocasOnly)
+            {
+                selfCalls.push_back(call);
+            }
+
+            else if (!call->hasFlag(EnumInstructionFlag::TAIL) && !call->hasFlag(EnumInstructionFlag::MUST_TAIL))
+            {
+                // Matching prototypes are what LLVM needs to guarantee the frame is reused.
+                call->setFlag(callee->getFunctionType() == function.getFunctionType() ? EnumInstructionFlag::MUST_TAIL : EnumInstructionFlag::TAIL);
+                ++markedCount;
+            }
+        }
+
+        if (!selfCalls.empty())
+        {
+            eliminate(function, selfCalls);
+        }
+
+        return eliminatedCount + markedCount != before;
+    }
+
+    std::size_t TailCallElimination::getEliminatedCount() const CMM_NOEXCEPT
+    {
+        return eliminatedCount;
+    }
+
+    std::size_t TailCallElimination::getMarkedCount() const CMM_NOEXCEPT
+    {
+        return markedCount;
+    }
+
+    /* static */
+    std::vector<Instruction*> TailCallElimination::findTailCalls(const Function& function)
+    {
+        std::vector<Instruction*> calls;
+
+        for (const auto& block : function)
+        {
+            auto* terminator = block->getTerminator();
+
+            if (terminator == nullptr || terminator->getOpcode() != EnumOpcode::RET)
+            {
+                continue;
+            }
+
+            Instruction* previous = nullptr;
+
+            for (const auto& instruction : *block)
+            {
+                if (instruction.get() == terminator)
+                {
+                    break;
+                }
+
+                previous = instruction.get();
+            }
+
+            if (previous == nullptr || previous->getOpcode() != EnumOpcode::CALL)
+            {
+                continue;
+            }
+
+            else if (terminator->getNumOperands() == 0 ? previous->getType()->isVoid() : terminator->getOperand(0) == previous)
+            {
+                calls.push_back(previous);
+            }
+        }
+
+        return calls;
+    }
+
+    void TailCallElimination::eliminate(Function& function, const std::vector<Instruction*>& calls)
+    {
+        auto& module = *function.getParent();
+        auto* entry = function.getEntryBlock();
+        IRBuilder builder(module);
+
+        // Everything but the allocas moves to a new header the recursive calls branch back to.
+        Instruction* first = nullptr;
+
+        for (const auto& instruction : *entry)
+        {
+            if (instruction->getOpcode() != EnumOpcode::ALLOCA)
+            {
+                first = instruction.get();
+                break;
+            }
+        }
+
+        auto* header = function.insertBlockAfter(entry, std::make_unique<BasicBlock>(module.getTypes().getLabel(), "tailrecurse"));
+        entry->spliceInto(first, header);
+
+        builder.setInsertPoint(entry);
+        auto* branch = builder.createBr(header);
+
+        for (auto iter = header->begin(); iter != header->end();)
+        {
+            auto* instruction = (iter++)->get();
+
+            if (instruction->getOpcode() == EnumOpcode::ALLOCA)
+            {
+                instruction->moveBefore(branch);
+            }
+        }
+
+        for (auto* succ : header->getSuccessors())
+        {
+            for (auto& instruction : *succ)
+            {
+                if (instruction->getOpcode() != EnumOpcode::PHI)
+                {
+                    break;
+                }
+
+                instruction->replaceUsesOfWith(entry, header);
+            }
+        }
+
+        // Each argument becomes a phi of the original argument and what each call passes.
+        std::vector<Instruction*> phis;
+        builder.setInsertPoint(header->front());
+
+        for (std::size_t i = 0; i < function.argSize(); ++i)
+        {
+            auto* arg = function.getArg(i);
+            auto* phi = builder.createPhi(arg->getType(), arg->hasName() ? arg->getName() + ".tr" : "");
+
+            arg->replaceAllUsesWith(phi);
+            phi->addIncoming(arg, entry);
+            phis.push_back(phi);
+        }
+
+        for (auto* call : calls)
+        {
+            auto* block = call->getParent();
+            auto* ret = block->getTerminator();
+
+            for (std::size_t i = 0; i < phis.size(); ++i)
+            {
+                phis[i]->addIncoming(call->getOperand(i + 1), block);
+            }
+
+            builder.setInsertPoint(ret);
+            builder.createBr(header);
+            ret->eraseFromParent();
+            call->eraseFromParent();
+            ++eliminatedCount;
+        }
+    }
+}
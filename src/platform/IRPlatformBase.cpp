@@ -0,0 +1,82 @@
+/**
+ * A base class for platform backends that consume the cmm IR (rather than AST nodes).
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/platform/IRPlatformBase.h>
+#include <cmm/ir/Module.h>
+#include <cmm/ir/SlotTracker.h>
+
+// std includes
+#include <ostream>
+
+namespace cmm
+{
+    IRPlatformBase::IRPlatformBase(const std::string& name) : name(name)
+    {
+    }
+
+    IRPlatformBase::IRPlatformBase(std::string&& name) CMM_NOEXCEPT : name(std::move(name))
+    {
+    }
+
+    const std::string& IRPlatformBase::getName() const CMM_NOEXCEPT
+    {
+        return name;
+    }
+
+    void IRPlatformBase::emit(const ir::Module& module, std::ostream& os)
+    {
+        emitHeader(module, os);
+
+        for (const auto* type : module.getTypes().getStructs())
+        {
+            emitStructType(*type, os);
+        }
+
+        for (const auto& global : module.getGlobals())
+        {
+            emitGlobal(*global, os);
+        }
+
+        for (const auto& function : module.getFunctions())
+        {
+            if (function->isDeclaration())
+            {
+                emitFunctionDeclaration(*function, os);
+                continue;
+            }
+
+            ir::SlotTracker slots;
+            slots.incorporate(*function);
+            emitFunctionStart(*function, slots, os);
+
+            for (const auto& block : *function)
+            {
+                emitBlockLabel(*block, slots, os);
+
+                for (const auto& instruction : *block)
+                {
+                    emitInstruction(*instruction, slots, os);
+                }
+            }
+
+            emitFunctionEnd(*function, os);
+        }
+
+        emitFooter(module, os);
+    }
+
+    /* virtual */
+    void IRPlatformBase::emitHeader(const ir::Module& module, std::ostream& os)
+    {
+    }
+
+    /* virtual */
+    void IRPlatformBase::emitFooter(const ir::Module& module, std::ostream& os)
+    {
+    }
+}
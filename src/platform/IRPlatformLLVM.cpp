@@ -0,0 +1,92 @@
+/**
+ * An IR backend emitting LLVM assembly.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/platform/IRPlatformLLVM.h>
+#include <cmm/ir/Module.h>
+#include <cmm/ir/Printer.h>
+#include <cmm/ir/SlotTracker.h>
+
+// std includes
+#include <ostream>
+
+namespace cmm
+{
+    IRPlatformLLVM::IRPlatformLLVM() : IRPlatformBase("LLVM")
+    {
+    }
+
+    /* virtual */
+    void IRPlatformLLVM::emitHeader(const ir::Module& module, std::ostream& os) /* override */
+    {
+        if (!module.getName().empty())
+        {
+            os << "; ModuleID = '" << module.getName() << "'\n\n";
+        }
+    }
+
+    /* virtual */
+    void IRPlatformLLVM::emitStructType(const ir::Type& type, std::ostream& os) /* override */
+    {
+        // The IR printer already speaks LLVM's syntax, so reuse it rather than duplicating it.
+        ir::Printer printer(os, false);
+        printer.printStructType(type);
+        os << '\n';
+    }
+
+    /* virtual */
+    void IRPlatformLLVM::emitGlobal(const ir::GlobalVariable& global, std::ostream& os) /* override */
+    {
+        ir::Printer printer(os, false);
+        printer.printGlobal(global);
+        os << '\n';
+    }
+
+    /* virtual */
+    void IRPlatformLLVM::emitFunctionDeclaration(const ir::Function& function, std::ostream& os) /* override */
+    {
+        ir::SlotTracker slots;
+        ir::Printer printer(os, false);
+
+        os << '\n';
+        printer.printFunctionHeader(function, slots);
+        os << '\n';
+    }
+
+    /* virtual */
+    void IRPlatformLLVM::emitFunctionStart(const ir::Function& function, ir::SlotTracker& slots, std::ostream& os) /* override */
+    {
+        ir::Printer printer(os, false);
+
+        os << '\n';
+        printer.printFunctionHeader(function, slots);
+        os << "\n{\n";
+    }
+
+    /* virtual */
+    void IRPlatformLLVM::emitBlockLabel(const ir::BasicBlock& block, ir::SlotTracker& slots, std::ostream& os) /* override */
+    {
+        ir::Printer printer(os, false);
+        printer.printBlockLabel(block, slots);
+    }
+
+    /* virtual */
+    void IRPlatformLLVM::emitInstruction(const ir::Instruction& instruction, ir::SlotTracker& slots, std::ostream& os) /* override */
+    {
+        ir::Printer printer(os, false);
+
+        os << "    ";
+        printer.printInstruction(instruction, slots);
+        os << '\n';
+    }
+
+    /* virtual */
+    void IRPlatformLLVM::emitFunctionEnd(const ir::Function& function, std::ostream& os) /* override */
+    {
+        os << "}\n";
+    }
+}
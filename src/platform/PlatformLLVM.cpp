@@ -21,6 +21,18 @@
 
 namespace cmm
 {
+    /**
+     * Gets whether signed overflow of an integer type is undefined (i.e. 'nsw').  Anything
+     * narrower than an int would be promoted first in C, so it just truncates.
+     *
+     * @param datatype the integer CType.
+     * @return bool.
+     */
+    static bool hasUndefinedSignedOverflow(const CType& datatype) CMM_NOEXCEPT
+    {
+        return datatype.type == EnumCType::ENUM || datatype.type == EnumCType::INT32 || datatype.type == EnumCType::INT64;
+    }
+
     /* static */
     const std::string PlatformLLVM::structNamePrefix = "%struct.";
 
@@ -209,13 +221,13 @@ namespace cmm
         const auto rightTypeStr = resolveDatatype(referenceDatatype);
         const bool isFloatingPoint = referenceDatatype.isFloatingPoint();
 
-        // TODO: When we support unsigned types, make this dynamic:
-        CMM_CONSTEXPR bool isSignedInt = false;
+        // Note: Pointers compare as unsigned.
+        const bool isSignedInt = node.getLeft()->getDatatype().isSignedInt() && referenceDatatype.isSignedInt();
+        const bool isNoSignedWrap = isSignedInt && hasUndefinedSignedOverflow(referenceDatatype);
 
         auto& os = encoder->getOStream();
         encoder->printIndent();
 
-        // ASSIGNMENT = 0, ADD, SUBTRACT, MULTIPLY, DIVIDE
         const EnumBinOpNodeType binOpType = node.getTypeof();
 
         if (binOpType == EnumBinOpNodeType::ASSIGNMENT)
@@ -236,35 +248,86 @@ namespace cmm
             if (isFloatingPoint)
                 os << "fadd ";
             else
-                os << "add " << (isSignedInt ? "nsw " : "");
+                os << "add " << (isNoSignedWrap ? "nsw " : "");
 
             break;
         case EnumBinOpNodeType::SUBTRACT:
             if (isFloatingPoint)
                 os << "fsub ";
             else
-                os << "sub " << (isSignedInt ? "nsw " : "");
+                os << "sub " << (isNoSignedWrap ? "nsw " : "");
             break;
         case EnumBinOpNodeType::MULTIPLY:
             if (isFloatingPoint)
                 os << "fmul ";
             else
-                os << "mul " << (isSignedInt ? "nsw " : "");
+                os << "mul " << (isNoSignedWrap ? "nsw " : "");
             break;
         case EnumBinOpNodeType::DIVIDE:
             if (isFloatingPoint)
                 os << "fdiv ";
             else
-                os << (isSignedInt ? "sdiv nsw " : "udiv");
+                os << (isSignedInt ? "sdiv " : "udiv ");
+            break;
+        case EnumBinOpNodeType::MODULUS:
+            if (isFloatingPoint)
+                os << "frem ";
+            else
+                os << (isSignedInt ? "srem " : "urem ");
+            break;
+        case EnumBinOpNodeType::BITWISE_AND:
+            os << "and ";
+            break;
+        case EnumBinOpNodeType::BITWISE_OR:
+            os << "or ";
+            break;
+        case EnumBinOpNodeType::BITWISE_XOR:
+            os << "xor ";
+            break;
+        case EnumBinOpNodeType::SHIFT_LEFT:
+            os << "shl ";
+            break;
+        case EnumBinOpNodeType::SHIFT_RIGHT:
+            os << (node.getLeft()->getDatatype().isSignedInt() ? "ashr " : "lshr ");
+            break;
+        case EnumBinOpNodeType::CMP_EQ:
+            if (isFloatingPoint)
+                os << "fcmp oeq ";
+            else
+                os << "icmp eq ";
             break;
         case EnumBinOpNodeType::CMP_NE:
             reverseOperations = false;
 
             if (isFloatingPoint)
-                os << "fdiv ";
+                os << "fcmp une ";
             else
                 os << "icmp ne ";
             break;
+        case EnumBinOpNodeType::CMP_GE:
+            if (isFloatingPoint)
+                os << "fcmp oge ";
+            else
+                os << (isSignedInt ? "icmp sge " : "icmp uge ");
+            break;
+        case EnumBinOpNodeType::CMP_GT:
+            if (isFloatingPoint)
+                os << "fcmp ogt ";
+            else
+                os << (isSignedInt ? "icmp sgt " : "icmp ugt ");
+            break;
+        case EnumBinOpNodeType::CMP_LE:
+            if (isFloatingPoint)
+                os << "fcmp ole ";
+            else
+                os << (isSignedInt ? "icmp sle " : "icmp ule ");
+            break;
+        case EnumBinOpNodeType::CMP_LT:
+            if (isFloatingPoint)
+                os << "fcmp olt ";
+            else
+                os << (isSignedInt ? "icmp slt " : "icmp ult ");
+            break;
         default:
             {
                 static auto& reporter = Reporter::instance();
@@ -319,9 +382,7 @@ namespace cmm
 
             else if (datatype.isInt())
             {
-                // TODO: When we support unsigned types, make this dynamic:
-                CMM_CONSTEXPR bool isSignedInt = true;
-                return isSignedInt ? "si" : "ui";
+                return datatype.isUnsignedInt() ? "ui" : "si";
             }
 
             std::ostringstream os;
@@ -346,7 +407,7 @@ namespace cmm
         }
 
         encoder->printIndent();
-        os << temp << " = " << (toCType.isFloatingPoint() ? "fp" : "z");
+        os << temp << " = " << (toCType.isFloatingPoint() ? "fp" : fromCType.isSignedInt() ? "s" : "z");
 
         switch (node.getCastType())
         {
@@ -666,9 +727,7 @@ namespace cmm
         const EnumUnaryOpType opType = node.getOpType();
         const auto& datatype = node.getDatatype();
         const bool isFloatingPoint = datatype.isFloatingPoint();
-
-        // TODO: When we support unsigned types, make this dynamic:
-        CMM_CONSTEXPR bool isSignedInt = false;
+        const bool isNoSignedWrap = datatype.isSignedInt() && hasUndefinedSignedOverflow(datatype);
 
         auto& os = encoder->getOStream();
         std::string temp;
@@ -696,7 +755,7 @@ namespace cmm
 
             else
             {
-                os << "sub " << (isSignedInt ? "nsw " : "") << typeStr << " 0, ";
+                os << "sub " << (isNoSignedWrap ? "nsw " : "") << typeStr << " 0, ";
             }
 
             os << *expr.result.str;
@@ -719,7 +778,7 @@ namespace cmm
 
             else
             {
-                os << "add " << typeStr << (isSignedInt ? " nsw " : " ") << *expr.result.str << ", 1";
+                os << "add " << (isNoSignedWrap ? "nsw " : "") << typeStr << " " << *expr.result.str << ", 1";
             }
 
             // If it's postfix, we can either swap with temp or just return the original.
@@ -745,7 +804,7 @@ namespace cmm
 
             else
             {
-                os << "sub " << typeStr << (isSignedInt ? " nsw " : " ") << *expr.result.str << ", 1";
+                os << "sub " << (isNoSignedWrap ? "nsw " : "") << typeStr << " " << *expr.result.str << ", 1";
             }
 
             // If it's postfix, we can either swap with temp or just return the original.
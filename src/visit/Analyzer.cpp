@@ -14,8 +14,13 @@
 #include <cmm/StructTable.h>
 
 // std includes
+#include <algorithm>
 #include <cassert>
 #include <limits>
+#include <optional>
+#include <sstream>
+#include <unordered_set>
+#include <vector>
 
 namespace cmm
 {
@@ -28,7 +33,115 @@ namespace cmm
         return std::numeric_limits<T>::lowest() <= value && value <= std::numeric_limits<T>::max();
     }
 
-    Analyzer::Analyzer() CMM_NOEXCEPT : currentTranslationUnitNodePtr(nullptr)
+    /**
+     * Evaluates the expression of a case label, which must be an integer constant.
+     *
+     * @param expression the (analyzed) ExpressionNode.
+     * @return optional s64 value, std::nullopt if not an integer constant.
+     */
+    static std::optional<s64> evaluateCaseValue(const ExpressionNode* expression)
+    {
+        switch (expression->getType())
+        {
+        case EnumNodeType::LITTERAL:
+        {
+            const auto* litteralNode = static_cast<const LitteralNode*>(expression);
+            const auto& value = litteralNode->getValue();
+
+            switch (litteralNode->getDatatype().pointers == 0 ? litteralNode->getDatatype().type : EnumCType::NULL_T)
+            {
+            case EnumCType::CHAR:
+                return std::make_optional<s64>(value.valueChar);
+            case EnumCType::ENUM:
+                return std::make_optional<s64>(value.valueEnum);
+            case EnumCType::INT8:
+                return std::make_optional<s64>(value.valueS8);
+            case EnumCType::INT16:
+                return std::make_optional<s64>(value.valueS16);
+            case EnumCType::INT32:
+                return std::make_optional<s64>(value.valueS32);
+            case EnumCType::INT64:
+                return std::make_optional<s64>(value.valueS64);
+            default:
+                return std::nullopt;
+            }
+        }
+        case EnumNodeType::ENUM_USAGE:
+        {
+            const auto* enumerator = static_cast<const EnumUsageNode*>(expression)->getEnumerator();
+            return enumerator != nullptr ? std::make_optional<s64>(enumerator->getValue()) : std::nullopt;
+        }
+        case EnumNodeType::PAREN_EXPRESSION:
+            return evaluateCaseValue(static_cast<const ParenExpressionNode*>(expression)->getExpression());
+        case EnumNodeType::UNARY_OP:
+        {
+            const auto* unaryOpNode = static_cast<const UnaryOpNode*>(expression);
+            const auto opType = unaryOpNode->getOpType();
+
+            if ((opType != EnumUnaryOpType::NEGATIVE && opType != EnumUnaryOpType::POSITIVE) || !unaryOpNode->hasExpression())
+            {
+                return std::nullopt;
+            }
+
+            const auto value = evaluateCaseValue(unaryOpNode->getExpression());
+
+            if (value.has_value() && opType == EnumUnaryOpType::NEGATIVE)
+            {
+                return std::make_optional<s64>(-*value);
+            }
+
+            return value;
+        }
+        default:
+            return std::nullopt;
+        }
+    }
+
+    /**
+     * Gets whether a value can be represented by an integer type.
+     *
+     * @param datatype the integer CType.
+     * @param value the s64 value.
+     * @return bool.
+     */
+    static bool fitsIntType(const CType& datatype, const s64 value) CMM_NOEXCEPT
+    {
+        if (datatype.isUnsignedInt())
+        {
+            switch (datatype.type)
+            {
+            case EnumCType::CHAR:
+                // fallthrough
+            case EnumCType::INT8:
+                return static_cast<u8>(value) == value;
+            case EnumCType::INT16:
+                return static_cast<u16>(value) == value;
+            case EnumCType::INT32:
+                // Note: Not promoted any further, so a negative value wraps around like in C.
+                return static_cast<u32>(value) == value || static_cast<s32>(value) == value;
+            default:
+                return true;
+            }
+        }
+
+        switch (datatype.type)
+        {
+        case EnumCType::CHAR:
+            // fallthrough
+        case EnumCType::INT8:
+            return static_cast<s8>(value) == value;
+        case EnumCType::INT16:
+            return static_cast<s16>(value) == value;
+        case EnumCType::ENUM:
+            // fallthrough
+        case EnumCType::INT32:
+            return static_cast<s32>(value) == value;
+        default:
+            return true;
+        }
+    }
+
+    Analyzer::Analyzer() CMM_NOEXCEPT : currentTranslationUnitNodePtr(nullptr), breakableDepth(0)
     {
         localityStack.push(EnumLocality::GLOBAL);
     }
@@ -41,7 +154,83 @@ namespace cmm
         return VisitorResult();
     }
 
+    VisitorResult Analyzer::visit(ArrayIndexNode& node)
+    {
+        auto* expression = node.getExpression();
+        expression->accept(this);
+
+        const CType& datatype = expression->getDatatype();
+
+        if (!datatype.isArray() && (!datatype.isPointerType() || datatype.type == EnumCType::VOID || datatype.type == EnumCType::VOID_PTR))
+        {
+            std::ostringstream builder;
+            builder << "Subscripted value of type '";
+            printType(builder, datatype);
+            builder << "' is not an array or pointer";
+            reporter.error(builder.str(), node.getLocation());
+
+            // Carry on with the base's type to avoid cascading errors.
+            node.setDatatype(datatype);
+
+            return VisitorResult();
+        }
+
+        auto indexResult = node.getIndex()->accept(this);
+
+        if (indexResult.resultType == EnumVisitorResultType::NODE)
+        {
+            node.setIndex(std::unique_ptr<ExpressionNode>(static_cast<ExpressionNode*>(indexResult.result.node)));
+
+            // Release ownership
+            indexResult.owned = false;
+        }
+
+        auto* index = node.getIndex();
+
+        if (isValidNonLitteralRHSNodeType(index->getType()) && !isExpressionNodeAParameterVariable(index))
+        {
+            node.derefIndex();
+            index = node.getIndex();
+            index->accept(this);
+        }
+
+        if (!index->getDatatype().isInt())
+        {
+            std::ostringstream builder;
+            builder << "Array subscript of type '";
+            printType(builder, index->getDatatype());
+            builder << "' is not an integer";
+            reporter.error(builder.str(), index->getLocation());
+        }
+
+        node.setDatatype(datatype.getElementType());
+
+        return VisitorResult();
+    }
+
     VisitorResult Analyzer::visit(BinOpNode& node)
+    {
+        // Note: The right operands are analyzed outermost first and the rest of each
+        // node innermost first, matching the order of the recursive walk.
+        std::vector<BinOpNode*> spine;
+        node.collectLeftSpine(spine);
+
+        for (auto* binOpNode : spine)
+        {
+            analyzeBinOpRight(*binOpNode);
+        }
+
+        spine.back()->getLeft()->accept(this);
+
+        for (auto iter = spine.rbegin(); iter != spine.rend(); ++iter)
+        {
+            analyzeBinOpLeft(**iter);
+        }
+
+        return VisitorResult();
+    }
+
+    void Analyzer::analyzeBinOpRight(BinOpNode& node)
     {
         auto* rightNode = node.getRight();
         auto rightNodeResult = rightNode->accept(this);
@@ -75,26 +264,47 @@ namespace cmm
                 rightNode->accept(this);
                 rightType = rightNode->getDatatype();
             }
+
+            // An array read as a value is a pointer to its first element.
+            if (rightNode->getDatatype().isArray())
+            {
+                node.castRight(rightNode->getDatatype().decay());
+            }
         }
+    }
 
+    void Analyzer::analyzeBinOpLeft(BinOpNode& node)
+    {
         auto* leftNode = node.getLeft();
-
-        [[maybe_unused]]
-        auto leftNodeResult = leftNode->accept(this);
+        auto* rightNode = node.getRight();
+        auto& rightType = rightNode->getDatatype();
         const bool isAssignment = node.getTypeof() == EnumBinOpNodeType::ASSIGNMENT;
         const bool isLeftVariable = leftNode->getType() == EnumNodeType::VARIABLE;
         const bool isLeftDerefNode = leftNode->getType() == EnumNodeType::DEREF;
         const bool isLeftFieldAccess = leftNode->getType() == EnumNodeType::FIELD_ACCESS;
+        const bool isLeftArrayIndex = leftNode->getType() == EnumNodeType::ARRAY_INDEX;
 
-        if (isAssignment && !isLeftVariable && !isLeftDerefNode && !isLeftFieldAccess)
+        if (isAssignment && !isLeftVariable && !isLeftDerefNode && !isLeftFieldAccess && !isLeftArrayIndex)
         {
             reporter.error("Expression is not assignable", leftNode->getLocation());
 
-            return VisitorResult();
+            return;
+        }
+
+        else if (leftNode->getDatatype().isArray())
+        {
+            std::ostringstream builder;
+            builder << "Invalid operand of array type '";
+            printType(builder, leftNode->getDatatype());
+            builder << '\'';
+            reporter.error(builder.str(), leftNode->getLocation());
+
+            return;
         }
 
         // Establish the Node's datatype by it's left node.
-        const auto& leftType = leftNode->getDatatype();
+        // Copied since popping a DerefNode below frees the node it belongs to.
+        const CType leftType = leftNode->getDatatype();
         node.setDatatype(leftType);
 
         VariableNode* varNode = nullptr;
@@ -138,7 +348,7 @@ namespace cmm
                 // leftNode = node.getLeft();
             }
 
-            else if (isLeftFieldAccess)
+            else if (isLeftFieldAccess || isLeftArrayIndex)
             {
                 // For now, NOOP?
                 ;
@@ -148,7 +358,7 @@ namespace cmm
         // If the left node is a variable and this is NOT an assignment operation,
         // we need to add a DerefNode to wrap it.
         // else if (isLeftVariable || isLeftFieldAccess)
-        else if (isLeftVariable || isLeftFieldAccess || isLeftDerefNode) // @@@ testing
+        else if (isLeftVariable || isLeftFieldAccess || isLeftDerefNode || isLeftArrayIndex) // @@@ testing
         {
             if (!isExpressionNodeAParameterVariable(leftNode))
             {
@@ -178,6 +388,14 @@ namespace cmm
                 castRight = true;
             }
 
+            // Like C's usual arithmetic conversions, an unsigned operand wins over a
+            // signed one of the same type (ex. u+1 is unsigned).
+            else if (leftType.type == rightType.type && leftType.isUnsignedInt())
+            {
+                optCastType = canPromote(rightType, leftType);
+                castRight = true;
+            }
+
             else
             {
                 // Try left to right first (ex. 1+2.0F).
@@ -212,6 +430,7 @@ namespace cmm
                 else
                 {
                     node.castLeft(*optCastType);
+                    node.setDatatype(*optCastType);
                 }
             }
 
@@ -261,21 +480,63 @@ namespace cmm
 
             reporter.error(builder.str(), node.getLocation());
         }
+    }
+
+    VisitorResult Analyzer::visit(BlockNode& node)
+    {
+        node.walkNestedBlocks([this](BlockNode&) { scope.push(true); },
+                              [this](StatementNode& statement) { statement.accept(this); },
+                              [this](BlockNode&) { scope.pop(); });
 
         return VisitorResult();
     }
 
-    VisitorResult Analyzer::visit(BlockNode& node)
+    VisitorResult Analyzer::visit(BreakStatementNode& node)
     {
-        scope.push(true);
+        if (breakableDepth == 0)
+        {
+            reporter.error("'break' statement not within a loop or switch", node.getLocation());
+        }
+
+        return VisitorResult();
+    }
+
+    VisitorResult Analyzer::visit(CaseStatementNode& node)
+    {
+        auto* expression = node.getExpression();
+
+        if (expression != nullptr)
+        {
+            auto exprVisitorResult = expression->accept(this);
+
+            // An enumerator comes back as its EnumUsageNode (ex. "case RUNNING:").
+            if (exprVisitorResult.resultType == EnumVisitorResultType::NODE)
+            {
+                node.setExpression(std::unique_ptr<ExpressionNode>(static_cast<ExpressionNode*>(exprVisitorResult.result.node)));
+
+                // Release ownership
+                exprVisitorResult.owned = false;
+                expression = node.getExpression();
+            }
+
+            const auto value = evaluateCaseValue(expression);
+
+            if (value.has_value())
+            {
+                node.setValue(*value);
+            }
+
+            else
+            {
+                reporter.error("Expected an integer constant expression for the case label", expression->getLocation());
+            }
+        }
 
         for (auto& statementPtr : node)
         {
             statementPtr->accept(this);
         }
 
-        scope.pop();
-
         return VisitorResult();
     }
 
@@ -326,6 +587,12 @@ namespace cmm
             node.setCastType(EnumCastType::NOP);
         }
 
+        // Only the signedness changes (ex. (unsigned) x), the bits stay the same.
+        else if (from.type == to.type && from.unsignedInt != to.unsignedInt && from.isInt() && to.isInt())
+        {
+            node.setCastType(EnumCastType::NOP);
+        }
+
         else if (from.pointers == 0 && from.pointers == to.pointers)
         {
             if (canPromote(from, to))
@@ -821,7 +1088,18 @@ namespace cmm
     VisitorResult Analyzer::visit(IfElseStatementNode& node)
     {
         auto* ifCondExpression = node.getIfConditional();
-        ifCondExpression->accept(this);
+        auto ifCondVisitorResult = ifCondExpression->accept(this);
+
+        // An enumerator comes back as its EnumUsageNode (ex. "if (VERBOSE) { ... }").
+        if (ifCondVisitorResult.resultType == EnumVisitorResultType::NODE)
+        {
+            node.setIfConditional(std::unique_ptr<ExpressionNode>(static_cast<ExpressionNode*>(ifCondVisitorResult.result.node)));
+
+            // Release ownership
+            ifCondVisitorResult.owned = false;
+            ifCondExpression = node.getIfConditional();
+        }
+
         auto ifCondExprNodeType = ifCondExpression->getType();
 
         // Check if the conditional is a simple variable (i.e. "if (a) { ... }"),
@@ -838,9 +1116,9 @@ namespace cmm
         // Note: static_cast is only safe if it is in fact a BinOpNode pointer.
         auto* binOpNodePtr = static_cast<BinOpNode*>(ifCondExpression);
 
-        // If this isn't a comparison operation, we must wrap it into one.
+        // If this isn't a comparison (or logical) operation, we must wrap it into one.
         // ex. if (1) { ... } should become if (1 != 0) { ... }
-        if (ifCondExprNodeType != EnumNodeType::BIN_OP || !binOpNodePtr->isComparisonOp())
+        if (ifCondExprNodeType != EnumNodeType::BIN_OP || (!binOpNodePtr->isComparisonOp() && !binOpNodePtr->isLogicalOp()))
         {
             const auto location = ifCondExpression->getLocation();
             const auto& datatype = ifCondExpression->getDatatype();
@@ -1049,7 +1327,17 @@ namespace cmm
     VisitorResult Analyzer::visit(ReturnStatementNode& node)
     {
         auto* expression = node.getExpression();
-        expression->accept(this);
+        auto exprVisitorResult = expression->accept(this);
+
+        // An enumerator comes back as its EnumUsageNode (ex. "return RUNNING;").
+        if (exprVisitorResult.resultType == EnumVisitorResultType::NODE)
+        {
+            node.setExpression(std::unique_ptr<ExpressionNode>(static_cast<ExpressionNode*>(exprVisitorResult.result.node)));
+
+            // Release ownership
+            exprVisitorResult.owned = false;
+            expression = node.getExpression();
+        }
 
         if (isValidNonLitteralRHSNodeType(expression->getType()))
         {
@@ -1125,6 +1413,112 @@ namespace cmm
         return VisitorResult();
     }
 
+    VisitorResult Analyzer::visit(SwitchStatementNode& node)
+    {
+        auto* conditional = node.getConditional();
+        auto condVisitorResult = conditional->accept(this);
+
+        // An enumerator comes back as its EnumUsageNode.
+        if (condVisitorResult.resultType == EnumVisitorResultType::NODE)
+        {
+            node.setConditional(std::unique_ptr<ExpressionNode>(static_cast<ExpressionNode*>(condVisitorResult.result.node)));
+
+            // Release ownership
+            condVisitorResult.owned = false;
+            conditional = node.getConditional();
+        }
+
+        const CType datatype = conditional->getDatatype();
+
+        if (conditional->getType() == EnumNodeType::VARIABLE)
+        {
+            node.derefConditional();
+        }
+
+        if (!datatype.isInt())
+        {
+            reporter.error("Expected an integer expression to switch on", conditional->getLocation());
+            return VisitorResult();
+        }
+
+        // All of the labels share the switch's scope, like in C.
+        ++breakableDepth;
+        scope.push(true);
+
+        std::unordered_set<s64> values;
+        bool seenDefault = false;
+
+        for (auto& casePtr : node)
+        {
+            casePtr->accept(this);
+
+            if (casePtr->isDefault())
+            {
+                if (seenDefault)
+                {
+                    reporter.error("Multiple default labels in one switch", casePtr->getLocation());
+                }
+
+                seenDefault = true;
+                continue;
+            }
+
+            const auto value = casePtr->getValue();
+
+            if (!value.has_value())
+            {
+                continue;
+            }
+
+            else if (!values.insert(*value).second)
+            {
+                std::ostringstream os;
+                os << "Duplicate case value '" << *value << "'";
+                reporter.error(os.str(), casePtr->getLocation());
+            }
+
+            else if (!fitsIntType(datatype, *value))
+            {
+                std::ostringstream os;
+                os << "Case value '" << *value << "' can never match the switch expression's type";
+                reporter.warn(os.str(), casePtr->getLocation());
+            }
+        }
+
+        scope.pop();
+        --breakableDepth;
+
+        // Without a default, every enumerator of an enum is expected to be handled.
+        if (!seenDefault && datatype.isEnum() && datatype.optTypeName.has_value())
+        {
+            const auto* enumDataPtr = currentTranslationUnitNodePtr->getEnumTable().get(*datatype.optTypeName);
+
+            if (enumDataPtr != nullptr)
+            {
+                std::vector<std::string> unhandled;
+
+                for (const auto& [name, enumerator] : enumDataPtr->enumeratorMap)
+                {
+                    if (values.find(enumerator.getValue()) == values.cend())
+                    {
+                        unhandled.push_back(name);
+                    }
+                }
+
+                std::sort(unhandled.begin(), unhandled.end());
+
+                for (const auto& name : unhandled)
+                {
+                    std::ostringstream os;
+                    os << "Enumeration value '" << name << "' not handled in switch";
+                    reporter.warn(os.str(), node.getLocation());
+                }
+            }
+        }
+
+        return VisitorResult();
+    }
+
     VisitorResult Analyzer::visit(TranslationUnitNode& node)
     {
         for (auto& statement : node)
@@ -1162,9 +1556,18 @@ namespace cmm
             auto* expression = node.getExpression();
             expression->accept(this);
 
-            if (node.getOpType() == EnumUnaryOpType::ADDRESS_OF)
+            if (expression->getDatatype().isArray())
+            {
+                std::ostringstream builder;
+                builder << "Invalid operand of array type '";
+                printType(builder, expression->getDatatype());
+                builder << '\'';
+                reporter.error(builder.str(), node.getLocation());
+            }
+
+            else if (node.getOpType() == EnumUnaryOpType::ADDRESS_OF)
             {
-                if (expression->getType() != EnumNodeType::VARIABLE)
+                if (expression->getType() != EnumNodeType::VARIABLE && expression->getType() != EnumNodeType::ARRAY_INDEX)
                 {
                     const char* message = "Expected a variable expression prior to attempting to take the address of it";
                     reporter.error(message, node.getLocation());
@@ -1180,7 +1583,7 @@ namespace cmm
                 }
             }
 
-            else if (expression->getType() == EnumNodeType::VARIABLE)
+            else if (expression->getType() == EnumNodeType::VARIABLE || expression->getType() == EnumNodeType::ARRAY_INDEX)
             {
                 const CType datatype = expression->getDatatype();
                 node.derefNode();
@@ -1231,6 +1634,13 @@ namespace cmm
         auto& typeNode = node.getTypeNode();
         typeNode.accept(this);
 
+        if (node.getDatatype().isArray() && node.getDatatype().type == EnumCType::VOID && node.getDatatype().pointers == 0)
+        {
+            std::ostringstream builder;
+            builder << "Declaration of variable '" << node.getName() << "' as an array of void";
+            reporter.error(builder.str(), node.getLocation());
+        }
+
         auto currentLocality = localityStack.top();
         VariableContext context(node.getDatatype(), currentLocality, EnumModifier::NO_MOD);
 
@@ -1269,7 +1679,17 @@ namespace cmm
     VisitorResult Analyzer::visit(WhileStatementNode& node)
     {
         auto* conditional = node.getConditional();
-        conditional->accept(this);
+        auto condVisitorResult = conditional->accept(this);
+
+        // An enumerator comes back as its EnumUsageNode (ex. "while (RUNNING) { ... }").
+        if (condVisitorResult.resultType == EnumVisitorResultType::NODE)
+        {
+            node.setConditional(std::unique_ptr<ExpressionNode>(static_cast<ExpressionNode*>(condVisitorResult.result.node)));
+
+            // Release ownership
+            condVisitorResult.owned = false;
+            conditional = node.getConditional();
+        }
 
         const auto condExprNodeType = conditional->getType();
         const auto& conditionalExprDatatype = conditional->getDatatype();
@@ -1292,7 +1712,10 @@ namespace cmm
         }
 
         auto* statement = node.getStatement();
+
+        ++breakableDepth;
         statement->accept(this);
+        --breakableDepth;
 
         return VisitorResult();
     }
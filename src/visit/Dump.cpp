@@ -12,6 +12,7 @@
 // std includes
 #include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace cmm
 {
@@ -53,45 +54,118 @@ namespace cmm
         return VisitorResult();
     }
 
-    VisitorResult Dump::visit(BinOpNode& node)
+    VisitorResult Dump::visit(ArrayIndexNode& node)
     {
         printIndentation();
         printNode(node);
         printNewLine();
 
         increaseIntentation();
-        auto* leftNode = node.getLeft();
-        leftNode->accept(this);
+        node.getExpression()->accept(this);
+        node.getIndex()->accept(this);
+
+        printIndentation();
+        std::cout << "datatype: ";
+        printType(std::cout, node.getDatatype());
+        printNewLine();
 
-        auto* rightNode = node.getRight();
-        rightNode->accept(this);
         decreaseIntentation();
+        printNewLine();
+
+        return VisitorResult();
+    }
+
+    VisitorResult Dump::visit(BinOpNode& node)
+    {
+        // Print the left spine top down, then the right operands bottom up, which
+        // is the same pre-order as recursing into each left operand.
+        std::vector<BinOpNode*> spine;
+        node.collectLeftSpine(spine);
+
+        for (auto* binOpNode : spine)
+        {
+            printIndentation();
+            printNode(*binOpNode);
+            printNewLine();
+            increaseIntentation();
+        }
+
+        spine.back()->getLeft()->accept(this);
+
+        for (auto iter = spine.rbegin(); iter != spine.rend(); ++iter)
+        {
+            (*iter)->getRight()->accept(this);
+            decreaseIntentation();
+        }
 
         return VisitorResult();
     }
 
     VisitorResult Dump::visit(BlockNode& node)
+    {
+        const auto enterBlock = [this](BlockNode& block)
+        {
+            printIndentation();
+            printNode(block);
+            printNewLine();
+
+            increaseIntentation();
+            printIndentation();
+            std::cout << "{\n";
+
+            increaseIntentation();
+        };
+
+        const auto exitBlock = [this](BlockNode&)
+        {
+            decreaseIntentation();
+
+            printIndentation();
+            std::cout << "}\n";
+            decreaseIntentation();
+        };
+
+        node.walkNestedBlocks(enterBlock, [this](StatementNode& statement) { statement.accept(this); }, exitBlock);
+
+        return VisitorResult();
+    }
+
+    VisitorResult Dump::visit(BreakStatementNode& node)
     {
         printIndentation();
         printNode(node);
         printNewLine();
 
-        increaseIntentation();
+        return VisitorResult();
+    }
+
+    VisitorResult Dump::visit(CaseStatementNode& node)
+    {
         printIndentation();
-        std::cout << "{\n";
+        printNode(node);
+        printNewLine();
 
         increaseIntentation();
 
-        for (auto iter = node.begin(); iter != node.end(); ++iter)
+        printIndentation();
+
+        if (node.isDefault())
         {
-            auto& statementPtr = *iter;
-            statementPtr->accept(this);
+            std::cout << "default:\n";
         }
 
-        decreaseIntentation();
+        else
+        {
+            std::cout << "case:\n";
+            node.getExpression()->accept(this);
+            printNewLine();
+        }
+
+        for (auto& statementPtr : node)
+        {
+            statementPtr->accept(this);
+        }
 
-        printIndentation();
-        std::cout << "}\n";
         decreaseIntentation();
 
         return VisitorResult();
@@ -521,6 +595,29 @@ namespace cmm
         return VisitorResult();
     }
 
+    VisitorResult Dump::visit(SwitchStatementNode& node)
+    {
+        printIndentation();
+        printNode(node);
+        printNewLine();
+
+        increaseIntentation();
+
+        printIndentation();
+        std::cout << "condition:\n";
+        node.getConditional()->accept(this);
+        printNewLine();
+
+        for (auto& casePtr : node)
+        {
+            casePtr->accept(this);
+        }
+
+        decreaseIntentation();
+
+        return VisitorResult();
+    }
+
     VisitorResult Dump::visit(TranslationUnitNode& node)
     {
         printIndentation();
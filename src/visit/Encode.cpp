@@ -12,6 +12,7 @@
 
 // std includes
 #include <stdexcept>
+#include <vector>
 
 namespace cmm
 {
@@ -73,32 +74,61 @@ namespace cmm
         return optVisitorResult.has_value() ? std::move(*optVisitorResult) : VisitorResult();
     }
 
+    VisitorResult Encode::visit(ArrayIndexNode& node)
+    {
+        // Only lowered through the IR (see Lower).
+        CMM_UNIMPLEMENTED_EXCEPTION();
+    }
+
     VisitorResult Encode::visit(BinOpNode& node)
     {
-        auto* rightNode = node.getRight();
-        const auto rightNodeResult = rightNode->accept(this);
+        // Note: The right operands are encoded outermost first and each node is emitted
+        // innermost first, matching the order of the recursive walk.
+        std::vector<BinOpNode*> spine;
+        node.collectLeftSpine(spine);
 
-        auto* leftNode = node.getLeft();
-        const auto leftNodeResult = leftNode->accept(this);
+        std::vector<VisitorResult> rightNodeResults;
+        rightNodeResults.reserve(spine.size());
 
-        auto optVisitorResult = platform->emit(this, node, leftNodeResult, rightNodeResult);
-        emitNewline();
+        for (auto* binOpNode : spine)
+        {
+            rightNodeResults.emplace_back(binOpNode->getRight()->accept(this));
+        }
 
-        return optVisitorResult.has_value() ? std::move(*optVisitorResult) : VisitorResult();
+        auto leftNodeResult = spine.back()->getLeft()->accept(this);
+
+        for (std::size_t i = spine.size(); i-- > 0;)
+        {
+            auto optVisitorResult = platform->emit(this, *spine[i], leftNodeResult, rightNodeResults[i]);
+            emitNewline();
+
+            leftNodeResult = optVisitorResult.has_value() ? std::move(*optVisitorResult) : VisitorResult();
+        }
+
+        return leftNodeResult;
     }
 
     VisitorResult Encode::visit(BlockNode& node)
     {
-        emitNewline();
-
-        for (auto& statementPtr : node)
-        {
-            statementPtr->accept(this);
-        }
+        node.walkNestedBlocks([this](BlockNode&) { emitNewline(); },
+                              [this](StatementNode& statement) { statement.accept(this); },
+                              [](BlockNode&) {});
 
         return VisitorResult();
     }
 
+    VisitorResult Encode::visit(BreakStatementNode& node)
+    {
+        // Only lowered through the IR (see Lower).
+        CMM_UNIMPLEMENTED_EXCEPTION();
+    }
+
+    VisitorResult Encode::visit(CaseStatementNode& node)
+    {
+        // Only lowered through the IR (see Lower).
+        CMM_UNIMPLEMENTED_EXCEPTION();
+    }
+
     VisitorResult Encode::visit(CastNode& node)
     {
         auto* expression = node.getExpression();
@@ -374,6 +404,12 @@ namespace cmm
         return VisitorResult();
     }
 
+    VisitorResult Encode::visit(SwitchStatementNode& node)
+    {
+        // Only lowered through the IR (see Lower).
+        CMM_UNIMPLEMENTED_EXCEPTION();
+    }
+
     VisitorResult Encode::visit(TranslationUnitNode& node)
     {
         // Give the platform the chance to include any global type information
@@ -414,6 +450,12 @@ namespace cmm
 
     VisitorResult Encode::visit(VariableDeclarationStatementNode& node)
     {
+        // Arrays are only lowered through the IR (see Lower).
+        if (node.getDatatype().isArray())
+        {
+            CMM_UNIMPLEMENTED_EXCEPTION();
+        }
+
         printIndent();
         auto& variable = node.getVariable();
         platform->emit(this, variable, false);
@@ -0,0 +1,1773 @@
+/**
+ * An implementation of the base visitor class for lowering an analyzed AST into the cmm IR.
+ *
+ * @author hockeyhurd
+ * @version 2026-10-18
+ */
+
+// Our includes
+#include <cmm/visit/Lower.h>
+#include <cmm/Enumerator.h>
+#include <cmm/NodeList.h>
+#include <cmm/Reporter.h>
+#include <cmm/ir/ConstantFold.h>
+
+// std includes
+#include <algorithm>
+#include <unordered_set>
+
+namespace cmm
+{
+    /* static */
+    Reporter& Lower::reporter = Reporter::instance();
+
+    /**
+     * Gets the expression within any parentheses.
+     *
+     * @param expression the ExpressionNode.
+     * @return pointer to the ExpressionNode.
+     */
+    static ExpressionNode* skipParens(ExpressionNode* expression) CMM_NOEXCEPT
+    {
+        while (expression->getType() == EnumNodeType::PAREN_EXPRESSION)
+        {
+            expression = static_cast<ParenExpressionNode*>(expression)->getExpression();
+        }
+
+        return expression;
+    }
+
+    /**
+     * Gets whether an expression is a binary operator yielding an i1, i.e. a comparison or
+     * a logical operator.
+     *
+     * @param expression the ExpressionNode.
+     * @return bool.
+     */
+    static bool isBoolBinOp(const ExpressionNode* expression) CMM_NOEXCEPT
+    {
+        if (expression->getType() != EnumNodeType::BIN_OP)
+        {
+            return false;
+        }
+
+        const auto* binOpNode = static_cast<const BinOpNode*>(expression);
+        return binOpNode->isComparisonOp() || binOpNode->isLogicalOp();
+    }
+
+    /**
+     * Gets whether an expression is a '&&' or '||'.
+     *
+     * @param expression the ExpressionNode.
+     * @return bool.
+     */
+    static bool isLogicalBinOp(const ExpressionNode* expression) CMM_NOEXCEPT
+    {
+        return expression->getType() == EnumNodeType::BIN_OP && static_cast<const BinOpNode*>(expression)->isLogicalOp();
+    }
+
+    /**
+     * Gets whether an expression's value is an unsigned int.
+     *
+     * @param expression the ExpressionNode.
+     * @return bool.
+     */
+    static bool isUnsignedExpression(const ExpressionNode* expression) CMM_NOEXCEPT
+    {
+        return expression != nullptr && expression->getDatatype().isUnsignedInt();
+    }
+
+    /**
+     * Gets whether integer arithmetic may be flagged 'nsw', i.e. signed overflow is undefined.
+     * Unsigned arithmetic wraps, and in C anything narrower than an int is promoted before
+     * the operation so its overflow is just a truncation.
+     *
+     * @param isUnsigned whether the operation is unsigned.
+     * @param type the ir::Type of the operation.
+     * @return bool.
+     */
+    static bool isNoSignedWrap(const bool isUnsigned, const ir::Type* type) CMM_NOEXCEPT
+    {
+        return !isUnsigned && type->isInt() && type->getBits() >= 32;
+    }
+
+    // The alignment given to arrays big enough to hold a vector register, matching the x86-64 ABI.
+    static constexpr u64 ARRAY_VECTOR_ALIGNMENT = 16;
+
+    /**
+     * Gets the alignment for the storage of an array.  Arrays of at least 16 bytes are
+     * over-aligned so that vectorized loops over them can use aligned loads and stores.
+     *
+     * @param type the array ir::Type.
+     * @return u32 alignment in bytes.
+     */
+    static u32 getArrayAlignment(const ir::Type* type) CMM_NOEXCEPT
+    {
+        const u64 alignment = type->getAlignment();
+
+        if (type->getSizeInBytes() >= ARRAY_VECTOR_ALIGNMENT)
+        {
+            return static_cast<u32>(std::max(alignment, ARRAY_VECTOR_ALIGNMENT));
+        }
+
+        return static_cast<u32>(alignment);
+    }
+
+    /**
+     * Evaluates a value computed from constants only, without changing anything.
+     *
+     * @param module the ir::Module to create the result in.
+     * @param value the ir::Value.
+     * @return pointer to the constant, else nullptr.
+     */
+    static ir::Value* evaluateConstant(ir::Module& module, ir::Value* value)
+    {
+        if (ir::isFoldableConstant(value))
+        {
+            return value;
+        }
+
+        else if (value->getKind() != ir::EnumValueKind::INSTRUCTION)
+        {
+            return nullptr;
+        }
+
+        const auto* instruction = static_cast<const ir::Instruction*>(value);
+
+        if (instruction->mayReadMemory() || instruction->mayHaveSideEffects())
+        {
+            return nullptr;
+        }
+
+        std::vector<ir::Value*> operands;
+        operands.reserve(instruction->getNumOperands());
+
+        for (std::size_t i = 0; i < instruction->getNumOperands(); ++i)
+        {
+            auto* operand = evaluateConstant(module, instruction->getOperand(i));
+
+            if (operand == nullptr)
+            {
+                return nullptr;
+            }
+
+            operands.push_back(operand);
+        }
+
+        return ir::foldInstruction(module, *instruction, operands);
+    }
+
+    /**
+     * Erases an instruction nothing uses anymore, along with the operands that were only
+     * computed for it.
+     *
+     * @param value the ir::Value.
+     */
+    static void eraseIfUnused(ir::Value* value)
+    {
+        if (value->getKind() != ir::EnumValueKind::INSTRUCTION || value->hasUses())
+        {
+            return;
+        }
+
+        auto* instruction = static_cast<ir::Instruction*>(value);
+        std::vector<ir::Value*> operands;
+
+        for (std::size_t i = 0; i < instruction->getNumOperands(); ++i)
+        {
+            operands.push_back(instruction->getOperand(i));
+        }
+
+        instruction->eraseFromParent();
+
+        for (auto* operand : operands)
+        {
+            eraseIfUnused(operand);
+        }
+    }
+
+    // A run of cases becomes a jump table when it has at least this many cases...
+    static constexpr std::size_t MIN_JUMP_TABLE_CASES = 4;
+
+    // ... covering at least this percentage of the values in its range.
+    static constexpr u64 MIN_JUMP_TABLE_DENSITY = 40;
+
+    // Up to this many clusters are simply tested one after another.
+    static constexpr std::size_t MAX_LINEAR_CLUSTERS = 3;
+
+    struct SwitchCluster
+    {
+        // The first and last case, as indices into the sorted cases.
+        std::size_t first;
+        std::size_t last;
+
+        // Whether the cases are dense enough for a jump table.
+        bool isJumpTable;
+    };
+
+    /**
+     * Gets the number of values from the first case's to the last case's.
+     *
+     * @param low the smallest value.
+     * @param high the largest value.
+     * @return u64 the size of the range, 0 if it covers every s64.
+     */
+    static u64 getRangeSize(const s64 low, const s64 high) CMM_NOEXCEPT
+    {
+        return static_cast<u64>(high) - static_cast<u64>(low) + 1;
+    }
+
+    /**
+     * Splits the sorted cases of a switch into clusters, greedily taking the longest run
+     * dense enough for a jump table from each case, else leaving the case on its own.
+     *
+     * @param cases the cases sorted by value.
+     * @return std::vector of SwitchClusters in order.
+     */
+    static std::vector<SwitchCluster> clusterCases(const std::vector<std::pair<s64, ir::BasicBlock*>>& cases)
+    {
+        std::vector<SwitchCluster> clusters;
+        std::size_t i = 0;
+
+        while (i < cases.size())
+        {
+            // No run starting here can have more cases than are left, so once the range
+            // outgrows what that many cases can fill there is no point looking further.
+            const u64 maxRange = static_cast<u64>(cases.size() - i) * 100 / MIN_JUMP_TABLE_DENSITY;
+            std::size_t best = i;
+
+            for (std::size_t j = i + MIN_JUMP_TABLE_CASES - 1; j < cases.size(); ++j)
+            {
+                const u64 range = getRangeSize(cases[i].first, cases[j].first);
+
+                if (range == 0 || range > maxRange)
+                {
+                    break;
+                }
+
+                else if (range <= static_cast<u64>(j - i + 1) * 100 / MIN_JUMP_TABLE_DENSITY)
+                {
+                    best = j;
+                }
+            }
+
+            clusters.push_back({ i, best, best != i });
+            i = best + 1;
+        }
+
+        return clusters;
+    }
+
+    Lower::Lower(ir::Module& module) : module(module), builder(module), currentFunction(nullptr), current(nullptr)
+    {
+    }
+
+    ir::Module& Lower::getModule() CMM_NOEXCEPT
+    {
+        return module;
+    }
+
+    VisitorResult Lower::visit(ArgNode& node)
+    {
+        current = lowerValue(node.getExpression());
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(ArrayIndexNode& node)
+    {
+        current = builder.createLoad(lowerArrayIndexAddress(node));
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(BinOpNode& node)
+    {
+        auto* result = lowerBinOp(node);
+
+        // A comparison (or '&&' and '||') used as a value takes on the type the Analyzer gave the node.
+        if (isBoolBinOp(&node))
+        {
+            result = widenBool(result, resolveType(node.getDatatype()));
+        }
+
+        current = result;
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(BlockNode& node)
+    {
+        node.walkNestedBlocks([this](BlockNode&) { scopes.emplace_back(); },
+                              [this](StatementNode& statement) { statement.accept(this); },
+                              [this](BlockNode&) { scopes.pop_back(); });
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(BreakStatementNode& node)
+    {
+        if (breakTargets.empty())
+        {
+            reporter.bug("'break' outside of a loop or switch", node.getLocation(), true);
+            return VisitorResult();
+        }
+
+        builder.createBr(breakTargets.back());
+
+        // Anything following a break is unreachable, but still needs a block to land in.
+        builder.setInsertPoint(currentFunction->createBlock());
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(CaseStatementNode& node)
+    {
+        // The label itself was handled by the SwitchStatementNode.
+        for (auto& statementPtr : node)
+        {
+            statementPtr->accept(this);
+        }
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(CastNode& node)
+    {
+        // Note: The cast to emit is derived from the IR types rather than EnumCastType,
+        // since casts inserted after analysis (ex. for return values) are never classified.
+        auto* value = lowerValue(node.getExpression());
+        current = convert(value, resolveType(node.getDatatype()), node.getLocation(),
+            isUnsignedExpression(node.getExpression()), node.getDatatype().isUnsignedInt());
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(CompilationUnitNode& node)
+    {
+        return node.getRoot().accept(this);
+    }
+
+    VisitorResult Lower::visit(DerefNode& node)
+    {
+        auto* value = lowerValue(node.getExpression());
+
+        // An implicit DerefNode only marks a read of a variable's memory, which lowerValue
+        // already does.  An explicit one ('*x') loads through the pointer value.
+        current = node.isExplicit() ? builder.createLoad(value) : value;
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(EnumDefinitionStatementNode& node)
+    {
+        // Enumerators are inlined as constants (see EnumUsageNode).
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(EnumUsageNode& node)
+    {
+        const auto* enumerator = node.getEnumerator();
+        current = module.getConstantInt(resolveType(node.getDatatype()), enumerator != nullptr ? enumerator->getValue() : 0);
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(ExpressionStatementNode& node)
+    {
+        if (node.hasExpression())
+        {
+            lowerValue(node.getExpression());
+        }
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(FieldAccessNode& node)
+    {
+        current = builder.createLoad(lowerAddress(&node));
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(FunctionCallNode& node)
+    {
+        auto* function = module.getFunction(node.getName());
+
+        if (function == nullptr)
+        {
+            reporter.bug("Call to a function that was never declared: '" + node.getName() + "'", node.getLocation(), true);
+            return VisitorResult();
+        }
+
+        const auto& params = function->getFunctionType()->getFields();
+        std::vector<ir::Value*> args;
+        args.reserve(node.size());
+
+        for (auto& arg : node)
+        {
+            auto* value = lowerValue(arg.getExpression());
+
+            if (args.size() < params.size())
+            {
+                value = convert(value, params[args.size()], arg.getLocation(), isUnsignedExpression(arg.getExpression()));
+            }
+
+            args.push_back(value);
+        }
+
+        if (args.size() != params.size())
+        {
+            reporter.bug("Mismatched argument count in call to '" + node.getName() + "'", node.getLocation(), false);
+            current = function->getReturnType()->isVoid() ? nullptr : module.getUndef(function->getReturnType());
+
+            return VisitorResult();
+        }
+
+        auto* call = builder.createCall(function, args);
+        current = function->getReturnType()->isVoid() ? nullptr : call;
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(FunctionDeclarationStatementNode& node)
+    {
+        // Prototypes are created up front when visiting the TranslationUnitNode.
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(FunctionDefinitionStatementNode& node)
+    {
+        auto* function = module.getFunction(node.getName());
+
+        // Multiple definitions were already reported by the Analyzer, only lower the first.
+        if (function == nullptr || !function->isDeclaration())
+        {
+            return VisitorResult();
+        }
+
+        currentFunction = function;
+        builder.setInsertPoint(function->createBlock("entry"));
+        scopes.emplace_back();
+
+        std::size_t index = 0;
+
+        for (auto& paramNode : node)
+        {
+            auto* arg = function->getArg(index++);
+            auto& optionalVariableNode = paramNode.getVariable();
+
+            if (!optionalVariableNode.has_value())
+            {
+                continue;
+            }
+
+            // Parameters get a stack slot just like locals so they can be assigned to and have
+            // their address taken.  Promoting slots to registers is left to the optimizer.
+            const auto& name = optionalVariableNode->getName();
+            arg->setName(name);
+
+            auto* slot = createEntryAlloca(arg->getType(), name + ".addr");
+            builder.createStore(arg, slot);
+            scopes.back()[name] = slot;
+        }
+
+        node.getBlock().accept(this);
+
+        scopes.pop_back();
+        finishFunction();
+        currentFunction = nullptr;
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(IfElseStatementNode& node)
+    {
+        auto* thenBlock = currentFunction->createBlock("if.then");
+        auto* elseBlock = node.hasElseStatement() ? currentFunction->createBlock("if.else") : nullptr;
+        auto* endBlock = currentFunction->createBlock("if.end");
+        const auto* constant = lowerBranch(node.getIfConditional(), thenBlock, elseBlock != nullptr ? elseBlock : endBlock);
+
+        // Decided at compile time, so only the arm taken is needed.
+        if (constant != nullptr)
+        {
+            thenBlock->eraseFromParent();
+            endBlock->eraseFromParent();
+
+            if (elseBlock != nullptr)
+            {
+                elseBlock->eraseFromParent();
+            }
+
+            auto* statement = !constant->isZero() ? node.getIfStatement() : node.getElseStatement();
+
+            if (statement != nullptr)
+            {
+                statement->accept(this);
+            }
+
+            return VisitorResult();
+        }
+
+        startBlock(thenBlock);
+        node.getIfStatement()->accept(this);
+        branchTo(endBlock);
+
+        if (elseBlock != nullptr)
+        {
+            startBlock(elseBlock);
+            node.getElseStatement()->accept(this);
+            branchTo(endBlock);
+        }
+
+        startBlock(endBlock);
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(LitteralNode& node)
+    {
+        const auto& datatype = node.getDatatype();
+        const auto value = node.getValue();
+        auto* type = resolveType(datatype);
+
+        switch (datatype.type)
+        {
+        case EnumCType::NULL_T:
+            // fallthrough
+        case EnumCType::VOID_PTR:
+            current = module.getNull(type);
+            break;
+        case EnumCType::BOOL:
+            current = module.getConstantInt(type, value.valueBool ? 1 : 0);
+            break;
+        case EnumCType::CHAR:
+            // Special case where this is a c-style string.
+            if (datatype.pointers == 1)
+            {
+                auto* global = module.getOrCreateCString(value.valueString);
+                auto* zero = module.getConstantInt(builder.getTypes().getInt(64), 0);
+                current = builder.createGEP(global->getValueType(), global, { zero, zero });
+            }
+
+            else
+            {
+                current = module.getConstantInt(type, value.valueChar);
+            }
+
+            break;
+        case EnumCType::ENUM:
+            current = module.getConstantInt(type, value.valueEnum);
+            break;
+        case EnumCType::INT8:
+            current = module.getConstantInt(type, value.valueS8);
+            break;
+        case EnumCType::INT16:
+            current = module.getConstantInt(type, value.valueS16);
+            break;
+        case EnumCType::INT32:
+            current = module.getConstantInt(type, value.valueS32);
+            break;
+        case EnumCType::INT64:
+            current = module.getConstantInt(type, value.valueS64);
+            break;
+        case EnumCType::FLOAT:
+            current = module.getConstantFP(type, value.valueF32);
+            break;
+        case EnumCType::DOUBLE:
+            current = module.getConstantFP(type, value.valueF64);
+            break;
+        default:
+            reporter.bug("Unsupported litteral type for lowering", node.getLocation(), true);
+            break;
+        }
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(ParameterNode& node)
+    {
+        // Parameters are handled with their FunctionDefinitionStatementNode.
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(ParenExpressionNode& node)
+    {
+        current = lowerValue(node.getExpression());
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(ReturnStatementNode& node)
+    {
+        auto* returnType = currentFunction->getReturnType();
+        ir::Value* value = node.hasExpression() ? lowerValue(node.getExpression()) : nullptr;
+
+        if (returnType->isVoid())
+        {
+            builder.createRetVoid();
+        }
+
+        else if (value == nullptr)
+        {
+            builder.createRet(module.getUndef(returnType));
+        }
+
+        else
+        {
+            builder.createRet(convert(value, returnType, node.getLocation(), isUnsignedExpression(node.getExpression())));
+        }
+
+        // Anything following a return is unreachable, but still needs a block to land in.
+        builder.setInsertPoint(currentFunction->createBlock());
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(StructDefinitionStatementNode& node)
+    {
+        // Struct types are created up front when visiting the TranslationUnitNode.
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(StructFwdDeclarationStatementNode& node)
+    {
+        // Struct types are created up front when visiting the TranslationUnitNode.
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(SwitchStatementNode& node)
+    {
+        const auto& location = node.getConditional()->getLocation();
+        auto* value = lowerValue(node.getConditional());
+        auto* i32 = builder.getTypes().getInt(32);
+        bool isUnsigned = isUnsignedExpression(node.getConditional());
+
+        // Integer promotion, the cases are compared as (at least) an int.
+        if (value->getType()->getBits() < 32)
+        {
+            value = convert(value, i32, location, isUnsigned);
+            isUnsigned = false;
+        }
+
+        auto* type = value->getType();
+        const u32 bits = type->getBits();
+        auto* endBlock = currentFunction->createBlock("switch.end");
+        auto* defaultBlock = endBlock;
+        std::vector<ir::BasicBlock*> blocks;
+        SwitchCaseList cases;
+
+        blocks.reserve(node.size());
+        cases.reserve(node.size());
+
+        for (auto& casePtr : node)
+        {
+            auto* block = currentFunction->createBlock(casePtr->isDefault() ? "switch.default" : "switch.case");
+            const auto caseValue = casePtr->getValue();
+            blocks.push_back(block);
+
+            if (casePtr->isDefault())
+            {
+                defaultBlock = block;
+            }
+
+            // A value the (promoted) type can't hold never matches.
+            else if (caseValue.has_value() && (bits >= 64 || static_cast<s32>(*caseValue) == *caseValue))
+            {
+                cases.emplace_back(*caseValue, block);
+            }
+
+            // Like C, an unsigned int switch converts the case (ex. -1 matches 0xFFFFFFFF).
+            else if (caseValue.has_value() && isUnsigned && static_cast<u32>(*caseValue) == *caseValue)
+            {
+                cases.emplace_back(*caseValue, block);
+            }
+        }
+
+        // Unsigned cases are kept zero extended so that they sort in unsigned order.
+        if (isUnsigned && bits < 64)
+        {
+            for (auto& entry : cases)
+            {
+                entry.first = static_cast<s64>(static_cast<u32>(entry.first));
+            }
+        }
+
+        const auto caseLess = [isUnsigned](const s64 left, const s64 right)
+        {
+            return isUnsigned ? static_cast<u64>(left) < static_cast<u64>(right) : left < right;
+        };
+
+        // Note: The sort is stable so that a value wrapped onto another one keeps the first label.
+        std::stable_sort(cases.begin(), cases.end(),
+            [&caseLess](const auto& left, const auto& right) { return caseLess(left.first, right.first); });
+        cases.erase(std::unique(cases.begin(), cases.end(),
+            [](const auto& left, const auto& right) { return left.first == right.first; }), cases.end());
+
+        // Switching on a constant just jumps to its case, the others are dropped as unreachable.
+        auto* constant = evaluateConstant(module, value);
+
+        if (constant != nullptr && constant->getKind() == ir::EnumValueKind::CONSTANT_INT)
+        {
+            const auto* constantInt = static_cast<ir::ConstantInt*>(constant);
+            const s64 constantValue = isUnsigned ? static_cast<s64>(constantInt->getZExtValue()) : constantInt->getValue();
+            const auto iter = std::lower_bound(cases.cbegin(), cases.cend(), constantValue,
+                [&caseLess](const auto& entry, const s64 target) { return caseLess(entry.first, target); });
+
+            eraseIfUnused(value);
+            builder.createBr(iter != cases.cend() && iter->first == constantValue ? iter->second : defaultBlock);
+        }
+
+        else
+        {
+            lowerSwitchDispatch(value, cases, defaultBlock, isUnsigned);
+        }
+
+        // All of the labels share one scope and each falls through into the next, like in C.
+        breakTargets.push_back(endBlock);
+        scopes.emplace_back();
+
+        for (std::size_t i = 0; i < blocks.size(); ++i)
+        {
+            startBlock(blocks[i]);
+            (node.begin() + i)->get()->accept(this);
+            branchTo(i + 1 < blocks.size() ? blocks[i + 1] : endBlock);
+        }
+
+        scopes.pop_back();
+        breakTargets.pop_back();
+
+        startBlock(endBlock);
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(TranslationUnitNode& node)
+    {
+        // The first pass creates every type, prototype and global so that uses may
+        // precede definitions in the source.
+        declareStructs(node);
+        scopes.emplace_back();
+
+        for (auto& statement : node)
+        {
+            switch (statement->getType())
+            {
+            case EnumNodeType::FUNCTION_DECLARATION_STATEMENT:
+            {
+                auto* declaration = static_cast<FunctionDeclarationStatementNode*>(statement.get());
+                std::vector<const ParameterNode*> params;
+
+                for (const auto& paramNode : *declaration)
+                {
+                    params.push_back(&paramNode);
+                }
+
+                declareFunction(declaration->getName(), declaration->getDatatype(), params);
+            }
+                break;
+            case EnumNodeType::FUNCTION_DEFINITION_STATEMENT:
+            {
+                auto* definition = static_cast<FunctionDefinitionStatementNode*>(statement.get());
+                std::vector<const ParameterNode*> params;
+
+                for (const auto& paramNode : *definition)
+                {
+                    params.push_back(&paramNode);
+                }
+
+                declareFunction(definition->getName(), definition->getDatatype(), params);
+            }
+                break;
+            case EnumNodeType::VARIABLE_DECLARATION_STATEMENT:
+            {
+                auto* declaration = static_cast<VariableDeclarationStatementNode*>(statement.get());
+                const auto linkage = declaration->getLocality() == EnumLocality::INTERNAL ?
+                    ir::EnumLinkage::INTERNAL : ir::EnumLinkage::EXTERNAL;
+                auto* type = resolveType(declaration->getDatatype());
+                auto* global = module.createGlobal(type, declaration->getName(), linkage, false);
+
+                if (type->isArray())
+                {
+                    global->setAlignment(getArrayAlignment(type));
+                }
+
+                scopes.back()[declaration->getName()] = global;
+            }
+                break;
+            default:
+                break;
+            }
+        }
+
+        for (auto& statement : node)
+        {
+            if (statement->getType() == EnumNodeType::FUNCTION_DEFINITION_STATEMENT)
+            {
+                statement->accept(this);
+            }
+        }
+
+        scopes.pop_back();
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(TypeNode& node)
+    {
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(UnaryOpNode& node)
+    {
+        auto* expression = node.getExpression();
+
+        switch (node.getOpType())
+        {
+        case EnumUnaryOpType::ADDRESS_OF:
+            current = lowerAddress(expression);
+            break;
+        case EnumUnaryOpType::NEGATIVE:
+        {
+            auto* value = lowerValue(expression);
+
+            if (value->getType()->isFloatingPoint())
+            {
+                current = builder.createFNeg(value);
+            }
+
+            else
+            {
+                auto* negate = builder.createBinary(ir::EnumOpcode::SUB, module.getZero(value->getType()), value);
+                negate->setFlag(ir::EnumInstructionFlag::NSW, isNoSignedWrap(isUnsignedExpression(expression), value->getType()));
+                current = negate;
+            }
+        }
+            break;
+        case EnumUnaryOpType::POSITIVE:
+            current = lowerValue(expression);
+            break;
+        case EnumUnaryOpType::DECREMENT:
+            // fallthrough
+        case EnumUnaryOpType::INCREMENT:
+        {
+            const bool increment = node.getOpType() == EnumUnaryOpType::INCREMENT;
+            auto* address = lowerAddress(expression);
+            auto* oldValue = builder.createLoad(address);
+            auto* type = oldValue->getType();
+            ir::Value* newValue;
+
+            if (type->isPointer())
+            {
+                auto* step = module.getConstantInt(builder.getTypes().getInt(64), increment ? 1 : -1);
+                newValue = builder.createGEP(type->getElementType(), oldValue, { step });
+            }
+
+            else if (type->isFloatingPoint())
+            {
+                newValue = builder.createBinary(increment ? ir::EnumOpcode::FADD : ir::EnumOpcode::FSUB, oldValue,
+                    module.getConstantFP(type, 1.0));
+            }
+
+            else
+            {
+                auto* step = builder.createBinary(increment ? ir::EnumOpcode::ADD : ir::EnumOpcode::SUB, oldValue,
+                    module.getConstantInt(type, 1));
+                step->setFlag(ir::EnumInstructionFlag::NSW, isNoSignedWrap(isUnsignedExpression(expression), type));
+                newValue = step;
+            }
+
+            builder.createStore(newValue, address);
+            current = node.isPostfix() ? oldValue : newValue;
+        }
+            break;
+        default:
+            reporter.bug("Unsupported unary operator for lowering", node.getLocation(), true);
+            break;
+        }
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(VariableDeclarationStatementNode& node)
+    {
+        // Globals are created when visiting the TranslationUnitNode.
+        if (currentFunction != nullptr)
+        {
+            auto* type = resolveType(node.getDatatype());
+            auto* alloca = createEntryAlloca(type, node.getName());
+
+            if (type->isArray())
+            {
+                alloca->setAlignment(getArrayAlignment(type));
+            }
+
+            scopes.back()[node.getName()] = alloca;
+        }
+
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(VariableNode& node)
+    {
+        current = builder.createLoad(lookupVariable(node.getName(), node.getLocation()));
+        return VisitorResult();
+    }
+
+    VisitorResult Lower::visit(WhileStatementNode& node)
+    {
+        auto* condBlock = currentFunction->createBlock("while.cond");
+        auto* bodyBlock = currentFunction->createBlock("while.body");
+        auto* endBlock = currentFunction->createBlock("while.end");
+        auto* preheader = builder.getInsertBlock();
+        auto* branch = builder.createBr(condBlock);
+        auto* headerBlock = condBlock;
+
+        startBlock(condBlock);
+        const auto* constant = lowerBranch(node.getConditional(), bodyBlock, endBlock);
+
+        // Nothing is left to test: 'while (0)' goes away entirely and 'while (1)' branches
+        // straight back into its body.
+        if (constant != nullptr)
+        {
+            builder.setInsertPoint(preheader);
+            branch->eraseFromParent();
+            condBlock->eraseFromParent();
+
+            if (constant->isZero())
+            {
+                bodyBlock->eraseFromParent();
+                endBlock->eraseFromParent();
+                return VisitorResult();
+            }
+
+            builder.createBr(bodyBlock);
+            headerBlock = bodyBlock;
+        }
+
+        startBlock(bodyBlock);
+        breakTargets.push_back(endBlock);
+        node.getStatement()->accept(this);
+        breakTargets.pop_back();
+        branchTo(headerBlock);
+
+        startBlock(endBlock);
+
+        return VisitorResult();
+    }
+
+    ir::Type* Lower::resolveType(const CType& datatype)
+    {
+        auto& types = builder.getTypes();
+        ir::Type* result = nullptr;
+
+        switch (datatype.type)
+        {
+        case EnumCType::NULL_T:
+            // fallthrough
+        case EnumCType::VOID_PTR:
+            result = types.getPointer(types.getInt(8));
+            break;
+        case EnumCType::VOID:
+            // There is no 'void*' in the IR, so use 'i8*' like C compilers do.
+            result = datatype.pointers > 0 ? types.getInt(8) : types.getVoid();
+            break;
+        case EnumCType::BOOL:
+            // fallthrough
+        case EnumCType::CHAR:
+            // fallthrough
+        case EnumCType::INT8:
+            result = types.getInt(8);
+            break;
+        case EnumCType::INT16:
+            result = types.getInt(16);
+            break;
+        case EnumCType::ENUM:
+            // fallthrough
+        case EnumCType::INT32:
+            result = types.getInt(32);
+            break;
+        case EnumCType::INT64:
+            result = types.getInt(64);
+            break;
+        case EnumCType::FLOAT:
+            result = types.getFloat();
+            break;
+        case EnumCType::DOUBLE:
+            result = types.getDouble();
+            break;
+        case EnumCType::STRUCT:
+            result = types.getStruct(*datatype.optTypeName);
+            break;
+        default:
+            reporter.bug("Unsupported CType for lowering", Location(0, 0), true);
+            return types.getVoid();
+        }
+
+        for (u16 i = 0; i < datatype.pointers; ++i)
+        {
+            result = result->getPointerTo();
+        }
+
+        if (datatype.isArray())
+        {
+            result = types.getArray(result, datatype.arrayLength);
+        }
+
+        return result;
+    }
+
+    ir::Value* Lower::lowerValue(ExpressionNode* expression)
+    {
+        // Like C, an array used as a value decays to a pointer to its first element.
+        if (expression->getDatatype().isArray())
+        {
+            auto* address = lowerAddress(expression);
+            auto* zero = module.getZero(builder.getTypes().getInt(64));
+
+            return builder.createGEP(address->getType()->getElementType(), address, { zero, zero });
+        }
+
+        current = nullptr;
+        expression->accept(this);
+
+        return current;
+    }
+
+    ir::Value* Lower::lowerAddress(ExpressionNode* expression)
+    {
+        switch (expression->getType())
+        {
+        case EnumNodeType::VARIABLE:
+        {
+            auto* variableNode = static_cast<VariableNode*>(expression);
+            return lookupVariable(variableNode->getName(), variableNode->getLocation());
+        }
+        case EnumNodeType::DEREF:
+        {
+            auto* derefNode = static_cast<DerefNode*>(expression);
+
+            // The address designated by '*x' is the value of x.
+            return derefNode->isExplicit() ? lowerValue(derefNode->getExpression()) : lowerAddress(derefNode->getExpression());
+        }
+        case EnumNodeType::PAREN_EXPRESSION:
+            return lowerAddress(static_cast<ParenExpressionNode*>(expression)->getExpression());
+        case EnumNodeType::ARRAY_INDEX:
+            return lowerArrayIndexAddress(*static_cast<ArrayIndexNode*>(expression));
+        case EnumNodeType::FIELD_ACCESS:
+        {
+            auto* fieldAccessNode = static_cast<FieldAccessNode*>(expression);
+            auto* base = fieldAccessNode->getFieldAccessType() == EnumFieldAccessType::DOT ?
+                lowerAddress(fieldAccessNode->getExpression()) : lowerValue(fieldAccessNode->getExpression());
+            auto* baseType = base->getType();
+
+            if (!baseType->isPointer() || !baseType->getElementType()->isStruct() || baseType->getElementType()->isOpaque())
+            {
+                reporter.bug("Field access on an incomplete or non-struct type", fieldAccessNode->getLocation(), true);
+                return base;
+            }
+
+            return builder.createStructGEP(base, static_cast<u32>(fieldAccessNode->getIndex()));
+        }
+        default:
+            reporter.bug("Expression is not addressable", expression->getLocation(), true);
+            return nullptr;
+        }
+    }
+
+    ir::Value* Lower::lowerCondition(ExpressionNode* expression)
+    {
+        expression = skipParens(expression);
+
+        if (isBoolBinOp(expression))
+        {
+            return lowerBinOp(*static_cast<BinOpNode*>(expression));
+        }
+
+        return toCondition(lowerValue(expression));
+    }
+
+    ir::Value* Lower::toCondition(ir::Value* value)
+    {
+        auto* type = value->getType();
+
+        if (type->isInt(1))
+        {
+            return value;
+        }
+
+        else if (type->isFloatingPoint())
+        {
+            return builder.createFCmp(ir::EnumCmpPredicate::UNE, value, module.getZero(type));
+        }
+
+        return builder.createICmp(ir::EnumCmpPredicate::NE, value, module.getZero(type));
+    }
+
+    ir::ConstantInt* Lower::foldCondition(ir::Value* cond)
+    {
+        auto* constant = evaluateConstant(module, cond);
+
+        if (constant == nullptr || constant->getKind() != ir::EnumValueKind::CONSTANT_INT)
+        {
+            return nullptr;
+        }
+
+        eraseIfUnused(cond);
+
+        return static_cast<ir::ConstantInt*>(constant);
+    }
+
+    ir::ConstantInt* Lower::lowerBranch(ExpressionNode* expression, ir::BasicBlock* trueBlock, ir::BasicBlock* falseBlock)
+    {
+        expression = skipParens(expression);
+
+        if (!isLogicalBinOp(expression))
+        {
+            auto* cond = lowerCondition(expression);
+            auto* constant = foldCondition(cond);
+
+            if (constant == nullptr)
+            {
+                builder.createCondBr(cond, trueBlock, falseBlock);
+            }
+
+            return constant;
+        }
+
+        // An operand that is itself constant just jumps to wherever it decides.
+        const auto branchOn = [this](ExpressionNode* operand, ir::BasicBlock* onTrue, ir::BasicBlock* onFalse)
+        {
+            const auto* constant = lowerBranch(operand, onTrue, onFalse);
+
+            if (constant != nullptr)
+            {
+                builder.createBr(constant->isZero() ? onFalse : onTrue);
+            }
+        };
+
+        // Walk down the left operands of a chain (ex. 'a && b && c') without recursing: the
+        // left operand of a '&&' goes on to test the right one when true, a '||' when false.
+        struct PendingOperand
+        {
+            ExpressionNode* expression;
+            ir::BasicBlock* block;
+            ir::BasicBlock* trueBlock;
+            ir::BasicBlock* falseBlock;
+        };
+
+        std::vector<PendingOperand> pending;
+
+        while (isLogicalBinOp(expression))
+        {
+            auto* binOpNode = static_cast<BinOpNode*>(expression);
+            const bool isAnd = binOpNode->getTypeof() == EnumBinOpNodeType::LOGICAL_AND;
+            auto* rhsBlock = currentFunction->createBlock(isAnd ? "land.rhs" : "lor.rhs");
+
+            pending.push_back({ binOpNode->getRight(), rhsBlock, trueBlock, falseBlock });
+            (isAnd ? trueBlock : falseBlock) = rhsBlock;
+            expression = skipParens(binOpNode->getLeft());
+        }
+
+        branchOn(expression, trueBlock, falseBlock);
+
+        for (auto iter = pending.rbegin(); iter != pending.rend(); ++iter)
+        {
+            startBlock(iter->block);
+            branchOn(iter->expression, iter->trueBlock, iter->falseBlock);
+        }
+
+        return nullptr;
+    }
+
+    ir::Value* Lower::lowerBinOp(BinOpNode& node)
+    {
+        if (node.getTypeof() == EnumBinOpNodeType::ASSIGNMENT)
+        {
+            return lowerAssignment(node);
+        }
+
+        // Long left-leaning chains (ex. 'a + b + c + ...') are walked iteratively, the same
+        // way as the Analyzer and Encode do, evaluating operands from left to right.
+        std::vector<BinOpNode*> spine;
+        node.collectLeftSpine(spine);
+
+        auto* innermost = spine.back();
+        ir::Value* result = innermost->getTypeof() == EnumBinOpNodeType::ASSIGNMENT ?
+            lowerAssignment(*innermost) : lowerValue(innermost->getLeft());
+        std::size_t i = innermost->getTypeof() == EnumBinOpNodeType::ASSIGNMENT ? spine.size() - 1 : spine.size();
+
+        while (i-- > 0)
+        {
+            // '&&' and '||' test the i1 as is, anything else needs it widened first.
+            if (i + 1 < spine.size() && isBoolBinOp(spine[i + 1]) && !spine[i]->isLogicalOp())
+            {
+                result = widenBool(result, resolveType(spine[i + 1]->getDatatype()));
+            }
+
+            result = lowerBinOpStep(*spine[i], result);
+        }
+
+        return result;
+    }
+
+    ir::Value* Lower::lowerBinOpStep(BinOpNode& node, ir::Value* left)
+    {
+        const EnumBinOpNodeType opType = node.getTypeof();
+        const auto& location = node.getLocation();
+
+        if (node.isLogicalOp())
+        {
+            return lowerLogical(node, left);
+        }
+
+        else if (opType == EnumBinOpNodeType::ASSIGNMENT)
+        {
+            reporter.bug("Unexpected assignment within a binary expression chain", location, true);
+            return left;
+        }
+
+        auto* right = lowerValue(node.getRight());
+
+        if (node.isComparisonOp())
+        {
+            return lowerCompare(node, left, right);
+        }
+
+        const bool isAdditive = opType == EnumBinOpNodeType::ADD || opType == EnumBinOpNodeType::SUBTRACT;
+
+        if (isAdditive && left->getType()->isPointer() && right->getType()->isInt())
+        {
+            return lowerPointerArithmetic(node, left, right, opType == EnumBinOpNodeType::SUBTRACT);
+        }
+
+        else if (opType == EnumBinOpNodeType::ADD && left->getType()->isInt() && right->getType()->isPointer())
+        {
+            return lowerPointerArithmetic(node, right, left, false);
+        }
+
+        right = convert(right, left->getType(), location, isUnsignedExpression(node.getRight()));
+
+        const bool fp = left->getType()->isFloatingPoint();
+        const bool isUnsigned = isUnsignedExpression(node.getLeft()) || isUnsignedExpression(node.getRight());
+        ir::EnumOpcode opcode;
+
+        switch (opType)
+        {
+        case EnumBinOpNodeType::ADD:
+            opcode = fp ? ir::EnumOpcode::FADD : ir::EnumOpcode::ADD;
+            break;
+        case EnumBinOpNodeType::SUBTRACT:
+            opcode = fp ? ir::EnumOpcode::FSUB : ir::EnumOpcode::SUB;
+            break;
+        case EnumBinOpNodeType::MULTIPLY:
+            opcode = fp ? ir::EnumOpcode::FMUL : ir::EnumOpcode::MUL;
+            break;
+        case EnumBinOpNodeType::DIVIDE:
+            opcode = fp ? ir::EnumOpcode::FDIV : isUnsigned ? ir::EnumOpcode::UDIV : ir::EnumOpcode::SDIV;
+            break;
+        case EnumBinOpNodeType::MODULUS:
+            opcode = fp ? ir::EnumOpcode::FREM : isUnsigned ? ir::EnumOpcode::UREM : ir::EnumOpcode::SREM;
+            break;
+        case EnumBinOpNodeType::BITWISE_AND:
+            opcode = ir::EnumOpcode::AND;
+            break;
+        case EnumBinOpNodeType::BITWISE_OR:
+            opcode = ir::EnumOpcode::OR;
+            break;
+        case EnumBinOpNodeType::BITWISE_XOR:
+            opcode = ir::EnumOpcode::XOR;
+            break;
+        case EnumBinOpNodeType::SHIFT_LEFT:
+            opcode = ir::EnumOpcode::SHL;
+            break;
+        case EnumBinOpNodeType::SHIFT_RIGHT:
+            // Note: The shifted value alone decides, like C's promoted left operand.
+            opcode = isUnsignedExpression(node.getLeft()) ? ir::EnumOpcode::LSHR : ir::EnumOpcode::ASHR;
+            break;
+        default:
+            reporter.bug("Unsupported binary operator for lowering", location, true);
+            return left;
+        }
+
+        if (!left->getType()->isInt() && !(fp && opcode >= ir::EnumOpcode::FADD))
+        {
+            reporter.bug("Invalid operand types for binary operator", location, true);
+            return left;
+        }
+
+        auto* instruction = builder.createBinary(opcode, left, right);
+
+        if (opcode == ir::EnumOpcode::ADD || opcode == ir::EnumOpcode::SUB || opcode == ir::EnumOpcode::MUL)
+        {
+            instruction->setFlag(ir::EnumInstructionFlag::NSW, isNoSignedWrap(isUnsigned, left->getType()));
+        }
+
+        return instruction;
+    }
+
+    ir::Value* Lower::lowerAssignment(BinOpNode& node)
+    {
+        auto* value = lowerValue(node.getRight());
+
+        // When the Analyzer pops the explicit DerefNode off of '*x = y', the left node
+        // is left as 'x', whose value is the address to store to.
+        auto* address = node.isLeftDerefPopped() ? lowerValue(node.getLeft()) : lowerAddress(node.getLeft());
+
+        if (address == nullptr || !address->getType()->isPointer())
+        {
+            reporter.bug("Assignment to a non-addressable expression", node.getLocation(), true);
+            return value;
+        }
+
+        value = convert(value, address->getType()->getElementType(), node.getLocation(),
+            isUnsignedExpression(node.getRight()), isUnsignedExpression(node.getLeft()));
+        builder.createStore(value, address);
+
+        return value;
+    }
+
+    ir::Value* Lower::lowerCompare(BinOpNode& node, ir::Value* left, ir::Value* right)
+    {
+        // Note: A NULL litteral adopts the type of the other operand.
+        if (left->getType() != right->getType())
+        {
+            if (left->getKind() == ir::EnumValueKind::CONSTANT_NULL)
+            {
+                left = convert(left, right->getType(), node.getLocation());
+            }
+
+            else
+            {
+                right = convert(right, left->getType(), node.getLocation(), isUnsignedExpression(node.getRight()));
+            }
+        }
+
+        auto* type = left->getType();
+        const bool fp = type->isFloatingPoint();
+        const bool isUnsigned = type->isPointer() || isUnsignedExpression(node.getLeft()) ||
+            isUnsignedExpression(node.getRight());
+        ir::EnumCmpPredicate predicate;
+
+        switch (node.getTypeof())
+        {
+        case EnumBinOpNodeType::CMP_EQ:
+            predicate = fp ? ir::EnumCmpPredicate::OEQ : ir::EnumCmpPredicate::EQ;
+            break;
+        case EnumBinOpNodeType::CMP_NE:
+            predicate = fp ? ir::EnumCmpPredicate::UNE : ir::EnumCmpPredicate::NE;
+            break;
+        case EnumBinOpNodeType::CMP_GE:
+            predicate = fp ? ir::EnumCmpPredicate::OGE : isUnsigned ? ir::EnumCmpPredicate::UGE : ir::EnumCmpPredicate::SGE;
+            break;
+        case EnumBinOpNodeType::CMP_GT:
+            predicate = fp ? ir::EnumCmpPredicate::OGT : isUnsigned ? ir::EnumCmpPredicate::UGT : ir::EnumCmpPredicate::SGT;
+            break;
+        case EnumBinOpNodeType::CMP_LE:
+            predicate = fp ? ir::EnumCmpPredicate::OLE : isUnsigned ? ir::EnumCmpPredicate::ULE : ir::EnumCmpPredicate::SLE;
+            break;
+        case EnumBinOpNodeType::CMP_LT:
+            predicate = fp ? ir::EnumCmpPredicate::OLT : isUnsigned ? ir::EnumCmpPredicate::ULT : ir::EnumCmpPredicate::SLT;
+            break;
+        default:
+            reporter.bug("Unsupported comparison operator for lowering", node.getLocation(), true);
+            return left;
+        }
+
+        return fp ? builder.createFCmp(predicate, left, right) : builder.createICmp(predicate, left, right);
+    }
+
+    ir::Value* Lower::lowerLogical(BinOpNode& node, ir::Value* left)
+    {
+        const bool isAnd = node.getTypeof() == EnumBinOpNodeType::LOGICAL_AND;
+        auto* cond = toCondition(left);
+        auto* leftBlock = builder.getInsertBlock();
+        auto* rhsBlock = currentFunction->createBlock(isAnd ? "land.rhs" : "lor.rhs");
+        auto* endBlock = currentFunction->createBlock(isAnd ? "land.end" : "lor.end");
+
+        // The right operand is only evaluated when the left one doesn't already decide.
+        builder.createCondBr(cond, isAnd ? rhsBlock : endBlock, isAnd ? endBlock : rhsBlock);
+
+        startBlock(rhsBlock);
+        auto* right = lowerCondition(node.getRight());
+        auto* rightBlock = builder.getInsertBlock();
+        builder.createBr(endBlock);
+
+        startBlock(endBlock);
+        auto* phi = builder.createPhi(builder.getTypes().getBool());
+        phi->addIncoming(module.getConstantInt(builder.getTypes().getBool(), isAnd ? 0 : 1), leftBlock);
+        phi->addIncoming(right, rightBlock);
+
+        return phi;
+    }
+
+    void Lower::lowerSwitchDispatch(ir::Value* value, const SwitchCaseList& cases, ir::BasicBlock* defaultBlock,
+        const bool isUnsigned)
+    {
+        if (cases.empty())
+        {
+            builder.createBr(defaultBlock);
+            return;
+        }
+
+        auto* type = value->getType();
+        const auto clusters = clusterCases(cases);
+
+        // Ranges of clusters still to dispatch over, each entered from its own block.  The
+        // ranges are halved at every step, so any case is found in a logarithmic number of tests.
+        struct PendingRange
+        {
+            std::size_t first;
+            std::size_t last;
+            ir::BasicBlock* block;
+        };
+
+        std::vector<PendingRange> pending { { 0, clusters.size() - 1, builder.getInsertBlock() } };
+
+        while (!pending.empty())
+        {
+            const auto range = pending.back();
+            pending.pop_back();
+
+            if (range.block != builder.getInsertBlock())
+            {
+                startBlock(range.block);
+            }
+
+            if (range.last - range.first + 1 > MAX_LINEAR_CLUSTERS)
+            {
+                const std::size_t middle = range.first + (range.last - range.first + 1) / 2;
+                auto* pivot = module.getConstantInt(type, cases[clusters[middle].first].first);
+                auto* lowBlock = currentFunction->createBlock("switch.lo");
+                auto* highBlock = currentFunction->createBlock("switch.hi");
+
+                const auto predicate = isUnsigned ? ir::EnumCmpPredicate::ULT : ir::EnumCmpPredicate::SLT;
+                builder.createCondBr(builder.createICmp(predicate, value, pivot), lowBlock, highBlock);
+
+                // The low half is popped (and emitted) first.
+                pending.push_back({ middle, range.last, highBlock });
+                pending.push_back({ range.first, middle - 1, lowBlock });
+                continue;
+            }
+
+            for (std::size_t i = range.first; i <= range.last; ++i)
+            {
+                const auto& cluster = clusters[i];
+                auto* nextBlock = i < range.last ? currentFunction->createBlock("switch.next") : defaultBlock;
+
+                if (cluster.isJumpTable)
+                {
+                    auto* instruction = builder.createSwitch(value, nextBlock);
+
+                    for (std::size_t j = cluster.first; j <= cluster.last; ++j)
+                    {
+                        instruction->addCase(module.getConstantInt(type, cases[j].first), cases[j].second);
+                    }
+                }
+
+                else
+                {
+                    const auto& [caseValue, caseBlock] = cases[cluster.first];
+                    auto* cond = builder.createICmp(ir::EnumCmpPredicate::EQ, value, module.getConstantInt(type, caseValue));
+                    builder.createCondBr(cond, caseBlock, nextBlock);
+                }
+
+                if (i < range.last)
+                {
+                    startBlock(nextBlock);
+                }
+            }
+        }
+    }
+
+    ir::Value* Lower::lowerArrayIndexAddress(ArrayIndexNode& node)
+    {
+        auto* i64 = builder.getTypes().getInt(64);
+        auto* base = node.getExpression();
+        const bool isArray = base->getDatatype().isArray();
+        auto* pointer = isArray ? lowerAddress(base) : lowerValue(base);
+        auto* index = lowerValue(node.getIndex());
+        const bool isUnsigned = isUnsignedExpression(node.getIndex());
+
+        // Keep constant indices constant so that alias analysis can tell the elements apart.
+        if (index->getKind() == ir::EnumValueKind::CONSTANT_INT)
+        {
+            const auto* constant = static_cast<const ir::ConstantInt*>(index);
+            index = module.getConstantInt(i64, isUnsigned ? static_cast<s64>(constant->getZExtValue()) : constant->getValue());
+        }
+
+        else
+        {
+            index = convert(index, i64, node.getLocation(), isUnsigned);
+        }
+
+        if (isArray)
+        {
+            return builder.createGEP(pointer->getType()->getElementType(), pointer, { module.getZero(i64), index });
+        }
+
+        return builder.createGEP(pointer->getType()->getElementType(), pointer, { index });
+    }
+
+    ir::Value* Lower::lowerPointerArithmetic(BinOpNode& node, ir::Value* pointer, ir::Value* offset, const bool negate)
+    {
+        auto* i64 = builder.getTypes().getInt(64);
+        const auto* offsetExpression = node.getLeft()->getDatatype().isPointerType() ? node.getRight() : node.getLeft();
+        offset = convert(offset, i64, node.getLocation(), isUnsignedExpression(offsetExpression));
+
+        if (negate)
+        {
+            offset = builder.createBinary(ir::EnumOpcode::SUB, module.getZero(i64), offset);
+        }
+
+        return builder.createGEP(pointer->getType()->getElementType(), pointer, { offset });
+    }
+
+    ir::Value* Lower::convert(ir::Value* value, ir::Type* type, const Location& location, const bool fromUnsigned,
+        const bool toUnsigned)
+    {
+        auto* from = value->getType();
+
+        if (from == type)
+        {
+            return value;
+        }
+
+        ir::EnumOpcode opcode;
+
+        if (from->isInt() && type->isInt())
+        {
+            // Note: i1 only ever comes from comparisons which are 0 or 1.
+            opcode = from->getBits() > type->getBits() ? ir::EnumOpcode::TRUNC :
+                from->isInt(1) || fromUnsigned ? ir::EnumOpcode::ZEXT : ir::EnumOpcode::SEXT;
+        }
+
+        else if (from->isInt() && type->isFloatingPoint())
+        {
+            opcode = from->isInt(1) || fromUnsigned ? ir::EnumOpcode::UI_TO_FP : ir::EnumOpcode::SI_TO_FP;
+        }
+
+        else if (from->isFloatingPoint() && type->isInt())
+        {
+            opcode = toUnsigned ? ir::EnumOpcode::FP_TO_UI : ir::EnumOpcode::FP_TO_SI;
+        }
+
+        else if (from->isFloatingPoint() && type->isFloatingPoint())
+        {
+            opcode = type->getKind() == ir::EnumTypeKind::DOUBLE ? ir::EnumOpcode::FP_EXT : ir::EnumOpcode::FP_TRUNC;
+        }
+
+        else if (from->isPointer() && type->isPointer())
+        {
+            if (value->getKind() == ir::EnumValueKind::CONSTANT_NULL)
+            {
+                return module.getNull(type);
+            }
+
+            opcode = ir::EnumOpcode::BITCAST;
+        }
+
+        else if (from->isPointer() && type->isInt())
+        {
+            opcode = ir::EnumOpcode::PTR_TO_INT;
+        }
+
+        else if (from->isInt() && type->isPointer())
+        {
+            if (value->getKind() == ir::EnumValueKind::CONSTANT_INT && static_cast<ir::ConstantInt*>(value)->isZero())
+            {
+                return module.getNull(type);
+            }
+
+            opcode = ir::EnumOpcode::INT_TO_PTR;
+        }
+
+        else
+        {
+            reporter.bug("Cannot convert from '" + from->toString() + "' to '" + type->toString() + '\'', location, true);
+            return value;
+        }
+
+        return builder.createCast(opcode, value, type);
+    }
+
+    ir::Value* Lower::widenBool(ir::Value* value, ir::Type* type)
+    {
+        if (value->getType() == type)
+        {
+            return value;
+        }
+
+        else if (type->isFloatingPoint())
+        {
+            return builder.createCast(ir::EnumOpcode::UI_TO_FP, value, type);
+        }
+
+        else if (type->isPointer())
+        {
+            auto* asInt = builder.createCast(ir::EnumOpcode::ZEXT, value, builder.getTypes().getInt(64));
+            return builder.createCast(ir::EnumOpcode::INT_TO_PTR, asInt, type);
+        }
+
+        return builder.createCast(ir::EnumOpcode::ZEXT, value, type);
+    }
+
+    ir::Instruction* Lower::createEntryAlloca(ir::Type* type, const std::string& name)
+    {
+        // Keep every alloca grouped at the top of the entry block, in declaration order.
+        auto* entry = currentFunction->getEntryBlock();
+        ir::Instruction* position = nullptr;
+
+        for (auto& instruction : *entry)
+        {
+            if (instruction->getOpcode() != ir::EnumOpcode::ALLOCA)
+            {
+                position = instruction.get();
+                break;
+            }
+        }
+
+        auto alloca = std::make_unique<ir::Instruction>(ir::EnumOpcode::ALLOCA, type->getPointerTo(), std::vector<ir::Value*>(), name);
+        alloca->setAuxType(type);
+
+        return entry->insertBefore(position, std::move(alloca));
+    }
+
+    void Lower::startBlock(ir::BasicBlock* block)
+    {
+        currentFunction->moveBlockAfter(block, builder.getInsertBlock());
+        builder.setInsertPoint(block);
+    }
+
+    void Lower::branchTo(ir::BasicBlock* block)
+    {
+        if (!builder.isTerminated())
+        {
+            builder.createBr(block);
+        }
+    }
+
+    void Lower::finishFunction()
+    {
+        auto* returnType = currentFunction->getReturnType();
+
+        // Falling off the end of a void function returns.  Anywhere else (ex. the block after
+        // an if/else whose branches both return) control can never get here.
+        for (auto& block : *currentFunction)
+        {
+            if (block->getTerminator() == nullptr)
+            {
+                builder.setInsertPoint(block.get());
+
+                if (returnType->isVoid())
+                {
+                    builder.createRetVoid();
+                }
+
+                else
+                {
+                    builder.createUnreachable();
+                }
+            }
+        }
+
+        // Drop the blocks that can't be reached from the entry (mostly the blocks opened
+        // after a return statement) so the output stays readable.
+        std::unordered_set<ir::BasicBlock*> reachable;
+        std::vector<ir::BasicBlock*> worklist { currentFunction->getEntryBlock() };
+        reachable.insert(worklist.front());
+
+        while (!worklist.empty())
+        {
+            auto* block = worklist.back();
+            worklist.pop_back();
+
+            for (auto* succ : block->getSuccessors())
+            {
+                if (reachable.insert(succ).second)
+                {
+                    worklist.push_back(succ);
+                }
+            }
+        }
+
+        std::vector<ir::BasicBlock*> unreachable;
+
+        for (auto& block : *currentFunction)
+        {
+            if (reachable.find(block.get()) == reachable.cend())
+            {
+                unreachable.push_back(block.get());
+            }
+        }
+
+        // Drop references first since dead blocks may use each other's values.
+        for (auto* block : unreachable)
+        {
+            for (auto& instruction : *block)
+            {
+                instruction->dropAllReferences();
+            }
+        }
+
+        for (auto* block : unreachable)
+        {
+            currentFunction->remove(block);
+        }
+
+        builder.setInsertPoint(static_cast<ir::BasicBlock*>(nullptr));
+    }
+
+    void Lower::declareStructs(TranslationUnitNode& node)
+    {
+        auto& types = builder.getTypes();
+
+        for (auto& statement : node)
+        {
+            if (statement->getType() == EnumNodeType::STRUCT_FWD_DECLARATION)
+            {
+                types.getStruct(static_cast<StructFwdDeclarationStatementNode*>(statement.get())->getName());
+            }
+
+            else if (statement->getType() == EnumNodeType::STRUCT_DEFINITION)
+            {
+                auto* definition = static_cast<StructDefinitionStatementNode*>(statement.get());
+                auto* type = types.getStruct(definition->getName());
+                std::vector<ir::Type*> fields;
+
+                for (const auto& fieldStatementPtr : definition->getBlockNode())
+                {
+                    const auto& field = static_cast<const VariableDeclarationStatementNode&>(*fieldStatementPtr);
+                    fields.push_back(resolveType(field.getDatatype()));
+                }
+
+                type->setFields(std::move(fields));
+            }
+        }
+    }
+
+    void Lower::declareFunction(const std::string& name, const CType& returnType, const std::vector<const ParameterNode*>& params)
+    {
+        std::vector<ir::Type*> paramTypes;
+        paramTypes.reserve(params.size());
+
+        for (const auto* param : params)
+        {
+            paramTypes.push_back(resolveType(param->getDatatype().getDatatype()));
+        }
+
+        auto* functionType = builder.getTypes().getFunction(resolveType(returnType), paramTypes);
+        module.getOrInsertFunction(name, functionType);
+    }
+
+    ir::Value* Lower::lookupVariable(const std::string& name, const Location& location)
+    {
+        for (auto iter = scopes.rbegin(); iter != scopes.rend(); ++iter)
+        {
+            const auto findResult = iter->find(name);
+
+            if (findResult != iter->cend())
+            {
+                return findResult->second;
+            }
+        }
+
+        reporter.bug("Failed to find storage for variable '" + name + '\'', location, true);
+        return nullptr;
+    }
+}
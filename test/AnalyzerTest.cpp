@@ -1,10 +1,13 @@
 #include <cmm/NodeList.h>
 #include <cmm/Parser.h>
 #include <cmm/Reporter.h>
+#include <cmm/platform/PlatformLLVM.h>
 #include <cmm/visit/Analyzer.h>
+#include <cmm/visit/Encode.h>
 
 #include <gtest/gtest.h>
 
+#include <sstream>
 #include <string>
 
 using namespace cmm;
@@ -873,6 +876,24 @@ TEST(AnalyzerTest, AnalyzerEnumDefinitionStatementNodeThenAssignToVarValid)
     ASSERT_EQ(reporter.getErrorCount(), 0);
 }
 
+TEST(AnalyzerTest, AnalyzerEnumeratorAsConditionalValid)
+{
+    reporter.reset();
+
+    const std::string input = "enum A { X, Y }; int main() { int a; a = 0; if (Y) { a = 1; } while (X) { a = 2; } return a; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getWarningCount(), 0);
+    ASSERT_EQ(reporter.getErrorCount(), 0);
+}
+
 TEST(AnalyzerTest, AnalyzerEnumDefinitionStatementNodeWithAssignmentCharWarning)
 {
     reporter.reset();
@@ -981,6 +1002,307 @@ TEST(AnalyzerTest, AnalyzerAssignEnumVariableToAnotherWarning)
     ASSERT_EQ(reporter.getErrorCount(), 1);
 }
 
+TEST(AnalyzerTest, AnalyzerAssignThroughPointerPromotesToPointeeType)
+{
+    reporter.reset();
+
+    // Assigning through the pointer pops the DerefNode the left type came from.
+    const std::string input = "void func(float* value) { *value = 2; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getWarningCount(), 1);
+    ASSERT_EQ(reporter.getErrorCount(), 0);
+
+    auto& translationUnit = compUnitPtr->getRoot();
+    auto* funcDefPtr = static_cast<FunctionDefinitionStatementNode*>(translationUnit.begin()->get());
+    auto* statementPtr = static_cast<ExpressionStatementNode*>(funcDefPtr->getBlock().begin()->get());
+    ASSERT_EQ(statementPtr->getExpression()->getType(), EnumNodeType::BIN_OP);
+
+    auto* binOpPtr = static_cast<BinOpNode*>(statementPtr->getExpression());
+    ASSERT_EQ(binOpPtr->getDatatype(), CType(EnumCType::FLOAT));
+    ASSERT_EQ(binOpPtr->getRight()->getType(), EnumNodeType::CAST);
+    ASSERT_EQ(binOpPtr->getRight()->getDatatype(), CType(EnumCType::FLOAT));
+}
+
+TEST(AnalyzerTest, AnalyzerAndEncodeLongBinOpChain)
+{
+    reporter.reset();
+
+    // Deep enough to overflow the stack if any pass recursed once per operator.
+    const std::size_t terms = 100000;
+    std::ostringstream builder;
+    builder << "int main() { int x; x = 1; x = x";
+
+    for (std::size_t i = 1; i < terms; ++i)
+    {
+        builder << " + x";
+    }
+
+    builder << "; return x; }";
+
+    Parser parser(builder.str());
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getWarningCount(), 0);
+    ASSERT_EQ(reporter.getErrorCount(), 0);
+
+    std::ostringstream os;
+    PlatformLLVM platform;
+    Encode encoder(&platform, os);
+    encoder.visit(*compUnitPtr);
+
+    ASSERT_FALSE(os.str().empty());
+
+    // Destroying the tree must not recurse once per operator either.
+    compUnitPtr.reset();
+}
+
+TEST(AnalyzerTest, AnalyzerAndEncodeDeeplyNestedBlocks)
+{
+    reporter.reset();
+
+    // Deep enough to overflow the stack if any pass recursed once per block.
+    const std::size_t depth = 100000;
+    std::ostringstream builder;
+    builder << "int main() { int x; x = 1; ";
+
+    for (std::size_t i = 0; i < depth; ++i)
+    {
+        builder << '{';
+    }
+
+    builder << " int y; y = x; x = y + 1; ";
+
+    for (std::size_t i = 0; i < depth; ++i)
+    {
+        builder << '}';
+    }
+
+    builder << " return x; }";
+
+    Parser parser(builder.str());
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getWarningCount(), 0);
+    ASSERT_EQ(reporter.getErrorCount(), 0);
+
+    std::ostringstream os;
+    PlatformLLVM platform;
+    Encode encoder(&platform, os);
+    encoder.visit(*compUnitPtr);
+
+    ASSERT_FALSE(os.str().empty());
+
+    // Destroying the tree must not recurse once per block either.
+    compUnitPtr.reset();
+}
+
+TEST(AnalyzerTest, AnalyzerSwitchStatementOnEnum)
+{
+    reporter.reset();
+
+    const std::string input = "enum State { IDLE, RUN, DONE }; enum State step(enum State s) { "
+        "while (1) { switch (s) { case IDLE: s = RUN; break; case RUN: return DONE; case DONE: break; } break; } "
+        "return s; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getWarningCount(), 0);
+    ASSERT_EQ(reporter.getErrorCount(), 0);
+}
+
+TEST(AnalyzerTest, AnalyzerSwitchStatementUnhandledEnumeratorWarning)
+{
+    reporter.reset();
+
+    const std::string input = "enum State { IDLE, RUN, DONE }; int f(enum State s) { switch (s) { case IDLE: return 1; } return 0; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getWarningCount(), 2);
+    ASSERT_EQ(reporter.getErrorCount(), 0);
+}
+
+TEST(AnalyzerTest, AnalyzerSwitchStatementDuplicateCaseError)
+{
+    reporter.reset();
+
+    const std::string input = "int f(int x) { switch (x) { case 1: return 1; case 2: return 2; case 1: return 3; } return 0; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getWarningCount(), 0);
+    ASSERT_EQ(reporter.getErrorCount(), 1);
+}
+
+TEST(AnalyzerTest, AnalyzerSwitchStatementNonConstantCaseError)
+{
+    reporter.reset();
+
+    const std::string input = "int f(int x, int y) { switch (x) { case y: return 1; default: return 2; } return 0; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getErrorCount(), 1);
+}
+
+TEST(AnalyzerTest, AnalyzerBreakStatementOutsideLoopError)
+{
+    reporter.reset();
+
+    const std::string input = "int f(int x) { if (x > 0) { break; } return x; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getWarningCount(), 0);
+    ASSERT_EQ(reporter.getErrorCount(), 1);
+}
+
+TEST(AnalyzerTest, AnalyzerUnsignedOperandWinsAndEncodes)
+{
+    reporter.reset();
+
+    const std::string input = "unsigned f(unsigned u, int i) { unsigned q; q = i / u; "
+        "if (i < u) { q = q >> 1; } return q; } long g(unsigned u) { unsigned q; q = u; return (long) q; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getErrorCount(), 0);
+
+    std::ostringstream os;
+    PlatformLLVM platform;
+    Encode encoder(&platform, os);
+    encoder.visit(*compUnitPtr);
+
+    const auto output = os.str();
+    ASSERT_NE(output.find("udiv i32"), std::string::npos);
+    ASSERT_NE(output.find("icmp ult i32"), std::string::npos);
+    ASSERT_NE(output.find("lshr i32"), std::string::npos);
+    ASSERT_NE(output.find("zext i32"), std::string::npos);
+    ASSERT_EQ(output.find("sdiv"), std::string::npos);
+}
+
+TEST(AnalyzerTest, AnalyzerSignedArithmeticEncodesNoSignedWrap)
+{
+    reporter.reset();
+
+    const std::string input = "int f(int a, int b) { int c; c = a * b - 1; c++; return -c / b; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getErrorCount(), 0);
+
+    std::ostringstream os;
+    PlatformLLVM platform;
+    Encode encoder(&platform, os);
+    encoder.visit(*compUnitPtr);
+
+    const auto output = os.str();
+    ASSERT_NE(output.find("mul nsw i32"), std::string::npos);
+    ASSERT_NE(output.find("add nsw i32"), std::string::npos);
+    ASSERT_NE(output.find("sub nsw i32 0,"), std::string::npos);
+    ASSERT_NE(output.find("sdiv i32"), std::string::npos);
+}
+
+TEST(AnalyzerTest, AnalyzerArrayIndexAndDecay)
+{
+    reporter.reset();
+
+    const std::string input = "int sum(int p[], int n) { return p[n - 1]; } "
+        "int main() { int a[4]; int* p; a[0] = 1; p = a; p[1] = a[0]; return sum(a, 2); }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getErrorCount(), 0);
+    ASSERT_EQ(reporter.getWarningCount(), 0);
+}
+
+TEST(AnalyzerTest, AnalyzerArrayIndexErrors)
+{
+    reporter.reset();
+
+    const std::string input = "int main() { int a[4]; int b[4]; int x; float f; "
+        "x[0] = 1; a[f] = 2; a = b; a++; return 0; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    // Subscripting a non-array, a non-int subscript and assigning or incrementing an array.
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    ASSERT_EQ(reporter.getErrorCount(), 4);
+}
+
 s32 main(s32 argc, char* argv[])
 {
     reporter.setEnablePrint(false);
@@ -0,0 +1,1963 @@
+#include <cmm/NodeList.h>
+#include <cmm/Parser.h>
+#include <cmm/Reporter.h>
+#include <cmm/ir/AliasAnalysis.h>
+#include <cmm/ir/CallGraph.h>
+#include <cmm/ir/ConstantFold.h>
+#include <cmm/ir/DataFlow.h>
+#include <cmm/ir/Dominators.h>
+#include <cmm/ir/IRBuilder.h>
+#include <cmm/ir/LoopInfo.h>
+#include <cmm/ir/Module.h>
+#include <cmm/ir/Printer.h>
+#include <cmm/ir/Verifier.h>
+#include <cmm/opt/ArgumentAttributes.h>
+#include <cmm/opt/ConstantPropagation.h>
+#include <cmm/opt/DeadCodeElimination.h>
+#include <cmm/opt/FunctionAttributes.h>
+#include <cmm/opt/GlobalValueNumbering.h>
+#include <cmm/opt/Inliner.h>
+#include <cmm/opt/LoopInvariantCodeMotion.h>
+#include <cmm/opt/LoopStrengthReduction.h>
+#include <cmm/opt/LoopVectorize.h>
+#include <cmm/opt/Mem2Reg.h>
+#include <cmm/opt/PassManager.h>
+#include <cmm/opt/Peephole.h>
+#include <cmm/opt/ScalarReplacement.h>
+#include <cmm/opt/TailCallElimination.h>
+#include <cmm/platform/IRPlatformLLVM.h>
+#include <cmm/visit/Analyzer.h>
+#include <cmm/visit/Lower.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace cmm;
+
+static Reporter& reporter = Reporter::instance();
+
+// Parses, analyzes and lowers the input, asserting each stage is error free.
+static std::unique_ptr<ir::Module> lowerInput(const std::string& input)
+{
+    reporter.reset();
+
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    EXPECT_TRUE(errorMessage.empty());
+    EXPECT_NE(compUnitPtr, nullptr);
+
+    if (compUnitPtr == nullptr)
+    {
+        return nullptr;
+    }
+
+    Analyzer analyzer;
+    analyzer.visit(*compUnitPtr);
+    EXPECT_EQ(reporter.getErrorCount(), 0);
+
+    auto module = std::make_unique<ir::Module>("test");
+    Lower lower(*module);
+    lower.visit(*compUnitPtr);
+    EXPECT_EQ(reporter.getErrorCount(), 0);
+
+    ir::Verifier verifier;
+    const bool valid = verifier.verify(*module);
+
+    for (const auto& error : verifier.getErrors())
+    {
+        ADD_FAILURE() << error;
+    }
+
+    EXPECT_TRUE(valid);
+
+    return module;
+}
+
+static bool contains(const std::string& str, const std::string& substr)
+{
+    return str.find(substr) != std::string::npos;
+}
+
+TEST(IRTest, LowerReturnConstant)
+{
+    auto module = lowerInput("int main() { return 42; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "define i32 @main()"));
+    ASSERT_TRUE(contains(output, "ret i32 42"));
+}
+
+TEST(IRTest, LowerDeeplyNestedBlocks)
+{
+    const std::size_t depth = 100000;
+    const std::string input = "int main() { int x; x = 41; " + std::string(depth, '{') + " int y; y = x + 1; x = y; "
+        + std::string(depth, '}') + " return x; }";
+
+    auto module = lowerInput(input);
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "define i32 @main()"));
+    ASSERT_TRUE(contains(output, "add nsw i32"));
+}
+
+TEST(IRTest, LowerFunctionCall)
+{
+    auto module = lowerInput("int sum(int x, int y) { return x + y; } int main() { int a; a = 10; int b; b = 32; int c; c = sum(a, b); return c; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "define i32 @sum(i32 %x, i32 %y)"));
+    ASSERT_TRUE(contains(output, "add nsw i32"));
+    ASSERT_TRUE(contains(output, "call i32 @sum(i32"));
+}
+
+TEST(IRTest, LowerIfElse)
+{
+    auto module = lowerInput("int main() { int a; a = 10; if (a + 1) { a = 20; } else { a = 30; } return a; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "icmp ne i32"));
+    ASSERT_TRUE(contains(output, "if.then:"));
+    ASSERT_TRUE(contains(output, "if.else:"));
+    ASSERT_TRUE(contains(output, "if.end:"));
+}
+
+TEST(IRTest, LowerIfBothBranchesReturn)
+{
+    auto module = lowerInput("int main() { int a; a = 10; if (a == 10) { return 1; } else { return 2; } }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "icmp eq i32"));
+
+    // Nothing branches to the join block, so it is dropped.
+    ASSERT_FALSE(contains(output, "if.end"));
+}
+
+TEST(IRTest, LowerWhile)
+{
+    auto module = lowerInput("int main() { int i; i = 0; while (i < 10) { i = i + 1; } return i; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "while.cond:"));
+    ASSERT_TRUE(contains(output, "icmp slt i32"));
+    ASSERT_TRUE(contains(output, "br label %while.cond"));
+}
+
+TEST(IRTest, LowerFloatCast)
+{
+    auto module = lowerInput("int main() { float a; a = 10.0F; float b; b = 16.0F; float c; c = (2.0F * -b) + a; int result; result = (int) c; return result; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "fneg float"));
+    ASSERT_TRUE(contains(output, "fmul float"));
+    ASSERT_TRUE(contains(output, "fptosi float"));
+}
+
+TEST(IRTest, LowerPointers)
+{
+    auto module = lowerInput("void func(int* value) { *value = *value * 2; } int main() { int x; x = 2; func(&x); return x; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "define void @func(i32* %value)"));
+    ASSERT_TRUE(contains(output, "call void @func(i32* %x)"));
+    ASSERT_TRUE(contains(output, "ret void"));
+}
+
+TEST(IRTest, LowerIncrementDecrement)
+{
+    auto module = lowerInput("int main() { int x; x = 2; int y; y = 3; int result; result = x-- + --y; return result; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "sub nsw i32"));
+}
+
+TEST(IRTest, LowerNestedStructs)
+{
+    auto module = lowerInput("struct Vec2 { int x; int y; }; struct Vec3 { struct Vec2 v2; int z; }; int main() { struct Vec3 v3; v3.v2.x = 10; v3.v2.y = 12; v3.z = 20; int result; result = v3.v2.x + v3.v2.y + v3.z; return result; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "%struct.Vec2 = type { i32, i32 }"));
+    ASSERT_TRUE(contains(output, "%struct.Vec3 = type { %struct.Vec2, i32 }"));
+    ASSERT_TRUE(contains(output, "getelementptr inbounds %struct.Vec3, %struct.Vec3* %v3, i32 0, i32 0"));
+}
+
+TEST(IRTest, LowerEnum)
+{
+    auto module = lowerInput("enum A { X, Y }; int main() { enum A a; a = Y; return (int) a; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "store i32 1"));
+}
+
+TEST(IRTest, LowerStringsAndOpaqueStructs)
+{
+    auto module = lowerInput("struct FILE* fopen(char* filename, char* mode); int fclose(struct FILE*); int fputs(char* str, struct FILE*); int main() { struct FILE* file; file = fopen(\"test.txt\", \"w\"); fputs(\"Hello, world!\", file); fclose(file); return 0; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "%struct.FILE = type opaque"));
+    ASSERT_TRUE(contains(output, "c\"Hello, world!\\00\""));
+    ASSERT_TRUE(contains(output, "declare %struct.FILE* @fopen(i8*, i8*)"));
+}
+
+TEST(IRTest, LowerGlobal)
+{
+    auto module = lowerInput("int counter; int main() { counter = 5; return counter; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "@counter = global i32 0"));
+    ASSERT_TRUE(contains(output, "store i32 5, i32* @counter"));
+}
+
+TEST(IRTest, PlatformLLVMEmit)
+{
+    auto module = lowerInput("int main() { return 0; }");
+    ASSERT_NE(module, nullptr);
+
+    IRPlatformLLVM platform;
+    std::ostringstream os;
+    platform.emit(*module, os);
+
+    ASSERT_TRUE(contains(os.str(), "; ModuleID = 'test'"));
+    ASSERT_TRUE(contains(os.str(), "    ret i32 0"));
+}
+
+TEST(IRTest, LowerConstantConditionsFolded)
+{
+    auto module = lowerInput("enum Mode { OFF, ON }; int main() { int a; a = 0; int i; i = 0; if (1) { a = 2; } else { a = 3; } "
+        "if (OFF) { a = a + 100; } while (0) { a = a + 1000; } if (ON) { a = a + 7; } if (2 > 1) { a = a + 1; } "
+        "while (1) { if (i == 5) { return a + i; } i = i + 1; } return 99; }");
+    ASSERT_NE(module, nullptr);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    // Only the taken arms are left, 'while (0)' is gone and 'while (1)' tests nothing.
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "store i32 2, i32* %a"));
+    ASSERT_FALSE(contains(output, "store i32 3, i32* %a"));
+    ASSERT_FALSE(contains(output, "100"));
+    ASSERT_FALSE(contains(output, "1000"));
+    ASSERT_TRUE(contains(output, "add nsw i32 %t_0, 7"));
+    ASSERT_TRUE(contains(output, "add nsw i32 %t_2, 1"));
+    ASSERT_FALSE(contains(output, "while.cond"));
+    ASSERT_FALSE(contains(output, "icmp ne"));
+
+    // The only conditional branch left is the 'i == 5' test, the loop is entered and
+    // continued unconditionally.
+    std::size_t condBrCount = 0;
+    ir::BasicBlock* body = nullptr;
+
+    for (const auto& block : *module->getFunction("main"))
+    {
+        condBrCount += block->getTerminator()->getOpcode() == ir::EnumOpcode::COND_BR ? 1 : 0;
+        body = block->getName() == "while.body" ? block.get() : body;
+    }
+
+    ASSERT_EQ(condBrCount, 1);
+    ASSERT_NE(body, nullptr);
+    ASSERT_EQ(body->getPredecessors().size(), 2);
+
+    for (const auto* pred : body->getPredecessors())
+    {
+        ASSERT_EQ(pred->getSuccessors().size(), 1);
+    }
+}
+
+TEST(IRTest, LowerVariableConditionKept)
+{
+    auto module = lowerInput("int main() { int a; a = 1; if (a) { a = 2; } while (a < 10) { a = a + 1; } return a; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "br i1 %t_1, label %if.then, label %if.end"));
+    ASSERT_TRUE(contains(output, "while.cond:"));
+}
+
+TEST(IRTest, LowerLogicalConditionBranches)
+{
+    auto module = lowerInput("int main() { int a; a = 3; int b; b = 0; int r; r = 0; if (a > 2 && (b == 0 || b > a)) { r = 1; } "
+        "while (a < 10 || b < 10) { a = a + 1; b = b + 2; } return r; }");
+    ASSERT_NE(module, nullptr);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    // Each comparison branches on its own, no boolean is merged and tested again.
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "phi"));
+    ASSERT_FALSE(contains(output, "zext"));
+    ASSERT_FALSE(contains(output, "icmp ne"));
+
+    std::size_t condBrCount = 0;
+
+    for (const auto& block : *module->getFunction("main"))
+    {
+        condBrCount += block->getTerminator()->getOpcode() == ir::EnumOpcode::COND_BR ? 1 : 0;
+    }
+
+    ASSERT_EQ(condBrCount, 5);
+    ASSERT_TRUE(contains(output, "land.rhs:"));
+    ASSERT_TRUE(contains(output, "lor.rhs:"));
+}
+
+TEST(IRTest, LowerLogicalValueShortCircuits)
+{
+    auto module = lowerInput("int calls; int bump() { calls = calls + 1; return 1; } "
+        "int main() { int a; a = 3; int z; z = a > 1 || bump(); int y; y = a < 1 && bump(); return z + y; }");
+    ASSERT_NE(module, nullptr);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    // The calls are only reached through the block evaluating the right operand.
+    for (const auto& block : *module->getFunction("main"))
+    {
+        for (const auto& instruction : *block)
+        {
+            if (instruction->getOpcode() == ir::EnumOpcode::CALL)
+            {
+                ASSERT_TRUE(block->getName() == "lor.rhs" || block->getName() == "land.rhs");
+            }
+        }
+    }
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "phi i1 [ true, %entry ]"));
+    ASSERT_TRUE(contains(output, "phi i1 [ false, %lor.end ]"));
+
+    // Once 'a' is known, neither call is needed.
+    opt::PassManager passManager;
+    std::string errorMessage;
+    ASSERT_TRUE(passManager.addPipeline("mem2reg,constprop,dce", &errorMessage));
+    passManager.run(*module);
+    ASSERT_FALSE(contains(ir::toString(*module->getFunction("main")), "call"));
+}
+
+// Counts the terminators of the function matching the opcode.
+static std::size_t countTerminators(ir::Function& function, const ir::EnumOpcode opcode)
+{
+    std::size_t count = 0;
+
+    for (const auto& block : function)
+    {
+        count += block->getTerminator()->getOpcode() == opcode ? 1 : 0;
+    }
+
+    return count;
+}
+
+TEST(IRTest, LowerSwitchDenseJumpTable)
+{
+    auto module = lowerInput("int f(int x) { int r; r = 0; switch (x) { case 0: r = 10; break; case 1: r = 11; "
+        "case 2: r = r + 12; break; case 3: r = 13; break; case 5: r = 15; break; default: r = 99; } return r; } "
+        "int main() { return f(2); }");
+    ASSERT_NE(module, nullptr);
+
+    auto* function = module->getFunction("f");
+    ASSERT_NE(function, nullptr);
+    ASSERT_EQ(countTerminators(*function, ir::EnumOpcode::SWITCH), 1);
+    ASSERT_EQ(countTerminators(*function, ir::EnumOpcode::COND_BR), 0);
+
+    // 'case 1' falls through into 'case 2'.
+    const auto output = ir::toString(*function);
+    ASSERT_TRUE(contains(output, "switch i32"));
+    ASSERT_TRUE(contains(output, "switch.default:"));
+    ASSERT_TRUE(contains(output, "switch.end:"));
+}
+
+TEST(IRTest, LowerSwitchSparseBinarySearch)
+{
+    auto module = lowerInput("int f(int x) { switch (x) { case 1: return 1; case 100: return 2; case 1000: return 3; "
+        "case 10000: return 4; case 100000: return 5; } return 0; } int main() { return f(1000); }");
+    ASSERT_NE(module, nullptr);
+
+    auto* function = module->getFunction("f");
+    ASSERT_NE(function, nullptr);
+    ASSERT_EQ(countTerminators(*function, ir::EnumOpcode::SWITCH), 0);
+
+    // A single range check on the middle case followed by equality tests at the leaves.
+    const auto output = ir::toString(*function);
+    ASSERT_TRUE(contains(output, "icmp slt i32"));
+    ASSERT_TRUE(contains(output, "icmp eq i32"));
+    ASSERT_EQ(countTerminators(*function, ir::EnumOpcode::COND_BR), 6);
+}
+
+TEST(IRTest, LowerSwitchMixedClusters)
+{
+    auto module = lowerInput("int f(int x) { switch (x) { case 0: return 1; case 1: return 2; case 2: return 3; "
+        "case 3: return 4; case 500: return 5; case 900: return 6; case 1000: return 7; case 1001: return 8; "
+        "case 1002: return 9; case 1003: return 10; } return 0; } int main() { return f(1001); }");
+    ASSERT_NE(module, nullptr);
+
+    auto* function = module->getFunction("f");
+    ASSERT_NE(function, nullptr);
+    ASSERT_EQ(countTerminators(*function, ir::EnumOpcode::SWITCH), 2);
+    ASSERT_TRUE(contains(ir::toString(*function), "icmp slt i32"));
+}
+
+TEST(IRTest, LowerSwitchConstantCondition)
+{
+    auto module = lowerInput("int main() { int r; r = 0; switch (2) { case 1: r = 1; break; case 2: r = 2; "
+        "case 3: r = r + 3; break; default: r = 9; } return r; }");
+    ASSERT_NE(module, nullptr);
+
+    auto* function = module->getFunction("main");
+    ASSERT_NE(function, nullptr);
+    ASSERT_EQ(countTerminators(*function, ir::EnumOpcode::SWITCH), 0);
+    ASSERT_EQ(countTerminators(*function, ir::EnumOpcode::COND_BR), 0);
+}
+
+TEST(IRTest, LowerUnsignedArithmetic)
+{
+    auto module = lowerInput("unsigned f(unsigned a, unsigned b) { unsigned q; q = a / b + a % b; "
+        "if (a < b) { q = q >> 2; } return q * 3; } "
+        "long g(unsigned a) { long l; l = a; double d; d = a; unsigned c; c = (unsigned) d; return l; } "
+        "int h(int a, char c) { c = c + c; return a * 3 + a / 2 - (a >> 1); } int main() { return h(1, 'a'); }");
+    ASSERT_NE(module, nullptr);
+
+    const auto f = ir::toString(*module->getFunction("f"));
+    ASSERT_TRUE(contains(f, "udiv i32"));
+    ASSERT_TRUE(contains(f, "urem i32"));
+    ASSERT_TRUE(contains(f, "lshr i32"));
+    ASSERT_TRUE(contains(f, "icmp ult i32"));
+
+    // Unsigned arithmetic wraps, so it is never flagged.
+    ASSERT_TRUE(contains(f, "mul i32"));
+    ASSERT_FALSE(contains(f, "nsw"));
+
+    const auto g = ir::toString(*module->getFunction("g"));
+    ASSERT_TRUE(contains(g, "zext i32"));
+    ASSERT_TRUE(contains(g, "uitofp i32"));
+    ASSERT_TRUE(contains(g, "fptoui double"));
+    ASSERT_FALSE(contains(g, "sext"));
+
+    // Signed int overflow is undefined, while a char is only truncated back (no flag).
+    const auto h = ir::toString(*module->getFunction("h"));
+    ASSERT_TRUE(contains(h, "add i8"));
+    ASSERT_TRUE(contains(h, "mul nsw i32"));
+    ASSERT_TRUE(contains(h, "add nsw i32"));
+    ASSERT_TRUE(contains(h, "sub nsw i32"));
+    ASSERT_TRUE(contains(h, "sdiv i32"));
+    ASSERT_TRUE(contains(h, "ashr i32"));
+}
+
+TEST(IRTest, LowerArrayIndex)
+{
+    auto module = lowerInput("int g[8]; int f(unsigned u) { int a[4]; int i; i = 0; "
+        "while (i < 4) { a[i] = g[i + 1]; i = i + 1; } a[2] = 5; return a[u] + a[2]; } int main() { return f(1); }");
+    ASSERT_NE(module, nullptr);
+
+    // Arrays big enough for a vector register are 16 byte aligned.
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "@g = global [8 x i32] zeroinitializer, align 16"));
+    ASSERT_TRUE(contains(output, "alloca [4 x i32], align 16"));
+
+    // Signed indices are sign extended while unsigned ones are zero extended, and constant ones stay constant.
+    const auto f = ir::toString(*module->getFunction("f"));
+    ASSERT_TRUE(contains(f, "add nsw i32"));
+    ASSERT_TRUE(contains(f, "sext i32"));
+    ASSERT_TRUE(contains(f, "zext i32"));
+    ASSERT_TRUE(contains(f, "getelementptr inbounds [8 x i32], [8 x i32]* @g, i64 0, i64 %"));
+    ASSERT_TRUE(contains(f, "getelementptr inbounds [4 x i32], [4 x i32]* %a, i64 0, i64 2"));
+}
+
+TEST(IRTest, LowerArrayDecaysToPointer)
+{
+    auto module = lowerInput("int sum(int p[], int n) { int s; s = 0; while (n > 0) { n = n - 1; s = s + p[n]; } return s; } "
+        "int main() { int a[2]; int* p; a[0] = 1; a[1] = 2; p = a; return sum(p, 2) + sum(a, 2); }");
+    ASSERT_NE(module, nullptr);
+
+    // A parameter declared as an array is a pointer.
+    const auto sum = ir::toString(*module->getFunction("sum"));
+    ASSERT_TRUE(contains(sum, "i32* "));
+    ASSERT_TRUE(contains(sum, "getelementptr inbounds i32, i32* "));
+
+    // Using the array as a value takes the address of its first element.
+    const auto output = ir::toString(*module->getFunction("main"));
+    ASSERT_TRUE(contains(output, "getelementptr inbounds [2 x i32], [2 x i32]* %a, i64 0, i64 0"));
+}
+
+TEST(IRTest, LowerSwitchUnsignedBinarySearch)
+{
+    auto module = lowerInput("int f(unsigned x) { switch (x) { case 1: return 1; case 100: return 2; case 1000: return 3; "
+        "case 10000: return 4; case -1: return 5; } return 0; } int main() { return f(1); }");
+    ASSERT_NE(module, nullptr);
+
+    // -1 is the largest unsigned value, so it is last in the search.
+    const auto output = ir::toString(*module->getFunction("f"));
+    ASSERT_TRUE(contains(output, "icmp ult i32"));
+    ASSERT_FALSE(contains(output, "icmp slt"));
+    ASSERT_TRUE(contains(output, "icmp eq i32 %t_0, -1"));
+}
+
+TEST(IRTest, LowerBreakExitsLoop)
+{
+    auto module = lowerInput("int main() { int i; i = 0; while (1) { i = i + 1; if (i > 5) { break; } } return i; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto output = ir::toString(*module->getFunction("main"));
+    ASSERT_TRUE(contains(output, "br label %while.end"));
+}
+
+TEST(IRTest, DominatorTreeDiamond)
+{
+    auto module = lowerInput("int main() { int a; a = 10; if (a + 1) { a = 20; } else { a = 30; } return a; }");
+    ASSERT_NE(module, nullptr);
+
+    auto* function = module->getFunction("main");
+    const ir::DominatorTree dominators(*function);
+    const auto& order = dominators.getReversePostOrder();
+    ASSERT_EQ(order.size(), 4);
+
+    auto* entry = function->getEntryBlock();
+    auto* end = entry->getSuccessors()[0]->getSuccessors()[0];
+    ASSERT_EQ(end->getName(), "if.end");
+
+    for (auto* arm : entry->getSuccessors())
+    {
+        ASSERT_EQ(dominators.getIDom(arm), entry);
+        ASSERT_TRUE(dominators.dominates(entry, arm));
+        ASSERT_FALSE(dominators.dominates(arm, end));
+        ASSERT_EQ(dominators.getFrontier(arm).size(), 1);
+        ASSERT_EQ(dominators.getFrontier(arm).front(), end);
+    }
+
+    ASSERT_EQ(dominators.getIDom(end), entry);
+    ASSERT_EQ(dominators.getChildren(entry).size(), 3);
+    ASSERT_TRUE(dominators.getFrontier(entry).empty());
+}
+
+TEST(IRTest, DataFlowBitVector)
+{
+    ir::BitVector bits(130);
+    ASSERT_EQ(bits.size(), 130);
+    ASSERT_FALSE(bits.any());
+    ASSERT_EQ(bits.findNext(0), ir::BitVector::npos);
+
+    bits.set(3);
+    bits.set(64);
+    bits.set(129);
+    ASSERT_TRUE(bits.test(64));
+    ASSERT_FALSE(bits.test(65));
+    ASSERT_EQ(bits.count(), 3);
+    ASSERT_EQ(bits.findNext(0), 3);
+    ASSERT_EQ(bits.findNext(4), 64);
+    ASSERT_EQ(bits.findNext(65), 129);
+
+    ir::BitVector other(130);
+    other.set(3);
+    other.set(100);
+    ASSERT_TRUE(bits.unionWith(other));
+    ASSERT_FALSE(bits.unionWith(other));
+    ASSERT_EQ(bits.count(), 4);
+
+    ASSERT_TRUE(bits.subtract(other));
+    ASSERT_EQ(bits.count(), 2);
+    ASSERT_TRUE(bits.intersectWith(other));
+    ASSERT_FALSE(bits.any());
+
+    // The bits past the end never show up.
+    const ir::BitVector full(130, true);
+    ASSERT_EQ(full.count(), 130);
+    bits.setAll();
+    ASSERT_EQ(bits, full);
+
+    bits.reset(129);
+    ASSERT_NE(bits, full);
+    ASSERT_TRUE(bits.assignTransfer(other, full, full));
+    ASSERT_EQ(bits, other);
+}
+
+TEST(IRTest, DataFlowSolverLiveSlots)
+{
+    auto module = lowerInput("int main() { int a; a = 1; int s; s = 0; while (a < 10) { s = s + a; a = a + 1; } return s; }");
+    ASSERT_NE(module, nullptr);
+
+    auto* function = module->getFunction("main");
+    std::vector<const ir::Instruction*> slots;
+
+    for (const auto& instruction : *function->getEntryBlock())
+    {
+        if (instruction->getOpcode() == ir::EnumOpcode::ALLOCA)
+        {
+            slots.push_back(instruction.get());
+        }
+    }
+
+    ASSERT_EQ(slots.size(), 2);
+
+    // A slot is live where it may still be loaded before being stored to again.
+    ir::DataFlowSolver solver(*function, slots.size(), ir::EnumDataFlowDirection::BACKWARD, ir::EnumDataFlowMeet::UNION);
+    ir::BasicBlock* cond = nullptr;
+    ir::BasicBlock* end = nullptr;
+
+    for (const auto& block : *function)
+    {
+        auto& gen = solver.getGen(block.get());
+        auto& kill = solver.getKill(block.get());
+
+        for (const auto& instruction : *block)
+        {
+            const bool isLoad = instruction->getOpcode() == ir::EnumOpcode::LOAD;
+
+            if (!isLoad && instruction->getOpcode() != ir::EnumOpcode::STORE)
+            {
+                continue;
+            }
+
+            const auto* pointer = instruction->getOperand(isLoad ? 0 : 1);
+            const auto index = static_cast<std::size_t>(std::find(slots.cbegin(), slots.cend(), pointer) - slots.cbegin());
+
+            if (isLoad && !kill.test(index))
+            {
+                gen.set(index);
+            }
+
+            else if (!isLoad)
+            {
+                kill.set(index);
+            }
+        }
+
+        cond = block->getName() == "while.cond" ? block.get() : cond;
+        end = block->getName() == "while.end" ? block.get() : end;
+    }
+
+    ASSERT_NE(cond, nullptr);
+    ASSERT_NE(end, nullptr);
+    ASSERT_GT(solver.solve(), function->size());
+
+    // Both 'a' and 's' are live around the loop, only 's' after it.
+    ASSERT_FALSE(solver.getIn(function->getEntryBlock()).any());
+    ASSERT_TRUE(solver.getIn(cond).test(0));
+    ASSERT_TRUE(solver.getIn(cond).test(1));
+    ASSERT_FALSE(solver.getIn(end).test(0));
+    ASSERT_TRUE(solver.getIn(end).test(1));
+}
+
+TEST(IRTest, DataFlowSolverAvailableFacts)
+{
+    ir::Module module;
+    auto& types = module.getTypes();
+    auto* function = module.getOrInsertFunction("f", types.getFunction(types.getVoid(), { types.getBool() }));
+    auto* cond = function->getArg(0);
+
+    ir::IRBuilder builder(module);
+    auto* entry = function->createBlock("entry");
+    auto* left = function->createBlock("left");
+    auto* right = function->createBlock("right");
+    auto* join = function->createBlock("join");
+    auto* loop = function->createBlock("loop");
+    auto* exit = function->createBlock("exit");
+    auto* dead = function->createBlock("dead");
+
+    builder.setInsertPoint(entry);
+    builder.createCondBr(cond, left, right);
+    builder.setInsertPoint(left);
+    builder.createBr(join);
+    builder.setInsertPoint(right);
+    builder.createBr(join);
+    builder.setInsertPoint(join);
+    builder.createBr(loop);
+    builder.setInsertPoint(loop);
+    builder.createCondBr(cond, loop, exit);
+    builder.setInsertPoint(exit);
+    builder.createRetVoid();
+    builder.setInsertPoint(dead);
+    builder.createBr(exit);
+
+    // Fact 0 comes from the entry, 1 from one arm only, 2 from both arms, 3 is killed by the loop.
+    ir::DataFlowSolver solver(*function, 4, ir::EnumDataFlowDirection::FORWARD, ir::EnumDataFlowMeet::INTERSECTION);
+    solver.getGen(entry).set(0);
+    solver.getGen(entry).set(3);
+    solver.getGen(left).set(1);
+    solver.getGen(left).set(2);
+    solver.getGen(right).set(2);
+    solver.getKill(loop).set(3);
+    solver.solve();
+
+    const auto& atJoin = solver.getIn(join);
+    ASSERT_TRUE(atJoin.test(0));
+    ASSERT_FALSE(atJoin.test(1));
+    ASSERT_TRUE(atJoin.test(2));
+    ASSERT_TRUE(atJoin.test(3));
+
+    // The unreachable block doesn't hold anything back at the exit.
+    ASSERT_EQ(solver.getIn(dead).count(), 4);
+    ASSERT_FALSE(solver.getIn(loop).test(3));
+    ASSERT_TRUE(solver.getIn(exit).test(2));
+    ASSERT_FALSE(solver.getIn(exit).test(3));
+}
+
+TEST(IRTest, Mem2RegIfElse)
+{
+    auto module = lowerInput("int main() { int a; a = 10; if (a + 1) { a = 20; } else { a = 30; } return a; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    ASSERT_TRUE(mem2reg.run(*module));
+    ASSERT_EQ(mem2reg.getPromotedCount(), 1);
+    ASSERT_EQ(mem2reg.getPhiCount(), 1);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "alloca"));
+    ASSERT_FALSE(contains(output, "load"));
+    ASSERT_FALSE(contains(output, "store"));
+    ASSERT_TRUE(contains(output, "%a = phi i32 [ 20, %if.then ], [ 30, %if.else ]"));
+}
+
+TEST(IRTest, Mem2RegWhile)
+{
+    auto module = lowerInput("int main() { int i; i = 0; int s; s = 0; while (i < 10) { s = s + i; i = i + 1; } return s; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    ASSERT_TRUE(mem2reg.run(*module));
+    ASSERT_EQ(mem2reg.getPromotedCount(), 2);
+    ASSERT_EQ(mem2reg.getPhiCount(), 2);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "alloca"));
+    ASSERT_TRUE(contains(output, "%i = phi i32 [ 0, %entry ], [ %t_2, %while.body ]"));
+}
+
+TEST(IRTest, Mem2RegParameters)
+{
+    auto module = lowerInput("int sum(int x, int y) { return x + y; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    ASSERT_TRUE(mem2reg.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "add nsw i32 %x, %y"));
+    ASSERT_FALSE(contains(output, "x.addr"));
+}
+
+TEST(IRTest, Mem2RegAddressTakenNotPromoted)
+{
+    auto module = lowerInput("int main() { int a; a = 42; int* ptr; ptr = &a; int result; result = *ptr; return result; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    ASSERT_TRUE(mem2reg.run(*module));
+    ASSERT_EQ(mem2reg.getPromotedCount(), 2);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "%a = alloca i32"));
+    ASSERT_FALSE(contains(output, "%ptr = alloca"));
+}
+
+TEST(IRTest, ConstantFoldIntWraps)
+{
+    ir::Module module;
+    auto& types = module.getTypes();
+    auto* i8 = types.getInt(8);
+
+    auto* result = ir::foldBinary(module, ir::EnumOpcode::ADD, module.getConstantInt(i8, 127), module.getConstantInt(i8, 1));
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(static_cast<ir::ConstantInt*>(result)->getValue(), -128);
+
+    result = ir::foldBinary(module, ir::EnumOpcode::LSHR, module.getConstantInt(i8, -1), module.getConstantInt(i8, 4));
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(static_cast<ir::ConstantInt*>(result)->getValue(), 15);
+
+    result = ir::foldBinary(module, ir::EnumOpcode::ASHR, module.getConstantInt(i8, -16), module.getConstantInt(i8, 2));
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(static_cast<ir::ConstantInt*>(result)->getValue(), -4);
+}
+
+TEST(IRTest, ConstantFoldUndefinedNotFolded)
+{
+    ir::Module module;
+    auto& types = module.getTypes();
+    auto* i32 = types.getInt(32);
+    auto* minValue = module.getConstantInt(i32, std::numeric_limits<s32>::min());
+
+    ASSERT_EQ(ir::foldBinary(module, ir::EnumOpcode::SDIV, module.getConstantInt(i32, 1), module.getConstantInt(i32, 0)), nullptr);
+    ASSERT_EQ(ir::foldBinary(module, ir::EnumOpcode::SREM, minValue, module.getConstantInt(i32, -1)), nullptr);
+    ASSERT_EQ(ir::foldBinary(module, ir::EnumOpcode::SHL, module.getConstantInt(i32, 1), module.getConstantInt(i32, 32)), nullptr);
+    ASSERT_EQ(ir::foldCast(module, ir::EnumOpcode::FP_TO_SI, module.getConstantFP(types.getDouble(), 3.0e10), i32), nullptr);
+    ASSERT_EQ(ir::foldCast(module, ir::EnumOpcode::FP_TO_SI, module.getConstantFP(types.getDouble(), std::nan("")), i32), nullptr);
+}
+
+TEST(IRTest, ConstantFoldFloatingPoint)
+{
+    ir::Module module;
+    auto& types = module.getTypes();
+    auto* f32Type = types.getFloat();
+
+    // 16777216 + 1 is not representable as a float.
+    auto* result = ir::foldBinary(module, ir::EnumOpcode::FADD, module.getConstantFP(f32Type, 16777216.0), module.getConstantFP(f32Type, 1.0));
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(static_cast<ir::ConstantFP*>(result)->getValue(), 16777216.0);
+
+    auto* nan = module.getConstantFP(types.getDouble(), std::nan(""));
+    ASSERT_EQ(ir::foldCompare(module, ir::EnumCmpPredicate::OEQ, nan, nan), module.getFalse());
+    ASSERT_EQ(ir::foldCompare(module, ir::EnumCmpPredicate::UNE, nan, nan), module.getTrue());
+
+    result = ir::foldCast(module, ir::EnumOpcode::FP_TO_SI, module.getConstantFP(f32Type, -2.75), types.getInt(32));
+    ASSERT_NE(result, nullptr);
+    ASSERT_EQ(static_cast<ir::ConstantInt*>(result)->getValue(), -2);
+}
+
+TEST(IRTest, ConstantPropagationStraightLine)
+{
+    auto module = lowerInput("enum A { X, Y }; int main() { int a; a = 10; int b; b = 32 * (int) Y; int c; c = a + b - 10; return (c << 1) / 2; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::ConstantPropagation constantPropagation;
+    ASSERT_TRUE(constantPropagation.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    auto* entry = module->getFunction("main")->getEntryBlock();
+    ASSERT_EQ(entry->size(), 1);
+    ASSERT_TRUE(contains(ir::toString(*module), "ret i32 32"));
+}
+
+TEST(IRTest, ConstantPropagationThroughBranches)
+{
+    auto module = lowerInput("int main() { int a; a = 1; int r; if (a == 1) { r = 5; } else { r = 7; } return r + a; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::ConstantPropagation constantPropagation;
+    ASSERT_TRUE(constantPropagation.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "br i1 true"));
+    ASSERT_TRUE(contains(output, "ret i32 6"));
+    ASSERT_FALSE(contains(output, "phi"));
+}
+
+TEST(IRTest, ConstantPropagationLoopNotFolded)
+{
+    auto module = lowerInput("int main() { int i; i = 0; while (i < 10) { i = i + 1; } return i; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::ConstantPropagation constantPropagation;
+    ASSERT_FALSE(constantPropagation.run(*module));
+    ASSERT_TRUE(contains(ir::toString(*module), "phi i32"));
+}
+
+TEST(IRTest, ConstantPropagationKeepsDivisionByZero)
+{
+    auto module = lowerInput("int main() { int z; z = 0; return 5 / z; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::ConstantPropagation constantPropagation;
+    constantPropagation.run(*module);
+    ASSERT_TRUE(contains(ir::toString(*module), "sdiv i32 5, 0"));
+}
+
+TEST(IRTest, DeadCodeEliminationConstantBranch)
+{
+    auto module = lowerInput("int main() { int a; a = 1; int r; if (a == 1) { r = 5; } else { r = 7; } return r + a; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::ConstantPropagation constantPropagation;
+    constantPropagation.run(*module);
+
+    opt::DeadCodeElimination deadCodeElimination;
+    ASSERT_TRUE(deadCodeElimination.run(*module));
+    ASSERT_EQ(deadCodeElimination.getRemovedBlockCount(), 3);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    auto* function = module->getFunction("main");
+    ASSERT_EQ(function->size(), 1);
+    ASSERT_EQ(function->getInstructionCount(), 1);
+    ASSERT_TRUE(contains(ir::toString(*module), "ret i32 6"));
+}
+
+TEST(IRTest, DeadCodeEliminationOverwrittenStore)
+{
+    auto module = lowerInput("int main() { int x; x = 5; x = 6; return x; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::DeadCodeElimination deadCodeElimination;
+    ASSERT_TRUE(deadCodeElimination.run(*module));
+    ASSERT_EQ(deadCodeElimination.getRemovedStoreCount(), 1);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "store i32 5"));
+    ASSERT_TRUE(contains(output, "store i32 6"));
+}
+
+TEST(IRTest, DeadCodeEliminationUnreadLocals)
+{
+    auto module = lowerInput("struct P { int x; int y; }; int main() { int unused; unused = 3; struct P p; p.x = 1; p.y = 2; int a; a = 3; a * 7; return 0; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::DeadCodeElimination deadCodeElimination;
+    ASSERT_TRUE(deadCodeElimination.run(*module));
+    ASSERT_EQ(deadCodeElimination.getRemovedStoreCount(), 4);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    // Everything but the return is dead.
+    ASSERT_EQ(module->getFunction("main")->getInstructionCount(), 1);
+}
+
+TEST(IRTest, DeadCodeEliminationKeepsSideEffects)
+{
+    auto module = lowerInput("int puts(char* str); void f(int* p); int main() { int r; r = puts(\"hi\"); int x; x = 1; f(&x); return 0; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::DeadCodeElimination deadCodeElimination;
+    deadCodeElimination.run(*module);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "call i32 @puts"));
+    ASSERT_TRUE(contains(output, "store i32 1, i32* %x"));
+    ASSERT_TRUE(contains(output, "call void @f(i32* %x)"));
+}
+
+TEST(IRTest, DeadCodeEliminationLoopKept)
+{
+    auto module = lowerInput("int main() { int i; i = 0; int s; s = 0; while (i < 10) { s = s + i; i = i + 1; } return s; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::DeadCodeElimination deadCodeElimination;
+    ASSERT_FALSE(deadCodeElimination.run(*module));
+    ASSERT_EQ(module->getFunction("main")->size(), 4);
+}
+
+TEST(IRTest, GlobalValueNumberingArithmetic)
+{
+    auto module = lowerInput("int f(int a, int b) { int x; x = a * b + 1; int y; y = b * a + 1; return x - y; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::GlobalValueNumbering globalValueNumbering;
+    ASSERT_TRUE(globalValueNumbering.run(*module));
+    ASSERT_EQ(globalValueNumbering.getEliminatedCount(), 2);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_EQ(output.find("mul"), output.rfind("mul"));
+}
+
+TEST(IRTest, GlobalValueNumberingFieldAccess)
+{
+    auto module = lowerInput("struct Vec2 { int x; int y; }; struct Vec3 { struct Vec2 v2; int z; }; "
+                             "int main() { struct Vec3 v3; v3.v2.x = 10; v3.z = 20; int result; result = v3.v2.x + v3.z + v3.v2.x; return result; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::GlobalValueNumbering globalValueNumbering;
+    ASSERT_TRUE(globalValueNumbering.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    // Storing to v3.z doesn't clobber v3.v2.x, so every load is forwarded from its store.
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "load"));
+    ASSERT_EQ(globalValueNumbering.getEliminatedLoadCount(), 3);
+}
+
+TEST(IRTest, GlobalValueNumberingRespectsClobbers)
+{
+    auto module = lowerInput("void g(int* p); int f(int* p, int* q) { int a; a = *p; *q = 1; int b; b = *p; g(p); int c; c = *p; return a + b + c; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::GlobalValueNumbering globalValueNumbering;
+    globalValueNumbering.run(*module);
+    ASSERT_EQ(globalValueNumbering.getEliminatedLoadCount(), 0);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+}
+
+TEST(IRTest, GlobalValueNumberingDominatingScopes)
+{
+    auto module = lowerInput("int f(int a, int b) { int x; x = a + b; if (a) { x = x + (a + b); } else { x = b + a; } return x + (a + b); }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::GlobalValueNumbering globalValueNumbering;
+    ASSERT_TRUE(globalValueNumbering.run(*module));
+    ASSERT_EQ(globalValueNumbering.getEliminatedCount(), 3);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+}
+
+TEST(IRTest, AliasAnalysisMayAlias)
+{
+    auto module = lowerInput("int g; int main() { int a; int b; int* p; p = &a; *p = 1; b = 2; g = 3; return a + b + g; }");
+    ASSERT_NE(module, nullptr);
+
+    const auto* entry = module->getFunction("main")->getEntryBlock();
+    std::vector<const ir::Instruction*> allocas;
+
+    for (const auto& instruction : *entry)
+    {
+        if (instruction->getOpcode() == ir::EnumOpcode::ALLOCA)
+        {
+            allocas.push_back(instruction.get());
+        }
+    }
+
+    ASSERT_GE(allocas.size(), 3);
+    ASSERT_TRUE(ir::mayAlias(allocas[0], allocas[0]));
+    ASSERT_FALSE(ir::mayAlias(allocas[0], allocas[1]));
+    ASSERT_FALSE(ir::mayAlias(allocas[0], module->getGlobal("g")));
+}
+
+TEST(IRTest, AliasAnalysisAddressTakenAndTypes)
+{
+    auto module = lowerInput("int g; void keep(int* p); "
+        "int f(int* p, double* q) { *p = 1; *q = 2.5; int a; int b; keep(&a); b = 2; g = 3; return *p + a + b; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    const auto* function = module->getFunction("f");
+    const ir::AliasAnalysis aliasAnalysis(*function);
+    const auto* p = function->getArg(0);
+    const auto* q = function->getArg(1);
+    const auto* g = module->getGlobal("g");
+    const ir::Instruction* a = nullptr;
+    const ir::Instruction* call = nullptr;
+
+    for (const auto& block : *function)
+    {
+        for (const auto& instruction : *block)
+        {
+            if (instruction->getOpcode() == ir::EnumOpcode::ALLOCA)
+            {
+                a = instruction.get();
+            }
+
+            else if (instruction->getOpcode() == ir::EnumOpcode::CALL)
+            {
+                call = instruction.get();
+            }
+        }
+    }
+
+    // Only 'a' is left in memory after mem2reg, since its address is passed on.
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(call, nullptr);
+    ASSERT_TRUE(aliasAnalysis.isAddressTaken(a));
+    ASSERT_EQ(aliasAnalysis.getAddressTaken().size(), 1);
+
+    ASSERT_EQ(aliasAnalysis.alias(p, p), ir::EnumAliasResult::MUST_ALIAS);
+    ASSERT_EQ(aliasAnalysis.alias(p, q), ir::EnumAliasResult::NO_ALIAS);
+    ASSERT_EQ(aliasAnalysis.alias(p, g), ir::EnumAliasResult::MAY_ALIAS);
+    ASSERT_EQ(aliasAnalysis.alias(p, a), ir::EnumAliasResult::MAY_ALIAS);
+    ASSERT_FALSE(aliasAnalysis.mayAlias(g, a));
+    ASSERT_TRUE(aliasAnalysis.mayAccess(*call, g));
+    ASSERT_TRUE(aliasAnalysis.mayAccess(*call, a));
+}
+
+TEST(IRTest, ArgumentAttributesNoCaptureNoAlias)
+{
+    auto module = lowerInput("int g; int* saved; int get(int* p) { return *p; } int both(int* p, int* q) { *q = 1; return *p; } "
+        "int keep(int* p) { saved = p; return 0; } int pass(int* p) { return get(p); } "
+        "int main() { int a; a = 42; int b; b = pass(&a); return b; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::ArgumentAttributes argumentAttributes;
+    ASSERT_TRUE(argumentAttributes.run(*module));
+
+    const auto hasAttribute = [&module](const char* name, const std::size_t index, const ir::EnumArgumentAttribute attribute)
+    {
+        return module->getFunction(name)->getArg(index)->hasAttribute(attribute);
+    };
+
+    // 'pass' only hands its pointer to a nocapture argument, found on a second sweep.
+    ASSERT_TRUE(hasAttribute("get", 0, ir::EnumArgumentAttribute::NO_CAPTURE));
+    ASSERT_TRUE(hasAttribute("get", 0, ir::EnumArgumentAttribute::NO_ALIAS));
+    ASSERT_TRUE(hasAttribute("pass", 0, ir::EnumArgumentAttribute::NO_CAPTURE));
+    ASSERT_FALSE(hasAttribute("pass", 0, ir::EnumArgumentAttribute::NO_ALIAS));
+    ASSERT_TRUE(hasAttribute("both", 0, ir::EnumArgumentAttribute::NO_CAPTURE));
+    ASSERT_FALSE(hasAttribute("both", 0, ir::EnumArgumentAttribute::NO_ALIAS));
+    ASSERT_FALSE(hasAttribute("both", 1, ir::EnumArgumentAttribute::NO_ALIAS));
+    ASSERT_FALSE(hasAttribute("keep", 0, ir::EnumArgumentAttribute::NO_CAPTURE));
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "define i32 @get(i32* noalias nocapture %p)"));
+    ASSERT_TRUE(contains(output, "define i32 @keep(i32* %p)"));
+}
+
+TEST(IRTest, AliasAnalysisFeedsValueNumberingAndDeadStores)
+{
+    auto module = lowerInput("void use(int* p); int twice(int* a, double* b) { int x; x = *a; *b = 1.5; int y; y = *a; return x + y; } "
+        "int local() { int v; v = 1; use(&v); v = 5; return 0; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    // Storing a double can't change an int.
+    opt::GlobalValueNumbering globalValueNumbering;
+    ASSERT_TRUE(globalValueNumbering.run(*module));
+    ASSERT_EQ(globalValueNumbering.getEliminatedLoadCount(), 1);
+
+    // The last store to 'v' is dead once the function returns.
+    opt::DeadCodeElimination deadCodeElimination;
+    ASSERT_TRUE(deadCodeElimination.run(*module));
+    ASSERT_EQ(deadCodeElimination.getRemovedStoreCount(), 1);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "store i32 1, i32* %v"));
+    ASSERT_FALSE(contains(output, "store i32 5, i32* %v"));
+}
+
+TEST(IRTest, CallGraphBottomUpAndRecursion)
+{
+    auto module = lowerInput("int leaf(int x) { return x; } "
+                             "int even(int n); int odd(int n) { if (n) { int m; m = n - 1; return even(m); } return 0; } "
+                             "int even(int n) { if (n) { int m; m = n - 1; return odd(m); } return 1; } "
+                             "int main() { int a; a = leaf(3); int b; b = odd(a); return b; }");
+    ASSERT_NE(module, nullptr);
+
+    ir::CallGraph callGraph(*module);
+    const auto* leaf = module->getFunction("leaf");
+    const auto* odd = module->getFunction("odd");
+    const auto* even = module->getFunction("even");
+    const auto* main = module->getFunction("main");
+
+    ASSERT_FALSE(callGraph.isRecursive(leaf));
+    ASSERT_FALSE(callGraph.isRecursive(main));
+    ASSERT_TRUE(callGraph.isRecursive(odd));
+    ASSERT_TRUE(callGraph.isRecursive(even));
+    ASSERT_TRUE(callGraph.isSameComponent(odd, even));
+    ASSERT_FALSE(callGraph.isSameComponent(main, odd));
+    ASSERT_EQ(callGraph.getCalls(main).size(), 2);
+    ASSERT_EQ(callGraph.getCallSites(odd).size(), 2);
+
+    const auto& order = callGraph.getBottomUpOrder();
+    ASSERT_EQ(order.size(), 4);
+    ASSERT_EQ(order.back(), main);
+}
+
+TEST(IRTest, InlinerSmallFunctionFolds)
+{
+    auto module = lowerInput("int sum(int x, int y) { return x + y; } int main() { int a; a = 10; int b; b = 32; int c; c = sum(a, b); return c; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::Inliner inliner;
+    ASSERT_TRUE(inliner.run(*module));
+    ASSERT_EQ(inliner.getInlinedCount(), 1);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    opt::ConstantPropagation constantPropagation;
+    constantPropagation.run(*module);
+
+    opt::DeadCodeElimination deadCodeElimination;
+    deadCodeElimination.run(*module);
+    ASSERT_TRUE(verifier.verify(*module));
+
+    // The call is gone and what is left of main folds down to the result.
+    auto* main = module->getFunction("main");
+    ASSERT_EQ(main->size(), 1);
+    ASSERT_EQ(main->getInstructionCount(), 1);
+    ASSERT_TRUE(contains(ir::toString(*module), "ret i32 42"));
+}
+
+TEST(IRTest, InlinerMultipleReturnsMerge)
+{
+    auto module = lowerInput("int sel(int c, int a, int b) { if (c) { return a; } return b; } "
+                             "int main() { int x; x = 1; int r; r = sel(x, 7, 9); return r; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::Inliner inliner;
+    ASSERT_TRUE(inliner.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "call i32 @sel"));
+    ASSERT_TRUE(contains(output, "sel.exit:"));
+    ASSERT_TRUE(contains(output, "phi i32"));
+
+    opt::ConstantPropagation constantPropagation;
+    constantPropagation.run(*module);
+
+    opt::DeadCodeElimination deadCodeElimination;
+    deadCodeElimination.run(*module);
+    ASSERT_TRUE(verifier.verify(*module));
+    ASSERT_TRUE(contains(ir::toString(*module), "ret i32 7"));
+}
+
+TEST(IRTest, InlinerSkipsRecursionAndLargeFunctions)
+{
+    auto module = lowerInput("int fact(int n) { if (n) { int m; m = n - 1; return n * fact(m); } return 1; } "
+                             "int big(int x) { x = x + 1; x = x * 2; x = x - 3; return x; } "
+                             "int main() { int a; a = fact(5); int b; b = big(a); int c; c = big(b); return c; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::Inliner inliner(2);
+    ASSERT_FALSE(inliner.run(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "call i32 @fact"));
+    ASSERT_TRUE(contains(output, "call i32 @big"));
+}
+
+TEST(IRTest, InlinerMovesAllocasToEntry)
+{
+    auto module = lowerInput("struct P { int x; int y; }; int len(int a) { struct P p; p.x = a; p.y = 2; return p.x + p.y; } "
+                             "int main() { int i; i = 0; int s; s = 0; while (i < 3) { s = len(i); i = i + 1; } return s; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::Inliner inliner;
+    ASSERT_TRUE(inliner.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto* entry = module->getFunction("main")->getEntryBlock();
+    ASSERT_EQ(entry->front()->getOpcode(), ir::EnumOpcode::ALLOCA);
+    ASSERT_EQ(entry->front()->getName(), "p");
+}
+
+TEST(IRTest, LoopInfoNestedLoops)
+{
+    auto module = lowerInput("int main() { int i; i = 0; int s; s = 0; while (i < 10) { int j; j = 0; while (j < i) { s = s + j; j = j + 1; } i = i + 1; } return s; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    const auto* main = module->getFunction("main");
+    ir::DominatorTree dominators(*main);
+    ir::LoopInfo loopInfo(dominators);
+
+    ASSERT_EQ(loopInfo.size(), 2);
+    ASSERT_EQ(loopInfo.getTopLevelLoops().size(), 1);
+
+    auto* outer = loopInfo.getTopLevelLoops().front();
+    ASSERT_EQ(outer->getSubLoops().size(), 1);
+
+    auto* inner = outer->getSubLoops().front();
+    ASSERT_EQ(inner->getParentLoop(), outer);
+    ASSERT_EQ(outer->getDepth(), 1);
+    ASSERT_EQ(inner->getDepth(), 2);
+    ASSERT_TRUE(outer->contains(inner));
+    ASSERT_TRUE(outer->contains(inner->getHeader()));
+    ASSERT_FALSE(inner->contains(outer->getHeader()));
+    ASSERT_EQ(loopInfo.getLoopFor(inner->getHeader()), inner);
+    ASSERT_EQ(loopInfo.getLoopsInnermostFirst().front(), inner);
+
+    ASSERT_EQ(outer->getPreheader(), main->getEntryBlock());
+    ASSERT_NE(outer->getLatch(), nullptr);
+    ASSERT_NE(inner->getPreheader(), nullptr);
+    ASSERT_EQ(inner->getExitBlocks().size(), 1);
+    ASSERT_TRUE(outer->contains(inner->getExitBlocks().front()));
+}
+
+TEST(IRTest, LoopInvariantCodeMotionArithmetic)
+{
+    auto module = lowerInput("int f(int a, int b, int n) { int i; i = 0; int s; s = 0; while (i < n) { s = s + a * b; i = i + 1; } return s; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::LoopInvariantCodeMotion loopInvariantCodeMotion;
+    ASSERT_TRUE(loopInvariantCodeMotion.run(*module));
+    ASSERT_EQ(loopInvariantCodeMotion.getHoistedCount(), 1);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto* entry = module->getFunction("f")->getEntryBlock();
+    bool found = false;
+
+    for (const auto& instruction : *entry)
+    {
+        found |= instruction->getOpcode() == ir::EnumOpcode::MUL;
+    }
+
+    ASSERT_TRUE(found);
+}
+
+TEST(IRTest, LoopInvariantCodeMotionLoads)
+{
+    auto module = lowerInput("struct P { int x; int y; }; "
+                             "int f(int n) { struct P p; p.x = 3; p.y = 0; int i; i = 0; while (i < n) { p.y = p.y + p.x; i = i + 1; } return p.y; } "
+                             "int g(int* q, int* r) { int i; i = 0; int s; s = 0; while (i < *q) { s = s + *r; i = i + 1; } return s; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::LoopInvariantCodeMotion loopInvariantCodeMotion;
+    ASSERT_TRUE(loopInvariantCodeMotion.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    // p.x isn't written in the loop, but p.y is.  In g, *q is read whenever the loop is
+    // entered, but *r is only read if it runs (and r could be null).
+    const auto countLoopLoads = [](const ir::Function* function)
+    {
+        ir::DominatorTree dominators(*function);
+        ir::LoopInfo loopInfo(dominators);
+        std::size_t count = 0;
+
+        for (const auto* block : loopInfo.getTopLevelLoops().front()->getBlocks())
+        {
+            for (const auto& instruction : *block)
+            {
+                count += instruction->getOpcode() == ir::EnumOpcode::LOAD;
+            }
+        }
+
+        return count;
+    };
+
+    ASSERT_EQ(countLoopLoads(module->getFunction("f")), 1);
+    ASSERT_EQ(countLoopLoads(module->getFunction("g")), 1);
+}
+
+TEST(IRTest, LoopInvariantCodeMotionCreatesPreheader)
+{
+    auto module = lowerInput("int f(int a, int n) { int i; if (a) { i = 1; } else { i = 2; } while (i < n) { i = i + a * 3; } return i; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::DeadCodeElimination deadCodeElimination;
+    deadCodeElimination.run(*module);
+
+    opt::LoopInvariantCodeMotion loopInvariantCodeMotion;
+    ASSERT_TRUE(loopInvariantCodeMotion.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto* function = module->getFunction("f");
+    ir::DominatorTree dominators(*function);
+    ir::LoopInfo loopInfo(dominators);
+    ASSERT_NE(loopInfo.getTopLevelLoops().front()->getPreheader(), nullptr);
+}
+
+TEST(IRTest, LoopStrengthReductionMultiply)
+{
+    auto module = lowerInput("int f(int n) { int i; i = 0; int s; s = 0; while (i < n) { s = s + i * 12; i = i + 1; } return s; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::LoopStrengthReduction loopStrengthReduction;
+    ASSERT_TRUE(loopStrengthReduction.run(*module));
+    ASSERT_EQ(loopStrengthReduction.getReducedCount(), 1);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "mul"));
+    ASSERT_TRUE(contains(output, "phi i32 [ 0, %entry ]"));
+    ASSERT_TRUE(contains(output, ", 12"));
+}
+
+TEST(IRTest, LoopVectorizeReduction)
+{
+    auto module = lowerInput("int sum(int* p, int n) { int s; s = 0; int i; i = 0; while (i < n) { s = s + p[i]; i = i + 1; } return s; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::LoopVectorize loopVectorize;
+    ASSERT_TRUE(loopVectorize.run(*module));
+    ASSERT_EQ(loopVectorize.getVectorizedCount(), 1);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    // Nothing is stored, so no run time check is needed.  The scalar loop resumes with the
+    // vector loop's index and the lanes summed up.
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "ptrtoint"));
+    ASSERT_TRUE(contains(output, "load <4 x i32>, <4 x i32>* %t_"));
+    ASSERT_TRUE(contains(output, ", align 4"));
+    ASSERT_TRUE(contains(output, "add <4 x i32> %s.vector"));
+    ASSERT_TRUE(contains(output, "add nsw i32 %i.vector, 4"));
+    ASSERT_TRUE(contains(output, "extractelement <4 x i32> %s.vector, i32 3"));
+    ASSERT_TRUE(contains(output, "[ %i.vector, %vector.end ]"));
+}
+
+TEST(IRTest, LoopVectorizeRuntimeChecks)
+{
+    auto module = lowerInput("void saxpy(float a, float x[], float y[], int n) { int i; i = 0; while (i < n) { y[i] = a * x[i] + y[i]; i = i + 1; } }");
+    ASSERT_NE(module, nullptr);
+
+    // x and y may overlap: the vector loop only runs when they don't.
+    opt::PassManager passManager;
+    passManager.setVectorWidth(256);
+    ASSERT_TRUE(passManager.addPipeline("mem2reg,vectorize", nullptr));
+    ASSERT_TRUE(passManager.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "icmp ule i64"));
+    ASSERT_TRUE(contains(output, "label %vector.ph, label %while.cond"));
+    ASSERT_TRUE(contains(output, "insertelement <8 x float> undef, float %a, i32 0"));
+    ASSERT_TRUE(contains(output, "fmul <8 x float>"));
+    ASSERT_TRUE(contains(output, "store <8 x float> %t_"));
+    ASSERT_TRUE(contains(output, "sub nsw i64 %t_0, 7"));
+}
+
+TEST(IRTest, LoopVectorizeSkipsUnsupportedLoops)
+{
+    // The index used as a value, a floating point reduction and a call.
+    auto module = lowerInput("int g(int x); void iota(int* p, int n) { int i; i = 0; while (i < n) { p[i] = i; i = i + 1; } } "
+                             "float fsum(float* p, int n) { float s; s = 1.0F; int i; i = 0; while (i < n) { s = s + p[i]; i = i + 1; } return s; } "
+                             "void apply(int* p, int n) { int i; i = 0; while (i < n) { int v; v = p[i]; p[i] = g(v); i = i + 1; } }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::LoopVectorize loopVectorize;
+    ASSERT_FALSE(loopVectorize.run(*module));
+    ASSERT_EQ(loopVectorize.getVectorizedCount(), 0);
+
+    // A width of 0 turns the pass off.
+    auto other = lowerInput("void fill(int* p, int n) { int i; i = 0; while (i < n) { p[i] = 7; i = i + 1; } }");
+    ASSERT_NE(other, nullptr);
+    mem2reg.run(*other);
+
+    opt::LoopVectorize disabled(0);
+    ASSERT_FALSE(disabled.run(*other));
+    ASSERT_FALSE(contains(ir::toString(*other), "x i32>"));
+}
+
+TEST(IRTest, PeepholeIdentities)
+{
+    auto module = lowerInput("int f(int x) { int n; n = -x; int y; y = -n; return (y + 0) * 1 + x * 0; } float g(float x) { float n; n = -x; return -n * 1.0F; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::Peephole peephole;
+    ASSERT_TRUE(peephole.run(*module));
+
+    opt::DeadCodeElimination deadCodeElimination;
+    deadCodeElimination.run(*module);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_EQ(peephole.getStrengthReducedCount(), 0);
+    ASSERT_TRUE(contains(output, "ret i32 %x"));
+    ASSERT_TRUE(contains(output, "ret float %x"));
+    ASSERT_FALSE(contains(output, "sub"));
+    ASSERT_FALSE(contains(output, "fneg"));
+}
+
+TEST(IRTest, PeepholePowerOfTwo)
+{
+    auto module = lowerInput("int f(int x) { int a; a = x * 8; int b; b = x / 4; int c; c = x % 16; return a + b + c; } double g(double x) { return x / 0.5; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::Peephole peephole;
+    ASSERT_TRUE(peephole.run(*module));
+    ASSERT_EQ(peephole.getStrengthReducedCount(), 4);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "shl i32 %x, 3"));
+    ASSERT_TRUE(contains(output, "ashr i32 %x, 31"));
+    ASSERT_TRUE(contains(output, "fmul double %x"));
+    ASSERT_FALSE(contains(output, "mul i32"));
+    ASSERT_FALSE(contains(output, "sdiv"));
+    ASSERT_FALSE(contains(output, "srem"));
+    ASSERT_FALSE(contains(output, "fdiv"));
+}
+
+TEST(IRTest, PeepholeDivisionByConstant)
+{
+    auto module = lowerInput("int f(int x) { int a; a = x / 7; int b; b = x % 10; return a + b; } float g(float x) { return x / 3.0F; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::Peephole peephole;
+    ASSERT_TRUE(peephole.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    // 7's magic number is 0x92492493 (negative as an i32) with a shift of 2.
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, ", -1840700269"));
+    ASSERT_FALSE(contains(output, "sdiv"));
+    ASSERT_FALSE(contains(output, "srem"));
+
+    // 1 / 3 isn't exact, so the division stays.
+    ASSERT_TRUE(contains(output, "fdiv float %x, "));
+}
+
+TEST(IRTest, TailCallEliminationSelfRecursion)
+{
+    auto module = lowerInput("int sum(int n, int acc) { if (n < 1) { return acc; } int m; m = n - 1; int a; a = acc + n; return sum(m, a); }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::TailCallElimination tailCallElimination;
+    ASSERT_TRUE(tailCallElimination.run(*module));
+    ASSERT_EQ(tailCallElimination.getEliminatedCount(), 1);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "call"));
+    ASSERT_TRUE(contains(output, "tailrecurse:"));
+    ASSERT_TRUE(contains(output, "%n.tr = phi i32 [ %n, %entry ]"));
+
+    // The recursion is now a loop.
+    ir::DominatorTree dominators(*module->getFunction("sum"));
+    ir::LoopInfo loopInfo(dominators);
+    ASSERT_EQ(loopInfo.size(), 1);
+}
+
+TEST(IRTest, TailCallEliminationMarksTailCalls)
+{
+    auto module = lowerInput("int isEven(int n); int isOdd(int n) { if (n < 1) { return 0; } int m; m = n - 1; return isEven(m); } "
+                             "int isEven(int n) { if (n < 1) { return 1; } int m; m = n - 1; return isOdd(m); } "
+                             "int both(int a, int b) { return isEven(a); } int notTail(int a) { int r; r = isOdd(a); return r + 1; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::TailCallElimination tailCallElimination;
+    ASSERT_TRUE(tailCallElimination.run(*module));
+    ASSERT_EQ(tailCallElimination.getEliminatedCount(), 0);
+    ASSERT_EQ(tailCallElimination.getMarkedCount(), 3);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "musttail call i32 @isEven("));
+    ASSERT_TRUE(contains(output, "musttail call i32 @isOdd("));
+    ASSERT_TRUE(contains(output, "= tail call i32 @isEven(i32 %a)"));
+    ASSERT_TRUE(contains(output, "= call i32 @isOdd(i32 %a)"));
+
+    // 'musttail' is only valid right before the return.
+    auto* notTail = module->getFunction("notTail");
+    notTail->getEntryBlock()->front()->setFlag(ir::EnumInstructionFlag::MUST_TAIL);
+    ASSERT_FALSE(verifier.verify(*module));
+}
+
+TEST(IRTest, TailCallEliminationEscapingLocal)
+{
+    auto module = lowerInput("int f(int* p, int n) { int x; x = n; if (n < 1) { return *p; } int m; m = n - 1; return f(&x, m); }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    // The callee reads the caller's 'x', so the frame has to stay.
+    opt::TailCallElimination tailCallElimination;
+    ASSERT_FALSE(tailCallElimination.run(*module));
+    ASSERT_TRUE(contains(ir::toString(*module), " = call i32 @f("));
+}
+
+TEST(IRTest, ScalarReplacementNestedStruct)
+{
+    auto module = lowerInput("struct Vec2 { int x; int y; }; struct Vec3 { struct Vec2 v2; int z; }; "
+        "int main() { struct Vec3 v3; v3.v2.x = 10; v3.v2.y = 12; v3.z = 20; int result; result = v3.v2.x + v3.v2.y + v3.z; return result; }");
+    ASSERT_NE(module, nullptr);
+
+    // Vec3 and then its Vec2 field.
+    opt::ScalarReplacement scalarReplacement;
+    ASSERT_TRUE(scalarReplacement.run(*module));
+    ASSERT_EQ(scalarReplacement.getSplitCount(), 2);
+    ASSERT_FALSE(contains(ir::toString(*module), "alloca %struct."));
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+    opt::ConstantPropagation constantPropagation;
+    constantPropagation.run(*module);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "alloca"));
+    ASSERT_TRUE(contains(output, "ret i32 42"));
+}
+
+TEST(IRTest, ScalarReplacementStructCopy)
+{
+    auto module = lowerInput("struct Vec2 { int x; int y; }; "
+        "int main() { struct Vec2 a; a.x = 30; a.y = 12; struct Vec2 b; b = a; a.x = 100; return b.x + b.y; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::ScalarReplacement scalarReplacement;
+    ASSERT_TRUE(scalarReplacement.run(*module));
+    ASSERT_EQ(scalarReplacement.getSplitCount(), 2);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+    opt::ConstantPropagation constantPropagation;
+    constantPropagation.run(*module);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    // The copy reads 'a' before it is overwritten.
+    const auto output = ir::toString(*module);
+    ASSERT_FALSE(contains(output, "alloca"));
+    ASSERT_TRUE(contains(output, "ret i32 42"));
+}
+
+TEST(IRTest, ScalarReplacementEscapingStruct)
+{
+    auto module = lowerInput("struct Vec2 { int x; int y; }; int take(struct Vec2* p) { return p->x; } "
+        "int main() { struct Vec2 a; a.x = 7; a.y = 8; return take(&a); }");
+    ASSERT_NE(module, nullptr);
+
+    opt::ScalarReplacement scalarReplacement;
+    ASSERT_FALSE(scalarReplacement.run(*module));
+    ASSERT_TRUE(contains(ir::toString(*module), "alloca %struct.Vec2"));
+}
+
+TEST(IRTest, FunctionAttributesInference)
+{
+    auto module = lowerInput("int g; int puts(char* str); int sq(int x) { return x * x; } int rd(int* p) { return *p; } "
+        "int spin(int n) { int i; i = 0; while (i < n) { i = i + 1; } return i; } int wr(int v) { g = v; return sq(v); } "
+        "int fact(int n) { if (n < 2) { return 1; } int m; m = n - 1; return n * fact(m); } "
+        "int hello() { return puts(\"hi\"); }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+
+    opt::FunctionAttributes functionAttributes;
+    ASSERT_TRUE(functionAttributes.run(*module));
+
+    const auto getAttributes = [&module](const char* name) { return module->getFunction(name)->getAttributes(); };
+    const u8 noUnwind = ir::EnumFunctionAttribute::NO_UNWIND;
+    const u8 willReturn = ir::EnumFunctionAttribute::WILL_RETURN;
+
+    ASSERT_EQ(getAttributes("sq"), ir::EnumFunctionAttribute::READ_NONE | noUnwind | willReturn);
+    ASSERT_EQ(getAttributes("rd"), ir::EnumFunctionAttribute::READ_ONLY | noUnwind | willReturn);
+    ASSERT_EQ(getAttributes("wr"), noUnwind | willReturn);
+
+    // A loop or recursion may never end.
+    ASSERT_EQ(getAttributes("spin"), ir::EnumFunctionAttribute::READ_NONE | noUnwind);
+    ASSERT_EQ(getAttributes("fact"), ir::EnumFunctionAttribute::READ_NONE | noUnwind);
+
+    // Nothing is known about an external function.
+    ASSERT_EQ(getAttributes("puts"), ir::EnumFunctionAttribute::NO_FUNCTION_ATTRIBUTES);
+    ASSERT_EQ(getAttributes("hello"), noUnwind);
+
+    const auto output = ir::toString(*module);
+    ASSERT_TRUE(contains(output, "define i32 @sq(i32 %x) readnone nounwind willreturn"));
+    ASSERT_TRUE(contains(output, "declare i32 @puts(i8*)\n"));
+}
+
+TEST(IRTest, FunctionAttributesEnableCallElimination)
+{
+    auto module = lowerInput("int g; int sq(int x) { return x * x; } int rd() { return g; } "
+        "int main() { int a; a = g; int b; b = sq(a); int c; c = sq(a); int u; u = sq(b); int r; r = rd(); return b + c; }");
+    ASSERT_NE(module, nullptr);
+
+    opt::Mem2Reg mem2reg;
+    mem2reg.run(*module);
+    opt::FunctionAttributes functionAttributes;
+    functionAttributes.run(*module);
+
+    // The second sq(a) reuses the first, the unused calls go away.
+    opt::GlobalValueNumbering globalValueNumbering;
+    ASSERT_TRUE(globalValueNumbering.run(*module));
+    opt::DeadCodeElimination deadCodeElimination;
+    ASSERT_TRUE(deadCodeElimination.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+
+    const auto output = ir::toString(*module);
+    const auto first = output.find("call i32 @sq(");
+    ASSERT_NE(first, std::string::npos);
+    ASSERT_EQ(output.find("call i32 @sq(", first + 1), std::string::npos);
+    ASSERT_FALSE(contains(output, "call i32 @rd("));
+}
+
+TEST(IRTest, PassManagerPipelines)
+{
+    opt::PassManager passManager;
+    std::string errorMessage;
+
+    ASSERT_TRUE(passManager.addPipeline("mem2reg,gvn,dce", &errorMessage));
+    ASSERT_EQ(passManager.getPassNames(), std::vector<std::string>({ "mem2reg", "gvn", "dce" }));
+
+    // Nothing is added when a name is unknown.
+    ASSERT_FALSE(passManager.addPipeline("constprop,bogus", &errorMessage));
+    ASSERT_TRUE(contains(errorMessage, "bogus"));
+    ASSERT_EQ(passManager.size(), 3);
+
+    opt::PassManager o0;
+    o0.addDefaultPipeline(opt::EnumOptLevel::O0);
+    ASSERT_EQ(o0.size(), 0);
+
+    opt::PassManager o1;
+    o1.addDefaultPipeline(opt::EnumOptLevel::O1);
+    ASSERT_EQ(o1.getPassNames(), std::vector<std::string>({ "sroa", "mem2reg", "argattrs", "funcattrs", "tailcall", "constprop", "peephole", "dce" }));
+}
+
+TEST(IRTest, PassManagerCachesAnalyses)
+{
+    auto module = lowerInput("int f(int a, int n) { int i; i = 0; while (i < n) { i = i + a * 3; } return i; }");
+    ASSERT_NE(module, nullptr);
+
+    // The dominator tree mem2reg computed is reused by gvn (which adds the alias analysis),
+    // and the loops built on it by lsr.
+    opt::PassManager passManager;
+    ASSERT_TRUE(passManager.addPipeline("mem2reg,gvn,lsr", nullptr));
+    passManager.run(*module);
+    ASSERT_EQ(passManager.getAnalysisManager().getComputedCount(), 3);
+
+    // licm inserts a preheader, so the dominator tree and loops are computed again for lsr.
+    auto other = lowerInput("int f(int a, int n) { int i; i = 0; while (i < n) { i = i + a * 3; } return i; }");
+    ASSERT_NE(other, nullptr);
+
+    opt::PassManager licmPassManager;
+    ASSERT_TRUE(licmPassManager.addPipeline("mem2reg,licm,lsr", nullptr));
+    licmPassManager.run(*other);
+    ASSERT_TRUE(licmPassManager.getStatistics()[1].changed);
+    ASSERT_EQ(licmPassManager.getAnalysisManager().getComputedCount(), 5);
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*other));
+}
+
+TEST(IRTest, PassManagerStatistics)
+{
+    auto module = lowerInput("int add(int x, int y) { return x + y; } int main() { int a; a = 10; int b; b = 32; return add(a, b); }");
+    ASSERT_NE(module, nullptr);
+
+    const std::size_t before = module->getInstructionCount();
+
+    opt::PassManager passManager;
+    passManager.addDefaultPipeline(opt::EnumOptLevel::O2);
+    ASSERT_TRUE(passManager.run(*module));
+
+    ir::Verifier verifier;
+    ASSERT_TRUE(verifier.verify(*module));
+    ASSERT_TRUE(contains(ir::toString(*module), "ret i32 42"));
+
+    const auto& statistics = passManager.getStatistics();
+    ASSERT_EQ(statistics.size(), passManager.size());
+    ASSERT_EQ(statistics.front().name, "sroa");
+    ASSERT_EQ(statistics.front().instructionsBefore, before);
+    ASSERT_EQ(statistics.back().instructionsAfter, module->getInstructionCount());
+
+    for (std::size_t i = 1; i < statistics.size(); ++i)
+    {
+        ASSERT_EQ(statistics[i].instructionsBefore, statistics[i - 1].instructionsAfter);
+    }
+
+    std::ostringstream os;
+    passManager.printStatistics(os);
+    ASSERT_TRUE(contains(os.str(), "[stats] inline"));
+    ASSERT_TRUE(contains(os.str(), "inlined 1 calls"));
+    ASSERT_TRUE(contains(os.str(), "[stats] total"));
+}
+
+TEST(IRTest, VerifierMissingTerminatorError)
+{
+    ir::Module module;
+    auto& types = module.getTypes();
+    auto* function = module.getOrInsertFunction("f", types.getFunction(types.getVoid(), {}));
+
+    ir::IRBuilder builder(module);
+    builder.setInsertPoint(function->createBlock("entry"));
+    builder.createAlloca(types.getInt(32));
+
+    ir::Verifier verifier;
+    ASSERT_FALSE(verifier.verify(module));
+    ASSERT_FALSE(verifier.getErrors().empty());
+}
+
+TEST(IRTest, VerifierReturnTypeMismatchError)
+{
+    ir::Module module;
+    auto& types = module.getTypes();
+    auto* function = module.getOrInsertFunction("f", types.getFunction(types.getInt(32), {}));
+
+    ir::IRBuilder builder(module);
+    builder.setInsertPoint(function->createBlock("entry"));
+    builder.createRet(module.getConstantInt(types.getInt(64), 0));
+
+    ir::Verifier verifier;
+    ASSERT_FALSE(verifier.verify(module));
+    ASSERT_EQ(verifier.getErrors().size(), 1);
+}
+
+TEST(IRTest, VerifierStoreTypeMismatchError)
+{
+    ir::Module module;
+    auto& types = module.getTypes();
+    auto* function = module.getOrInsertFunction("f", types.getFunction(types.getVoid(), {}));
+
+    ir::IRBuilder builder(module);
+    builder.setInsertPoint(function->createBlock("entry"));
+    auto* slot = builder.createAlloca(types.getInt(32));
+    builder.createStore(module.getConstantFP(types.getFloat(), 1.0), slot);
+    builder.createRetVoid();
+
+    ir::Verifier verifier;
+    ASSERT_FALSE(verifier.verify(module));
+}
+
+TEST(IRTest, VerifierDominanceError)
+{
+    ir::Module module;
+    auto& types = module.getTypes();
+    auto* i32 = types.getInt(32);
+    auto* function = module.getOrInsertFunction("f", types.getFunction(i32, { types.getBool() }));
+
+    ir::IRBuilder builder(module);
+    auto* entry = function->createBlock("entry");
+    auto* left = function->createBlock("left");
+    auto* right = function->createBlock("right");
+
+    builder.setInsertPoint(entry);
+    builder.createCondBr(function->getArg(0), left, right);
+
+    builder.setInsertPoint(left);
+    auto* value = builder.createBinary(ir::EnumOpcode::ADD, module.getConstantInt(i32, 1), module.getConstantInt(i32, 2));
+    builder.createRet(value);
+
+    // 'right' is not dominated by 'left', so it may not use its values.
+    builder.setInsertPoint(right);
+    builder.createRet(value);
+
+    ir::Verifier verifier;
+    ASSERT_FALSE(verifier.verify(module));
+    ASSERT_EQ(verifier.getErrors().size(), 1);
+}
+
+s32 main(s32 argc, char* argv[])
+{
+    reporter.setEnablePrint(false);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
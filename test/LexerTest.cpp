@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <vector>
 
 using namespace cmm;
 
@@ -153,6 +154,20 @@ TEST(LexerTest, LexNegDouble1Period)
     ASSERT_TRUE(lexer.completedOrWhitespaceOnly());
 }
 
+TEST(LexerTest, LexZeroDouble)
+{
+    const f64 value = 0.0;
+    const std::string input = " 0.0 ";
+    Lexer lexer(input);
+    Token token('\0', false);
+
+    ASSERT_TRUE(lexer.nextToken(token));
+    ASSERT_EQ(token.getType(), TokenType::DOUBLE);
+    ASSERT_EQ(token.asDouble(), value);
+    ASSERT_FALSE(lexer.nextToken(token));
+    ASSERT_TRUE(lexer.completedOrWhitespaceOnly());
+}
+
 TEST(LexerTest, LexPosDoubleEError)
 {
     const std::string input = " 1.234E ";
@@ -193,6 +208,20 @@ TEST(LexerTest, LexPosFloat)
     ASSERT_TRUE(lexer.completedOrWhitespaceOnly());
 }
 
+TEST(LexerTest, LexZeroFloat)
+{
+    const f32 value = 0.0F;
+    const std::string input = " 0.0F ";
+    Lexer lexer(input);
+    Token token('\0', false);
+
+    ASSERT_TRUE(lexer.nextToken(token));
+    ASSERT_EQ(token.getType(), TokenType::FLOAT);
+    ASSERT_EQ(token.asFloat(), value);
+    ASSERT_FALSE(lexer.nextToken(token));
+    ASSERT_TRUE(lexer.completedOrWhitespaceOnly());
+}
+
 TEST(LexerTest, LexNegFloat)
 {
     const f64 value = -1.234f;
@@ -616,6 +645,39 @@ TEST(LexerTest, LexArrowStringSymbol)
     ASSERT_TRUE(lexer.completedOrWhitespaceOnly());
 }
 
+TEST(LexerTest, LexTwoCharOperatorStringSymbols)
+{
+    const std::string input = "== != <= >= << >> && ||";
+    const std::vector<std::string> expected = { "==", "!=", "<=", ">=", "<<", ">>", "&&", "||" };
+    Lexer lexer(input);
+    Token token('\0', false);
+
+    for (const auto& symbol : expected)
+    {
+        ASSERT_TRUE(lexer.nextToken(token));
+        ASSERT_EQ(token.getType(), TokenType::SYMBOL);
+        ASSERT_EQ(token.asStringSymbol(), symbol);
+    }
+
+    ASSERT_TRUE(lexer.completedOrWhitespaceOnly());
+}
+
+TEST(LexerTest, LexSingleCharOperatorCharSymbols)
+{
+    const std::string input = "% | ^ ! & =";
+    Lexer lexer(input);
+    Token token('\0', false);
+
+    for (const char symbol : { '%', '|', '^', '!', '&', '=' })
+    {
+        ASSERT_TRUE(lexer.nextToken(token));
+        ASSERT_EQ(token.getType(), TokenType::CHAR_SYMBOL);
+        ASSERT_EQ(token.asCharSymbol(), symbol);
+    }
+
+    ASSERT_TRUE(lexer.completedOrWhitespaceOnly());
+}
+
 s32 main(s32 argc, char *argv[])
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -1,5 +1,7 @@
 #include <cmm/Types.h>
 #include <cmm/EnumTable.h>
+#include <cmm/Keyword.h>
+#include <cmm/ParserDispatchTable.h>
 #include <cmm/StructTable.h>
 
 #include <gtest/gtest.h>
@@ -108,6 +110,55 @@ TEST(MiscTest, StructTableAddAndCheck)
     ASSERT_EQ(table.get(name)->symState, EnumSymState::DEFINED);
 }
 
+TEST(MiscTest, KeywordInfoTableMatchesKeywords)
+{
+    for (std::size_t i = 0; i < keywordInfoTable.size(); ++i)
+    {
+        const auto& info = keywordInfoTable[i];
+        const std::string name(info.name);
+
+        const auto* keywordPtr = Keyword::isKeyword(name);
+        ASSERT_NE(keywordPtr, nullptr);
+        ASSERT_EQ(static_cast<std::size_t>(keywordPtr->getEnumKeyword()), i);
+        ASSERT_EQ(Keyword::isTypeKeyword(name) != nullptr, info.isAType);
+
+        const auto optionalKeyword = findEnumKeyword(name);
+        ASSERT_TRUE(optionalKeyword.has_value());
+        ASSERT_EQ(static_cast<std::size_t>(*optionalKeyword), i);
+    }
+
+    ASSERT_FALSE(findEnumKeyword("notAKeyword").has_value());
+}
+
+TEST(MiscTest, ParserDispatchTableLookup)
+{
+    using Func = s32 (*)();
+    static CMM_CONSTEXPR auto table = []()
+    {
+        ParserDispatchTable<Func> table;
+        table.registerFunction(CHAR_LPAREN, []() -> s32 { return 1; });
+        table.registerFunction(EnumKeyword::RETURN, []() -> s32 { return 2; });
+        table.registerFunction(TokenType::SYMBOL, []() -> s32 { return 3; });
+
+        return table;
+    }();
+
+    Token token(CHAR_LPAREN, true);
+    ASSERT_NE(table.dispatch(token), nullptr);
+    ASSERT_EQ(table.dispatch(token)(), 1);
+
+    token.setCharSymbol(CHAR_RPAREN);
+    ASSERT_EQ(table.dispatch(token), nullptr);
+
+    token.setStringSymbol("return");
+    ASSERT_NE(table.dispatch(token), nullptr);
+    ASSERT_EQ(table.dispatch(token)(), 2);
+
+    token.setStringSymbol("x");
+    ASSERT_NE(table.dispatch(token), nullptr);
+    ASSERT_EQ(table.dispatch(token)(), 3);
+}
+
 s32 main(s32 argc, char* argv[])
 {
     ::testing::InitGoogleTest(&argc, argv);
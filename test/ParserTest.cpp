@@ -1,10 +1,12 @@
 #include <cmm/NodeList.h>
 #include <cmm/Parser.h>
+#include <cmm/ParserMemo.h>
 #include <cmm/Reporter.h>
 
 #include <gtest/gtest.h>
 
 #include <string>
+#include <utility>
 
 using namespace cmm;
 
@@ -165,31 +167,32 @@ TEST(ParserTest, ParseCompilationNodeIntSum3)
     ASSERT_NE(expressionStatement->getExpression(), nullptr);
     ASSERT_EQ(expressionStatement->getExpression()->getType(), EnumNodeType::BIN_OP);
 
+    // Addition is left associative: (10 + 31) + 1
     auto* rootSumPtr = static_cast<BinOpNode*>(expressionStatement->getExpression());
     ASSERT_EQ(rootSumPtr->getTypeof(), EnumBinOpNodeType::ADD);
     ASSERT_NE(rootSumPtr->getLeft(), nullptr);
-    ASSERT_EQ(rootSumPtr->getLeft()->getType(), EnumNodeType::LITTERAL);
+    ASSERT_EQ(rootSumPtr->getLeft()->getType(), EnumNodeType::BIN_OP);
     ASSERT_NE(rootSumPtr->getRight(), nullptr);
-    ASSERT_EQ(rootSumPtr->getRight()->getType(), EnumNodeType::BIN_OP);
+    ASSERT_EQ(rootSumPtr->getRight()->getType(), EnumNodeType::LITTERAL);
 
-    auto* leftIntPtr = static_cast<LitteralNode*>(rootSumPtr->getLeft());
-    ASSERT_EQ(leftIntPtr->getDatatype().type, EnumCType::INT32);
-    ASSERT_EQ(leftIntPtr->getValue().valueS32, 10);
+    auto* rightIntPtr = static_cast<LitteralNode*>(rootSumPtr->getRight());
+    ASSERT_EQ(rightIntPtr->getDatatype().type, EnumCType::INT32);
+    ASSERT_EQ(rightIntPtr->getValue().valueS32, 1);
 
-    auto* rightSumPtr = static_cast<BinOpNode*>(rootSumPtr->getRight());
-    ASSERT_EQ(rightSumPtr->getTypeof(), EnumBinOpNodeType::ADD);
-    ASSERT_NE(rightSumPtr->getLeft(), nullptr);
-    ASSERT_EQ(rightSumPtr->getLeft()->getType(), EnumNodeType::LITTERAL);
-    ASSERT_NE(rightSumPtr->getRight(), nullptr);
-    ASSERT_EQ(rightSumPtr->getRight()->getType(), EnumNodeType::LITTERAL);
+    auto* leftSumPtr = static_cast<BinOpNode*>(rootSumPtr->getLeft());
+    ASSERT_EQ(leftSumPtr->getTypeof(), EnumBinOpNodeType::ADD);
+    ASSERT_NE(leftSumPtr->getLeft(), nullptr);
+    ASSERT_EQ(leftSumPtr->getLeft()->getType(), EnumNodeType::LITTERAL);
+    ASSERT_NE(leftSumPtr->getRight(), nullptr);
+    ASSERT_EQ(leftSumPtr->getRight()->getType(), EnumNodeType::LITTERAL);
 
-    leftIntPtr = static_cast<LitteralNode*>(rightSumPtr->getLeft());
+    auto* leftIntPtr = static_cast<LitteralNode*>(leftSumPtr->getLeft());
     ASSERT_EQ(leftIntPtr->getDatatype().type, EnumCType::INT32);
-    ASSERT_EQ(leftIntPtr->getValue().valueS32, 31);
+    ASSERT_EQ(leftIntPtr->getValue().valueS32, 10);
 
-    auto* rightIntPtr = static_cast<LitteralNode*>(rightSumPtr->getRight());
+    rightIntPtr = static_cast<LitteralNode*>(leftSumPtr->getRight());
     ASSERT_EQ(rightIntPtr->getDatatype().type, EnumCType::INT32);
-    ASSERT_EQ(rightIntPtr->getValue().valueS32, 1);
+    ASSERT_EQ(rightIntPtr->getValue().valueS32, 31);
 }
 
 TEST(ParserTest, ParseCompilationNodeFloatSubtract2)
@@ -226,6 +229,72 @@ TEST(ParserTest, ParseCompilationNodeFloatSubtract2)
     ASSERT_EQ(rightFloatPtr->getValue().valueF32, 32.0F);
 }
 
+TEST(ParserTest, ParseCompilationNodeAssignZeroDouble)
+{
+    const std::string input = "float f() { float s; s = 0.0; return s; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    auto& translationUnit = compUnitPtr->getRoot();
+    ASSERT_EQ(translationUnit.size(), 1);
+    ASSERT_EQ((*translationUnit.begin())->getType(), EnumNodeType::FUNCTION_DEFINITION_STATEMENT);
+
+    auto* funcDefPtr = static_cast<FunctionDefinitionStatementNode*>(translationUnit.begin()->get());
+    auto& block = funcDefPtr->getBlock();
+    ASSERT_EQ(block.size(), 3);
+
+    auto& assignStatement = *std::next(block.begin());
+    ASSERT_EQ(assignStatement->getType(), EnumNodeType::EXPRESSION_STATEMENT);
+
+    auto* expressionStatement = static_cast<ExpressionStatementNode*>(assignStatement.get());
+    ASSERT_EQ(expressionStatement->getExpression()->getType(), EnumNodeType::BIN_OP);
+
+    auto* assignPtr = static_cast<BinOpNode*>(expressionStatement->getExpression());
+    ASSERT_EQ(assignPtr->getTypeof(), EnumBinOpNodeType::ASSIGNMENT);
+    ASSERT_EQ(assignPtr->getRight()->getType(), EnumNodeType::LITTERAL);
+
+    auto* zeroPtr = static_cast<LitteralNode*>(assignPtr->getRight());
+    ASSERT_EQ(zeroPtr->getDatatype().type, EnumCType::DOUBLE);
+    ASSERT_EQ(zeroPtr->getValue().valueF64, 0.0);
+}
+
+TEST(ParserTest, ParseCompilationNodeAssignZeroFloat)
+{
+    const std::string input = "float f() { float s; s = 0.0F; return s; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    auto& translationUnit = compUnitPtr->getRoot();
+    ASSERT_EQ(translationUnit.size(), 1);
+    ASSERT_EQ((*translationUnit.begin())->getType(), EnumNodeType::FUNCTION_DEFINITION_STATEMENT);
+
+    auto* funcDefPtr = static_cast<FunctionDefinitionStatementNode*>(translationUnit.begin()->get());
+    auto& block = funcDefPtr->getBlock();
+    ASSERT_EQ(block.size(), 3);
+
+    auto& assignStatement = *std::next(block.begin());
+    ASSERT_EQ(assignStatement->getType(), EnumNodeType::EXPRESSION_STATEMENT);
+
+    auto* expressionStatement = static_cast<ExpressionStatementNode*>(assignStatement.get());
+    ASSERT_EQ(expressionStatement->getExpression()->getType(), EnumNodeType::BIN_OP);
+
+    auto* assignPtr = static_cast<BinOpNode*>(expressionStatement->getExpression());
+    ASSERT_EQ(assignPtr->getTypeof(), EnumBinOpNodeType::ASSIGNMENT);
+    ASSERT_EQ(assignPtr->getRight()->getType(), EnumNodeType::LITTERAL);
+
+    auto* zeroPtr = static_cast<LitteralNode*>(assignPtr->getRight());
+    ASSERT_EQ(zeroPtr->getDatatype().type, EnumCType::FLOAT);
+    ASSERT_EQ(zeroPtr->getValue().valueF32, 0.0F);
+}
+
 TEST(ParserTest, ParseCompilationNodeIntMultiply2)
 {
     const std::string input = "123 * 456789;";
@@ -1814,6 +1883,68 @@ TEST(ParserTest, ParseCompilationNodeIntDeclarationStatement)
     ASSERT_EQ(outName, name);
 }
 
+TEST(ParserTest, ParseCompilationNodeUnsignedDeclarationStatements)
+{
+    const std::string input = "unsigned x; unsigned char* c; signed long l; int i;";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    auto& translationUnit = compUnitPtr->getRoot();
+    auto iter = translationUnit.begin();
+    const std::pair<EnumCType, bool> expected[] = {
+        { EnumCType::INT32, true }, { EnumCType::CHAR, true }, { EnumCType::INT64, false }, { EnumCType::INT32, false }
+    };
+
+    for (const auto& [type, unsignedInt] : expected)
+    {
+        ASSERT_NE(iter, translationUnit.end());
+        ASSERT_EQ((*iter)->getType(), EnumNodeType::VARIABLE_DECLARATION_STATEMENT);
+
+        const auto& datatype = static_cast<VariableDeclarationStatementNode*>(iter->get())->getDatatype();
+        ASSERT_EQ(datatype.type, type);
+        ASSERT_EQ(datatype.unsignedInt, unsignedInt);
+        ++iter;
+    }
+
+    ASSERT_EQ(iter, translationUnit.end());
+}
+
+TEST(ParserTest, ParseCompilationNodeArrayDeclarationStatement)
+{
+    const std::string input = "int* a[8];";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    auto& translationUnit = compUnitPtr->getRoot();
+    auto& firstStatement = *translationUnit.begin();
+    ASSERT_EQ(firstStatement->getType(), EnumNodeType::VARIABLE_DECLARATION_STATEMENT);
+
+    const auto& datatype = static_cast<VariableDeclarationStatementNode*>(firstStatement.get())->getDatatype();
+    ASSERT_EQ(datatype.type, EnumCType::INT32);
+    ASSERT_EQ(datatype.pointers, 1);
+    ASSERT_EQ(datatype.arrayLength, 8);
+    ASSERT_TRUE(datatype.isArray());
+    ASSERT_FALSE(datatype.isPointerType());
+}
+
+TEST(ParserTest, ParseCompilationNodeArrayDeclarationStatementMissingSize)
+{
+    const std::string input = "int a[];";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_FALSE(errorMessage.empty());
+}
+
 TEST(ParserTest, ParseCompilationNodeIntPointerDeclarationStatement)
 {
     const std::string input = "int* x;";
@@ -3666,6 +3797,88 @@ TEST(ParserTest, ParseCompilationNodeWhileStatementWithBlockNode)
     ASSERT_EQ(iter, blockNodePtr->cend());
 }
 
+TEST(ParserTest, ParseCompilationNodeSwitchStatement)
+{
+    const std::string input = "switch (x) { case 1: case 2: y = 2; break; default: y = 0; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    auto& translationUnit = compUnitPtr->getRoot();
+    auto& firstStatement = *translationUnit.begin();
+    ASSERT_EQ(firstStatement->getType(), EnumNodeType::SWITCH_STATEMENT);
+
+    auto* switchStatementPtr = static_cast<SwitchStatementNode*>(firstStatement.get());
+    ASSERT_NE(switchStatementPtr->getConditional(), nullptr);
+    ASSERT_EQ(switchStatementPtr->getConditional()->getType(), EnumNodeType::VARIABLE);
+    ASSERT_EQ(switchStatementPtr->size(), 3);
+
+    auto iter = switchStatementPtr->cbegin();
+    ASSERT_FALSE((*iter)->isDefault());
+    ASSERT_TRUE((*iter)->empty());
+
+    ++iter;
+    ASSERT_FALSE((*iter)->isDefault());
+    ASSERT_EQ((*iter)->getExpression()->getType(), EnumNodeType::LITTERAL);
+
+    auto statementIter = (*iter)->cbegin();
+    ASSERT_NE(statementIter, (*iter)->cend());
+    ASSERT_EQ((*statementIter)->getType(), EnumNodeType::EXPRESSION_STATEMENT);
+
+    ++statementIter;
+    ASSERT_NE(statementIter, (*iter)->cend());
+    ASSERT_EQ((*statementIter)->getType(), EnumNodeType::BREAK_STATEMENT);
+
+    ++iter;
+    ASSERT_TRUE((*iter)->isDefault());
+    ASSERT_EQ((*iter)->getExpression(), nullptr);
+    ASSERT_FALSE((*iter)->empty());
+}
+
+TEST(ParserTest, ParseCompilationNodeSwitchStatementMissingColon)
+{
+    const std::string input = "switch (x) { case 1 y = 2; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_FALSE(errorMessage.empty());
+    ASSERT_EQ(compUnitPtr, nullptr);
+}
+
+TEST(ParserTest, ParseCompilationNodeArrayIndexExpression)
+{
+    const std::string input = "a[i + 1] = p[2];";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    auto& translationUnit = compUnitPtr->getRoot();
+    auto& firstStatement = *translationUnit.begin();
+    ASSERT_EQ(firstStatement->getType(), EnumNodeType::EXPRESSION_STATEMENT);
+
+    auto* expression = static_cast<ExpressionStatementNode*>(firstStatement.get())->getExpression();
+    ASSERT_EQ(expression->getType(), EnumNodeType::BIN_OP);
+
+    auto* binOpNode = static_cast<BinOpNode*>(expression);
+    ASSERT_EQ(binOpNode->getTypeof(), EnumBinOpNodeType::ASSIGNMENT);
+    ASSERT_EQ(binOpNode->getLeft()->getType(), EnumNodeType::ARRAY_INDEX);
+    ASSERT_EQ(binOpNode->getRight()->getType(), EnumNodeType::ARRAY_INDEX);
+
+    auto* leftIndexNode = static_cast<ArrayIndexNode*>(binOpNode->getLeft());
+    ASSERT_EQ(leftIndexNode->getExpression()->getType(), EnumNodeType::VARIABLE);
+    ASSERT_EQ(leftIndexNode->getIndex()->getType(), EnumNodeType::BIN_OP);
+
+    auto* rightIndexNode = static_cast<ArrayIndexNode*>(binOpNode->getRight());
+    ASSERT_EQ(rightIndexNode->getIndex()->getType(), EnumNodeType::LITTERAL);
+}
+
 TEST(ParserTest, ParseCompilationNodeMultipleStatements)
 {
     const std::string input = "true; false;";
@@ -3965,6 +4178,413 @@ TEST(ParserTest, ParseCompilationNodeEnumDefinitionStatementNodeWithMultiAssignm
     ASSERT_EQ(findResult->second.getValue(), 32);
 }
 
+TEST(ParserTest, ParseCompilationNodeParallelFunctionDefinitions)
+{
+    const std::string input = "struct Vec2 { int x; int y; };\n"
+                              "enum Color { RED, GREEN };\n"
+                              "int add(int x, int y) { return x + y; }\n"
+                              "int sub(int x, int y) { enum Local { ONE = 1 }; return x - y; }\n"
+                              "void nop();\n"
+                              "void doNothing() { if (true) { } else { } }\n";
+    Parser parser(input);
+    parser.setParseThreadCount(4);
+    ASSERT_EQ(parser.getParseThreadCount(), 4);
+
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    auto& translationUnit = compUnitPtr->getRoot();
+    ASSERT_EQ(translationUnit.size(), 6);
+
+    static const EnumNodeType expectedTypes[] = { EnumNodeType::STRUCT_DEFINITION, EnumNodeType::ENUM_DEFINITION,
+        EnumNodeType::FUNCTION_DEFINITION_STATEMENT, EnumNodeType::FUNCTION_DEFINITION_STATEMENT,
+        EnumNodeType::FUNCTION_DECLARATION_STATEMENT, EnumNodeType::FUNCTION_DEFINITION_STATEMENT };
+    static const char* expectedNames[] = { "add", "sub" };
+
+    std::size_t index = 0;
+
+    for (auto& statement : translationUnit)
+    {
+        ASSERT_EQ(statement->getType(), expectedTypes[index]);
+
+        if (index == 2 || index == 3)
+        {
+            auto* funcDefPtr = static_cast<FunctionDefinitionStatementNode*>(statement.get());
+            ASSERT_EQ(funcDefPtr->getName(), expectedNames[index - 2]);
+            ASSERT_EQ(funcDefPtr->paramCount(), 2);
+            ASSERT_EQ(funcDefPtr->getLocation().getLine(), index + 1);
+        }
+
+        ++index;
+    }
+
+    // Enums defined in function bodies on other threads are merged back in.
+    auto& enumTable = translationUnit.getEnumTable();
+    ASSERT_TRUE(enumTable.has("Color"));
+    ASSERT_TRUE(enumTable.has("Local"));
+    ASSERT_NE(enumTable.findEnumFromEnumeratorName("ONE"), nullptr);
+}
+
+TEST(ParserTest, ParseCompilationNodeParallelDuplicateEnumFallsBack)
+{
+    const std::string input = "int f() { enum A { X }; return 0; }\n"
+                              "int g() { enum A { Y }; return 0; }\n";
+    Parser parser(input);
+    parser.setParseThreadCount(2);
+
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_FALSE(errorMessage.empty());
+    ASSERT_EQ(compUnitPtr, nullptr);
+}
+
+TEST(ParserTest, ParseCompilationNodeParallelMissingClosingBracket)
+{
+    const std::string input = "int f() { return 0; }\n"
+                              "int g() { return 1; }\n"
+                              "int h() { return 2;\n";
+    Parser parser(input);
+    parser.setParseThreadCount(2);
+
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_FALSE(errorMessage.empty());
+    ASSERT_EQ(compUnitPtr, nullptr);
+}
+
+TEST(ParserTest, ParseCompilationNodeParallelReportsFirstErrorOnly)
+{
+    const std::string input = "int f() { return 0; }\n"
+                              "int g() { return 1 }\n"
+                              "int h() { return 2 }\n"
+                              "int k() { return 3; }\n";
+
+    reporter.reset();
+    std::string sequentialErrorMessage;
+    Parser sequentialParser(input);
+    ASSERT_EQ(sequentialParser.parseCompilationUnit(&sequentialErrorMessage), nullptr);
+    const auto sequentialErrorCount = reporter.getErrorCount();
+    ASSERT_GT(sequentialErrorCount, 0);
+
+    reporter.reset();
+    std::string errorMessage;
+    Parser parser(input);
+    parser.setParseThreadCount(4);
+    ASSERT_EQ(parser.parseCompilationUnit(&errorMessage), nullptr);
+
+    // Same as the sequential parse, 'h' is never reported since 'g' already failed.
+    ASSERT_FALSE(errorMessage.empty());
+    ASSERT_EQ(reporter.getErrorCount(), sequentialErrorCount);
+    reporter.reset();
+}
+
+TEST(ParserTest, ParseCompilationNodeNestedBlocks)
+{
+    const std::string input = "int main() { { int x; { x = 1; } } { } return 0; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    auto* funcDefPtr = static_cast<FunctionDefinitionStatementNode*>(compUnitPtr->getRoot().begin()->get());
+    auto& block = funcDefPtr->getBlock();
+    ASSERT_EQ(block.size(), 3);
+
+    auto iter = block.begin();
+    ASSERT_EQ((*iter)->getType(), EnumNodeType::BLOCK);
+
+    auto* outerPtr = static_cast<BlockNode*>(iter->get());
+    ASSERT_EQ(outerPtr->size(), 2);
+    ASSERT_EQ((*outerPtr->begin())->getType(), EnumNodeType::VARIABLE_DECLARATION_STATEMENT);
+
+    auto& innerPtr = *std::next(outerPtr->begin());
+    ASSERT_EQ(innerPtr->getType(), EnumNodeType::BLOCK);
+    ASSERT_EQ(static_cast<BlockNode*>(innerPtr.get())->size(), 1);
+
+    ++iter;
+    ASSERT_EQ((*iter)->getType(), EnumNodeType::BLOCK);
+    ASSERT_TRUE(static_cast<BlockNode*>(iter->get())->empty());
+
+    ++iter;
+    ASSERT_EQ((*iter)->getType(), EnumNodeType::RETURN_STATEMENT);
+}
+
+TEST(ParserTest, ParseCompilationNodeNestedBlocksMissingClosingBracket)
+{
+    reporter.reset();
+
+    const std::string input = "int main() { { { return 0; }";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    // Each still open block reports the missing '}', innermost first.
+    ASSERT_EQ(compUnitPtr, nullptr);
+    ASSERT_EQ(errorMessage, "Expected a closing '}' bracket");
+    ASSERT_EQ(reporter.getErrorCount(), 3);
+    reporter.reset();
+}
+
+TEST(ParserTest, ParserMemoRecordsFailures)
+{
+    ParserMemo memo;
+    const Snapshot end(7, Location(1, 8));
+
+    ASSERT_EQ(memo.findFailure(EnumParseRule::CAST_EXPRESSION, 3), nullptr);
+    memo.addFailure(EnumParseRule::CAST_EXPRESSION, 3, end);
+
+    // Same position, different rule is a miss.
+    ASSERT_EQ(memo.findFailure(EnumParseRule::PAREN_EXPRESSION, 3), nullptr);
+
+    const auto* failureEnd = memo.findFailure(EnumParseRule::CAST_EXPRESSION, 3);
+    ASSERT_NE(failureEnd, nullptr);
+    ASSERT_EQ(failureEnd->getIndex(), 7);
+
+    const auto& stats = memo.getStats();
+    ASSERT_EQ(stats.totalLookups(), 3);
+    ASSERT_EQ(stats.totalHits(), 1);
+    ASSERT_EQ(stats[EnumParseRule::CAST_EXPRESSION].stores, 1);
+    ASSERT_EQ(stats[EnumParseRule::PAREN_EXPRESSION].hits, 0);
+}
+
+TEST(ParserTest, ParseCompilationNodeWithMemoization)
+{
+    const std::string input = "int main() { int x; x = (int) (2 + 3) * (x); return x; }";
+    Parser parser(input);
+    parser.setMemoizationEnabled(true);
+    ASSERT_TRUE(parser.isMemoizationEnabled());
+
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_TRUE(errorMessage.empty());
+    ASSERT_NE(compUnitPtr, nullptr);
+
+    auto& translationUnit = compUnitPtr->getRoot();
+    ASSERT_EQ(translationUnit.size(), 1);
+    ASSERT_EQ((*translationUnit.begin())->getType(), EnumNodeType::FUNCTION_DEFINITION_STATEMENT);
+
+    auto* funcDefPtr = static_cast<FunctionDefinitionStatementNode*>(translationUnit.begin()->get());
+    ASSERT_EQ(funcDefPtr->getBlock().size(), 3);
+
+    const auto& stats = parser.getMemoStats();
+    ASSERT_GT(stats[EnumParseRule::CAST_EXPRESSION].lookups, 0);
+    ASSERT_GT(stats[EnumParseRule::DECLARATION_STATEMENT].lookups, 0);
+    ASSERT_LE(stats.totalHits(), stats.totalLookups());
+}
+
+static BinOpNode* getFirstBinOpExpression(CompilationUnitNode* compUnitPtr)
+{
+    if (compUnitPtr == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto& firstStatement = *compUnitPtr->getRoot().begin();
+
+    if (firstStatement->getType() != EnumNodeType::EXPRESSION_STATEMENT)
+    {
+        return nullptr;
+    }
+
+    auto* expression = static_cast<ExpressionStatementNode*>(firstStatement.get())->getExpression();
+    return expression != nullptr && expression->getType() == EnumNodeType::BIN_OP ? static_cast<BinOpNode*>(expression) : nullptr;
+}
+
+TEST(ParserTest, ParseBinOpMultiplyBindsTighterThanAdd)
+{
+    const std::string input = "a + b * c - d;";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+    auto* root = getFirstBinOpExpression(compUnitPtr.get());
+
+    ASSERT_TRUE(errorMessage.empty());
+
+    // (a + (b * c)) - d
+    ASSERT_NE(root, nullptr);
+    ASSERT_EQ(root->getTypeof(), EnumBinOpNodeType::SUBTRACT);
+    ASSERT_EQ(root->getRight()->getType(), EnumNodeType::VARIABLE);
+    ASSERT_EQ(root->getLeft()->getType(), EnumNodeType::BIN_OP);
+
+    auto* addPtr = static_cast<BinOpNode*>(root->getLeft());
+    ASSERT_EQ(addPtr->getTypeof(), EnumBinOpNodeType::ADD);
+    ASSERT_EQ(addPtr->getLeft()->getType(), EnumNodeType::VARIABLE);
+    ASSERT_EQ(addPtr->getRight()->getType(), EnumNodeType::BIN_OP);
+    ASSERT_EQ(static_cast<BinOpNode*>(addPtr->getRight())->getTypeof(), EnumBinOpNodeType::MULTIPLY);
+}
+
+TEST(ParserTest, ParseBinOpCastBindsTighterThanAdd)
+{
+    const std::string input = "(int) a + 1;";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+    auto* root = getFirstBinOpExpression(compUnitPtr.get());
+
+    ASSERT_TRUE(errorMessage.empty());
+
+    // ((int) a) + 1
+    ASSERT_NE(root, nullptr);
+    ASSERT_EQ(root->getTypeof(), EnumBinOpNodeType::ADD);
+    ASSERT_EQ(root->getLeft()->getType(), EnumNodeType::CAST);
+    ASSERT_EQ(static_cast<CastNode*>(root->getLeft())->getExpression()->getType(), EnumNodeType::VARIABLE);
+    ASSERT_EQ(root->getRight()->getType(), EnumNodeType::LITTERAL);
+}
+
+TEST(ParserTest, ParseBinOpCastBindsTighterThanMultiply)
+{
+    const std::string input = "3 * (int) a + 1;";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+    auto* root = getFirstBinOpExpression(compUnitPtr.get());
+
+    ASSERT_TRUE(errorMessage.empty());
+
+    // (3 * ((int) a)) + 1
+    ASSERT_NE(root, nullptr);
+    ASSERT_EQ(root->getTypeof(), EnumBinOpNodeType::ADD);
+    ASSERT_EQ(root->getRight()->getType(), EnumNodeType::LITTERAL);
+    ASSERT_EQ(root->getLeft()->getType(), EnumNodeType::BIN_OP);
+
+    auto* multiplyPtr = static_cast<BinOpNode*>(root->getLeft());
+    ASSERT_EQ(multiplyPtr->getTypeof(), EnumBinOpNodeType::MULTIPLY);
+    ASSERT_EQ(multiplyPtr->getLeft()->getType(), EnumNodeType::LITTERAL);
+    ASSERT_EQ(multiplyPtr->getRight()->getType(), EnumNodeType::CAST);
+    ASSERT_EQ(static_cast<CastNode*>(multiplyPtr->getRight())->getExpression()->getType(), EnumNodeType::VARIABLE);
+}
+
+TEST(ParserTest, ParseBinOpCastBindsTighterThanDivide)
+{
+    const std::string input = "a / (int) 2 - 3;";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+    auto* root = getFirstBinOpExpression(compUnitPtr.get());
+
+    ASSERT_TRUE(errorMessage.empty());
+
+    // (a / ((int) 2)) - 3
+    ASSERT_NE(root, nullptr);
+    ASSERT_EQ(root->getTypeof(), EnumBinOpNodeType::SUBTRACT);
+    ASSERT_EQ(root->getRight()->getType(), EnumNodeType::LITTERAL);
+    ASSERT_EQ(root->getLeft()->getType(), EnumNodeType::BIN_OP);
+
+    auto* dividePtr = static_cast<BinOpNode*>(root->getLeft());
+    ASSERT_EQ(dividePtr->getTypeof(), EnumBinOpNodeType::DIVIDE);
+    ASSERT_EQ(dividePtr->getLeft()->getType(), EnumNodeType::VARIABLE);
+    ASSERT_EQ(dividePtr->getRight()->getType(), EnumNodeType::CAST);
+    ASSERT_EQ(static_cast<CastNode*>(dividePtr->getRight())->getExpression()->getType(), EnumNodeType::LITTERAL);
+}
+
+TEST(ParserTest, ParseBinOpCastOfParenExpression)
+{
+    const std::string input = "(int) (a + b) * 2;";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+    auto* root = getFirstBinOpExpression(compUnitPtr.get());
+
+    ASSERT_TRUE(errorMessage.empty());
+
+    // ((int) (a + b)) * 2
+    ASSERT_NE(root, nullptr);
+    ASSERT_EQ(root->getTypeof(), EnumBinOpNodeType::MULTIPLY);
+    ASSERT_EQ(root->getLeft()->getType(), EnumNodeType::CAST);
+    ASSERT_EQ(static_cast<CastNode*>(root->getLeft())->getExpression()->getType(), EnumNodeType::PAREN_EXPRESSION);
+    ASSERT_EQ(root->getRight()->getType(), EnumNodeType::LITTERAL);
+}
+
+TEST(ParserTest, ParseBinOpLogicalAndComparisons)
+{
+    const std::string input = "a < b && c == d || e >= f;";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+    auto* root = getFirstBinOpExpression(compUnitPtr.get());
+
+    ASSERT_TRUE(errorMessage.empty());
+
+    // ((a < b) && (c == d)) || (e >= f)
+    ASSERT_NE(root, nullptr);
+    ASSERT_EQ(root->getTypeof(), EnumBinOpNodeType::LOGICAL_OR);
+    ASSERT_EQ(root->getRight()->getType(), EnumNodeType::BIN_OP);
+    ASSERT_EQ(static_cast<BinOpNode*>(root->getRight())->getTypeof(), EnumBinOpNodeType::CMP_GE);
+    ASSERT_EQ(root->getLeft()->getType(), EnumNodeType::BIN_OP);
+
+    auto* andPtr = static_cast<BinOpNode*>(root->getLeft());
+    ASSERT_EQ(andPtr->getTypeof(), EnumBinOpNodeType::LOGICAL_AND);
+    ASSERT_EQ(andPtr->getLeft()->getType(), EnumNodeType::BIN_OP);
+    ASSERT_EQ(static_cast<BinOpNode*>(andPtr->getLeft())->getTypeof(), EnumBinOpNodeType::CMP_LT);
+    ASSERT_EQ(andPtr->getRight()->getType(), EnumNodeType::BIN_OP);
+    ASSERT_EQ(static_cast<BinOpNode*>(andPtr->getRight())->getTypeof(), EnumBinOpNodeType::CMP_EQ);
+}
+
+TEST(ParserTest, ParseBinOpBitwisePrecedence)
+{
+    const std::string input = "a | b ^ c & d << 2;";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+    auto* root = getFirstBinOpExpression(compUnitPtr.get());
+
+    ASSERT_TRUE(errorMessage.empty());
+
+    // a | (b ^ (c & (d << 2)))
+    ASSERT_NE(root, nullptr);
+    ASSERT_EQ(root->getTypeof(), EnumBinOpNodeType::BITWISE_OR);
+    ASSERT_EQ(root->getRight()->getType(), EnumNodeType::BIN_OP);
+
+    auto* xorPtr = static_cast<BinOpNode*>(root->getRight());
+    ASSERT_EQ(xorPtr->getTypeof(), EnumBinOpNodeType::BITWISE_XOR);
+    ASSERT_EQ(xorPtr->getRight()->getType(), EnumNodeType::BIN_OP);
+
+    auto* andPtr = static_cast<BinOpNode*>(xorPtr->getRight());
+    ASSERT_EQ(andPtr->getTypeof(), EnumBinOpNodeType::BITWISE_AND);
+    ASSERT_EQ(andPtr->getRight()->getType(), EnumNodeType::BIN_OP);
+    ASSERT_EQ(static_cast<BinOpNode*>(andPtr->getRight())->getTypeof(), EnumBinOpNodeType::SHIFT_LEFT);
+}
+
+TEST(ParserTest, ParseBinOpAssignmentIsRightAssociative)
+{
+    const std::string input = "a = b = c % 2;";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+    auto* root = getFirstBinOpExpression(compUnitPtr.get());
+
+    ASSERT_TRUE(errorMessage.empty());
+
+    // a = (b = (c % 2))
+    ASSERT_NE(root, nullptr);
+    ASSERT_EQ(root->getTypeof(), EnumBinOpNodeType::ASSIGNMENT);
+    ASSERT_EQ(root->getLeft()->getType(), EnumNodeType::VARIABLE);
+    ASSERT_EQ(root->getRight()->getType(), EnumNodeType::BIN_OP);
+
+    auto* innerPtr = static_cast<BinOpNode*>(root->getRight());
+    ASSERT_EQ(innerPtr->getTypeof(), EnumBinOpNodeType::ASSIGNMENT);
+    ASSERT_EQ(innerPtr->getRight()->getType(), EnumNodeType::BIN_OP);
+    ASSERT_EQ(static_cast<BinOpNode*>(innerPtr->getRight())->getTypeof(), EnumBinOpNodeType::MODULUS);
+}
+
+TEST(ParserTest, ParseBinOpDanglingOperatorError)
+{
+    const std::string input = "a + ;";
+    Parser parser(input);
+    std::string errorMessage;
+    auto compUnitPtr = parser.parseCompilationUnit(&errorMessage);
+
+    ASSERT_FALSE(errorMessage.empty());
+}
+
 s32 main(s32 argc, char* argv[])
 {
     reporter.setEnablePrint(false);